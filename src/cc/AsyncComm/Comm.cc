@@ -256,6 +256,8 @@ int Comm::send_request(IOHandlerDataPtr &data_handler, uint32_t timeout_ms,
   }
 
   cbuf->header.timeout_ms = timeout_ms;
+  if (ReactorFactory::payload_checksum)
+    cbuf->header.flags |= CommHeader::FLAGS_BIT_PAYLOAD_CHECKSUM;
   cbuf->write_header_and_reset();
 
   if ((error = data_handler->send_message(cbuf, timeout_ms, resp_handler))
@@ -278,6 +280,10 @@ int Comm::send_response(const CommAddress &addr, CommBufPtr &cbuf) {
   }
 
   cbuf->header.flags &= CommHeader::FLAGS_MASK_REQUEST;
+  if (ReactorFactory::payload_checksum)
+    cbuf->header.flags |= CommHeader::FLAGS_BIT_PAYLOAD_CHECKSUM;
+  else
+    cbuf->header.flags &= CommHeader::FLAGS_MASK_PAYLOAD_CHECKSUM;
 
   cbuf->write_header_and_reset();
 
@@ -27,6 +27,7 @@
 #include <boost/shared_array.hpp>
 
 #include "Common/ByteString.h"
+#include "Common/Checksum.h"
 #include "Common/InetAddr.h"
 #include "Common/Logger.h"
 #include "Common/ReferenceCount.h"
@@ -140,11 +141,22 @@ namespace Hypertable {
      * resets the primary and extended data pointers to point to the
      * beginning of their respective buffers.  The AsyncComm layer
      * uses these pointers to track how much data has been sent and
-     * what is remaining to be sent.
+     * what is remaining to be sent.  If the header has
+     * FLAGS_BIT_PAYLOAD_CHECKSUM set, the crc32c checksum of the
+     * payload (primary buffer after the header, followed by the
+     * extended buffer) is stored in the header as well.
      */
     void write_header_and_reset() {
       uint8_t *buf = data.base;
       HT_ASSERT((data_ptr - data.base) == (int)data.size);
+      if (header.flags & CommHeader::FLAGS_BIT_PAYLOAD_CHECKSUM) {
+        size_t header_len = header.encoded_length();
+        header.payload_checksum = crc32c(data.base + header_len,
+                                         data.size - header_len);
+        if (ext.base)
+          header.payload_checksum = crc32c_update(header.payload_checksum,
+                                                  ext.base, ext.size);
+      }
       header.encode(&buf);
       data_ptr = data.base;
       ext_ptr = ext.base;
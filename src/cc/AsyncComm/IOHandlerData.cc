@@ -36,6 +36,7 @@ extern "C" {
 #include <sys/uio.h>
 }
 
+#include "Common/Checksum.h"
 #include "Common/Error.h"
 #include "Common/FileUtils.h"
 #include "Common/InetAddr.h"
@@ -597,6 +598,16 @@ void IOHandlerData::handle_message_body() {
     m_event->payload = m_message;
     m_event->payload_len = m_event->header.total_len
                            - m_event->header.header_len;
+    if ((m_event->header.flags & CommHeader::FLAGS_BIT_PAYLOAD_CHECKSUM) &&
+        crc32c(m_event->payload, m_event->payload_len)
+        != m_event->header.payload_checksum) {
+      HT_ERRORF("Payload checksum mismatch in message from %s (id=%d, "
+                "command=%llu, len=%d)", InetAddr::format(m_addr).c_str(),
+                (int)m_event->header.id, (Llu)m_event->header.command,
+                (int)m_event->payload_len);
+      m_event->type = Event::ERROR;
+      m_event->error = Error::COMM_PAYLOAD_CHECKSUM_MISMATCH;
+    }
     m_event->set_proxy(m_proxy);
     //HT_INFOF("Just received messaage of size %d", m_event->header.total_len);
     deliver_event( m_event, dh );
@@ -43,6 +43,7 @@ atomic_t     ReactorFactory::ms_next_reactor = ATOMIC_INIT(0);
 bool         ReactorFactory::ms_epollet = true;
 bool         ReactorFactory::use_poll = false;
 bool         ReactorFactory::proxy_master = false;
+bool         ReactorFactory::payload_checksum = false;
 
 /**
  */
@@ -71,6 +72,8 @@ void ReactorFactory::initialize(uint16_t reactor_count) {
   if (Config::properties->get_bool("Comm.UsePoll") == true)
     use_poll = true;
 
+  payload_checksum = Config::properties->get_bool("Comm.PayloadChecksum");
+
   for (uint16_t i=0; i<reactor_count; i++) {
     reactor_ptr = new Reactor();
     ms_reactors.push_back(reactor_ptr);
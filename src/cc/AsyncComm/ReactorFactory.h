@@ -73,6 +73,7 @@ namespace Hypertable {
     static bool ms_epollet;
     static bool use_poll;
     static bool proxy_master;
+    static bool payload_checksum;
 
   private:
     static Mutex        ms_mutex;
@@ -19,9 +19,17 @@
 
 #include "Compat.h"
 #include <arpa/inet.h>
+#include <string.h>
 #include <zlib.h>
 #include "Checksum.h"
 
+#if defined(__x86_64__) && (defined(__clang__) || __GNUC__ > 4 || \
+    (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define HT_CRC32C_HW 1
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 namespace Hypertable {
 
 #define HT_F32_DO1(buf,i) \
@@ -207,6 +215,210 @@ crc32_update(uint32_t crc, const void *data, size_t len) {
   return ::crc32(crc, (Bytef *)data, len);
 }
 
+
+/* CRC-32C (Castagnoli), reflected polynomial 0x82f63b78.
+ *
+ * The functions below work on the raw (non-inverted) CRC register.  The
+ * hardware version runs three independent crc32 instruction streams over
+ * adjacent chunks to hide the instruction latency and then folds the
+ * partial CRCs together with a carry-less multiply by x^(8*chunk) mod P.
+ * The portable version is table driven (slicing-by-8).
+ */
+namespace {
+
+  const uint32_t CRC32C_POLY = 0x82f63b78;
+  const size_t CRC32C_LONG = 8192;
+  const size_t CRC32C_SHORT = 256;
+
+  uint32_t crc32c_table[8][256];
+
+  // x^(8*n) mod P for the hardware chunk sizes, see crc32c_init()
+  uint32_t crc32c_long_shift1, crc32c_long_shift2;
+  uint32_t crc32c_short_shift1, crc32c_short_shift2;
+
+  inline uint32_t load_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+      ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+  }
+
+  uint32_t
+  crc32c_update_sw(uint32_t crc, const uint8_t *data, size_t len) {
+    while (len && ((uintptr_t)data & 7)) {
+      crc = crc32c_table[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+      len--;
+    }
+    while (len >= 8) {
+      uint32_t lo = crc ^ load_le32(data);
+      uint32_t hi = load_le32(data + 4);
+      crc = crc32c_table[7][lo & 0xff] ^ crc32c_table[6][(lo >> 8) & 0xff] ^
+        crc32c_table[5][(lo >> 16) & 0xff] ^ crc32c_table[4][lo >> 24] ^
+        crc32c_table[3][hi & 0xff] ^ crc32c_table[2][(hi >> 8) & 0xff] ^
+        crc32c_table[1][(hi >> 16) & 0xff] ^ crc32c_table[0][hi >> 24];
+      data += 8;
+      len -= 8;
+    }
+    while (len) {
+      crc = crc32c_table[0][(crc ^ *data++) & 0xff] ^ (crc >> 8);
+      len--;
+    }
+    return crc;
+  }
+
+  /** Returns x^(8*n) mod P, i.e. the CRC register of the polynomial 1
+   * after n zero bytes have been fed through it */
+  uint32_t crc32c_zeros_sw(size_t n) {
+    uint32_t crc = 0x80000000;
+    while (n--)
+      crc = crc32c_table[0][crc & 0xff] ^ (crc >> 8);
+    return crc;
+  }
+
+#if defined(HT_CRC32C_HW)
+
+  /** Multiplies two reflected polynomials modulo P.  The carry-less
+   * product is one bit short of the 64-bit reflected representation; the
+   * low half is then reduced with a crc32 instruction.
+   */
+  __attribute__((target("sse4.2,pclmul")))
+  inline uint32_t crc32c_multiply_hw(uint32_t a, uint32_t b) {
+    __m128i product = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int)a),
+                                           _mm_cvtsi32_si128((int)b), 0);
+    uint64_t p = (uint64_t)_mm_cvtsi128_si64(product) << 1;
+    return _mm_crc32_u32(0, (uint32_t)p) ^ (uint32_t)(p >> 32);
+  }
+
+  __attribute__((target("sse4.2,pclmul")))
+  inline uint64_t
+  crc32c_streams_hw(uint64_t crc0, const uint8_t *&data, size_t chunk,
+                    uint32_t shift1, uint32_t shift2) {
+    uint64_t crc1 = 0, crc2 = 0, word0, word1, word2;
+    const uint8_t *end = data + chunk;
+    do {
+      memcpy(&word0, data, 8);
+      memcpy(&word1, data + chunk, 8);
+      memcpy(&word2, data + 2*chunk, 8);
+      crc0 = _mm_crc32_u64(crc0, word0);
+      crc1 = _mm_crc32_u64(crc1, word1);
+      crc2 = _mm_crc32_u64(crc2, word2);
+      data += 8;
+    } while (data < end);
+    data += 2*chunk;
+    return crc32c_multiply_hw((uint32_t)crc0, shift2) ^
+      crc32c_multiply_hw((uint32_t)crc1, shift1) ^ (uint32_t)crc2;
+  }
+
+  __attribute__((target("sse4.2,pclmul")))
+  uint32_t
+  crc32c_update_hw(uint32_t crc, const uint8_t *data, size_t len) {
+    uint64_t crc0 = crc, word;
+
+    while (len && ((uintptr_t)data & 7)) {
+      crc0 = _mm_crc32_u8((uint32_t)crc0, *data++);
+      len--;
+    }
+    while (len >= 3*CRC32C_LONG) {
+      crc0 = crc32c_streams_hw(crc0, data, CRC32C_LONG, crc32c_long_shift1,
+                               crc32c_long_shift2);
+      len -= 3*CRC32C_LONG;
+    }
+    while (len >= 3*CRC32C_SHORT) {
+      crc0 = crc32c_streams_hw(crc0, data, CRC32C_SHORT, crc32c_short_shift1,
+                               crc32c_short_shift2);
+      len -= 3*CRC32C_SHORT;
+    }
+    while (len >= 8) {
+      memcpy(&word, data, 8);
+      crc0 = _mm_crc32_u64(crc0, word);
+      data += 8;
+      len -= 8;
+    }
+    while (len) {
+      crc0 = _mm_crc32_u8((uint32_t)crc0, *data++);
+      len--;
+    }
+    return (uint32_t)crc0;
+  }
+
+#endif
+
+  typedef uint32_t (*Crc32cUpdateFunc)(uint32_t, const uint8_t *, size_t);
+
+  uint32_t crc32c_update_dispatch(uint32_t crc, const uint8_t *data,
+                                  size_t len);
+
+  Crc32cUpdateFunc crc32c_update_impl = crc32c_update_dispatch;
+  bool crc32c_hw_selected = false;
+
+  void crc32c_init() {
+    for (uint32_t n=0; n<256; n++) {
+      uint32_t crc = n;
+      for (int k=0; k<8; k++)
+        crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+      crc32c_table[0][n] = crc;
+    }
+    for (uint32_t n=0; n<256; n++) {
+      uint32_t crc = crc32c_table[0][n];
+      for (int k=1; k<8; k++) {
+        crc = crc32c_table[0][crc & 0xff] ^ (crc >> 8);
+        crc32c_table[k][n] = crc;
+      }
+    }
+    crc32c_long_shift1 = crc32c_zeros_sw(CRC32C_LONG);
+    crc32c_long_shift2 = crc32c_zeros_sw(2*CRC32C_LONG);
+    crc32c_short_shift1 = crc32c_zeros_sw(CRC32C_SHORT);
+    crc32c_short_shift2 = crc32c_zeros_sw(2*CRC32C_SHORT);
+
+    Crc32cUpdateFunc impl = crc32c_update_sw;
+#if defined(HT_CRC32C_HW)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("pclmul")) {
+      impl = crc32c_update_hw;
+      crc32c_hw_selected = true;
+    }
+#endif
+    crc32c_update_impl = impl;
+  }
+
+  /* Only reached if crc32c is called from another static initializer
+   * before the one below has run */
+  uint32_t crc32c_update_dispatch(uint32_t crc, const uint8_t *data,
+                                  size_t len) {
+    crc32c_init();
+    return crc32c_update_impl(crc, data, len);
+  }
+
+  struct Crc32cInitializer {
+    Crc32cInitializer() {
+      if (crc32c_update_impl == crc32c_update_dispatch)
+        crc32c_init();
+    }
+  } crc32c_initializer;
+
+} // local namespace
+
+uint32_t
+crc32c(const void *data, size_t len) {
+  return ~crc32c_update_impl(0xffffffff, (const uint8_t *)data, len);
+}
+
+uint32_t
+crc32c_update(uint32_t crc, const void *data, size_t len) {
+  return ~crc32c_update_impl(~crc, (const uint8_t *)data, len);
+}
+
+uint32_t
+crc32c_portable(const void *data, size_t len) {
+  if (crc32c_update_impl == crc32c_update_dispatch)
+    crc32c_init();
+  return ~crc32c_update_sw(0xffffffff, (const uint8_t *)data, len);
+}
+
+bool crc32c_hardware() {
+  if (crc32c_update_impl == crc32c_update_dispatch)
+    crc32c_init();
+  return crc32c_hw_selected;
+}
+
 } // namespace Hypertable
 
 /* vim: et sw=2
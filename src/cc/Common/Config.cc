@@ -160,6 +160,8 @@ void DefaultPolicy::init_options() {
     ("Comm.DispatchDelay", i32()->default_value(0), "[TESTING ONLY] "
         "Delay dispatching of read requests by this number of milliseconds")
     ("Comm.UsePoll", boo()->default_value(false), "Use poll() interface")
+    ("Comm.PayloadChecksum", boo()->default_value(false),
+        "Attach a crc32c checksum of the payload to every outgoing message")
     ("Hypertable.Verbose", boo()->default_value(false),
         "Enable verbose output (system wide)")
     ("Hypertable.Silent", boo()->default_value(false),
@@ -224,6 +226,9 @@ void DefaultPolicy::init_options() {
         " maintenance interval (checkpoint BerkeleyDB, log cleanup etc)")
     ("Hyperspace.Checkpoint.Size", i32()->default_value(1*M), "Run BerkeleyDB checkpoint"
         " when logs exceed this size limit")
+    ("Hyperspace.NodeCache.MaxEntries", i32()->default_value(100000),
+        "Maximum number of nodes for which the Hyperspace master caches "
+        "existence, attributes and directory listings (0 disables)")
     ("Hyperspace.Client.Datagram.SendPort", i16()->default_value(0),
         "Client UDP send port for keepalive packets")
     ("Hyperspace.LogGc.Interval", i32()->default_value(60000), "Check for unused BerkeleyDB "
@@ -270,6 +275,23 @@ void DefaultPolicy::init_options() {
     ("Hypertable.LoadBalancer.LoadavgThreshold", f64()->default_value(0.25),
         "Servers with loadavg above this much above the mean will be considered by the "
         "load balancer to be overloaded")
+    ("Hypertable.LoadBalancer.CostAware.Enable", boo()->default_value(false),
+        "Use the multi-resource, cost-aware planner when balancing load")
+    ("Hypertable.LoadBalancer.CostAware.Weight.Loadavg", f64()->default_value(1.0),
+        "Weight of loadavg in the cost-aware load balancer server score")
+    ("Hypertable.LoadBalancer.CostAware.Weight.Memory", f64()->default_value(1.0),
+        "Weight of range memory usage in the cost-aware load balancer server score")
+    ("Hypertable.LoadBalancer.CostAware.Weight.Disk", f64()->default_value(0.5),
+        "Weight of range disk usage in the cost-aware load balancer server score")
+    ("Hypertable.LoadBalancer.CostAware.Weight.WriteRate", f64()->default_value(1.0),
+        "Weight of write rate in the cost-aware load balancer server score")
+    ("Hypertable.LoadBalancer.CostAware.ScoreThreshold", f64()->default_value(0.25),
+        "Servers whose score is this much above the mean score (1.0) will be "
+        "considered overloaded by the cost-aware load balancer")
+    ("Hypertable.LoadBalancer.CostAware.MaxMoveCost", i64()->default_value(2*G),
+        "Maximum total cost (CellCache bytes plus estimated stalled writes) of "
+        "the range moves in flight, including those of earlier cost-aware "
+        "balance plans that have not completed")
     ("Hypertable.HqlInterpreter.Mutator.NoLogSync", boo()->default_value(false),
         "Suspends CommitLog sync operation on updates until command completion")
     ("Hypertable.Mutator.FlushDelay", i32()->default_value(0), "Number of "
@@ -294,6 +316,12 @@ void DefaultPolicy::init_options() {
         "Number of Hypertable Master communication reactor threads created")
     ("Hypertable.Master.Gc.Interval", i32()->default_value(300000),
         "Garbage collection interval in milliseconds by Master")
+    ("Hypertable.Master.Gc.Concurrency", i32()->default_value(8),
+        "Number of concurrent METADATA scanners, directory listings and "
+        "file removals used by Master garbage collection")
+    ("Hypertable.Master.Gc.ScanDirectories", boo()->default_value(false),
+        "Also list range directories during garbage collection and remove "
+        "CellStores that are not referenced from METADATA")
     ("Hypertable.Master.Locations.IncludeMasterHash", boo()->default_value(false),
         "Includes master hash (host:port) in RangeServer location id")
     ("Hypertable.Master.Split.SoftLimitEnabled", boo()->default_value(true),
@@ -311,6 +339,19 @@ void DefaultPolicy::init_options() {
      "RangeServer memory limit specified as percentage of physical RAM")
     ("Hypertable.RangeServer.LowMemoryLimit.Percentage", i32()->default_value(10),
      "Amount of memory to free in low memory condition as percentage of RangeServer memory limit")
+    ("Hypertable.RangeServer.UpdateThrottle.LowWatermark", i32()->default_value(80),
+     "Percentage of the RangeServer memory limit at which updates start to "
+     "be throttled")
+    ("Hypertable.RangeServer.UpdateThrottle.MaxDelay", i32()->default_value(500),
+     "Maximum number of milliseconds an update is delayed by the update "
+     "throttle before memory reaches the limit")
+    ("Hypertable.RangeServer.UpdateThrottle.Horizon", i32()->default_value(5000),
+     "Number of milliseconds over which the growth rate of memory use is "
+     "projected when computing the update throttle level")
+    ("Hypertable.RangeServer.UpdateThrottle.MaxQueuedUpdates", i32()->default_value(1000),
+     "Maximum number of update batches waiting to be qualified; further "
+     "user table updates are rejected with RANGESERVER_UPDATES_THROTTLED "
+     "and retried by the client")
     ("Hypertable.RangeServer.MemoryLimit.EnsureUnused", i64(), "Amount of unused physical memory")
     ("Hypertable.RangeServer.MemoryLimit.EnsureUnused.Percentage", i32(),
      "Amount of unused physical memory specified as percentage of physical RAM")
@@ -324,6 +365,10 @@ void DefaultPolicy::init_options() {
      boo()->default_value(false), "Enable CellStore shadow caching")
     ("Hypertable.RangeServer.AccessGroup.MaxMemory", i64()->default_value(1*G),
         "Maximum bytes consumed by an Access Group")
+    ("Hypertable.RangeServer.AccessGroup.DefaultCompactionPolicy",
+        str()->default_value("merge-run"), "Default merging compaction policy "
+        "for access groups that do not specify one (merge-run, size-tiered or "
+        "time-window)")
     ("Hypertable.RangeServer.CellStore.TargetSize.Minimum",
         i64()->default_value(10*MiB), "Target minimum size for CellStores")
     ("Hypertable.RangeServer.CellStore.TargetSize.Window",
@@ -333,14 +378,35 @@ void DefaultPolicy::init_options() {
         "Trigger a merge if an adjacent run of merge candidate CellStores exceeds this length")
     ("Hypertable.RangeServer.CellStore.DefaultBlockSize",
         i32()->default_value(64*KiB), "Default block size for cell stores")
+    ("Hypertable.RangeServer.CellStore.RestartInterval",
+        i32()->default_value(16), "Number of keys between restart points "
+        "(keys stored without prefix compression) in cell store data blocks; "
+        "0 disables restart points")
     ("Hypertable.RangeServer.Data.DefaultReplication",
         i32()->default_value(-1), "Default replication for data")
     ("Hypertable.RangeServer.CellStore.DefaultCompressor",
         str()->default_value("snappy"), "Default compressor for cell stores")
+    ("Hypertable.RangeServer.CellStore.AutoCompressor.Objective",
+        str()->default_value("balanced"), "Objective used by the \"auto\" "
+        "cell store compressor when picking a codec for a block "
+        "(speed, balanced or space)")
+    ("Hypertable.RangeServer.CellStore.AutoCompressor.SampleInterval",
+        i32()->default_value(16), "Number of blocks the \"auto\" cell store "
+        "compressor writes with its current codec before sampling again")
     ("Hypertable.RangeServer.CellStore.DefaultBloomFilter",
         str()->default_value("rows"), "Default bloom filter for cell stores")
     ("Hypertable.RangeServer.CellStore.SkipNotFound",
         boo()->default_value(false), "Skip over cell stores that are non-existent")
+    ("Hypertable.RangeServer.CellStore.OpenConcurrency",
+        i32()->default_value(8), "Number of cell stores of a range that are "
+        "opened concurrently when the range is loaded")
+    ("Hypertable.RangeServer.Recovery.LoadConcurrency",
+        i32()->default_value(8), "Number of ranges loaded concurrently while "
+        "recovering ranges from the RSML at startup")
+    ("Hypertable.RangeServer.BlockChecksum", str()->default_value("fletcher32"),
+        "Checksum for CellStore and commit log blocks written by this server "
+        "(fletcher32 or crc32c).  Only switch to crc32c once every server "
+        "can read it")
     ("Hypertable.RangeServer.IgnoreClockSkewErrors",
         boo()->default_value(false), "Ignore clock skew errors")
     ("Hypertable.RangeServer.CommitInterval", i32()->default_value(50),
@@ -349,6 +415,17 @@ void DefaultPolicy::init_options() {
         "Minimum size of block cache")
     ("Hypertable.RangeServer.BlockCache.MaxMemory", i64(),
         "Maximum (target) size of block cache")
+    ("Hypertable.RangeServer.BlockCache.Local.Directory", str()->default_value(""),
+        "Directory on local disk (e.g. SSD) holding the second-tier block "
+        "cache; empty disables it")
+    ("Hypertable.RangeServer.BlockCache.Local.Capacity", i64()->default_value(10*G),
+        "Size of the local-disk block cache file")
+    ("Hypertable.RangeServer.BlockCache.Local.AdmitOnFirstMiss",
+        boo()->default_value(false), "Admit blocks into the local-disk block "
+        "cache on their first miss instead of their second")
+    ("Hypertable.RangeServer.BlockCache.WarmOnMove", boo()->default_value(false),
+        "Record the cached blocks of a range when it is relinquished and "
+        "prefetch them into the block cache of the server that loads it")
     ("Hypertable.RangeServer.QueryCache.MaxMemory", i64()->default_value(50*M),
         "Maximum size of query cache")
     ("Hypertable.RangeServer.Range.SplitSize", i64()->default_value(256*MiB),
@@ -359,6 +436,17 @@ void DefaultPolicy::init_options() {
         "range in bytes before splitting (for testing)")
     ("Hypertable.RangeServer.Range.SplitOff", str()->default_value("high"),
         "Portion of range to split off (high or low)")
+    ("Hypertable.RangeServer.Range.LoadSplit.Threshold",
+        i32()->default_value(0), "Split ranges, whatever their size, "
+        "that see more than this many accesses (cells written plus scans) "
+        "per second, at the row that divides the load in half (0, the "
+        "default, disables)")
+    ("Hypertable.RangeServer.Range.LoadSplit.SampleInterval",
+        i32()->default_value(64), "Sample one in this many range accesses "
+        "when estimating the load split row")
+    ("Hypertable.RangeServer.Range.LoadSplit.SampleRows",
+        i32()->default_value(1000), "Maximum number of sampled rows tracked "
+        "per range for load splitting")
     ("Hypertable.RangeServer.ClockSkew.Max", i32()->default_value(3*M),
         "Maximum amount of clock skew (microseconds) the system will tolerate")
     ("Hypertable.RangeServer.CommitLog.DfsBroker.Host", str(),
@@ -385,6 +473,9 @@ void DefaultPolicy::init_options() {
     ("Hypertable.RangeServer.Failover.FlushLimit.Aggregate",
      i64()->default_value(100*M), "Amount of updates (bytes) accumulated for "
         "all range to trigger a replay buffer flush")
+    ("Hypertable.MetaLog.MaxFileSize", i64()->default_value(100*M),
+        "Compact a MetaLog into a new file containing only live entity "
+        "records once it grows beyond this many bytes (0 disables)")
     ("Hypertable.Metadata.Replication", i32()->default_value(-1),
         "Replication factor for commit log files")
     ("Hypertable.CommitLog.RollLimit", i64()->default_value(100*M),
@@ -252,6 +252,8 @@ namespace {
         "RANGE SERVER fragment completely received"},
     { Error::RANGESERVER_INVALID_RECOVERY,
         "RANGE SERVER invalid recovery"},
+    { Error::RANGESERVER_UPDATES_THROTTLED,
+        "RANGE SERVER update queue full, retry later"},
     { Error::HQL_BAD_LOAD_FILE_FORMAT,         "HQL bad load file format" },
     { Error::METALOG_BAD_RS_HEADER, "METALOG bad range server metalog header" },
     { Error::METALOG_BAD_HEADER,  "METALOG bad metalog header" },
@@ -200,6 +200,7 @@ namespace Hypertable {
       RANGESERVER_RANGE_NOT_ACTIVE             = 0x0005001C,
       RANGESERVER_FRAGMENT_COMPLETELY_RECEIVED = 0x0005001D,
       RANGESERVER_INVALID_RECOVERY             = 0x0005001E,
+      RANGESERVER_UPDATES_THROTTLED            = 0x0005001F,
 
       HQL_BAD_LOAD_FILE_FORMAT  = 0x00060001,
 
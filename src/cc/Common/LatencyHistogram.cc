@@ -0,0 +1,126 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Compat.h"
+#include "Logger.h"
+#include "Serialization.h"
+#include "LatencyHistogram.h"
+
+using namespace Hypertable;
+
+void LatencyHistogram::clear() {
+  count = total = 0;
+  memset(buckets, 0, sizeof(buckets));
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other) {
+  count += other.count;
+  total += other.total;
+  for (int i=0; i<BUCKET_COUNT; i++)
+    buckets[i] += other.buckets[i];
+}
+
+void LatencyHistogram::subtract(const LatencyHistogram &other) {
+  count = (count > other.count) ? count - other.count : 0;
+  total = (total > other.total) ? total - other.total : 0;
+  for (int i=0; i<BUCKET_COUNT; i++)
+    buckets[i] = (buckets[i] > other.buckets[i]) ? buckets[i] - other.buckets[i] : 0;
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const {
+  uint64_t target, accum = 0;
+
+  if (count == 0)
+    return 0;
+
+  target = (uint64_t)(fraction * (double)count);
+  if (target == 0)
+    target = 1;
+
+  for (int i=0; i<BUCKET_COUNT; i++) {
+    accum += buckets[i];
+    if (accum >= target)
+      return bucket_limit(i);
+  }
+  return bucket_limit(BUCKET_COUNT-1);
+}
+
+uint64_t LatencyHistogram::max() const {
+  for (int i=BUCKET_COUNT-1; i>=0; i--) {
+    if (buckets[i])
+      return bucket_limit(i);
+  }
+  return 0;
+}
+
+namespace {
+  int used_buckets(const uint64_t *buckets) {
+    int n = LatencyHistogram::BUCKET_COUNT;
+    while (n > 0 && buckets[n-1] == 0)
+      n--;
+    return n;
+  }
+}
+
+size_t LatencyHistogram::encoded_length() const {
+  int n = used_buckets(buckets);
+  size_t len = Serialization::encoded_length_vi64(count) +
+    Serialization::encoded_length_vi64(total) +
+    Serialization::encoded_length_vi32(n);
+  for (int i=0; i<n; i++)
+    len += Serialization::encoded_length_vi64(buckets[i]);
+  return len;
+}
+
+void LatencyHistogram::encode(uint8_t **bufp) const {
+  int n = used_buckets(buckets);
+  Serialization::encode_vi64(bufp, count);
+  Serialization::encode_vi64(bufp, total);
+  Serialization::encode_vi32(bufp, n);
+  for (int i=0; i<n; i++)
+    Serialization::encode_vi64(bufp, buckets[i]);
+}
+
+void LatencyHistogram::decode(const uint8_t **bufp, size_t *remainp) {
+  clear();
+  count = Serialization::decode_vi64(bufp, remainp);
+  total = Serialization::decode_vi64(bufp, remainp);
+  int n = (int)Serialization::decode_vi32(bufp, remainp);
+  for (int i=0; i<n; i++) {
+    uint64_t value = Serialization::decode_vi64(bufp, remainp);
+    // fold buckets from a wider encoder into the overflow bucket
+    if (i < BUCKET_COUNT)
+      buckets[i] = value;
+    else
+      buckets[BUCKET_COUNT-1] += value;
+  }
+}
+
+bool LatencyHistogram::operator==(const LatencyHistogram &other) const {
+  return count == other.count && total == other.total &&
+    !memcmp(buckets, other.buckets, sizeof(buckets));
+}
+
+String LatencyHistogram::summary() const {
+  return format("count=%llu mean=%.1fus p50=%lluus p90=%lluus p99=%lluus "
+                "max=%lluus", (Llu)count, mean(), (Llu)percentile(0.5),
+                (Llu)percentile(0.9), (Llu)percentile(0.99), (Llu)max());
+}
@@ -0,0 +1,113 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_LATENCYHISTOGRAM_H
+#define HYPERTABLE_LATENCYHISTOGRAM_H
+
+extern "C" {
+#include <stddef.h>
+#include <stdint.h>
+}
+
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /**
+   * Fixed-size latency histogram with power-of-two microsecond buckets.
+   * Bucket 0 holds samples below 1us, bucket i (i > 0) holds samples in
+   * the range [2^(i-1), 2^i) microseconds and the last bucket holds
+   * everything above that.  Recording a sample is a handful of integer
+   * operations so it can be done on hot paths.
+   */
+  class LatencyHistogram {
+  public:
+    enum { BUCKET_COUNT = 28 };
+
+    LatencyHistogram() { clear(); }
+
+    void clear();
+
+    /** Records one sample.
+     *
+     * @param micros sample latency in microseconds
+     */
+    void add(uint64_t micros) {
+      buckets[bucket_index(micros)]++;
+      count++;
+      total += micros;
+    }
+
+    /** Adds all of the samples in <code>other</code> to this histogram */
+    void merge(const LatencyHistogram &other);
+
+    /** Removes the samples in <code>other</code> from this histogram.
+     * <code>other</code> must be an earlier snapshot of this histogram.
+     */
+    void subtract(const LatencyHistogram &other);
+
+    /** Returns the upper bound, in microseconds, of the bucket that
+     * contains the given fraction of samples (e.g. 0.99)
+     */
+    uint64_t percentile(double fraction) const;
+
+    /** Returns the upper bound, in microseconds, of the highest
+     * non-empty bucket
+     */
+    uint64_t max() const;
+
+    double mean() const {
+      return count ? (double)total / (double)count : 0.0;
+    }
+
+    size_t encoded_length() const;
+    void encode(uint8_t **bufp) const;
+    void decode(const uint8_t **bufp, size_t *remainp);
+
+    bool operator==(const LatencyHistogram &other) const;
+    bool operator!=(const LatencyHistogram &other) const {
+      return !(*this == other);
+    }
+
+    /** Returns a one-line summary (count, mean, p50, p90, p99, max) */
+    String summary() const;
+
+    static int bucket_index(uint64_t micros) {
+      int index = 0;
+      while (micros && index < BUCKET_COUNT-1) {
+        micros >>= 1;
+        index++;
+      }
+      return index;
+    }
+
+    static uint64_t bucket_limit(int index) {
+      return (uint64_t)1 << index;
+    }
+
+    uint64_t count;
+    uint64_t total;
+    uint64_t buckets[BUCKET_COUNT];
+  };
+
+}
+
+#endif // HYPERTABLE_LATENCYHISTOGRAM_H
@@ -0,0 +1,86 @@
+#include "Common/Compat.h"
+
+#include <cstdlib>
+#include <iostream>
+
+#include "Common/Checksum.h"
+#include "Common/Init.h"
+#include "Common/Stopwatch.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+struct MyPolicy : Config::Policy {
+  static void init_options() {
+    cmdline_desc("Usage: %s [Options]\n\nValidates crc32c and measures the "
+                 "throughput of the block checksums.\n\nOptions").add_options()
+      ("size", i32()->default_value(64*K), "size of the checksummed buffer")
+      ("total", i64()->default_value(256*M), "bytes to checksum per function")
+      ;
+  }
+};
+
+typedef Cons<MyPolicy, DefaultPolicy> AppPolicy;
+
+#define MEASURE(_label_, _func_) do { \
+  Stopwatch w; \
+  for (int64_t i = 0; i < iterations; ++i) \
+    last_checksum += _func_(buf + (i & 7), size); \
+  w.stop(); \
+  cout << _label_ << ": " << (double)(iterations * size) / w.elapsed() / M \
+       << " MB/s" << endl; \
+} while (0)
+
+} // local namespace
+
+int main(int ac, char *av[]) {
+  try {
+    init_with_policy<AppPolicy>(ac, av);
+
+    // well known check value
+    HT_ASSERT(crc32c("123456789", 9) == 0xe3069283);
+    HT_ASSERT(crc32c_portable("123456789", 9) == 0xe3069283);
+    HT_ASSERT(crc32c("", 0) == 0);
+
+    size_t size = get_i32("size");
+    size_t max_len = std::max(size, (size_t)(64*K));
+    uint8_t *buf = new uint8_t [max_len + 8];
+
+    for (size_t i = 0; i < max_len + 8; ++i)
+      buf[i] = (uint8_t)rand();
+
+    // the hardware path (3-way streams, folding, unaligned head and tail)
+    // and incremental updates must agree with the table-driven version
+    for (size_t len = 0; len <= max_len; len += 1 + len / 5) {
+      for (size_t offset = 0; offset < 8; ++offset) {
+        uint32_t expected = crc32c_portable(buf + offset, len);
+        HT_ASSERT(crc32c(buf + offset, len) == expected);
+        size_t half = len / 3;
+        HT_ASSERT(crc32c_update(crc32c(buf + offset, half), buf + offset + half,
+                                len - half) == expected);
+      }
+    }
+
+    cout << "crc32c implementation: "
+         << (crc32c_hardware() ? "sse4.2+pclmul" : "portable") << endl;
+
+    int64_t iterations = std::max(get_i64("total") / (int64_t)size, (int64_t)1);
+    uint32_t last_checksum = 0;
+
+    MEASURE("fletcher32", fletcher32);
+    MEASURE("crc32 (zlib)", crc32);
+    MEASURE("crc32c (portable)", crc32c_portable);
+    MEASURE("crc32c", crc32c);
+
+    cout << "last checksum=" << last_checksum << endl;
+    delete [] buf;
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/LatencyHistogram.h"
+#include "Common/Logger.h"
+
+using namespace Hypertable;
+
+
+int main(int argc, char *argv[]) {
+  Config::init(argc, argv);
+  LatencyHistogram hist, snapshot;
+
+  HT_ASSERT(LatencyHistogram::bucket_index(0) == 0);
+  HT_ASSERT(LatencyHistogram::bucket_index(1) == 1);
+  HT_ASSERT(LatencyHistogram::bucket_index(3) == 2);
+  HT_ASSERT(LatencyHistogram::bucket_index(1024) == 11);
+  HT_ASSERT(LatencyHistogram::bucket_index((uint64_t)-1) ==
+            LatencyHistogram::BUCKET_COUNT-1);
+
+  for (uint64_t i=0; i<90; i++)
+    hist.add(10);
+  for (uint64_t i=0; i<10; i++)
+    hist.add(5000);
+
+  HT_ASSERT(hist.count == 100);
+  HT_ASSERT(hist.total == 90*10 + 10*5000);
+  HT_ASSERT(hist.percentile(0.5) == 16);
+  HT_ASSERT(hist.percentile(0.9) == 16);
+  HT_ASSERT(hist.percentile(0.99) == 8192);
+  HT_ASSERT(hist.max() == 8192);
+
+  // delta between two snapshots
+  snapshot = hist;
+  hist.add(100);
+  hist.subtract(snapshot);
+  HT_ASSERT(hist.count == 1);
+  HT_ASSERT(hist.percentile(0.5) == 128);
+
+  hist.merge(snapshot);
+  HT_ASSERT(hist.count == 101);
+
+  // serialization round trip
+  size_t len = hist.encoded_length();
+  uint8_t *buf = new uint8_t [len];
+  uint8_t *ptr = buf;
+  hist.encode(&ptr);
+  HT_ASSERT((size_t)(ptr-buf) == len);
+
+  LatencyHistogram hist2;
+  const uint8_t *ptr2 = buf;
+  hist2.decode(&ptr2, &len);
+  HT_ASSERT(len == 0);
+  HT_ASSERT(hist == hist2);
+  delete [] buf;
+
+  return 0;
+}
@@ -75,7 +75,9 @@ BerkeleyDbFilesystem::BerkeleyDbFilesystem(PropertiesPtr &props,
                                            const std::string &basedir,
                                            const vector<Thread::id> &thread_ids,
                                            bool force_recover)
-    : m_base_dir(basedir), m_env(0) {
+    : m_base_dir(basedir), m_env(0), m_commit_count(0), m_synced_count(0),
+      m_log_flush_count(0), m_sync_in_progress(false),
+      m_node_cache(props->get_i32("Hyperspace.NodeCache.MaxEntries")) {
 
   m_checkpoint_size = props->get_i32("Hyperspace.Checkpoint.Size");
   m_log_gc_interval = props->get_i32("Hyperspace.LogGc.Interval");
@@ -514,6 +516,15 @@ BDbHandlesPtr BerkeleyDbFilesystem::get_db_handles() {
 
 void BerkeleyDbFilesystem::do_checkpoint() {
 
+  {
+    uint64_t hits, misses;
+    ScopedLock lock(m_group_commit_mutex);
+    m_node_cache.get_stats(&hits, &misses);
+    HT_INFOF("Group commit: %llu commits, %llu log flushes; node cache: "
+             "%llu hits, %llu misses", (Llu)m_commit_count,
+             (Llu)m_log_flush_count, (Llu)hits, (Llu)misses);
+  }
+
   // do checkpoint, don't bother to check if this is the master
   // since its just ignored be  slaves
   HT_DEBUG_OUT << "Do checkpoint if log > " << m_checkpoint_size/1000 << "KB" << HT_END;
@@ -584,6 +595,7 @@ void BerkeleyDbFilesystem::start_transaction(BDbTxn &txn) {
 
     // open txn
     m_env.txn_begin(NULL, &txn.m_db_txn, 0);
+    txn.m_fs = this;
   }
   catch (DbException &e) {
     HT_FATALF("Error starting Berkeley DB transaction: %s", e.what());
@@ -594,6 +606,35 @@ void BerkeleyDbFilesystem::start_transaction(BDbTxn &txn) {
 }
 
 
+void BerkeleyDbFilesystem::group_sync() {
+  ScopedLock lock(m_group_commit_mutex);
+  // our commit record is already in the log buffer, so any flush that
+  // starts after this point covers it
+  uint64_t ticket = ++m_commit_count;
+
+  while (m_synced_count < ticket) {
+    if (m_sync_in_progress) {
+      m_group_commit_cond.wait(lock);
+      continue;
+    }
+    m_sync_in_progress = true;
+    uint64_t target = m_commit_count;
+    lock.unlock();
+    try {
+      m_env.log_flush(NULL);
+    }
+    catch (DbException &e) {
+      HT_FATALF("Error flushing Berkeley DB log: %s", e.what());
+    }
+    lock.lock();
+    m_synced_count = target;
+    m_sync_in_progress = false;
+    m_log_flush_count++;
+    m_group_commit_cond.notify_all();
+  }
+}
+
+
 /**
  */
 bool
@@ -658,6 +699,7 @@ BerkeleyDbFilesystem::set_xattr_i32(BDbTxn &txn, const String &fname,
   }
 
   HT_ASSERT(ret == 0);
+  m_node_cache.invalidate(fname);
 }
 
 
@@ -725,6 +767,7 @@ BerkeleyDbFilesystem::set_xattr_i64(BDbTxn &txn, const String &fname,
   }
 
   HT_ASSERT(ret == 0);
+  m_node_cache.invalidate(fname);
 }
 
 /**
@@ -774,6 +817,7 @@ BerkeleyDbFilesystem::incr_attr(BDbTxn &txn, const String &fname, const String &
 
       if ((ret = txn.m_handle_namespace_db->put(txn.m_db_txn, &key, &data, 0)) == 0) {
         HT_DEBUG_ATTR(txn, fname, aname, key, new_value);
+        m_node_cache.invalidate(fname);
         return true;
       }
     }
@@ -816,6 +860,7 @@ BerkeleyDbFilesystem::set_xattr(BDbTxn &txn, const String &fname,
   }
 
   HT_ASSERT(ret == 0);
+  m_node_cache.invalidate(fname);
 }
 
 
@@ -900,6 +945,7 @@ BerkeleyDbFilesystem::del_xattr(BDbTxn &txn, const String &fname,
     if ((ret = txn.m_handle_namespace_db->del(txn.m_db_txn, &key, 0)) == DB_NOTFOUND)
       HT_THROW(HYPERSPACE_ATTR_NOT_FOUND, aname);
     HT_DEBUG_ATTR_(txn, fname, aname, key, "", 0);
+    m_node_cache.invalidate(fname);
   }
   catch (DbException &e) {
     if (e.get_errno() == DB_LOCK_DEADLOCK)
@@ -956,6 +1002,7 @@ void BerkeleyDbFilesystem::mkdir(BDbTxn &txn, const String &name) {
     data.clear();
 
     ret = txn.m_handle_namespace_db->put(txn.m_db_txn, &key, &data, 0);
+    m_node_cache.invalidate(name);
 
   }
   catch (DbException &e) {
@@ -1022,6 +1069,7 @@ void BerkeleyDbFilesystem::unlink(BDbTxn &txn, const String &name) {
       HT_ASSERT(txn.m_handle_namespace_db->del(txn.m_db_txn, &key, 0) != DB_NOTFOUND);
       HT_DEBUG_ATTR_(txn, name, "", key, "", 0);
     }
+    m_node_cache.invalidate(name);
   }
   catch (DbException &e) {
     HT_ERRORF("Berkeley DB error: %s", e.what());
@@ -1113,6 +1161,7 @@ BerkeleyDbFilesystem::create(BDbTxn &txn, const String &fname, bool temp) {
       key.set_size(temp_key.length()+1);
       ret = txn.m_handle_namespace_db->put(txn.m_db_txn, &key, &data, 0);
     }
+    m_node_cache.invalidate(fname);
   }
   catch (DbException &e) {
     HT_ERRORF("Berkeley DB error: %s", e.what());
@@ -2329,6 +2378,7 @@ BerkeleyDbFilesystem::delete_handle(BDbTxn &txn, uint64_t id)
     HT_ASSERT(ret==0);
     ret = cursorp->del(0);
     HT_ASSERT(ret==0);
+    m_node_cache.invalidate_handle(id);
 
   }
   catch (DbException &e) {
@@ -3994,6 +4044,12 @@ BerkeleyDbFilesystem::get_next_id_i64(BDbTxn &txn, int id_type, bool increment)
   return retval;
 }
 
+void BDbTxn::commit(int flag) {
+  m_db_txn->commit(flag | DB_TXN_NOSYNC);
+  if (m_fs && (flag & DB_TXN_NOSYNC) == 0)
+    m_fs->group_sync();
+}
+
 ostream& Hyperspace::operator<<(ostream &out, const BDbTxn &txn) {
   out << "{BDbTxn m_handle_namespace_db=" << txn.m_handle_namespace_db
       << ", m_handle_state_db=" << txn.m_handle_state_db
@@ -44,6 +44,7 @@
 
 #include "DirEntry.h"
 #include "DirEntryAttr.h"
+#include "NodeCache.h"
 #include "StateDbKeys.h"
 
 namespace Hyperspace {
@@ -120,14 +121,21 @@ namespace Hyperspace {
 
   typedef intrusive_ptr<BDbHandles> BDbHandlesPtr;
 
+  class BerkeleyDbFilesystem;
+
   class BDbTxn{
   public:
-    BDbTxn(): m_handle_namespace_db(0), m_handle_state_db(0), m_db_txn(0) {}
+    BDbTxn(): m_handle_namespace_db(0), m_handle_state_db(0), m_db_txn(0),
+              m_fs(0) {}
     ~BDbTxn() {}
 
-    void commit(int flag=0) {
-      m_db_txn->commit(flag);
-    }
+    /**
+     * Commits the transaction.  The commit record is written without
+     * syncing the log; unless <code>flag</code> contains DB_TXN_NOSYNC the
+     * call then waits for a group log flush that covers it, so concurrent
+     * committers share a single fsync.
+     */
+    void commit(int flag=0);
 
     void abort() {
       m_db_txn->abort();
@@ -136,6 +144,7 @@ namespace Hyperspace {
     Db *m_handle_namespace_db;
     Db *m_handle_state_db;
     DbTxn *m_db_txn;
+    BerkeleyDbFilesystem *m_fs;
   };
 
   ostream &operator<<(ostream &out, const BDbTxn &txn);
@@ -175,6 +184,21 @@ namespace Hyperspace {
      */
     void start_transaction(BDbTxn &txn);
 
+    /**
+     * Blocks until every transaction committed before this call is
+     * durable.  The first caller to arrive issues a log flush on behalf of
+     * all transactions committed up to that point; callers arriving while
+     * a flush is in progress wait for it and, if not covered by it, for the
+     * next one.
+     */
+    void group_sync();
+
+    /**
+     * Cache of read-only namespace lookups.  Entries are invalidated by the
+     * namespace mutators below.
+     */
+    NodeCache &node_cache() { return m_node_cache; }
+
     bool get_xattr_i32(BDbTxn &txn, const String &fname,
                        const String &aname, uint32_t *valuep);
     void set_xattr_i32(BDbTxn &txn, const String &fname,
@@ -725,6 +749,15 @@ namespace Hyperspace {
     uint32_t  m_log_gc_interval;
     uint32_t m_max_unused_logs;
     boost::xtime m_last_log_gc_time;
+
+    Mutex m_group_commit_mutex;
+    boost::condition m_group_commit_cond;
+    uint64_t m_commit_count;
+    uint64_t m_synced_count;
+    uint64_t m_log_flush_count;
+    bool m_sync_in_progress;
+
+    NodeCache m_node_cache;
   };
 
 } // namespace Hyperspace
@@ -289,6 +289,15 @@ bool Master::get_session(uint64_t session_id, SessionDataPtr &session_data) {
   return true;
 }
 
+bool Master::get_cached_handle_node(SessionDataPtr &session_data,
+                                    uint64_t handle, String &node) {
+  boost::xtime now;
+  boost::xtime_get(&now, boost::TIME_UTC);
+  if (session_data->is_expired(now))
+    return false;
+  return m_bdb_fs->node_cache().get_handle_node(handle, node);
+}
+
 /**
  * destroy_session does the following:
  * > Lock the session expiry map and erase the session data object from it
@@ -1085,6 +1094,23 @@ Master::attr_get(ResponseCallbackAttrGet *cb, uint64_t session_id,
     HT_INFOF("attrget(session=%llu(%s), handle=%llu, name=%s)",
              (Llu)session_id, session_data->get_name(), (Llu)handle, name);
 
+  NodeCache &cache = m_bdb_fs->node_cache();
+  bool found;
+
+  if (get_cached_handle_node(session_data, handle, node) &&
+      cache.get_attr(node, name, &found, dbuf)) {
+    if (!found) {
+      cb->error(Error::HYPERSPACE_ATTR_NOT_FOUND, name);
+      return;
+    }
+    StaticBuffer buffer(dbuf);
+    if ((error = cb->response(buffer)) != Error::OK)
+      HT_ERRORF("Problem sending back response - %s", Error::get_text(error));
+    return;
+  }
+
+  uint64_t generation = cache.generation();
+
   HT_BDBTXN_BEGIN() {
     // (re) initialize vars
     aborted = false; commited = false;
@@ -1105,12 +1131,15 @@ Master::attr_get(ResponseCallbackAttrGet *cb, uint64_t session_id,
     }
 
     m_bdb_fs->get_handle_node(txn, handle, node);
+    cache.put_handle_node(generation, handle, node);
     if (!m_bdb_fs->get_xattr(txn, node, name, dbuf)) {
+      cache.put_attr(generation, node, name, false, 0, 0);
       error = Error::HYPERSPACE_ATTR_NOT_FOUND;
       error_msg = name;
       aborted = true;
       goto txn_commit;
     }
+    cache.put_attr(generation, node, name, true, dbuf.base, dbuf.fill());
 
     txn_commit:
       if (aborted)
@@ -1453,11 +1482,17 @@ Master::exists(ResponseCallbackExists *cb, uint64_t session_id,
 
   HT_ASSERT(name[0] == '/' && name[strlen(name)-1] != '/');
 
-  HT_BDBTXN_BEGIN() {
-    file_exists = m_bdb_fs->exists(txn, name);
-    txn.commit(0);
+  NodeCache &cache = m_bdb_fs->node_cache();
+
+  if (!cache.get_exists(name, &file_exists)) {
+    uint64_t generation = cache.generation();
+    HT_BDBTXN_BEGIN() {
+      file_exists = m_bdb_fs->exists(txn, name);
+      txn.commit(0);
+    }
+    HT_BDBTXN_END_CB(cb);
+    cache.put_exists(generation, name, file_exists);
   }
-  HT_BDBTXN_END_CB(cb);
 
   if ((error = cb->response(file_exists)) != Error::OK)
     HT_ERRORF("Problem sending back response - %s", Error::get_text(error));
@@ -1496,7 +1531,18 @@ Master::readdir(ResponseCallbackReaddir *cb, uint64_t session_id,
     HT_INFOF("readdir(session=%llu(%s), handle=%llu)",
              (Llu)session_id, session_data->get_name(),(Llu)handle);
 
+  NodeCache &cache = m_bdb_fs->node_cache();
+
+  if (get_cached_handle_node(session_data, handle, node) &&
+      cache.get_listing(node, listing)) {
+    cb->response(listing);
+    return;
+  }
+
+  uint64_t generation = cache.generation();
+
   HT_BDBTXN_BEGIN() {
+    listing.clear();
 
     // make sure session is still valid
     if (!m_bdb_fs->session_exists(txn, session_id)) {
@@ -1515,6 +1561,8 @@ Master::readdir(ResponseCallbackReaddir *cb, uint64_t session_id,
 
     m_bdb_fs->get_handle_node(txn, handle, node);
     m_bdb_fs->get_directory_listing(txn, node, listing);
+    cache.put_handle_node(generation, handle, node);
+    cache.put_listing(generation, node, listing);
 
     txn_commit:
       if (aborted)
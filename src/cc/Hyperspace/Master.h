@@ -134,6 +134,19 @@ namespace Hyperspace {
     void destroy_session(uint64_t session_id);
     void initialize_session(uint64_t session_id, const String &name);
 
+    /**
+     * Looks up the node that <code>handle</code> refers to in the read cache.
+     * Only succeeds if the session's lease is still current, in which case a
+     * read-only request can be served without a Berkeley DB transaction.
+     *
+     * @param session_data session issuing the request
+     * @param handle handle id
+     * @param node receives the node name
+     * @return true if found, false otherwise
+     */
+    bool get_cached_handle_node(SessionDataPtr &session_data, uint64_t handle,
+                                String &node);
+
     /**
      * Attempts to renew the session lease for session with the given ID.  If
      * the session cannot be found or if it is expired, the method returns
@@ -0,0 +1,193 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include "NodeCache.h"
+
+using namespace Hypertable;
+using namespace Hyperspace;
+
+namespace {
+  String strip_trailing_slash(const String &name) {
+    if (name.length() > 1 && name[name.length()-1] == '/')
+      return name.substr(0, name.length()-1);
+    return name;
+  }
+}
+
+
+bool NodeCache::get_handle_node(uint64_t handle, String &node) {
+  ScopedLock lock(m_mutex);
+  HandleMap::iterator iter = m_handles.find(handle);
+  if (iter == m_handles.end())
+    return false;
+  node = iter->second;
+  return true;
+}
+
+
+bool NodeCache::get_exists(const String &name, bool *existsp) {
+  ScopedLock lock(m_mutex);
+  Entry *entry = lookup(name);
+  if (entry == 0 || !entry->exists_known) {
+    m_misses++;
+    return false;
+  }
+  m_hits++;
+  *existsp = entry->exists;
+  return true;
+}
+
+
+bool NodeCache::get_attr(const String &node, const String &aname,
+                         bool *foundp, DynamicBuffer &value) {
+  ScopedLock lock(m_mutex);
+  Entry *entry = lookup(node);
+  std::map<String, AttrValue>::iterator iter;
+  if (entry == 0 || (iter = entry->attrs.find(aname)) == entry->attrs.end()) {
+    m_misses++;
+    return false;
+  }
+  m_hits++;
+  *foundp = iter->second.found;
+  if (iter->second.found) {
+    value.clear();
+    value.add(iter->second.value.data(), iter->second.value.length());
+  }
+  return true;
+}
+
+
+bool NodeCache::get_listing(const String &node,
+                            std::vector<DirEntry> &listing) {
+  ScopedLock lock(m_mutex);
+  Entry *entry = lookup(node);
+  if (entry == 0 || !entry->listing_known) {
+    m_misses++;
+    return false;
+  }
+  m_hits++;
+  listing = entry->listing;
+  return true;
+}
+
+
+void NodeCache::put_handle_node(uint64_t generation, uint64_t handle,
+                                const String &node) {
+  ScopedLock lock(m_mutex);
+  if (!enabled() || generation != m_generation)
+    return;
+  if (m_handles.size() >= m_max_entries)
+    m_handles.clear();
+  m_handles[handle] = node;
+}
+
+
+void NodeCache::put_exists(uint64_t generation, const String &name,
+                           bool exists) {
+  ScopedLock lock(m_mutex);
+  Entry *entry = insert(generation, name);
+  if (entry) {
+    entry->exists_known = true;
+    entry->exists = exists;
+  }
+}
+
+
+void NodeCache::put_attr(uint64_t generation, const String &node,
+                         const String &aname, bool found, const void *value,
+                         size_t value_len) {
+  ScopedLock lock(m_mutex);
+  Entry *entry = insert(generation, node);
+  if (entry) {
+    AttrValue &attr = entry->attrs[aname];
+    attr.found = found;
+    if (found)
+      attr.value.assign((const char *)value, value_len);
+    else
+      attr.value.clear();
+  }
+}
+
+
+void NodeCache::put_listing(uint64_t generation, const String &node,
+                            const std::vector<DirEntry> &listing) {
+  ScopedLock lock(m_mutex);
+  Entry *entry = insert(generation, node);
+  if (entry) {
+    entry->listing_known = true;
+    entry->listing = listing;
+  }
+}
+
+
+void NodeCache::invalidate(const String &name) {
+  ScopedLock lock(m_mutex);
+  invalidate_locked(strip_trailing_slash(name));
+}
+
+
+void NodeCache::invalidate_handle(uint64_t handle) {
+  ScopedLock lock(m_mutex);
+  m_handles.erase(handle);
+  m_generation++;
+}
+
+
+void NodeCache::clear() {
+  ScopedLock lock(m_mutex);
+  m_entries.clear();
+  m_handles.clear();
+  m_generation++;
+}
+
+
+NodeCache::Entry *NodeCache::lookup(const String &name) {
+  EntryMap::iterator iter = m_entries.find(strip_trailing_slash(name));
+  return (iter == m_entries.end()) ? 0 : &iter->second;
+}
+
+
+NodeCache::Entry *NodeCache::insert(uint64_t generation, const String &name) {
+  if (!enabled() || generation != m_generation)
+    return 0;
+  // Bound memory by starting over; the working set refills quickly
+  if (m_entries.size() >= m_max_entries)
+    m_entries.clear();
+  return &m_entries[strip_trailing_slash(name)];
+}
+
+
+void NodeCache::invalidate_locked(const String &name) {
+  m_entries.erase(name);
+
+  size_t lastslash = name.rfind('/');
+  if (lastslash != String::npos) {
+    String parent = (lastslash == 0) ? String("/") : name.substr(0, lastslash);
+    EntryMap::iterator iter = m_entries.find(parent);
+    if (iter != m_entries.end()) {
+      iter->second.listing_known = false;
+      iter->second.listing.clear();
+    }
+  }
+  m_generation++;
+}
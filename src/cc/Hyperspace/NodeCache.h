@@ -0,0 +1,123 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERSPACE_NODECACHE_H
+#define HYPERSPACE_NODECACHE_H
+
+#include <map>
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/HashMap.h"
+#include "Common/Mutex.h"
+#include "Common/String.h"
+
+#include "DirEntry.h"
+
+namespace Hyperspace {
+  using namespace Hypertable;
+
+  /**
+   * In-memory cache of read-only namespace lookups (node existence,
+   * attribute values, directory listings and the handle to node mapping)
+   * that allows exists, attr_get and readdir to be answered without
+   * opening a Berkeley DB transaction.  Every mutation of the namespace
+   * database invalidates the affected node (and the listing of its parent)
+   * and bumps a generation counter.  Callers that populate the cache from
+   * a transaction pass in the generation they read before starting it so
+   * that a value that raced with a concurrent mutation is never installed.
+   */
+  class NodeCache {
+  public:
+    NodeCache(size_t max_entries)
+      : m_max_entries(max_entries), m_generation(0), m_hits(0),
+        m_misses(0) { }
+
+    bool enabled() const { return m_max_entries != 0; }
+
+    uint64_t generation() {
+      ScopedLock lock(m_mutex);
+      return m_generation;
+    }
+
+    bool get_handle_node(uint64_t handle, String &node);
+    bool get_exists(const String &name, bool *existsp);
+    bool get_attr(const String &node, const String &aname, bool *foundp,
+                  DynamicBuffer &value);
+    bool get_listing(const String &node, std::vector<DirEntry> &listing);
+
+    void put_handle_node(uint64_t generation, uint64_t handle,
+                         const String &node);
+    void put_exists(uint64_t generation, const String &name, bool exists);
+    void put_attr(uint64_t generation, const String &node, const String &aname,
+                  bool found, const void *value, size_t value_len);
+    void put_listing(uint64_t generation, const String &node,
+                     const std::vector<DirEntry> &listing);
+
+    /** Drops everything cached for <code>name</code> as well as the
+     * directory listing of its parent.
+     */
+    void invalidate(const String &name);
+    void invalidate_handle(uint64_t handle);
+    void clear();
+
+    void get_stats(uint64_t *hitsp, uint64_t *missesp) {
+      ScopedLock lock(m_mutex);
+      *hitsp = m_hits;
+      *missesp = m_misses;
+    }
+
+  private:
+
+    struct AttrValue {
+      AttrValue() : found(false) { }
+      bool found;
+      String value;
+    };
+
+    struct Entry {
+      Entry() : exists_known(false), exists(false), listing_known(false) { }
+      bool exists_known;
+      bool exists;
+      bool listing_known;
+      std::vector<DirEntry> listing;
+      std::map<String, AttrValue> attrs;
+    };
+
+    typedef hash_map<String, Entry> EntryMap;
+    typedef hash_map<uint64_t, String> HandleMap;
+
+    Entry *lookup(const String &name);
+    Entry *insert(uint64_t generation, const String &name);
+    void invalidate_locked(const String &name);
+
+    Mutex      m_mutex;
+    size_t     m_max_entries;
+    uint64_t   m_generation;
+    uint64_t   m_hits;
+    uint64_t   m_misses;
+    EntryMap   m_entries;
+    HandleMap  m_handles;
+  };
+
+} // namespace Hyperspace
+
+#endif // HYPERSPACE_NODECACHE_H
@@ -0,0 +1,151 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+
+#include "Hyperspace/NodeCache.h"
+
+using namespace Hyperspace;
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  vector<DirEntry> make_listing(const char *name) {
+    vector<DirEntry> listing;
+    DirEntry entry;
+    entry.name = name;
+    entry.is_dir = false;
+    listing.push_back(entry);
+    return listing;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  DynamicBuffer value;
+  vector<DirEntry> listing;
+  uint64_t hits, misses;
+  String node;
+  bool exists, found;
+
+  // hits return what was put, misses are counted
+  {
+    NodeCache cache(16);
+    HT_ASSERT(cache.enabled());
+    HT_ASSERT(!cache.get_exists("/a/b", &exists));
+
+    cache.put_exists(cache.generation(), "/a/b", true);
+    HT_ASSERT(cache.get_exists("/a/b", &exists) && exists);
+    // trailing slashes name the same node
+    HT_ASSERT(cache.get_exists("/a/b/", &exists) && exists);
+
+    cache.put_attr(cache.generation(), "/a/b", "x", true, "val", 3);
+    cache.put_attr(cache.generation(), "/a/b", "y", false, 0, 0);
+    HT_ASSERT(cache.get_attr("/a/b", "x", &found, value) && found);
+    HT_ASSERT(value.fill() == 3 && !memcmp(value.base, "val", 3));
+    HT_ASSERT(cache.get_attr("/a/b", "y", &found, value) && !found);
+    HT_ASSERT(!cache.get_attr("/a/b", "z", &found, value));
+
+    cache.put_listing(cache.generation(), "/a", make_listing("b"));
+    HT_ASSERT(cache.get_listing("/a", listing));
+    HT_ASSERT(listing.size() == 1 && listing[0].name == "b");
+
+    cache.put_handle_node(cache.generation(), 7, "/a/b");
+    HT_ASSERT(cache.get_handle_node(7, node) && node == "/a/b");
+
+    cache.get_stats(&hits, &misses);
+    HT_ASSERT(hits == 5);
+    HT_ASSERT(misses == 2);
+  }
+
+  // invalidation drops the node and its parent's listing, but not the
+  // parent itself, and a value read before a mutation is not installed
+  {
+    NodeCache cache(16);
+    cache.put_exists(cache.generation(), "/a", true);
+    cache.put_listing(cache.generation(), "/a", make_listing("b"));
+    cache.put_exists(cache.generation(), "/a/b", true);
+    cache.put_attr(cache.generation(), "/a/b", "x", true, "val", 3);
+
+    uint64_t generation = cache.generation();
+    cache.invalidate("/a/b");
+    HT_ASSERT(cache.generation() != generation);
+    HT_ASSERT(!cache.get_exists("/a/b", &exists));
+    HT_ASSERT(!cache.get_attr("/a/b", "x", &found, value));
+    HT_ASSERT(!cache.get_listing("/a", listing));
+    HT_ASSERT(cache.get_exists("/a", &exists) && exists);
+
+    cache.put_exists(generation, "/a/b", true);
+    HT_ASSERT(!cache.get_exists("/a/b", &exists));
+
+    // top level nodes invalidate the listing of the root
+    cache.put_listing(cache.generation(), "/", make_listing("a"));
+    cache.invalidate("/a");
+    HT_ASSERT(!cache.get_listing("/", listing));
+
+    cache.put_handle_node(cache.generation(), 7, "/a/b");
+    cache.invalidate_handle(7);
+    HT_ASSERT(!cache.get_handle_node(7, node));
+
+    cache.put_exists(cache.generation(), "/c", false);
+    cache.clear();
+    HT_ASSERT(!cache.get_exists("/c", &exists));
+  }
+
+  // reaching MaxEntries evicts the cached nodes
+  {
+    NodeCache cache(2);
+    cache.put_exists(cache.generation(), "/a", true);
+    cache.put_exists(cache.generation(), "/b", true);
+    HT_ASSERT(cache.get_exists("/a", &exists));
+    HT_ASSERT(cache.get_exists("/b", &exists));
+
+    cache.put_exists(cache.generation(), "/c", true);
+    HT_ASSERT(cache.get_exists("/c", &exists));
+    HT_ASSERT(!cache.get_exists("/a", &exists));
+    HT_ASSERT(!cache.get_exists("/b", &exists));
+
+    cache.put_handle_node(cache.generation(), 1, "/a");
+    cache.put_handle_node(cache.generation(), 2, "/b");
+    cache.put_handle_node(cache.generation(), 3, "/c");
+    HT_ASSERT(cache.get_handle_node(3, node) && node == "/c");
+    HT_ASSERT(!cache.get_handle_node(1, node));
+  }
+
+  // a cache with MaxEntries of 0 is disabled
+  {
+    NodeCache cache(0);
+    HT_ASSERT(!cache.enabled());
+    cache.put_exists(cache.generation(), "/a", true);
+    cache.put_handle_node(cache.generation(), 1, "/a");
+    HT_ASSERT(!cache.get_exists("/a", &exists));
+    HT_ASSERT(!cache.get_handle_node(1, node));
+  }
+
+  return 0;
+}
@@ -39,7 +39,7 @@ namespace Hypertable {
   class BlockCompressionCodec : public ReferenceCount {
   public:
     enum Type { UNKNOWN=-1, NONE=0, BMZ=1, ZLIB=2, LZO=3, QUICKLZ=4,
-                SNAPPY=5, COMPRESSION_TYPE_LIMIT=6 };
+                SNAPPY=5, AUTO=6, COMPRESSION_TYPE_LIMIT=7 };
     typedef std::vector<String> Args;
 
     static const char *get_compressor_name(uint16_t algo);
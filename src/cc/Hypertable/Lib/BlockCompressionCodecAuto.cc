@@ -0,0 +1,229 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+
+#include "Common/Logger.h"
+#include "Common/Mutex.h"
+#include "Common/Time.h"
+
+#include "BlockCompressionCodecAuto.h"
+#include "CompressorFactory.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Candidate codecs, roughly in order of increasing CPU cost */
+  const int candidates[] = {
+    BlockCompressionCodec::NONE,
+    BlockCompressionCodec::SNAPPY,
+    BlockCompressionCodec::LZO,
+    BlockCompressionCodec::QUICKLZ,
+    BlockCompressionCodec::ZLIB
+  };
+  const size_t candidate_count = sizeof(candidates) / sizeof(int);
+
+  struct Trial {
+    int type;
+    size_t zlength;
+    int64_t nanos;
+  };
+
+  struct LtTrialCost {
+    bool operator()(const Trial &t1, const Trial &t2) const {
+      return t1.nanos < t2.nanos;
+    }
+  };
+
+  Mutex mix_mutex;
+  uint64_t mix_blocks[BlockCompressionCodec::COMPRESSION_TYPE_LIMIT];
+  uint64_t mix_bytes[BlockCompressionCodec::COMPRESSION_TYPE_LIMIT];
+  uint64_t mix_zbytes[BlockCompressionCodec::COMPRESSION_TYPE_LIMIT];
+
+  const char *parse_value(const BlockCompressionCodec::Args &args,
+                          BlockCompressionCodec::Args::const_iterator &it,
+                          const char *name) {
+    size_t name_len = strlen(name);
+    if (it->compare(0, name_len, name))
+      return 0;
+    if (it->length() > name_len && (*it)[name_len] == '=')
+      return it->c_str() + name_len + 1;
+    if (it->length() == name_len) {
+      if (++it == args.end())
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Missing value for "
+                  "'%s' argument to auto codec", name);
+      return it->c_str();
+    }
+    return 0;
+  }
+
+}
+
+
+BlockCompressionCodecAuto::BlockCompressionCodecAuto(const Args &args)
+  : m_trial_buf(0), m_objective(BALANCED), m_sample_interval(16),
+    m_blocks_until_sample(0), m_current(SNAPPY) {
+  if (!args.empty())
+    set_args(args);
+}
+
+
+BlockCompressionCodecAuto::~BlockCompressionCodecAuto() {
+}
+
+
+void BlockCompressionCodecAuto::set_args(const Args &args) {
+  Args::const_iterator it = args.begin(), arg_end = args.end();
+  const char *value;
+
+  for (; it != arg_end; ++it) {
+    if ((value = parse_value(args, it, "--objective")) != 0) {
+      if (!strcasecmp(value, "speed"))
+        m_objective = SPEED;
+      else if (!strcasecmp(value, "balanced"))
+        m_objective = BALANCED;
+      else if (!strcasecmp(value, "space"))
+        m_objective = SPACE;
+      else
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Unrecognized auto "
+                  "codec objective '%s' (expected speed, balanced or space)",
+                  value);
+    }
+    else if ((value = parse_value(args, it, "--sample-interval")) != 0) {
+      int interval = atoi(value);
+      if (interval <= 0)
+        HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Invalid auto codec "
+                  "sample interval '%s'", value);
+      m_sample_interval = (uint32_t)interval;
+    }
+    else
+      HT_THROWF(Error::BLOCK_COMPRESSOR_INVALID_ARG, "Unrecognized argument "
+                "to auto codec: '%s'", (*it).c_str());
+  }
+  m_blocks_until_sample = 0;
+}
+
+
+double BlockCompressionCodecAuto::min_gain(Objective objective) {
+  switch (objective) {
+  case SPEED:
+    return 0.20;
+  case BALANCED:
+    return 0.05;
+  default:
+    break;
+  }
+  return 0.0;
+}
+
+
+void
+BlockCompressionCodecAuto::get_codec_mix(uint64_t *blocks, uint64_t *bytes,
+                                         uint64_t *zbytes) {
+  ScopedLock lock(mix_mutex);
+  memcpy(blocks, mix_blocks, sizeof(mix_blocks));
+  memcpy(bytes, mix_bytes, sizeof(mix_bytes));
+  memcpy(zbytes, mix_zbytes, sizeof(mix_zbytes));
+}
+
+
+BlockCompressionCodec *BlockCompressionCodecAuto::get_codec(int type) {
+  if (type < 0 || type >= COMPRESSION_TYPE_LIMIT || type == AUTO)
+    HT_THROWF(Error::BLOCK_COMPRESSOR_UNSUPPORTED_TYPE,
+              "Invalid compression type '%d'", type);
+  if (!m_codecs[type])
+    m_codecs[type] = CompressorFactory::create_block_codec((Type)type);
+  return m_codecs[type].get();
+}
+
+
+/**
+ * Deflates the block with every candidate codec and walks the results in
+ * order of measured cost, moving to a more expensive codec only if it
+ * saves at least min_gain() of the input relative to the current choice.
+ * Codecs that fall back to storing the block uncompressed never win.
+ */
+void BlockCompressionCodecAuto::sample(const DynamicBuffer &input,
+                                       BlockCompressionHeader &header) {
+  Trial trials[candidate_count];
+  size_t threshold = (size_t)(min_gain(m_objective) * input.fill());
+
+  for (size_t i=0; i<candidate_count; i++) {
+    BlockCompressionCodec *codec = get_codec(candidates[i]);
+    int64_t start_ts = get_ts64();
+    codec->deflate(input, m_trial_buf, header);
+    trials[i].type = candidates[i];
+    trials[i].zlength = header.get_data_zlength();
+    trials[i].nanos = (candidates[i] == NONE) ? 0 : get_ts64() - start_ts;
+  }
+
+  std::stable_sort(trials, trials+candidate_count, LtTrialCost());
+
+  Trial *best = &trials[0];
+  for (size_t i=1; i<candidate_count; i++) {
+    if (trials[i].zlength < best->zlength &&
+        best->zlength - trials[i].zlength > threshold)
+      best = &trials[i];
+  }
+
+  if (best->type != m_current)
+    HT_DEBUGF("auto codec switching from %s to %s (%lu -> %lu bytes)",
+              get_compressor_name(m_current), get_compressor_name(best->type),
+              (Lu)input.fill(), (Lu)best->zlength);
+  m_current = best->type;
+}
+
+
+void
+BlockCompressionCodecAuto::deflate(const DynamicBuffer &input,
+    DynamicBuffer &output, BlockCompressionHeader &header, size_t reserve) {
+
+  if (m_blocks_until_sample == 0) {
+    sample(input, header);
+    m_blocks_until_sample = m_sample_interval;
+  }
+  m_blocks_until_sample--;
+
+  get_codec(m_current)->deflate(input, output, header, reserve);
+
+  int type = header.get_compression_type();
+  ScopedLock lock(mix_mutex);
+  mix_blocks[type]++;
+  mix_bytes[type] += header.get_data_length();
+  mix_zbytes[type] += header.get_data_zlength();
+}
+
+
+void
+BlockCompressionCodecAuto::inflate(const DynamicBuffer &input,
+    DynamicBuffer &output, BlockCompressionHeader &header) {
+  const uint8_t *ptr = input.base;
+  size_t remaining = input.fill();
+
+  // peek at the header to find out which codec wrote the block
+  header.decode(&ptr, &remaining);
+
+  get_codec(header.get_compression_type())->inflate(input, output, header);
+}
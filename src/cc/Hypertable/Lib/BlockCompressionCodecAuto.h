@@ -0,0 +1,84 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_BLOCKCOMPRESSIONCODECAUTO_H
+#define HYPERTABLE_BLOCKCOMPRESSIONCODECAUTO_H
+
+#include "Common/DynamicBuffer.h"
+
+#include "BlockCompressionCodec.h"
+
+namespace Hypertable {
+
+  /**
+   * Block codec that picks the concrete codec (none, snappy, lzo, quicklz
+   * or zlib) on a per-block basis.  Every <i>sample-interval</i> blocks the
+   * block is deflated with each of the candidate codecs and the cheapest
+   * one that still meets the configured objective is used for that block
+   * and the blocks that follow it.  The concrete codec is recorded in each
+   * block header, so inflate dispatches on the header type.
+   */
+  class BlockCompressionCodecAuto : public BlockCompressionCodec {
+
+  public:
+    enum Objective { SPEED=0, BALANCED=1, SPACE=2 };
+
+    BlockCompressionCodecAuto(const Args &args);
+    virtual ~BlockCompressionCodecAuto();
+
+    virtual void set_args(const Args &args);
+    virtual void deflate(const DynamicBuffer &input, DynamicBuffer &output,
+                         BlockCompressionHeader &header, size_t reserve=0);
+    virtual void inflate(const DynamicBuffer &input, DynamicBuffer &output,
+                         BlockCompressionHeader &header);
+    virtual int get_type() { return AUTO; }
+
+    /** Returns the codec type currently selected for deflate */
+    int get_current_type() { return m_current; }
+
+    /** Returns the minimum fraction of the input that a more expensive
+     * codec has to save, relative to the cheaper one, to be selected
+     */
+    static double min_gain(Objective objective);
+
+    /** Copies the process-wide codec mix (blocks, uncompressed bytes and
+     * compressed bytes written per concrete codec type) into the given
+     * arrays, each of which must hold COMPRESSION_TYPE_LIMIT entries.
+     */
+    static void get_codec_mix(uint64_t *blocks, uint64_t *bytes,
+                              uint64_t *zbytes);
+
+  private:
+    BlockCompressionCodec *get_codec(int type);
+    void sample(const DynamicBuffer &input, BlockCompressionHeader &header);
+
+    BlockCompressionCodecPtr m_codecs[COMPRESSION_TYPE_LIMIT];
+    DynamicBuffer m_trial_buf;
+    Objective m_objective;
+    uint32_t m_sample_interval;
+    uint32_t m_blocks_until_sample;
+    int m_current;
+  };
+
+}
+
+#endif // HYPERTABLE_BLOCKCOMPRESSIONCODECAUTO_H
@@ -74,8 +74,8 @@ BlockCompressionCodecQuicklz::deflate(const DynamicBuffer &input,
     header.set_data_length(input.fill());
     header.set_data_zlength(len);
   }
-  header.set_data_checksum(fletcher32(output.base + header.length(),
-                           header.get_data_zlength()));
+  header.set_data_checksum(header.compute_data_checksum(
+      output.base + header.length(), header.get_data_zlength()));
 
   output.ptr = output.base;
   header.encode(&output.ptr);
@@ -98,7 +98,8 @@ void BlockCompressionCodecQuicklz::inflate(const DynamicBuffer &input,
               "header zlength = %lu, actual = %lu",
               (Lu)header.get_data_zlength(), (Lu)remaining);
 
-  uint32_t checksum = fletcher32(msg_ptr, header.get_data_zlength());
+  uint32_t checksum = header.compute_data_checksum(msg_ptr,
+      header.get_data_zlength());
 
   if (checksum != header.get_data_checksum())
     HT_THROWF(Error::BLOCK_COMPRESSOR_CHECKSUM_MISMATCH, "Compressed block "
@@ -129,8 +129,8 @@ BlockCompressionCodecZlib::deflate(const DynamicBuffer &input,
     header.set_data_zlength(zlen);
   }
 
-  header.set_data_checksum(fletcher32(output.base + header.length(),
-                           header.get_data_zlength()));
+  header.set_data_checksum(header.compute_data_checksum(
+      output.base + header.length(), header.get_data_zlength()));
 
   deflateReset(&m_stream_deflate);
 
@@ -170,7 +170,8 @@ BlockCompressionCodecZlib::inflate(const DynamicBuffer &input,
               "header zlength = %lu, actual = %lu",
               (Lu)header.get_data_zlength(), (Lu)remaining);
 
-  uint32_t checksum = fletcher32(msg_ptr, header.get_data_zlength());
+  uint32_t checksum = header.compute_data_checksum(msg_ptr,
+      header.get_data_zlength());
 
   if (checksum != header.get_data_checksum())
     HT_THROWF(Error::BLOCK_COMPRESSOR_CHECKSUM_MISMATCH, "Compressed block "
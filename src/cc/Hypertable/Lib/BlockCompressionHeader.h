@@ -32,12 +32,22 @@ namespace Hypertable {
 
     static const size_t LENGTH = 26;
 
+    enum ChecksumType { CHECKSUM_FLETCHER32=0, CHECKSUM_CRC32C=1 };
+
+    /** Set in the encoded compression type byte when the data checksum
+     * is crc32c.  Headers without it were written with fletcher32. */
+    static const uint8_t FLAG_CHECKSUM_CRC32C = 0x80;
+
     BlockCompressionHeader() : m_data_length(0), m_data_zlength(0),
-        m_data_checksum(0), m_compression_type((uint16_t)-1) { }
+        m_data_checksum(0), m_compression_type((uint16_t)-1),
+        m_checksum_type(ms_default_checksum_type) { }
 
     BlockCompressionHeader(const char *magic)
       : m_data_length(0), m_data_zlength(0), m_data_checksum(0),
-        m_compression_type((uint16_t)-1) { memcpy(m_magic, magic, 10); }
+        m_compression_type((uint16_t)-1),
+        m_checksum_type(ms_default_checksum_type) {
+      memcpy(m_magic, magic, 10);
+    }
 
     virtual ~BlockCompressionHeader() { return; }
 
@@ -58,6 +68,23 @@ namespace Hypertable {
     void     set_compression_type(uint16_t type) { m_compression_type = type; }
     uint16_t get_compression_type() { return m_compression_type; }
 
+    void    set_checksum_type(uint8_t type) { m_checksum_type = type; }
+    uint8_t get_checksum_type() { return m_checksum_type; }
+
+    /** Computes the data checksum with this header's checksum type */
+    uint32_t compute_data_checksum(const void *data, size_t len);
+
+    /** Sets the checksum type used by newly constructed headers.  Blocks
+     * written with crc32c can not be read by servers that predate it, so
+     * this should only be switched once every server has been upgraded.
+     */
+    static void set_default_checksum_type(uint8_t type) {
+      ms_default_checksum_type = type;
+    }
+    static uint8_t get_default_checksum_type() {
+      return ms_default_checksum_type;
+    }
+
     virtual size_t length() { return LENGTH; }
     virtual void   encode(uint8_t **bufp);
     virtual void   write_header_checksum(uint8_t *base, uint8_t **bufp);
@@ -69,6 +96,9 @@ namespace Hypertable {
     uint32_t m_data_zlength;
     uint32_t m_data_checksum;
     uint16_t m_compression_type;
+    uint8_t m_checksum_type;
+
+    static uint8_t ms_default_checksum_type;
   };
 
 }
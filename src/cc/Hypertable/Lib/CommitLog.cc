@@ -214,7 +214,8 @@ int CommitLog::link_log(CommitLogBase *log_base) {
   header.set_compression_type(BlockCompressionCodec::NONE);
   header.set_data_length(log_dir.length() + 1);
   header.set_data_zlength(log_dir.length() + 1);
-  header.set_data_checksum(fletcher32(log_dir.c_str(), log_dir.length()+1));
+  header.set_data_checksum(header.compute_data_checksum(log_dir.c_str(),
+                                                       log_dir.length()+1));
 
   header.encode(&input.ptr);
   input.add(log_dir.c_str(), log_dir.length() + 1);
@@ -54,6 +54,8 @@ using namespace Hypertable;
 using namespace Hypertable::Config;
 using namespace std;
 
+const char CommitLogReader::HOT_BLOCKS_FILE[] = "hot_blocks";
+
 namespace {
   struct ByFragmentNumber {
     bool operator()(const String &x, const String &y) const {
@@ -232,7 +234,7 @@ void CommitLogReader::load_fragments(String log_dir, bool mark_for_deletion) {
 
   for (size_t i=0; i<listing.size(); i++) {
 
-    if (boost::ends_with(listing[i], ".tmp"))
+    if (boost::ends_with(listing[i], ".tmp") || listing[i] == HOT_BLOCKS_FILE)
       continue;
 
     char *endptr;
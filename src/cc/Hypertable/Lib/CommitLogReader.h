@@ -69,6 +69,10 @@ namespace Hypertable {
       return m_fragment_queue[m_fragment_queue_offset].num;
     }
 
+    /** Name of the file in a transfer log directory that lists the cached
+     * blocks of the range being moved.  It is not a log fragment. */
+    static const char HOT_BLOCKS_FILE[];
+
   private:
 
     void load_fragments(String log_dir, bool mark_for_deletion);
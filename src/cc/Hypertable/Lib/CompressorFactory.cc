@@ -22,6 +22,7 @@
 #include "Common/Compat.h"
 #include <boost/algorithm/string.hpp>
 #include "CompressorFactory.h"
+#include "BlockCompressionCodecAuto.h"
 #include "BlockCompressionCodecBmz.h"
 #include "BlockCompressionCodecNone.h"
 #include "BlockCompressionCodecZlib.h"
@@ -63,6 +64,9 @@ CompressorFactory::parse_block_codec_spec(const std::string &spec,
   if (name == "snappy")
     return BlockCompressionCodec::SNAPPY;
 
+  if (name == "auto")
+    return BlockCompressionCodec::AUTO;
+
   HT_ERRORF("unknown codec type: %s", name.c_str());
   return BlockCompressionCodec::UNKNOWN;
 }
@@ -83,6 +87,8 @@ CompressorFactory::create_block_codec(BlockCompressionCodec::Type type,
     return new BlockCompressionCodecQuicklz(args);
   case BlockCompressionCodec::SNAPPY:
     return new BlockCompressionCodecSnappy(args);
+  case BlockCompressionCodec::AUTO:
+    return new BlockCompressionCodecAuto(args);
   default:
     HT_THROWF(Error::BLOCK_COMPRESSOR_UNSUPPORTED_TYPE, "Invalid compression "
               "type: '%d'", (int)type);
@@ -341,6 +341,7 @@ namespace {
     "      | REPLICATION '=' int",
     "      | COMPRESSOR '=' compressor_spec",
     "      | BLOOMFILTER '=' bloom_filter_spec",
+    "      | COMPACTION_POLICY '=' compaction_policy_spec",
     "",
     "    compressor_spec:",
     "      bmz [ bmz_options ]",
@@ -348,12 +349,17 @@ namespace {
     "      | quicklz",
     "      | snappy",
     "      | zlib [ zlib_options ]",
+    "      | auto [ auto_options ]",
     "      | none",
     "",
     "    bmz_options:",
     "      --fp-len int",
     "      | --offset int",
     "",
+    "    auto_options:",
+    "      --objective speed|balanced|space",
+    "      | --sample-interval int",
+    "",
     "    zlib_options:",
     "      -9",
     "      | --best",
@@ -362,6 +368,7 @@ namespace {
     "    bloom_filter_spec:",
     "      rows [ bloom_filter_options ]",
     "      | rows+cols [ bloom_filter_options ]",
+    "      | rows-prefix prefix_option [ bloom_filter_options ]",
     "      | none ",
     "",
     "    bloom_filter_options:",
@@ -486,6 +493,7 @@ namespace {
     "      MAX_VERSIONS '=' int",
     "      | TTL '=' duration",
     "      | COUNTER",
+    "      | MERGE_OPERATOR '=' (max | min | append | hll)",
     "",
     "    duration:",
     "      int MONTHS",
@@ -502,6 +510,7 @@ namespace {
     "      | REPLICATION '=' int",
     "      | COMPRESSOR '=' compressor_spec",
     "      | BLOOMFILTER '=' bloom_filter_spec",
+    "      | COMPACTION_POLICY '=' compaction_policy_spec",
     "",
     "    compressor_spec:",
     "      bmz [ bmz_options ]",
@@ -509,12 +518,17 @@ namespace {
     "      | quicklz",
     "      | snappy",
     "      | zlib [ zlib_options ]",
+    "      | auto [ auto_options ]",
     "      | none",
     "",
     "    bmz_options:",
     "      --fp-len int",
     "      | --offset int",
     "",
+    "    auto_options:",
+    "      --objective speed|balanced|space",
+    "      | --sample-interval int",
+    "",
     "    zlib_options:",
     "      -9",
     "      | --best",
@@ -523,6 +537,7 @@ namespace {
     "    bloom_filter_spec:",
     "      rows [ bloom_filter_options ]",
     "      | rows+cols [ bloom_filter_options ]",
+    "      | rows-prefix prefix_option [ bloom_filter_options ]",
     "      | none ",
     "",
     "    bloom_filter_options:",
@@ -531,6 +546,12 @@ namespace {
     "      --num-hashes int",
     "      --max-approx-items int",
     "",
+    "    compaction_policy_spec:",
+    "      merge-run",
+    "      | size-tiered [ --size-ratio float ] [ --min-stores int ]",
+    "        [ --max-stores int ]",
+    "      | time-window [ --window int ] [ --min-stores int ]",
+    "",
     "    table_option:",
     "      MAX_VERSIONS '=' int",
     "      | TTL '=' duration",
@@ -539,6 +560,12 @@ namespace {
     "      | REPLICATION '=' int",
     "      | COMPRESSOR '=' compressor_spec",
     "      | GROUP_COMMIT_INTERVAL '=' int",
+    "      | SPLIT split_spec",
+    "",
+    "    split_spec:",
+    "      ON '(' row_key [, row_key ...] ')'",
+    "      | UNIFORM int",
+    "      | HASH int",
     "",
     "Description",
     "-----------",
@@ -633,6 +660,18 @@ namespace {
     "to 50ms.  The value specified for GROUP_COMMIT_INTERVAL will get rounded up to",
     "the nearest multiple of this property value.",
     "",
+    "The SPLIT option creates the table already divided into several ranges, which",
+    "the Master assigns across the range servers, so that a table expected to",
+    "receive a heavy load does not have to grow through a long series of splits.",
+    "SPLIT ON takes an explicit list of row keys to split at; n row keys create",
+    "n+1 ranges.  SPLIT UNIFORM n creates n ranges (at most 256) of equal width",
+    "over the first two bytes of the row key.  SPLIT HASH n creates n ranges of",
+    "equal width over eight-digit lowercase hexadecimal row prefixes, which suits",
+    "row keys that begin with a hex-encoded hash.  For example:",
+    "",
+    "    CREATE TABLE events (a, b) SPLIT HASH 32;",
+    "    CREATE TABLE users (profile) SPLIT ON ('g', 'n', 't');",
+    "",
     "Column Family Options",
     "---------------------",
     "",
@@ -676,6 +715,15 @@ namespace {
     "After these six values get written to a counter column, a subsequent read of that",
     "column would return the ASCII string \"10\".",
     "",
+    "The `MERGE_OPERATOR` option folds all values written to a cell into a",
+    "single value on the server instead of keeping versions.  Values are",
+    "merged when they are inserted, during compactions and at scan time.",
+    "",
+    "  max     Keep the largest value (numeric if both values are integers)",
+    "  min     Keep the smallest value (numeric if both values are integers)",
+    "  append  Concatenate values in the order they were written",
+    "  hll     Count distinct values; reads return the approximate count",
+    "",
     "Access Group Options",
     "--------------------",
     "",
@@ -687,6 +735,7 @@ namespace {
     "  * REPLICATION '=' int",
     "  * COMPRESSOR '=' compressor_spec",
     "  * BLOOMFILTER '=' bloom_filter_spec",
+    "  * COMPACTION_POLICY '=' compaction_policy_spec",
     "",
     "The COUNTER option makes all column families in the access group",
     "counter columns (see COUNTER description under Column Family Options",
@@ -735,11 +784,16 @@ namespace {
     "The bloom filter specification can take one of the following forms.  The rows",
     "form, which is the default, causes only row keys to be inserted into the bloom",
     "filter.  The rows+cols form causes the row key concatenated with the column",
-    "family to be inserted into the bloom filter.  none disables the bloom",
-    "filter.",
+    "family to be inserted into the bloom filter.  The rows-prefix form inserts",
+    "a leading prefix of each row key, either a fixed number of bytes",
+    "(--prefix-length) or everything up to and including the first occurrence",
+    "of a delimiter character (--prefix-delimiter), so that scans over rows",
+    "sharing one prefix can skip cell stores.  none disables the bloom filter.",
     "",
     "  * rows [ bloom_filter_options ]",
     "  * rows+cols [ bloom_filter_options ]",
+    "  * rows-prefix --prefix-length int [ bloom_filter_options ]",
+    "  * rows-prefix --prefix-delimiter char [ bloom_filter_options ]",
     "  * none",
     "",
     "The following describes the bloom filter options:",
@@ -762,6 +816,36 @@ namespace {
     "  --max-approx-items arg  Number of cell store items used to guess the number",
     "                          of actual bloom filter entries (default = 1000)",
     "",
+    "The COMPACTION_POLICY option chooses how the cell stores of the access group",
+    "are selected for merging compactions.  merge-run, the default, merges a run",
+    "of adjacent cell stores once their combined size reaches the cell store",
+    "target size, which keeps the number of cell stores low at the cost of",
+    "rewriting data more often.  size-tiered only merges adjacent cell stores of",
+    "similar size, which rewrites each cell roughly once per size tier and suits",
+    "write-heavy tables such as time series.  time-window groups cell stores into",
+    "windows by the newest timestamp they hold and only merges cell stores of the",
+    "same window; each past window ends up in a single cell store.  It also drops",
+    "cell stores whose cells have all outlived their TTL without reading them,",
+    "which suits append-only tables with a TTL on every column family.  The",
+    "default policy is defined by the config property",
+    "Hypertable.RangeServer.AccessGroup.DefaultCompactionPolicy.",
+    "",
+    "  --size-ratio arg   Maximum ratio between the largest and smallest cell",
+    "                     store merged together (default = 4)",
+    "",
+    "  --min-stores arg   Minimum number of similarly sized cell stores merged",
+    "                     together, or for time-window the number of cell",
+    "                     stores in the current window merged together",
+    "                     (default = 4)",
+    "",
+    "  --max-stores arg   Number of cell stores above which the smallest",
+    "                     adjacent ones are merged regardless of size ratio,",
+    "                     bounding the number of cell stores a read must",
+    "                     consult (default = 10)",
+    "",
+    "  --window arg       Width of a time-window window in seconds",
+    "                     (default = 86400)",
+    "",
     "Compressors",
     "-----------",
     "",
@@ -774,6 +858,7 @@ namespace {
     "  * quicklz",
     "  * zlib",
     "  * snappy",
+    "  * auto",
     "  * none",
     "",
     "The default code is lzo for cell store blocks.  The following list describes",
@@ -784,6 +869,14 @@ namespace {
     "  zlib -9 [ --best ]  Highest compression ratio (at the cost of speed)",
     "  zlib --normal       Normal compression ratio",
     "",
+    "The auto codec picks one of none, snappy, lzo, quicklz or zlib for each",
+    "block.  Every --sample-interval blocks it compresses the block with each",
+    "of them and moves to a more expensive codec only when the space saved",
+    "justifies it: speed requires a 20% saving, balanced 5% and space picks",
+    "the smallest output.  The defaults come from the config properties",
+    "Hypertable.RangeServer.CellStore.AutoCompressor.Objective and",
+    "Hypertable.RangeServer.CellStore.AutoCompressor.SampleInterval.",
+    "",
     0
   };
 
@@ -797,6 +890,15 @@ namespace {
     "      [where_clause]",
     "      [options_spec]",
     "",
+    "    SELECT aggregate_function",
+    "        '(' ('*' | (column_predicate [',' column_predicate]*)) ')'",
+    "      FROM table_name",
+    "      [where_clause]",
+    "      [GROUP BY (ROW | COLUMN FAMILY | QUALIFIER)]",
+    "      [options_spec]",
+    "",
+    "    aggregate_function: COUNT | SUM | MIN | MAX",
+    "",
     "    where_clause:",
     "        WHERE where_predicate [AND where_predicate ...]",
     "",
@@ -957,6 +1059,14 @@ namespace {
     "filter the requested rows at the range server, which will reduce the number of",
     "network roundtrips required when the number of rows requested is very large.",
     "",
+    "AGGREGATE FUNCTIONS",
+    "",
+    "COUNT, SUM, MIN and MAX are evaluated on the range servers, so only one cell",
+    "per group is sent back instead of every matching cell.  Groups are formed by",
+    "the GROUP BY clause (default COLUMN FAMILY); the value of each returned cell",
+    "is the aggregate for its group.  SUM interprets values as decimal integers,",
+    "and MIN and MAX compare integers numerically and other values bytewise.",
+    "",
     "Examples",
     "--------",
     "",
@@ -984,6 +1094,8 @@ namespace {
     "    SELECT col1:/^w[^a-zA-Z]*$/ from RegexpTest WHERE ROW REGEXP \"m.*\\s\\S\";",
     "    SELECT CELLS col1:/^w[^a-zA-Z]*$/ from RegexpTest WHERE VALUE REGEXP \"l.*e\";",
     "    SELECT CELLS col1:/^w[^a-zA-Z]*$/ from RegexpTest WHERE ROW REGEXP \"^\\D+\" AND VALUE REGEXP \"l.*e\";",
+    "    SELECT COUNT(*) FROM test WHERE ROW =^ 'b';",
+    "    SELECT SUM(hits) FROM test GROUP BY ROW;",
     "",
     0
   };
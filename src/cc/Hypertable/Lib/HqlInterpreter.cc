@@ -56,6 +56,7 @@ extern "C" {
 #include "LoadDataSourceFactory.h"
 #include "ScanSpec.h"
 #include "TableSplit.h"
+#include "TableSplitSpec.h"
 #include "Types.h"
 
 #include "DfsBroker/Lib/FileDevice.h"
@@ -173,13 +174,20 @@ cmd_create_table(NamespacePtr &ns, ParserState &state,
   String schema_str;
   SchemaPtr schema;
   bool need_default_ag = false;
+  std::vector<String> split_rows;
+
+  if (!state.split_algorithm.empty())
+    TableSplitSpec::generate(state.split_algorithm, state.split_range_count,
+                             split_rows);
+  else
+    split_rows = state.split_rows;
 
   if (!state.clone_table_name.empty()) {
     schema_str = ns->get_schema_str(state.clone_table_name, true);
     schema = Schema::new_instance(schema_str.c_str(), schema_str.size());
     schema_str.clear();
     schema->render(schema_str);
-    ns->create_table(state.table_name, schema_str.c_str());
+    ns->create_table(state.table_name, schema_str.c_str(), split_rows);
   }
   else {
     schema = new Schema();
@@ -190,6 +198,7 @@ cmd_create_table(NamespacePtr &ns, ParserState &state,
     foreach(Schema::AccessGroup *ag, state.ag_list) {
       schema->validate_compressor(ag->compressor);
       schema->validate_bloom_filter(ag->bloom_filter);
+      schema->validate_compaction_policy(ag->compaction_policy);
       if (state.table_in_memory)
         ag->in_memory = true;
       if (state.table_blocksize != 0 && ag->blocksize == 0)
@@ -233,7 +242,7 @@ cmd_create_table(NamespacePtr &ns, ParserState &state,
       HT_THROW(Error::HQL_PARSE_ERROR, schema->get_error_string());
 
     schema->render(schema_str);
-    ns->create_table(state.table_name, schema_str.c_str());
+    ns->create_table(state.table_name, schema_str.c_str(), split_rows);
   }
   cb.on_finish();
 }
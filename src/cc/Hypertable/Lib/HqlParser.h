@@ -216,7 +216,8 @@ namespace Hypertable {
       ScanState() : display_timestamps(false), keys_only(false),
           current_rowkey_set(false), start_time_set(false),
           end_time_set(false), current_timestamp_set(false),
-	  current_relop(0), buckets(0) { }
+	  current_relop(0), buckets(0), aggregate(ScanSpec::AGGREGATE_NONE),
+          aggregate_group(ScanSpec::AGGREGATE_GROUP_COLUMN_FAMILY) { }
 
       void set_time_interval(::int64_t start, ::int64_t end) {
         HQL_DEBUG("("<< start <<", "<< end <<")");
@@ -252,6 +253,8 @@ namespace Hypertable {
       bool    current_timestamp_set;
       int current_relop;
       int buckets;
+      int aggregate;
+      int aggregate_group;
     };
 
     class ParserState {
@@ -262,7 +265,8 @@ namespace Hypertable {
                       decimal_seconds(0), delete_all_columns(false),
                       delete_time(0), delete_version_time(0),
                       if_exists(false), tables_only(false), with_ids(false),
-                      replay(false), scanner_id(-1), row_uniquify_chars(0),
+                      replay(false), split_range_count(0),
+                      scanner_id(-1), row_uniquify_chars(0),
                       escape(true), nokeys(false) {
         memset(&tmval, 0, sizeof(tmval));
       }
@@ -314,6 +318,9 @@ namespace Hypertable {
       bool replay;
       String range_start_row;
       String range_end_row;
+      std::vector<String> split_rows;
+      String split_algorithm;
+      ::uint32_t split_range_count;
       ::int32_t scanner_id;
       ::int32_t row_uniquify_chars;
       bool escape;
@@ -589,6 +596,20 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct set_merge_operator {
+      set_merge_operator(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        String name(str, end-str);
+        trim_if(name, is_any_of("'\""));
+        to_lower(name);
+        if (MergeOperator::get(name) == 0)
+          HT_THROWF(Error::HQL_PARSE_ERROR, "Unknown merge operator '%s'",
+                    name.c_str());
+        state.cf->merge_operator = name;
+      }
+      ParserState &state;
+    };
+
     struct clear_column_definition {
       clear_column_definition(ParserState &state) : state(state) { }
       void operator()(char c) const {
@@ -672,6 +693,16 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct set_access_group_compaction_policy {
+      set_access_group_compaction_policy(ParserState &state) : state(state) { }
+      void operator()(char const * str, char const *end) const {
+        state.ag->compaction_policy = String(str, end-str);
+        trim_if(state.ag->compaction_policy, boost::is_any_of("'\""));
+        to_lower(state.ag->compaction_policy);
+      }
+      ParserState &state;
+    };
+
     struct add_column_family {
       add_column_family(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -765,6 +796,36 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct add_split_row {
+      add_split_row(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        if (!state.split_algorithm.empty())
+          HT_THROW(Error::HQL_PARSE_ERROR, "SPLIT multiply defined");
+        String row = String(str, end-str);
+        trim_if(row, is_any_of("'\""));
+        state.split_rows.push_back(row);
+      }
+      ParserState &state;
+    };
+
+    struct set_split_algorithm {
+      set_split_algorithm(ParserState &state) : state(state) { }
+      void operator()(char const *str, char const *end) const {
+        if (!state.split_algorithm.empty() || !state.split_rows.empty())
+          HT_THROW(Error::HQL_PARSE_ERROR, "SPLIT multiply defined");
+        state.split_algorithm = String(str, end-str);
+      }
+      ParserState &state;
+    };
+
+    struct set_split_range_count {
+      set_split_range_count(ParserState &state) : state(state) { }
+      void operator()(size_t range_count) const {
+        state.split_range_count = (::uint32_t)range_count;
+      }
+      ParserState &state;
+    };
+
     struct set_help {
       set_help(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -1428,6 +1489,32 @@ namespace Hypertable {
       ParserState &state;
     };
 
+    struct scan_set_aggregate {
+      scan_set_aggregate(ParserState &state, int function)
+        : state(state), function(function) { }
+      void operator()(char const *str, char const *end) const {
+        state.scan.aggregate = function;
+        state.scan.builder.set_aggregate(function, state.scan.aggregate_group);
+      }
+      ParserState &state;
+      int function;
+    };
+
+    struct scan_set_aggregate_group {
+      scan_set_aggregate_group(ParserState &state, int group)
+        : state(state), group(group) { }
+      void operator()(char const *str, char const *end) const {
+        if (state.scan.aggregate == ScanSpec::AGGREGATE_NONE)
+          HT_THROW(Error::HQL_PARSE_ERROR,
+                   "GROUP BY requires an aggregate function (COUNT, SUM, "
+                   "MIN or MAX)");
+        state.scan.aggregate_group = group;
+        state.scan.builder.set_aggregate(state.scan.aggregate, group);
+      }
+      ParserState &state;
+      int group;
+    };
+
     struct scan_set_keys_only {
       scan_set_keys_only(ParserState &state) : state(state) { }
       void operator()(char const *str, char const *end) const {
@@ -1669,6 +1756,7 @@ namespace Hypertable {
           Token TO           = as_lower_d["to"];
           Token TTL          = as_lower_d["ttl"];
           Token COUNTER      = as_lower_d["counter"];
+          Token MERGE_OPERATOR = as_lower_d["merge_operator"];
           Token MONTHS       = as_lower_d["months"];
           Token MONTH        = as_lower_d["month"];
           Token WEEKS        = as_lower_d["weeks"];
@@ -1697,6 +1785,12 @@ namespace Hypertable {
           Token WHERE        = as_lower_d["where"];
           Token REGEXP       = as_lower_d["regexp"];
           Token ROW          = as_lower_d["row"];
+          Token COUNT        = as_lower_d["count"];
+          Token SUM          = as_lower_d["sum"];
+          Token MIN          = as_lower_d["min"];
+          Token MAX          = as_lower_d["max"];
+          Token BY           = as_lower_d["by"];
+          Token QUALIFIER    = as_lower_d["qualifier"];
           Token CELL         = as_lower_d["cell"];
           Token CELLS        = as_lower_d["cells"];
           Token ROW_KEY_COLUMN          = as_lower_d["row_key_column"];
@@ -1754,6 +1848,7 @@ namespace Hypertable {
           Token COMMIT       = as_lower_d["commit"];
           Token LOG          = as_lower_d["log"];
           Token BLOOMFILTER  = as_lower_d["bloomfilter"];
+          Token COMPACTION_POLICY = as_lower_d["compaction_policy"];
           Token TRUE         = as_lower_d["true"];
           Token FALSE        = as_lower_d["false"];
           Token YES          = as_lower_d["yes"];
@@ -1782,6 +1877,9 @@ namespace Hypertable {
           Token USER         = as_lower_d["user"];
           Token RANGES       = as_lower_d["ranges"];
           Token SYNC         = as_lower_d["sync"];
+          Token SPLIT        = as_lower_d["split"];
+          Token UNIFORM      = as_lower_d["uniform"];
+          Token HASH         = as_lower_d["hash"];
 
           /**
            * Start grammar definition
@@ -2107,6 +2205,7 @@ namespace Hypertable {
             | table_option_in_memory[set_table_in_memory(self.state)]
             | table_option_blocksize
             | table_option_replication
+            | table_option_split
             | max_versions_option
             | ttl_option
             ;
@@ -2125,6 +2224,14 @@ namespace Hypertable {
                 set_table_replication(self.state)]
             ;
 
+          table_option_split
+            = SPLIT >> ((ON >> LPAREN >> string_literal[add_split_row(self.state)]
+                            >> *(COMMA >> string_literal[add_split_row(self.state)])
+                            >> RPAREN)
+                        | ((UNIFORM | HASH)[set_split_algorithm(self.state)]
+                           >> uint_p[set_split_range_count(self.state)]))
+            ;
+
           create_definitions
             = LPAREN >> create_definition
                      >> *(COMMA >> create_definition)
@@ -2176,6 +2283,7 @@ namespace Hypertable {
             = max_versions_option
             | ttl_option
             | counter_option
+            | merge_operator_option
             ;
 
           max_versions_option
@@ -2191,6 +2299,11 @@ namespace Hypertable {
             = COUNTER[set_counter(self.state)]
             ;
 
+          merge_operator_option
+            = MERGE_OPERATOR >> EQUAL
+              >> user_identifier[set_merge_operator(self.state)]
+            ;
+
           duration
             = ureal_p >> !(MONTHS | MONTH | WEEKS | WEEK | DAYS | DAY | HOURS |
                 HOUR | MINUTES | MINUTE | SECONDS | SECOND)
@@ -2213,6 +2326,7 @@ namespace Hypertable {
             | COMPRESSOR >> EQUAL >> string_literal[
                 set_access_group_compressor(self.state)]
             | bloom_filter_option
+            | compaction_policy_option
             ;
 
           bloom_filter_option
@@ -2220,6 +2334,11 @@ namespace Hypertable {
               >> string_literal[set_access_group_bloom_filter(self.state)]
             ;
 
+          compaction_policy_option
+            = COMPACTION_POLICY >> EQUAL
+              >> string_literal[set_access_group_compaction_policy(self.state)]
+            ;
+
           in_memory_option
             = IN_MEMORY
             ;
@@ -2236,12 +2355,39 @@ namespace Hypertable {
 
           select_statement
             = SELECT >> !(CELLS)
-              >> ('*' | (column_predicate >> *(COMMA >> column_predicate)))
+              >> ((aggregate_function >> select_columns >> RPAREN)
+                  | select_columns)
               >> FROM >> user_identifier[set_table_name(self.state)]
               >> !where_clause
+              >> !group_by_clause
               >> *(option_spec)
             ;
 
+          select_columns
+            = '*' | (column_predicate >> *(COMMA >> column_predicate))
+            ;
+
+          aggregate_function
+            = (COUNT >> LPAREN)[scan_set_aggregate(self.state,
+                                     ScanSpec::AGGREGATE_COUNT)]
+            | (SUM >> LPAREN)[scan_set_aggregate(self.state,
+                                   ScanSpec::AGGREGATE_SUM)]
+            | (MIN >> LPAREN)[scan_set_aggregate(self.state,
+                                   ScanSpec::AGGREGATE_MIN)]
+            | (MAX >> LPAREN)[scan_set_aggregate(self.state,
+                                   ScanSpec::AGGREGATE_MAX)]
+            ;
+
+          group_by_clause
+            = GROUP >> BY
+              >> (ROW[scan_set_aggregate_group(self.state,
+                      ScanSpec::AGGREGATE_GROUP_ROW)]
+                  | (COLUMN >> FAMILY)[scan_set_aggregate_group(self.state,
+                      ScanSpec::AGGREGATE_GROUP_COLUMN_FAMILY)]
+                  | QUALIFIER[scan_set_aggregate_group(self.state,
+                      ScanSpec::AGGREGATE_GROUP_QUALIFIER)])
+            ;
+
           column_predicate
             = longest_d[(identifier[scan_add_column_family(self.state, NO_QUALIFIER)])
             | (identifier[scan_add_column_family(self.state, EXACT_QUALIFIER)] >> COLON >>
@@ -2434,9 +2580,14 @@ namespace Hypertable {
           BOOST_SPIRIT_DEBUG_RULE(regexp_literal);
           BOOST_SPIRIT_DEBUG_RULE(ttl_option);
           BOOST_SPIRIT_DEBUG_RULE(counter_option);
+          BOOST_SPIRIT_DEBUG_RULE(merge_operator_option);
+          BOOST_SPIRIT_DEBUG_RULE(select_columns);
+          BOOST_SPIRIT_DEBUG_RULE(aggregate_function);
+          BOOST_SPIRIT_DEBUG_RULE(group_by_clause);
           BOOST_SPIRIT_DEBUG_RULE(access_group_definition);
           BOOST_SPIRIT_DEBUG_RULE(access_group_option);
           BOOST_SPIRIT_DEBUG_RULE(bloom_filter_option);
+          BOOST_SPIRIT_DEBUG_RULE(compaction_policy_option);
           BOOST_SPIRIT_DEBUG_RULE(in_memory_option);
           BOOST_SPIRIT_DEBUG_RULE(blocksize_option);
           BOOST_SPIRIT_DEBUG_RULE(replication_option);
@@ -2472,6 +2623,7 @@ namespace Hypertable {
           BOOST_SPIRIT_DEBUG_RULE(table_option_in_memory);
           BOOST_SPIRIT_DEBUG_RULE(table_option_blocksize);
           BOOST_SPIRIT_DEBUG_RULE(table_option_replication);
+          BOOST_SPIRIT_DEBUG_RULE(table_option_split);
           BOOST_SPIRIT_DEBUG_RULE(get_listing_statement);
           BOOST_SPIRIT_DEBUG_RULE(drop_table_statement);
           BOOST_SPIRIT_DEBUG_RULE(rename_table_statement);
@@ -2520,10 +2672,12 @@ namespace Hypertable {
           create_namespace_statement, use_namespace_statement, drop_namespace_statement,
           identifier, user_identifier, max_versions_option, statement,
           single_string_literal, double_string_literal, string_literal, regexp_literal,
-          ttl_option, counter_option, access_group_definition, access_group_option,
-          bloom_filter_option, in_memory_option,
+          ttl_option, counter_option, merge_operator_option,
+          access_group_definition, access_group_option,
+          bloom_filter_option, compaction_policy_option, in_memory_option,
           blocksize_option, replication_option, help_statement,
           describe_table_statement, show_statement, select_statement,
+          select_columns, aggregate_function, group_by_clause,
           where_clause, where_predicate,
           time_predicate, relop, row_interval, row_predicate, column_predicate,
           value_predicate,
@@ -2531,7 +2685,7 @@ namespace Hypertable {
           load_data_statement, load_data_input, load_data_option, insert_statement,
           insert_value_list, insert_value, delete_statement,
           delete_column_clause, table_option, table_option_in_memory,
-          table_option_blocksize, table_option_replication, get_listing_statement,
+          table_option_blocksize, table_option_replication, table_option_split, get_listing_statement,
           drop_table_statement, alter_table_statement,rename_table_statement,
           load_range_statement,
           dump_statement, dump_where_clause, dump_where_predicate,
@@ -165,6 +165,15 @@ void IntervalScannerAsync::init(const ScanSpec &scan_spec) {
     m_end_row = scan_spec.cell_intervals[0].end_row;
     m_end_inclusive = true;
   }
+  else if (ScanSpec::row_regexp_interval(scan_spec.row_regexp, m_start_row,
+                                         m_end_row)) {
+    // only visit the ranges that can hold rows matching the row regexp
+    if (m_end_row == "")
+      m_end_row = Key::END_ROW_MARKER;
+    m_end_inclusive = false;
+    m_scan_spec_builder.add_row_interval(m_start_row.c_str(), true,
+                                         m_end_row.c_str(), false);
+  }
   else {
     m_start_row = "";
     m_end_row = Key::END_ROW_MARKER;
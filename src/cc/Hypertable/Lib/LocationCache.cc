@@ -170,6 +170,7 @@ bool LocationCache::invalidate(const char * table_name, const char *rowkey) {
     return false;
 
   remove((*iter).second);
+  atomic_inc(&m_invalidations);
   return true;
 }
 
@@ -27,6 +27,7 @@
 #include <map>
 #include <set>
 
+#include "Common/atomic.h"
 #include "Common/Mutex.h"
 #include "Common/FlyweightString.h"
 #include "Common/InetAddr.h"
@@ -97,7 +98,9 @@ namespace Hypertable {
     };
 
     LocationCache(uint32_t max_entries) : m_mutex(), m_location_map(),
-        m_head(0), m_tail(0), m_max_entries(max_entries) { return; }
+        m_head(0), m_tail(0), m_max_entries(max_entries) {
+      atomic_set(&m_invalidations, 0);
+    }
     ~LocationCache();
 
     void insert(const char * table_name, RangeLocationInfo &range_loc_info,
@@ -106,6 +109,13 @@ namespace Hypertable {
                 RangeLocationInfo *rane_loc_infop, bool inclusive=false);
     bool invalidate(const char *table_name, const char *rowkey);
 
+    /**
+     * Returns the number of entries removed by invalidate().  Callers that
+     * remember a looked-up location can compare it to detect staleness
+     * without taking the cache lock.
+     */
+    int invalidation_count() { return atomic_read(&m_invalidations); }
+
     void display(std::ostream &);
 
   private:
@@ -131,6 +141,7 @@ namespace Hypertable {
     Value         *m_tail;
     uint32_t       m_max_entries;
     FlyweightString m_strings;
+    atomic_t       m_invalidations;
   };
 
   typedef intrusive_ptr<LocationCache> LocationCachePtr;
@@ -276,7 +276,8 @@ MasterClient::create_table(const String &tablename, const String &schema,
   initialize(timer, tmp_timer);
 
   while (!timer->expired()) {
-    cbp = MasterProtocol::create_create_table_request(tablename, schema);
+    cbp = MasterProtocol::create_create_table_request(tablename, schema,
+                                                      std::vector<String>());
     if (!send_message(cbp, timer, event, label))
       continue;
     const uint8_t *ptr = event->payload + 4;
@@ -299,6 +300,13 @@ MasterClient::create_table(const String &tablename, const String &schema,
 void
 MasterClient::create_table(const String &tablename, const String &schema,
                            Timer *timer) {
+  create_table(tablename, schema, std::vector<String>(), timer);
+}
+
+
+void
+MasterClient::create_table(const String &tablename, const String &schema,
+                           const std::vector<String> &split_rows, Timer *timer) {
   Timer tmp_timer(m_timeout_ms);
   CommBufPtr cbp;
   EventPtr event;
@@ -308,7 +316,8 @@ MasterClient::create_table(const String &tablename, const String &schema,
   initialize(timer, tmp_timer);
 
   while (!timer->expired()) {
-    cbp = MasterProtocol::create_create_table_request(tablename, schema);
+    cbp = MasterProtocol::create_create_table_request(tablename, schema,
+                                                      split_rows);
     if (!send_message(cbp, timer, event, label))
       continue;
     const uint8_t *ptr = event->payload + 4;
@@ -86,6 +86,8 @@ namespace Hypertable {
                       DispatchHandler *handler, Timer *timer = 0);
     void create_table(const String &tablename, const String &schema,
                       Timer *timer = 0);
+    void create_table(const String &tablename, const String &schema,
+                      const std::vector<String> &split_rows, Timer *timer = 0);
     void alter_table(const String &tablename, const String &schema,
                      DispatchHandler *handler, Timer *timer = 0);
     void alter_table(const String &tablename, const String &schema,
@@ -21,6 +21,7 @@
 
 #include "Common/Compat.h"
 #include "Common/Serialization.h"
+#include "Common/Sweetener.h"
 #include "Common/Time.h"
 
 #include "AsyncComm/CommHeader.h"
@@ -60,12 +61,19 @@ namespace Hypertable {
 
   CommBuf *
   MasterProtocol::create_create_table_request(const String &tablename,
-                                              const String &schemastr) {
+                                              const String &schemastr,
+                                              const std::vector<String> &split_rows) {
     CommHeader header(COMMAND_CREATE_TABLE);
-    CommBuf *cbuf = new CommBuf(header, encoded_length_vstr(tablename)
-        + encoded_length_vstr(schemastr));
+    size_t len = encoded_length_vstr(tablename)
+      + encoded_length_vstr(schemastr) + 4;
+    foreach (const String &row, split_rows)
+      len += encoded_length_vstr(row);
+    CommBuf *cbuf = new CommBuf(header, len);
     cbuf->append_vstr(tablename);
     cbuf->append_vstr(schemastr);
+    cbuf->append_i32(split_rows.size());
+    foreach (const String &row, split_rows)
+      cbuf->append_vstr(row);
     return cbuf;
   }
 
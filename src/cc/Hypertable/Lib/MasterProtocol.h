@@ -22,6 +22,8 @@
 #ifndef MASTER_PROTOCOL_H
 #define MASTER_PROTOCOL_H
 
+#include <vector>
+
 #include "Common/StatsSystem.h"
 
 #include "AsyncComm/CommBuf.h"
@@ -65,7 +67,8 @@ namespace Hypertable {
     static CommBuf *
     create_drop_namespace_request(const String &name, bool if_exists);
     static CommBuf *
-    create_create_table_request(const String &tablename, const String &schemastr);
+    create_create_table_request(const String &tablename, const String &schemastr,
+                                const std::vector<String> &split_rows);
     static CommBuf *
     create_alter_table_request(const String &tablename, const String &schemastr);
 
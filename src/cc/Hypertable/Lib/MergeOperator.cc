@@ -0,0 +1,198 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "Common/MurmurHash.h"
+
+#include "MergeOperator.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Parses a complete decimal integer, returns false for anything else */
+  bool parse_integer(const uint8_t *value, size_t len, int64_t *nump) {
+    char buf[32];
+    char *end;
+    if (len == 0 || len >= sizeof(buf))
+      return false;
+    memcpy(buf, value, len);
+    buf[len] = 0;
+    *nump = strtoll(buf, &end, 10);
+    return *end == 0;
+  }
+
+  /** Returns <0, 0 or >0.  Integers sort before everything else and
+   * compare numerically among themselves, everything else compares
+   * bytewise.  Mixing the two rules per pair would not be a total order
+   * ("2" < "10" < "1a" < "2"), so the result of max/min would depend on
+   * the order in which values are merged.
+   */
+  int compare_values(const uint8_t *a, size_t a_len,
+                     const uint8_t *b, size_t b_len) {
+    int64_t a_num, b_num;
+    bool a_is_num = parse_integer(a, a_len, &a_num);
+    bool b_is_num = parse_integer(b, b_len, &b_num);
+    if (a_is_num && b_is_num)
+      return (a_num < b_num) ? -1 : ((a_num > b_num) ? 1 : 0);
+    if (a_is_num != b_is_num)
+      return a_is_num ? -1 : 1;
+    int cmp = memcmp(a, b, (a_len < b_len) ? a_len : b_len);
+    if (cmp == 0)
+      return (a_len < b_len) ? -1 : ((a_len > b_len) ? 1 : 0);
+    return cmp;
+  }
+
+  class MaxMergeOperator : public MergeOperator {
+  public:
+    virtual const char *name() const { return "max"; }
+    virtual void merge(DynamicBuffer &acc, const uint8_t *older,
+                       size_t older_len) const {
+      if (compare_values(older, older_len, acc.base, acc.fill()) > 0)
+        acc.set(older, older_len);
+    }
+  };
+
+  class MinMergeOperator : public MergeOperator {
+  public:
+    virtual const char *name() const { return "min"; }
+    virtual void merge(DynamicBuffer &acc, const uint8_t *older,
+                       size_t older_len) const {
+      if (compare_values(older, older_len, acc.base, acc.fill()) < 0)
+        acc.set(older, older_len);
+    }
+  };
+
+  /** Concatenates values in timestamp order (oldest first) */
+  class AppendMergeOperator : public MergeOperator {
+  public:
+    virtual const char *name() const { return "append"; }
+    virtual void merge(DynamicBuffer &acc, const uint8_t *older,
+                       size_t older_len) const {
+      DynamicBuffer merged(older_len + acc.fill());
+      merged.add_unchecked(older, older_len);
+      merged.add_unchecked(acc.base, acc.fill());
+      acc.set(merged.base, merged.fill());
+    }
+  };
+
+  /** Approximate distinct count.  Each value is either an item to be
+   * counted or a sketch produced by an earlier merge.  Clients read back
+   * the estimate as a decimal string.
+   */
+  class HllMergeOperator : public MergeOperator {
+  public:
+    virtual const char *name() const { return "hll"; }
+
+    virtual void merge(DynamicBuffer &acc, const uint8_t *older,
+                       size_t older_len) const {
+      uint8_t sketch[HyperLogLog::SKETCH_LENGTH];
+      uint8_t *registers = sketch + HyperLogLog::MAGIC_LENGTH;
+      memcpy(sketch, HyperLogLog::SKETCH_MAGIC, HyperLogLog::MAGIC_LENGTH);
+      memset(registers, 0, HyperLogLog::REGISTER_COUNT);
+      HyperLogLog::add(registers, acc.base, acc.fill());
+      HyperLogLog::add(registers, older, older_len);
+      acc.set(sketch, sizeof(sketch));
+    }
+
+    virtual bool finalize(const uint8_t *value, size_t len,
+                          DynamicBuffer &out) const {
+      uint8_t registers[HyperLogLog::REGISTER_COUNT];
+      memset(registers, 0, sizeof(registers));
+      HyperLogLog::add(registers, value, len);
+      String str = format("%llu", (Llu)HyperLogLog::estimate(registers));
+      out.set(str.c_str(), str.length());
+      return true;
+    }
+  };
+
+  MaxMergeOperator    max_operator;
+  MinMergeOperator    min_operator;
+  AppendMergeOperator append_operator;
+  HllMergeOperator    hll_operator;
+
+  MergeOperator *operators[] = {
+    &max_operator, &min_operator, &append_operator, &hll_operator, 0
+  };
+
+}
+
+
+MergeOperator *MergeOperator::get(const String &name) {
+  for (size_t i=0; operators[i]; i++) {
+    if (!strcasecmp(name.c_str(), operators[i]->name()))
+      return operators[i];
+  }
+  return 0;
+}
+
+
+const char *HyperLogLog::SKETCH_MAGIC = "HLL\001";
+
+bool HyperLogLog::is_sketch(const uint8_t *value, size_t len) {
+  return len == SKETCH_LENGTH && !memcmp(value, SKETCH_MAGIC, MAGIC_LENGTH);
+}
+
+void HyperLogLog::add(uint8_t *registers, const uint8_t *value, size_t len) {
+  if (is_sketch(value, len)) {
+    value += MAGIC_LENGTH;
+    for (size_t i=0; i<REGISTER_COUNT; i++) {
+      if (value[i] > registers[i])
+        registers[i] = value[i];
+    }
+    return;
+  }
+  uint32_t index = murmurhash2(value, len, 0) & (REGISTER_COUNT-1);
+  uint32_t hash = murmurhash2(value, len, 0x9747b28c);
+  uint8_t rank = 1;
+  while (rank <= 32 && (hash & 0x80000000) == 0) {
+    hash <<= 1;
+    rank++;
+  }
+  if (rank > registers[index])
+    registers[index] = rank;
+}
+
+uint64_t HyperLogLog::estimate(const uint8_t *registers) {
+  double m = (double)REGISTER_COUNT;
+  double alpha = 0.7213 / (1.0 + 1.079 / m);
+  double sum = 0.0;
+  size_t zeros = 0;
+
+  for (size_t i=0; i<REGISTER_COUNT; i++) {
+    sum += ldexp(1.0, -(int)registers[i]);
+    if (registers[i] == 0)
+      zeros++;
+  }
+
+  double estimate = alpha * m * m / sum;
+
+  // small range correction (linear counting)
+  if (estimate <= 2.5 * m && zeros > 0)
+    estimate = m * log(m / (double)zeros);
+
+  return (uint64_t)(estimate + 0.5);
+}
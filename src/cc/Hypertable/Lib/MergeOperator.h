@@ -0,0 +1,100 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_MERGEOPERATOR_H
+#define HYPERTABLE_MERGEOPERATOR_H
+
+#include "Common/DynamicBuffer.h"
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /**
+   * Server-side merge operator for a column family.  Cells written to a
+   * column family that has a merge operator are not versioned; instead all
+   * of the values for a given row/column/qualifier are folded into one
+   * value.  Merging happens eagerly when a cell is added to the CellCache,
+   * during compactions, and lazily while scanning, so an operator must be
+   * associative and must not depend on how many values are folded at once.
+   * Operators are stateless singletons looked up by name.
+   */
+  class MergeOperator {
+  public:
+    virtual ~MergeOperator() { }
+
+    virtual const char *name() const = 0;
+
+    /** Folds an older value into the accumulated value.
+     *
+     * @param acc accumulated value, initially the newest value seen
+     * @param older pointer to the older value
+     * @param older_len length of the older value
+     */
+    virtual void merge(DynamicBuffer &acc, const uint8_t *older,
+                       size_t older_len) const = 0;
+
+    /** Converts a fully merged value into the value returned to clients.
+     * The default returns false, meaning the stored value is returned
+     * unchanged.
+     *
+     * @param value pointer to the merged value
+     * @param len length of the merged value
+     * @param out receives the client-visible value
+     * @return true if <code>out</code> was filled in
+     */
+    virtual bool finalize(const uint8_t *value, size_t len,
+                          DynamicBuffer &out) const {
+      return false;
+    }
+
+    /** Returns the operator registered under <code>name</code>
+     * (case-insensitive) or 0 if there is none.
+     */
+    static MergeOperator *get(const String &name);
+  };
+
+  /**
+   * HyperLogLog helpers used by the "hll" merge operator.  A stored value is
+   * either a raw item or a sketch, which is SKETCH_MAGIC followed by
+   * REGISTER_COUNT one-byte registers.
+   */
+  namespace HyperLogLog {
+    enum {
+      PRECISION = 10,
+      REGISTER_COUNT = 1 << PRECISION,
+      MAGIC_LENGTH = 4,
+      SKETCH_LENGTH = MAGIC_LENGTH + REGISTER_COUNT
+    };
+    extern const char *SKETCH_MAGIC;
+
+    bool is_sketch(const uint8_t *value, size_t len);
+
+    /** Adds a raw item or the registers of a sketch to <code>registers</code> */
+    void add(uint8_t *registers, const uint8_t *value, size_t len);
+
+    /** Returns the cardinality estimate for <code>registers</code> */
+    uint64_t estimate(const uint8_t *registers);
+  }
+
+}
+
+#endif // HYPERTABLE_MERGEOPERATOR_H
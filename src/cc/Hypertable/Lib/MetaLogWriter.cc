@@ -39,6 +39,7 @@ using namespace Hypertable::MetaLog;
 namespace {
   const int32_t DFS_BUFFER_SIZE = -1;
   const int64_t DFS_BLOCK_SIZE = -1;
+  const size_t KEEP_LOG_FILES = 10;
 }
 
 bool Writer::skip_recover_entry = false;
@@ -46,7 +47,10 @@ bool Writer::skip_recover_entry = false;
 
 Writer::Writer(FilesystemPtr &fs, DefinitionPtr &definition, const String &path,
                std::vector<EntityPtr> &initial_entities) :
-  m_fs(fs), m_definition(definition), m_offset(0) {
+  m_fs(fs), m_definition(definition), m_fd(-1), m_backup_fd(-1),
+  m_file_id(0), m_next_file_id(0), m_offset(0), m_pending_batch(1),
+  m_pending_count(0), m_durable_batch(0), m_flush_in_progress(false), m_error(Error::OK), m_compacting(false),
+  m_shutdown(false), m_compaction_thread(0) {
 
   HT_EXPECT(Config::properties, Error::FAILED_EXPECTATION);
 
@@ -63,25 +67,22 @@ Writer::Writer(FilesystemPtr &fs, DefinitionPtr &definition, const String &path,
   if (!FileUtils::exists(m_backup_path))
     FileUtils::mkdirs(m_backup_path);
 
+  m_max_file_size = Config::properties->get_i64("Hypertable.MetaLog.MaxFileSize");
+  m_compaction_trigger = m_max_file_size;
+
   std::vector<int32_t> file_ids;
   int32_t next_id;
 
   scan_log_directory(m_fs, m_path, file_ids, &next_id);
 
-  purge_old_log_files(file_ids, 10);
-
-  // get replication
-  int replication = Config::properties->get_i32("Hypertable.Metadata.Replication");
+  purge_old_log_files(file_ids, KEEP_LOG_FILES);
 
-  // Open DFS file
+  m_file_id = next_id;
+  m_next_file_id = next_id + 1;
   m_filename = m_path + "/" + next_id;
-  m_fd = m_fs->create(m_filename, 0, DFS_BUFFER_SIZE, replication, DFS_BLOCK_SIZE);
-
-  // Open backup file
   m_backup_filename = m_backup_path + "/" + next_id;
-  m_backup_fd = ::open(m_backup_filename.c_str(), O_CREAT|O_TRUNC|O_WRONLY, 0644);
-
-  write_header();
+  create_log_file(next_id, &m_fd, &m_backup_fd);
+  m_offset = Header::LENGTH;
 
   // Write existing entries
   foreach (EntityPtr &entity, initial_entities)
@@ -93,6 +94,10 @@ Writer::Writer(FilesystemPtr &fs, DefinitionPtr &definition, const String &path,
     record_state(&recover_entity);
   }
 
+  // A log without a trailing "Recover" entity is treated as incomplete,
+  // so compaction can't be used when those entries are suppressed
+  if (m_max_file_size > 0 && !skip_recover_entry)
+    m_compaction_thread = new Thread(CompactionThread(this));
 }
 
 Writer::~Writer() {
@@ -101,7 +106,24 @@ Writer::~Writer() {
 
 
 void Writer::close() {
+
+  {
+    ScopedLock lock(m_mutex);
+    m_shutdown = true;
+    m_compaction_cond.notify_all();
+  }
+
+  if (m_compaction_thread) {
+    m_compaction_thread->join();
+    delete m_compaction_thread;
+    m_compaction_thread = 0;
+  }
+
   ScopedLock lock(m_mutex);
+
+  while (m_flush_in_progress)
+    m_cond.wait(lock);
+
   try {
     if (m_fd != -1) {
       m_fs->close(m_fd, (DispatchHandler *)0);
@@ -141,7 +163,24 @@ void Writer::purge_old_log_files(std::vector<int32_t> &file_ids, size_t keep_cou
 }
 
 
-void Writer::write_header() {
+void Writer::create_log_file(int32_t file_id, int *fdp, int *backup_fdp) {
+
+  // get replication
+  int replication = Config::properties->get_i32("Hypertable.Metadata.Replication");
+
+  // Open DFS file
+  String filename = m_path + "/" + file_id;
+  *fdp = m_fs->create(filename, 0, DFS_BUFFER_SIZE, replication, DFS_BLOCK_SIZE);
+
+  // Open backup file
+  String backup_filename = m_backup_path + "/" + file_id;
+  *backup_fdp = ::open(backup_filename.c_str(), O_CREAT|O_TRUNC|O_WRONLY, 0644);
+
+  write_header(*fdp, *backup_fdp, filename);
+}
+
+
+void Writer::write_header(int fd, int backup_fd, const String &filename) {
   StaticBuffer buf(Header::LENGTH);
   uint8_t backup_buf[Header::LENGTH];
   Header header;
@@ -159,31 +198,26 @@ void Writer::write_header() {
   assert((ptr-buf.base) == Header::LENGTH);
   memcpy(backup_buf, buf.base, Header::LENGTH);
 
-  if (m_fs->append(m_fd, buf, Filesystem::O_FLUSH) != Header::LENGTH)
+  if (m_fs->append(fd, buf, Filesystem::O_FLUSH) != Header::LENGTH)
     HT_THROWF(Error::DFSBROKER_IO_ERROR, "Error writing %s "
               "metalog header to file: %s", m_definition->name(),
-              m_filename.c_str());
+              filename.c_str());
 
-  FileUtils::write(m_backup_fd, backup_buf, Header::LENGTH);
-  m_offset += Header::LENGTH;
+  FileUtils::write(backup_fd, backup_buf, Header::LENGTH);
 }
 
 
 
 void Writer::record_state(Entity *entity) {
   ScopedLock lock(m_mutex);
-  StaticBuffer buf(EntityHeader::LENGTH + entity->encoded_length());
-  boost::shared_array<uint8_t> backup_buf( new uint8_t [EntityHeader::LENGTH + entity->encoded_length()] );
-  uint8_t *ptr = buf.base;
+  size_t length = EntityHeader::LENGTH + entity->encoded_length();
+  m_pending.ensure(length);
+  uint8_t *base = m_pending.ptr;
 
-  entity->encode_entry( &ptr );
+  entity->encode_entry( &m_pending.ptr );
 
-  HT_ASSERT((ptr-buf.base) == (ptrdiff_t)buf.size);
-  memcpy(backup_buf.get(), buf.base, buf.size);
-
-  m_fs->append(m_fd, buf, Filesystem::O_FLUSH);
-  FileUtils::write(m_backup_fd, backup_buf.get(), buf.size);
-  m_offset += buf.size;
+  HT_ASSERT((size_t)(m_pending.ptr-base) == length);
+  commit(lock);
 }
 
 void Writer::record_state(std::vector<Entity *> &entities) {
@@ -193,68 +227,382 @@ void Writer::record_state(std::vector<Entity *> &entities) {
   for (size_t i=0; i<entities.size(); i++)
     length += EntityHeader::LENGTH + entities[i]->encoded_length();
 
-  {
-    StaticBuffer buf(length);
-    boost::shared_array<uint8_t> backup_buf( new uint8_t [length] );
-    uint8_t *ptr = buf.base;
-
-    for (size_t i=0; i<entities.size(); i++)
-      entities[i]->encode_entry( &ptr );
+  m_pending.ensure(length);
+  uint8_t *base = m_pending.ptr;
 
-    HT_ASSERT((ptr-buf.base) == (ptrdiff_t)buf.size);
-    memcpy(backup_buf.get(), buf.base, buf.size);
+  for (size_t i=0; i<entities.size(); i++)
+    entities[i]->encode_entry( &m_pending.ptr );
 
-    m_fs->append(m_fd, buf, Filesystem::O_FLUSH);
-    FileUtils::write(m_backup_fd, backup_buf.get(), buf.size);
-    m_offset += buf.size;
-  }
+  HT_ASSERT((size_t)(m_pending.ptr-base) == length);
+  commit(lock);
 }
 
 
 void Writer::record_removal(Entity *entity) {
   ScopedLock lock(m_mutex);
-  StaticBuffer buf(EntityHeader::LENGTH);
-  uint8_t backup_buf[EntityHeader::LENGTH];
-  uint8_t *ptr = buf.base;
 
   entity->header.flags |= EntityHeader::FLAG_REMOVE;
   entity->header.length = 0;
   entity->header.checksum = 0;
 
-  entity->header.encode( &ptr );
+  m_pending.ensure(EntityHeader::LENGTH);
+  entity->header.encode( &m_pending.ptr );
+  commit(lock);
+}
+
 
-  HT_ASSERT((ptr-buf.base) == (ptrdiff_t)buf.size);
-  memcpy(backup_buf, buf.base, buf.size);
+void Writer::record_removal(std::vector<Entity *> &entities) {
+  ScopedLock lock(m_mutex);
 
-  m_fs->append(m_fd, buf, Filesystem::O_FLUSH);
-  FileUtils::write(m_backup_fd, backup_buf, buf.size);
-  m_offset += buf.size;
+  m_pending.ensure(entities.size() * EntityHeader::LENGTH);
 
+  for (size_t i=0; i<entities.size(); i++) {
+    entities[i]->header.flags |= EntityHeader::FLAG_REMOVE;
+    entities[i]->header.length = 0;
+    entities[i]->header.checksum = 0;
+    entities[i]->header.encode( &m_pending.ptr );
+  }
+  commit(lock);
 }
 
 
-void Writer::record_removal(std::vector<Entity *> &entities) {
-  ScopedLock lock(m_mutex);
-  size_t length = entities.size() * EntityHeader::LENGTH;
+/**
+ * Waits for the records just added to the pending buffer to become durable.
+ * If no flush is in progress, the caller becomes the leader and writes out
+ * everything that has accumulated in the pending buffer, including records
+ * added by other threads while the previous flush was running.  A failed
+ * append is retried in a new log file; if that fails as well, every caller
+ * in the batch gets the exception and the next batch tries a new file again.
+ */
+void Writer::commit(ScopedLock &lock) {
+  int64_t batch = m_pending_batch;
 
-  {
-    StaticBuffer buf(length);
+  m_pending_count++;
+
+  while (true) {
+
+    FailedBatchMap::iterator iter = m_failed_batches.find(batch);
+    if (iter != m_failed_batches.end()) {
+      int error = iter->second.first;
+      if (--iter->second.second == 0)
+        m_failed_batches.erase(iter);
+      HT_THROWF(error, "Unable to write to metalog %s", m_filename.c_str());
+    }
+
+    if (m_durable_batch >= batch)
+      return;
+
+    if (m_flush_in_progress) {
+      m_cond.wait(lock);
+      continue;
+    }
+
+    HT_ASSERT(batch == m_pending_batch);
+
+    m_flush_in_progress = true;
+
+    size_t count = m_pending_count;
+    m_pending_count = 0;
+    m_pending_batch++;
+    size_t length = m_pending.fill();
     boost::shared_array<uint8_t> backup_buf( new uint8_t [length] );
-    uint8_t *ptr = buf.base;
+    memcpy(backup_buf.get(), m_pending.base, length);
+    StaticBuffer buf(m_pending);
+    int fd = m_fd;
+    int backup_fd = m_backup_fd;
+    bool reopen_needed = m_error != Error::OK;
+
+    lock.unlock();
+    if (!reopen_needed) {
+      try {
+        m_fs->append(fd, buf, Filesystem::O_FLUSH);
+        FileUtils::write(backup_fd, backup_buf.get(), length);
+      }
+      catch (Exception &e) {
+        HT_ERROR_OUT << "Problem writing metalog " << m_filename << " - "
+                     << e << HT_END;
+        reopen_needed = true;
+      }
+    }
+    if (reopen_needed) {
+      try {
+        reopen(backup_buf.get(), length);
+      }
+      catch (Exception &e) {
+        lock.lock();
+        HT_ERROR_OUT << "Problem reopening metalog " << m_path << " - "
+                     << e << HT_END;
+        m_error = e.code();
+        m_failed_batches[batch] = std::make_pair(e.code(), count);
+        m_flush_in_progress = false;
+        m_cond.notify_all();
+        continue;
+      }
+    }
+    lock.lock();
 
-    for (size_t i=0; i<entities.size(); i++) {
-      entities[i]->header.flags |= EntityHeader::FLAG_REMOVE;
-      entities[i]->header.length = 0;
-      entities[i]->header.checksum = 0;
-      entities[i]->header.encode( &ptr );
+    apply_batch(backup_buf.get(), length);
+    if (!reopen_needed)
+      m_offset += length;
+    m_durable_batch = batch;
+    m_flush_in_progress = false;
+
+    if (m_compaction_thread && !m_compacting &&
+        m_offset > m_compaction_trigger)
+      m_compaction_cond.notify_all();
+
+    m_cond.notify_all();
+  }
+}
+
+
+/**
+ * Switches to a new log file holding the live entity records, followed by
+ * <code>batch</code> and a "Recover" entity.  This is how the writer
+ * recovers from a failed append, which may have left a partial record at
+ * the end of the current file.  The caller must hold the flush slot.
+ */
+void Writer::reopen(const uint8_t *batch, size_t len) {
+  int32_t file_id;
+  int fd = -1, backup_fd = -1;
+  DynamicBuffer records;
+
+  {
+    ScopedLock lock(m_mutex);
+    file_id = m_next_file_id++;
+    for (LiveRecordMap::iterator iter = m_live_records.begin();
+         iter != m_live_records.end(); ++iter)
+      records.add(iter->second.data(), iter->second.length());
+  }
+  records.add(batch, len);
+  {
+    EntityRecover recover_entity;
+    records.ensure(EntityHeader::LENGTH);
+    recover_entity.encode_entry(&records.ptr);
+  }
+
+  String filename = m_path + "/" + file_id;
+  String backup_filename = m_backup_path + "/" + file_id;
+  int64_t offset = Header::LENGTH + records.fill();
+
+  try {
+    create_log_file(file_id, &fd, &backup_fd);
+    FileUtils::write(backup_fd, records.base, records.fill());
+    StaticBuffer buf(records);
+    m_fs->append(fd, buf, Filesystem::O_FLUSH);
+  }
+  catch (Exception &e) {
+    // a backup longer than its log file trips up the reader
+    if (backup_fd != -1) {
+      ::close(backup_fd);
+      FileUtils::unlink(backup_filename);
+    }
+    try {
+      if (fd != -1)
+        m_fs->close(fd, (DispatchHandler *)0);
+      m_fs->remove(filename);
     }
+    catch (...) {
+    }
+    throw;
+  }
 
-    HT_ASSERT((ptr-buf.base) == (ptrdiff_t)buf.size);
-    memcpy(backup_buf.get(), buf.base, buf.size);
+  int old_fd, old_backup_fd;
+  {
+    ScopedLock lock(m_mutex);
+    old_fd = m_fd;
+    old_backup_fd = m_backup_fd;
+    m_fd = fd;
+    m_backup_fd = backup_fd;
+    m_file_id = file_id;
+    m_filename = filename;
+    m_backup_filename = backup_filename;
+    m_offset = offset;
+    m_compaction_trigger = std::max(m_max_file_size, 2*offset);
+    m_error = Error::OK;
+  }
 
-    m_fs->append(m_fd, buf, Filesystem::O_FLUSH);
-    FileUtils::write(m_backup_fd, backup_buf.get(), buf.size);
-    m_offset += buf.size;
+  HT_INFOF("Switched %s metalog to %s after a write error",
+           m_definition->name(), filename.c_str());
+
+  try {
+    m_fs->close(old_fd, (DispatchHandler *)0);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
   }
+  ::close(old_backup_fd);
+}
+
+
+/**
+ * Updates the live record map with the records of a batch that has just
+ * been made durable.  While a compaction is running, the batch is also
+ * saved so that it can be appended to the compacted log file.
+ */
+void Writer::apply_batch(const uint8_t *base, size_t len) {
+  const uint8_t *ptr = base;
+  const uint8_t *end = base + len;
+  EntityHeader header;
+
+  while (ptr < end) {
+    const uint8_t *record = ptr;
+    size_t remaining = end - ptr;
+    header.decode(&ptr, &remaining);
+    if (header.flags & EntityHeader::FLAG_REMOVE)
+      m_live_records.erase(header);
+    else {
+      ptr += header.length;
+      if (header.type != EntityType::RECOVER)
+        m_live_records[header] = String((const char *)record, ptr-record);
+    }
+  }
+
+  if (m_compacting)
+    m_compaction_tail.add(base, len);
+}
+
+
+void Writer::compaction_loop() {
+  ScopedLock lock(m_mutex);
 
+  while (true) {
+
+    while (!m_shutdown && (m_compacting || m_offset <= m_compaction_trigger))
+      m_compaction_cond.wait(lock);
+
+    if (m_shutdown)
+      break;
+
+    lock.unlock();
+    compact();
+    lock.lock();
+  }
+}
+
+
+/**
+ * Rewrites the live entity records into a new log file.  The snapshot is
+ * written while records continue to be appended to the current file; those
+ * records are collected in the compaction tail and appended to the new file,
+ * followed by a "Recover" entity, once the flush slot has been acquired.  If
+ * the process dies before the "Recover" entity makes it to disk, the reader
+ * treats the new file as incomplete and falls back to the previous one.
+ */
+void Writer::compact() {
+  int32_t file_id;
+  int fd = -1, backup_fd = -1;
+  DynamicBuffer snapshot;
+  int32_t base_file_id;
+  int64_t old_offset;
+  bool holding_flush_slot = false;
+
+  {
+    ScopedLock lock(m_mutex);
+    file_id = m_next_file_id++;
+    base_file_id = m_file_id;
+    old_offset = m_offset;
+    for (LiveRecordMap::iterator iter = m_live_records.begin();
+         iter != m_live_records.end(); ++iter)
+      snapshot.add(iter->second.data(), iter->second.length());
+    m_compaction_tail.clear();
+    m_compacting = true;
+  }
+
+  String filename = m_path + "/" + file_id;
+  String backup_filename = m_backup_path + "/" + file_id;
+
+  try {
+    int64_t new_offset = Header::LENGTH + snapshot.fill();
+
+    create_log_file(file_id, &fd, &backup_fd);
+
+    if (snapshot.fill()) {
+      FileUtils::write(backup_fd, snapshot.base, snapshot.fill());
+      StaticBuffer buf(snapshot);
+      m_fs->append(fd, buf, 0);
+    }
+
+    DynamicBuffer tail;
+    {
+      ScopedLock lock(m_mutex);
+      while (m_flush_in_progress)
+        m_cond.wait(lock);
+      // a reopen after a write error has already produced a compact file
+      if (m_file_id != base_file_id)
+        HT_THROWF(Error::CANCELLED, "Switched to %s while compacting",
+                  m_filename.c_str());
+      m_flush_in_progress = true;
+      holding_flush_slot = true;
+      tail.add(m_compaction_tail.base, m_compaction_tail.fill());
+      m_compaction_tail.clear();
+    }
+
+    {
+      EntityRecover recover_entity;
+      tail.ensure(EntityHeader::LENGTH);
+      recover_entity.encode_entry(&tail.ptr);
+    }
+    new_offset += tail.fill();
+
+    FileUtils::write(backup_fd, tail.base, tail.fill());
+    StaticBuffer buf(tail);
+    m_fs->append(fd, buf, Filesystem::O_FLUSH);
+
+    int old_fd, old_backup_fd;
+    {
+      ScopedLock lock(m_mutex);
+      old_fd = m_fd;
+      old_backup_fd = m_backup_fd;
+      m_fd = fd;
+      m_backup_fd = backup_fd;
+      m_file_id = file_id;
+      m_filename = filename;
+      m_backup_filename = backup_filename;
+      m_offset = new_offset;
+      m_compaction_trigger = std::max(m_max_file_size, 2*new_offset);
+      m_error = Error::OK;
+      m_compacting = false;
+      m_flush_in_progress = false;
+      holding_flush_slot = false;
+      m_cond.notify_all();
+    }
+
+    HT_INFOF("Compacted %s metalog from %lld to %lld bytes (%s)",
+             m_definition->name(), (Lld)old_offset, (Lld)new_offset,
+             filename.c_str());
+
+    m_fs->close(old_fd, (DispatchHandler *)0);
+    ::close(old_backup_fd);
+
+    std::vector<int32_t> file_ids;
+    int32_t next_id;
+    scan_log_directory(m_fs, m_path, file_ids, &next_id);
+    purge_old_log_files(file_ids, KEEP_LOG_FILES);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << "Problem compacting metalog " << filename << " - "
+                 << e << HT_END;
+    ScopedLock lock(m_mutex);
+    if (m_fd != fd) {
+      try {
+        if (fd != -1)
+          m_fs->close(fd, (DispatchHandler *)0);
+        m_fs->remove(filename);
+      }
+      catch (...) {
+      }
+      if (backup_fd != -1) {
+        ::close(backup_fd);
+        FileUtils::unlink(backup_filename);
+      }
+    }
+    m_compaction_tail.clear();
+    m_compacting = false;
+    m_compaction_trigger = m_offset + m_max_file_size;
+    if (holding_flush_slot) {
+      m_flush_in_progress = false;
+      m_cond.notify_all();
+    }
+  }
 }
@@ -22,12 +22,17 @@
 #ifndef HYPERTABLE_METALOGWRITER_H
 #define HYPERTABLE_METALOGWRITER_H
 
+#include "Common/DynamicBuffer.h"
 #include "Common/Filesystem.h"
 #include "Common/Mutex.h"
 #include "Common/ReferenceCount.h"
+#include "Common/Thread.h"
 
+#include <map>
 #include <vector>
 
+#include <boost/thread/condition.hpp>
+
 #include "MetaLogDefinition.h"
 #include "MetaLogEntity.h"
 
@@ -35,6 +40,17 @@ namespace Hypertable {
 
   namespace MetaLog {
 
+    /**
+     * Appends entity state records to a MetaLog file.  Concurrent callers
+     * are group committed: each record is encoded into a shared pending
+     * buffer and the first caller to find no flush in progress becomes the
+     * leader, writing every pending record with a single append/sync while
+     * the others wait for it to become durable.  Once the file grows past
+     * Hypertable.MetaLog.MaxFileSize, a background thread rewrites the live
+     * entity records into a new log file and switches over to it.  A failed
+     * append may leave a partial record behind, so the batch is written to a
+     * fresh log file instead, the same way.
+     */
     class Writer : public ReferenceCount {
     public:
       Writer(FilesystemPtr &fs, DefinitionPtr &definition, const String &path,
@@ -49,11 +65,31 @@ namespace Hypertable {
       static bool skip_recover_entry;
 
     private:
-      void write_header();
+
+      class CompactionThread {
+      public:
+        CompactionThread(Writer *writer) : m_writer(writer) { }
+        void operator()() { m_writer->compaction_loop(); }
+      private:
+        Writer *m_writer;
+      };
+
+      typedef std::map<EntityHeader, String> LiveRecordMap;
+      // batch -> (error, number of callers yet to be told)
+      typedef std::map<int64_t, std::pair<int, size_t> > FailedBatchMap;
+
+      void write_header(int fd, int backup_fd, const String &filename);
       void purge_old_log_files(std::vector<int32_t> &file_ids, size_t keep_count);
-      void initialize_new_log_file(int32_t next_id);
+      void create_log_file(int32_t file_id, int *fdp, int *backup_fdp);
+      void commit(ScopedLock &lock);
+      void reopen(const uint8_t *batch, size_t len);
+      void apply_batch(const uint8_t *base, size_t len);
+      void compaction_loop();
+      void compact();
 
       Mutex m_mutex;
+      boost::condition m_cond;
+      boost::condition m_compaction_cond;
       FilesystemPtr m_fs;
       DefinitionPtr m_definition;
       String  m_path;
@@ -63,7 +99,29 @@ namespace Hypertable {
       String  m_backup_path;
       String  m_backup_filename;
       int m_backup_fd;
-      int m_offset;
+      int32_t m_file_id;
+      int32_t m_next_file_id;
+      int64_t m_offset;
+
+      // group commit state
+      DynamicBuffer m_pending;
+      int64_t m_pending_batch;
+      size_t m_pending_count;
+      int64_t m_durable_batch;
+      FailedBatchMap m_failed_batches;
+      bool m_flush_in_progress;
+      // error of the last failed append, cleared once the writer has
+      // moved to a new file
+      int m_error;
+
+      // compaction state
+      LiveRecordMap m_live_records;
+      DynamicBuffer m_compaction_tail;
+      bool m_compacting;
+      int64_t m_max_file_size;
+      int64_t m_compaction_trigger;
+      bool m_shutdown;
+      Thread *m_compaction_thread;
     };
     typedef intrusive_ptr<Writer> WriterPtr;
     
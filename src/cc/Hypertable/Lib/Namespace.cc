@@ -108,6 +108,15 @@ void Namespace::create_table(const String &table_name, const String &schema) {
 }
 
 
+void Namespace::create_table(const String &table_name, const String &schema,
+                             const std::vector<String> &split_rows) {
+  String full_name = get_full_name(table_name);
+  std::vector<String> rows(split_rows);
+  TableSplitSpec::normalize(rows);
+  m_master_client->create_table(full_name, schema, rows);
+}
+
+
 void Namespace::alter_table(const String &table_name, const String &alter_schema_str) {
   // Construct a new schema which is a merge of the existing schema
   // and the desired alterations.
@@ -39,6 +39,7 @@
 #include "TableScanner.h"
 #include "TableScannerAsync.h"
 #include "TableSplit.h"
+#include "TableSplitSpec.h"
 #include "TableMutator.h"
 #include "NamespaceListing.h"
 
@@ -126,6 +127,20 @@ namespace Hypertable {
      */
     void create_table(const String &name, const String &schema);
 
+    /**
+     * Creates a table that starts out divided into several ranges.  The
+     * table is split at each of split_rows (which need not be sorted),
+     * so it is created with split_rows.size()+1 ranges that the Master
+     * spreads across the available range servers.  TableSplitSpec can
+     * generate evenly spaced split rows.
+     *
+     * @param name name of the table
+     * @param schema schema definition for the table
+     * @param split_rows rows at which to split the table
+     */
+    void create_table(const String &name, const String &schema,
+                      const std::vector<String> &split_rows);
+
     /**
      * Alters column families within a table.  The schema parameter
      * contains an XML-style schema difference and supports a
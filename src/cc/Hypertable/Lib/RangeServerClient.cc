@@ -734,6 +734,21 @@ void RangeServerClient::phantom_commit_ranges(const CommAddress &addr, int64_t o
              + Protocol::string_format_message(event));
 }
 
+void RangeServerClient::attach_cell_stores(const CommAddress &addr,
+    const TableIdentifier &table, const RangeSpec &range,
+    const std::vector<String> &access_groups, const std::vector<String> &files) {
+  DispatchHandlerSynchronizer sync_handler;
+  EventPtr event;
+  CommBufPtr cbp(RangeServerProtocol::create_request_attach_cell_stores(table,
+      range, access_groups, files));
+  send_message(addr, cbp, &sync_handler, m_default_timeout_ms);
+
+  if (!sync_handler.wait_for_reply(event))
+    HT_THROW((int)Protocol::response_code(event),
+             String("RangeServer attach_cell_stores() failure : ")
+             + Protocol::string_format_message(event));
+}
+
 void
 RangeServerClient::send_message(const CommAddress &addr, CommBufPtr &cbp,
                                 DispatchHandler *handler, uint32_t timeout_ms) {
@@ -679,6 +679,21 @@ namespace Hypertable {
                                const String &location, const vector<QualifiedRangeSpec> &ranges,
                                uint32_t timeout);
 
+    /** Issues an "attach cell stores" request synchronously.  The files are
+     * moved into the range's access group directories and added to the
+     * range without going through the commit log.
+     *
+     * @param addr address of RangeServer
+     * @param table table identifier
+     * @param range range the files were partitioned on
+     * @param access_groups access group of each file
+     * @param files DFS paths of the CellStore files
+     */
+    void attach_cell_stores(const CommAddress &addr, const TableIdentifier &table,
+                            const RangeSpec &range,
+                            const std::vector<String> &access_groups,
+                            const std::vector<String> &files);
+
 
   private:
 
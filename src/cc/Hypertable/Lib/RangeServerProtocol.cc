@@ -59,6 +59,7 @@ namespace Hypertable {
     "phantom update",
     "phantom prepare ranges",
     "phantom commit ranges",
+    "attach cell stores",
     (const char *)0
   };
 
@@ -460,4 +461,23 @@ namespace Hypertable {
     return cbuf;
   }
 
+  CommBuf *RangeServerProtocol::create_request_attach_cell_stores(const TableIdentifier &table,
+      const RangeSpec &range, const std::vector<String> &access_groups,
+      const std::vector<String> &files) {
+    CommHeader header(COMMAND_ATTACH_CELL_STORES);
+    size_t len = table.encoded_length() + range.encoded_length() + 4;
+    for (size_t i=0; i<files.size(); i++)
+      len += Serialization::encoded_length_vstr(access_groups[i]) +
+        Serialization::encoded_length_vstr(files[i]);
+    CommBuf *cbuf = new CommBuf(header, len);
+    table.encode(cbuf->get_data_ptr_address());
+    range.encode(cbuf->get_data_ptr_address());
+    Serialization::encode_i32(cbuf->get_data_ptr_address(), files.size());
+    for (size_t i=0; i<files.size(); i++) {
+      Serialization::encode_vstr(cbuf->get_data_ptr_address(), access_groups[i]);
+      Serialization::encode_vstr(cbuf->get_data_ptr_address(), files[i]);
+    }
+    return cbuf;
+  }
+
 } // namespace Hypertable
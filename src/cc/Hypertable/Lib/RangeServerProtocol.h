@@ -66,7 +66,8 @@ namespace Hypertable {
     static const uint64_t COMMAND_PHANTOM_UPDATE           = 26;
     static const uint64_t COMMAND_PHANTOM_PREPARE_RANGES   = 27;
     static const uint64_t COMMAND_PHANTOM_COMMIT_RANGES    = 28;
-    static const uint64_t COMMAND_MAX                      = 29;
+    static const uint64_t COMMAND_ATTACH_CELL_STORES       = 29;
+    static const uint64_t COMMAND_MAX                      = 30;
 
     static const char *m_command_strings[];
 
@@ -81,7 +82,8 @@ namespace Hypertable {
     enum {
       /* Don't force a commit log sync on update */
       UPDATE_FLAG_NO_LOG_SYNC        = 0x0001,
-      UPDATE_FLAG_IGNORE_UNKNOWN_CFS = 0x0002
+      UPDATE_FLAG_IGNORE_UNKNOWN_CFS = 0x0002,
+      UPDATE_FLAG_COALESCE_UPDATES   = 0x0004
     };
 
     // Flags for
@@ -346,6 +348,18 @@ namespace Hypertable {
         const String &location, const std::vector<QualifiedRangeSpec> &ranges,
         uint32_t timeout_ms);
 
+    /** Creates an "attach cell stores" request message.
+     *
+     * @param table table identifier
+     * @param range range the files were partitioned on
+     * @param access_groups access group of each file
+     * @param files DFS paths of the CellStore files to attach
+     * @return protocol message
+     */
+    static CommBuf *create_request_attach_cell_stores(const TableIdentifier &table,
+        const RangeSpec &range, const std::vector<String> &access_groups,
+        const std::vector<String> &files);
+
     virtual const char *command_text(uint64_t command);
   };
 }
@@ -0,0 +1,163 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include "MergeOperator.h"
+#include "ScanAggregator.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /**
+   * Parses a decimal integer.  Anything else, including values that do not
+   * fit in 64 bits, would silently skew the result, so it is rejected.
+   */
+  int64_t parse_number(const uint8_t *value, size_t len) {
+    char buf[32];
+    char *end;
+    int64_t number;
+
+    if (len == 0 || len >= sizeof(buf))
+      HT_THROWF(Error::BAD_SCAN_SPEC, "Cannot aggregate non-numeric value "
+                "'%s'", String((const char *)value, len).c_str());
+    memcpy(buf, value, len);
+    buf[len] = 0;
+    errno = 0;
+    number = strtoll(buf, &end, 10);
+    if (*end || errno == ERANGE)
+      HT_THROWF(Error::BAD_SCAN_SPEC, "Cannot aggregate non-numeric value "
+                "'%s'", buf);
+    return number;
+  }
+
+}
+
+
+void AggregateValue::add_value(int function, const uint8_t *value, size_t len) {
+  switch (function) {
+  case ScanSpec::AGGREGATE_COUNT:
+    count++;
+    break;
+  case ScanSpec::AGGREGATE_SUM:
+    sum += parse_number(value, len);
+    break;
+  case ScanSpec::AGGREGATE_MIN:
+  case ScanSpec::AGGREGATE_MAX:
+    if (!have_extreme) {
+      extreme.set(value, len);
+      have_extreme = true;
+    }
+    else
+      // MergeOperator merges an older value into the current one, which
+      // for min/max is just a comparison
+      MergeOperator::get(function == ScanSpec::AGGREGATE_MIN ? "min" : "max")
+        ->merge(extreme, value, len);
+    break;
+  default:
+    HT_THROWF(Error::BAD_SCAN_SPEC, "Invalid aggregate function %d", function);
+  }
+}
+
+
+void AggregateValue::add_partial(int function, const uint8_t *value,
+                                 size_t len) {
+  switch (function) {
+  case ScanSpec::AGGREGATE_COUNT:
+    count += (uint64_t)parse_number(value, len);
+    break;
+  default:
+    // SUM, MIN and MAX partials combine the same way as raw values
+    add_value(function, value, len);
+  }
+}
+
+
+void AggregateValue::result(int function, DynamicBuffer &out) const {
+  String str;
+  switch (function) {
+  case ScanSpec::AGGREGATE_COUNT:
+    str = format("%llu", (Llu)count);
+    break;
+  case ScanSpec::AGGREGATE_SUM:
+    str = format("%lld", (Lld)sum);
+    break;
+  default:
+    out.set(extreme.base, extreme.fill());
+    return;
+  }
+  out.set(str.c_str(), str.length());
+}
+
+
+void ScanAggregator::add(const Cell &cell, CellsBuilder &cells) {
+  String key;
+  const char *qualifier = cell.column_qualifier ? cell.column_qualifier : "";
+
+  if (m_group == ScanSpec::AGGREGATE_GROUP_ROW) {
+    key = cell.row_key;
+    if (!m_groups.empty() && m_groups.begin()->first != key)
+      finish(cells);
+  }
+  else if (m_group == ScanSpec::AGGREGATE_GROUP_COLUMN_FAMILY)
+    key = cell.column_family;
+  else
+    key = format("%s:%s", cell.column_family, qualifier);
+
+  // Group holds a DynamicBuffer, so construct it in place
+  GroupMap::iterator iter = m_groups.find(key);
+  Group &group = (iter == m_groups.end()) ? m_groups[key] : iter->second;
+  if (iter == m_groups.end()) {
+    group.row = cell.row_key;
+    group.family = cell.column_family;
+    group.qualifier = qualifier;
+  }
+  group.value.add_partial(m_function, cell.value, cell.value_len);
+  if (cell.timestamp > group.value.timestamp)
+    group.value.timestamp = cell.timestamp;
+}
+
+
+void ScanAggregator::finish(CellsBuilder &cells) {
+  DynamicBuffer buf;
+  Cell cell;
+
+  for (GroupMap::iterator iter = m_groups.begin();
+       iter != m_groups.end(); ++iter) {
+    Group &group = iter->second;
+    group.value.result(m_function, buf);
+    cell.row_key = group.row.c_str();
+    cell.column_family = group.family.c_str();
+    cell.column_qualifier = group.qualifier.c_str();
+    cell.timestamp = group.value.timestamp;
+    cell.revision = group.value.timestamp;
+    cell.value = buf.base;
+    cell.value_len = buf.fill();
+    cell.flag = FLAG_INSERT;
+    cells.add(cell);
+  }
+  m_groups.clear();
+}
@@ -0,0 +1,102 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_SCANAGGREGATOR_H
+#define HYPERTABLE_SCANAGGREGATOR_H
+
+#include <map>
+
+#include "Common/DynamicBuffer.h"
+#include "Common/ReferenceCount.h"
+#include "Common/String.h"
+
+#include "Cells.h"
+#include "ScanSpec.h"
+
+namespace Hypertable {
+
+  /**
+   * Running value of one aggregate group.  The RangeServer folds cell
+   * values in with add_value() and ships result() to the client as a
+   * partial aggregate; the client folds partials from different ranges in
+   * with add_partial().  COUNT and SUM results are ASCII decimal numbers,
+   * MIN and MAX results are the selected value itself.  SUM throws
+   * Error::BAD_SCAN_SPEC for values that are not decimal integers.
+   */
+  class AggregateValue {
+  public:
+    AggregateValue() : count(0), sum(0), timestamp(TIMESTAMP_MIN),
+                       have_extreme(false), extreme(0) { }
+
+    void add_value(int function, const uint8_t *value, size_t len);
+    void add_partial(int function, const uint8_t *value, size_t len);
+    void result(int function, DynamicBuffer &out) const;
+
+    uint64_t count;
+    int64_t sum;
+    int64_t timestamp;
+    bool have_extreme;
+    DynamicBuffer extreme;
+  };
+
+  /**
+   * Combines the partial aggregates returned by the RangeServers for a
+   * scan with ScanSpec::aggregate set.  Rows spanning several ranges or
+   * column family/qualifier groups that appear in several ranges yield one
+   * partial cell per range; this class folds them into one cell per group.
+   * Ranges are scanned in row order, so a row group is complete as soon as
+   * a partial for the next row arrives and is emitted right away.  Column
+   * family and qualifier groups can recur in any range and are only
+   * emitted by finish(); they are few, so holding them is cheap.
+   */
+  class ScanAggregator : public ReferenceCount {
+  public:
+    ScanAggregator(const ScanSpec &spec)
+      : m_function(spec.aggregate), m_group(spec.aggregate_group) { }
+
+    /**
+     * Folds in one partial aggregate cell, appending any groups it
+     * completes to <code>cells</code>
+     */
+    void add(const Cell &cell, CellsBuilder &cells);
+
+    /** Appends the remaining groups, in group order, to <code>cells</code> */
+    void finish(CellsBuilder &cells);
+
+  private:
+    struct Group {
+      String row;
+      String family;
+      String qualifier;
+      AggregateValue value;
+    };
+    typedef std::map<String, Group> GroupMap;
+
+    int m_function;
+    int m_group;
+    GroupMap m_groups;
+  };
+  typedef intrusive_ptr<ScanAggregator> ScanAggregatorPtr;
+
+}
+
+#endif // HYPERTABLE_SCANAGGREGATOR_H
@@ -26,6 +26,8 @@
 #include <cstring>
 #include <iostream>
 
+#include <re2/re2.h>
+
 #include "Common/Serialization.h"
 
 #include "KeySpec.h"
@@ -95,7 +97,7 @@ size_t ScanSpec::encoded_length() const {
   foreach(const RowInterval &ri, row_intervals) len += ri.encoded_length();
   foreach(const CellInterval &ci, cell_intervals) len += ci.encoded_length();
 
-  return len + 8 + 8 + 3;
+  return len + 8 + 8 + 3 + 2;
 }
 
 void ScanSpec::encode(uint8_t **bufp) const {
@@ -116,6 +118,8 @@ void ScanSpec::encode(uint8_t **bufp) const {
   encode_vstr(bufp, row_regexp);
   encode_vstr(bufp, value_regexp);
   encode_bool(bufp, scan_and_filter_rows);
+  encode_i8(bufp, aggregate);
+  encode_i8(bufp, aggregate_group);
 }
 
 void ScanSpec::decode(const uint8_t **bufp, size_t *remainp) {
@@ -142,7 +146,9 @@ void ScanSpec::decode(const uint8_t **bufp, size_t *remainp) {
     keys_only = decode_bool(bufp, remainp);
     row_regexp = decode_vstr(bufp, remainp);
     value_regexp = decode_vstr(bufp, remainp);
-    scan_and_filter_rows = decode_bool(bufp, remainp));
+    scan_and_filter_rows = decode_bool(bufp, remainp);
+    aggregate = decode_i8(bufp, remainp);
+    aggregate_group = decode_i8(bufp, remainp));
 }
 
 
@@ -201,6 +207,9 @@ ostream &Hypertable::operator<<(ostream &os, const ScanSpec &scan_spec) {
   os << " row_regexp=" << scan_spec.row_regexp;
   os << " value_regexp=" << scan_spec.value_regexp;
   os << " scan_and_filter_rows=" << scan_spec.scan_and_filter_rows;
+  if (scan_spec.aggregate != ScanSpec::AGGREGATE_NONE)
+    os << " aggregate=" << (int)scan_spec.aggregate
+       << " aggregate_group=" << (int)scan_spec.aggregate_group;
 
   if (!scan_spec.row_intervals.empty()) {
     os << "\n rows=";
@@ -231,7 +240,8 @@ ScanSpec::ScanSpec(CharArena &arena, const ScanSpec &ss)
     cell_intervals(CellIntervalAlloc(arena)),
     time_interval(ss.time_interval.first, ss.time_interval.second),
     return_deletes(ss.return_deletes), keys_only(ss.keys_only),
-    scan_and_filter_rows(ss.scan_and_filter_rows) {
+    scan_and_filter_rows(ss.scan_and_filter_rows), aggregate(ss.aggregate),
+    aggregate_group(ss.aggregate_group) {
   columns.reserve(ss.columns.size());
   row_intervals.reserve(ss.row_intervals.size());
   cell_intervals.reserve(ss.cell_intervals.size());
@@ -276,3 +286,83 @@ void ScanSpec::parse_column(const char *column_str, String &family, String &qual
   }
 }
 
+
+namespace {
+
+  /** Returns true if every top-level alternative of regexp begins with '^' */
+  bool anchored_at_start(const char *regexp) {
+    int depth = 0;
+    bool in_class = false;
+
+    if (*regexp != '^')
+      return false;
+
+    for (const char *ptr = regexp; *ptr; ptr++) {
+      if (*ptr == '\\') {
+        // give up on \Q...\E quoting rather than track it
+        if (*++ptr == 0 || *ptr == 'Q')
+          return false;
+      }
+      else if (in_class) {
+        if (*ptr == ']')
+          in_class = false;
+      }
+      else if (*ptr == '[') {
+        in_class = true;
+        // a leading ']' (or '^]') is a literal member of the class
+        if (ptr[1] == '^')
+          ptr++;
+        if (ptr[1] == ']')
+          ptr++;
+      }
+      else if (*ptr == '(')
+        depth++;
+      else if (*ptr == ')')
+        depth--;
+      else if (*ptr == '|' && depth == 0 && ptr[1] != '^')
+        return false;
+    }
+    return true;
+  }
+
+}
+
+bool ScanSpec::row_regexp_interval(const char *regexp, String &start_row,
+                                   String &end_row) {
+  String min_row, max_row;
+
+  start_row.clear();
+  end_row.clear();
+
+  if (regexp == 0 || !anchored_at_start(regexp))
+    return false;
+
+  RE2 re(regexp, RE2::Quiet);
+  if (!re.ok() || !re.PossibleMatchRange(&min_row, &max_row, 256))
+    return false;
+
+  /**
+   * PossibleMatchRange() bounds anchored matches only, while rows are
+   * matched with PartialMatch() which allows any trailing characters.
+   * The common prefix of the two bounds is shared by every anchored match
+   * and therefore by every row that contains one.
+   */
+  size_t len = 0;
+  while (len < min_row.length() && len < max_row.length()
+         && min_row[len] == max_row[len])
+    len++;
+
+  if (len == 0)
+    return false;
+
+  start_row = min_row.substr(0, len);
+
+  // end_row is the smallest string greater than all strings with the prefix
+  end_row = start_row;
+  while (!end_row.empty() && (uint8_t)end_row[end_row.length()-1] == 0xff)
+    end_row.resize(end_row.length()-1);
+  if (!end_row.empty())
+    end_row[end_row.length()-1] = (char)((uint8_t)end_row[end_row.length()-1] + 1);
+
+  return true;
+}
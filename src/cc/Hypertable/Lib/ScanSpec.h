@@ -102,18 +102,36 @@ typedef std::vector<const char *, CstrAlloc> CstrColumns;
  */
 class ScanSpec {
 public:
+  /** Aggregate functions that can be evaluated on the RangeServer */
+  enum {
+    AGGREGATE_NONE = 0,
+    AGGREGATE_COUNT,
+    AGGREGATE_SUM,
+    AGGREGATE_MIN,
+    AGGREGATE_MAX
+  };
+
+  /** How aggregated cells are grouped */
+  enum {
+    AGGREGATE_GROUP_ROW = 0,
+    AGGREGATE_GROUP_COLUMN_FAMILY,
+    AGGREGATE_GROUP_QUALIFIER
+  };
+
   ScanSpec()
     : row_limit(0), cell_limit(0), cell_limit_per_family(0), max_versions(0),
       time_interval(TIMESTAMP_MIN, TIMESTAMP_MAX),
       return_deletes(false), keys_only(false),
-      row_regexp(0), value_regexp(0),scan_and_filter_rows(false) { }
+      row_regexp(0), value_regexp(0),scan_and_filter_rows(false),
+      aggregate(AGGREGATE_NONE), aggregate_group(AGGREGATE_GROUP_ROW) { }
   ScanSpec(CharArena &arena)
     : row_limit(0), cell_limit(0), cell_limit_per_family(0), max_versions(0), columns(CstrAlloc(arena)),
       row_intervals(RowIntervalAlloc(arena)),
       cell_intervals(CellIntervalAlloc(arena)),
       time_interval(TIMESTAMP_MIN, TIMESTAMP_MAX),
       return_deletes(false), keys_only(false),
-      row_regexp(0), value_regexp(0), scan_and_filter_rows(false) { }
+      row_regexp(0), value_regexp(0), scan_and_filter_rows(false),
+      aggregate(AGGREGATE_NONE), aggregate_group(AGGREGATE_GROUP_ROW) { }
   ScanSpec(CharArena &arena, const ScanSpec &);
   ScanSpec(const uint8_t **bufp, size_t *remainp) { decode(bufp, remainp); }
 
@@ -136,6 +154,8 @@ public:
     row_regexp = 0;
     value_regexp = 0;
     scan_and_filter_rows = false;
+    aggregate = AGGREGATE_NONE;
+    aggregate_group = AGGREGATE_GROUP_ROW;
   }
 
   /** Initialize 'other' ScanSpec with this copy sans the intervals */
@@ -153,6 +173,8 @@ public:
     other.row_regexp = row_regexp;
     other.value_regexp = value_regexp;
     other.scan_and_filter_rows = scan_and_filter_rows;
+    other.aggregate = aggregate;
+    other.aggregate_group = aggregate_group;
   }
 
   bool cacheable() {
@@ -194,6 +216,23 @@ public:
    */
   static void parse_column(const char *column, String &family, String &qualifier, bool *has_qualifier, bool *regexp);
 
+  /**
+   * Computes the literal prefix that every row matched by the given row
+   * regexp must begin with.  A prefix is only derived when every top-level
+   * alternative of the regexp is anchored with '^', since an unanchored
+   * regexp can match anywhere in the row.  All rows matched by the regexp
+   * fall into the interval [<code>start_row</code>, <code>end_row</code>);
+   * <code>end_row</code> is set to the empty string if the interval is
+   * unbounded above.
+   *
+   * @param regexp row regexp
+   * @param start_row inclusive start of the matching row interval
+   * @param end_row exclusive end of the matching row interval
+   * @return true if a non-empty prefix was found, false otherwise
+   */
+  static bool row_regexp_interval(const char *regexp, String &start_row,
+                                  String &end_row);
+
   void add_row(CharArena &arena, const char *str) {
     if (cell_intervals.size())
       HT_THROW(Error::BAD_SCAN_SPEC, "cell spec excludes rows");
@@ -271,6 +310,15 @@ public:
     time_interval.second = end;
   }
 
+  void set_aggregate(int function, int group) {
+    if (function < AGGREGATE_NONE || function > AGGREGATE_MAX)
+      HT_THROWF(Error::BAD_SCAN_SPEC, "Invalid aggregate function %d", function);
+    if (group < AGGREGATE_GROUP_ROW || group > AGGREGATE_GROUP_QUALIFIER)
+      HT_THROWF(Error::BAD_SCAN_SPEC, "Invalid aggregate grouping %d", group);
+    aggregate = (uint8_t)function;
+    aggregate_group = (uint8_t)group;
+  }
+
   int32_t row_limit;
   int32_t cell_limit;
   int32_t cell_limit_per_family;
@@ -284,6 +332,8 @@ public:
   const char *row_regexp;
   const char *value_regexp;
   bool scan_and_filter_rows;
+  uint8_t aggregate;
+  uint8_t aggregate_group;
 };
 
 /**
@@ -450,6 +500,22 @@ public:
     m_scan_spec.scan_and_filter_rows = val;
   }
 
+  /**
+   * Evaluates an aggregate function on the RangeServers instead of
+   * returning the matching cells.  The result is one cell per group whose
+   * value is the aggregate (as an ASCII number for COUNT and SUM).  Key
+   * fields that are not part of the grouping are empty, except that row
+   * groups carry the column family of their first cell.
+   *
+   * @param function one of ScanSpec::AGGREGATE_COUNT, AGGREGATE_SUM,
+   *        AGGREGATE_MIN or AGGREGATE_MAX
+   * @param group one of ScanSpec::AGGREGATE_GROUP_ROW,
+   *        AGGREGATE_GROUP_COLUMN_FAMILY or AGGREGATE_GROUP_QUALIFIER
+   */
+  void set_aggregate(int function, int group) {
+    m_scan_spec.set_aggregate(function, group);
+  }
+
   /**
    * Clears the state.
    */
@@ -72,15 +72,21 @@ Mutex desc_mutex;
 bool desc_inited = false;
 
 PropertiesDesc
-  compressor_desc("  bmz|lzo|quicklz|zlib|snappy|none [compressor_options]\n\n"
+  compressor_desc("  bmz|lzo|quicklz|zlib|snappy|auto|none [compressor_options]\n\n"
       "compressor_options"),
-  bloom_filter_desc("  rows|rows+cols|none [bloom_filter_options]\n\n"
+  bloom_filter_desc("  rows|rows+cols|rows-prefix|none [bloom_filter_options]\n\n"
       "  Default bloom filter is defined by the config property:\n"
       "  Hypertable.RangeServer.CellStore.DefaultBloomFilter.\n\n"
-      "bloom_filter_options");
+      "bloom_filter_options"),
+  compaction_policy_desc("  merge-run|size-tiered|time-window [compaction_policy_options]\n\n"
+      "  Default compaction policy is defined by the config property:\n"
+      "  Hypertable.RangeServer.AccessGroup.DefaultCompactionPolicy.\n\n"
+      "compaction_policy_options");
 
-PropertiesDesc compressor_hidden_desc, bloom_filter_hidden_desc;
-PositionalDesc compressor_pos_desc, bloom_filter_pos_desc;
+PropertiesDesc compressor_hidden_desc, bloom_filter_hidden_desc,
+  compaction_policy_hidden_desc;
+PositionalDesc compressor_pos_desc, bloom_filter_pos_desc,
+  compaction_policy_pos_desc;
 
 void init_schema_options_desc() {
   ScopedLock lock(desc_mutex);
@@ -93,10 +99,14 @@ void init_schema_options_desc() {
     ("normal", "Normal setting for zlib")
     ("fp-len", i16()->default_value(19), "Minimum fingerprint length for bmz")
     ("offset", i16()->default_value(0), "Starting fingerprint offset for bmz")
+    ("objective", str(), "Codec selection objective for auto "
+        "(speed|balanced|space)")
+    ("sample-interval", i32(), "Number of blocks between codec selection "
+        "samples for auto")
     ;
   compressor_hidden_desc.add_options()
     ("compressor-type", str(), 
-        "Compressor type (bmz|lzo|quicklz|zlib|snappy|none)")
+        "Compressor type (bmz|lzo|quicklz|zlib|snappy|auto|none)")
     ;
   compressor_pos_desc.add("compressor-type", 1);
 
@@ -109,11 +119,34 @@ void init_schema_options_desc() {
      "probability for the Bloom filter")
     ("max-approx-items", i32()->default_value(1000), "Number of cell store "
         "items used to guess the number of actual Bloom filter entries")
+    ("prefix-length", i32(), "Number of leading row key bytes hashed "
+        "by the rows-prefix Bloom filter")
+    ("prefix-delimiter", str(), "Character terminating the row key prefix "
+        "hashed by the rows-prefix Bloom filter")
     ;
   bloom_filter_hidden_desc.add_options()
-    ("bloom-filter-mode", str(), "Bloom filter mode (rows|rows+cols|none)")
+    ("bloom-filter-mode", str(), "Bloom filter mode "
+        "(rows|rows+cols|rows-prefix|none)")
     ;
   bloom_filter_pos_desc.add("bloom-filter-mode", 1);
+
+  compaction_policy_desc.add_options()
+    ("size-ratio", f64()->default_value(4.0), "Maximum ratio between the "
+        "largest and smallest CellStore merged together by size-tiered")
+    ("min-stores", i32()->default_value(4), "Minimum number of similarly "
+        "sized CellStores merged together by size-tiered, or of CellStores "
+        "in the current window merged together by time-window")
+    ("max-stores", i32()->default_value(10), "Number of CellStores above "
+        "which size-tiered merges the smallest adjacent ones regardless of "
+        "size ratio")
+    ("window", i32()->default_value(86400), "Width in seconds of the "
+        "time windows that time-window groups CellStores into")
+    ;
+  compaction_policy_hidden_desc.add_options()
+    ("compaction-policy", str(), "Compaction policy "
+        "(merge-run|size-tiered|time-window)")
+    ;
+  compaction_policy_pos_desc.add("compaction-policy", 1);
   desc_inited = true;
 }
 
@@ -144,6 +177,7 @@ Schema::Schema(const Schema &src_schema)
   m_need_id_assignment = src_schema.m_need_id_assignment;
   m_output_ids = src_schema.m_output_ids;
   m_counter_flags = src_schema.m_counter_flags;
+  m_merge_operators = src_schema.m_merge_operators;
 
   // Create access groups
   foreach(const AccessGroup *src_ag, src_schema.m_access_groups) {
@@ -155,6 +189,7 @@ Schema::Schema(const Schema &src_schema)
     ag->blocksize = src_ag->blocksize;
     ag->compressor = src_ag->compressor;
     ag->bloom_filter = src_ag->bloom_filter;
+    ag->compaction_policy = src_ag->compaction_policy;
 
     m_access_group_map.insert(make_pair(ag->name, ag));
     m_access_groups.push_back(ag);
@@ -240,6 +275,25 @@ Schema::parse_bloom_filter(const String &bloom_filter, PropertiesPtr &props) {
            || mode == "rows-cols" || mode == "row-col"
            || mode == "rows_cols" || mode == "row_col")
     props->set("bloom-filter-mode", BLOOM_FILTER_ROWS_COLS);
+  else if (mode == "rows-prefix" || mode == "row-prefix"
+           || mode == "rows_prefix" || mode == "row_prefix") {
+    bool has_length = props->has("prefix-length");
+    bool has_delimiter = props->has("prefix-delimiter");
+    if (has_length == has_delimiter)
+      HT_THROW(Error::BAD_SCHEMA, "rows-prefix bloom filter requires exactly "
+               "one of --prefix-length or --prefix-delimiter");
+    if (has_length) {
+      int32_t length = props->get_i32("prefix-length");
+      if (length <= 0 || length > 65535)
+        HT_THROWF(Error::BAD_SCHEMA, "invalid bloom filter prefix length: %d",
+                  (int)length);
+    }
+    else if (props->get_str("prefix-delimiter").length() != 1)
+      HT_THROWF(Error::BAD_SCHEMA, "bloom filter prefix delimiter must be a "
+                "single character: '%s'",
+                props->get_str("prefix-delimiter").c_str());
+    props->set("bloom-filter-mode", BLOOM_FILTER_ROWS_PREFIX);
+  }
   else HT_THROWF(Error::BAD_SCHEMA, "unknown bloom filter mode: '%s'",
                  mode.c_str());
 }
@@ -251,6 +305,55 @@ const PropertiesDesc &Schema::bloom_filter_spec_desc() {
 }
 
 
+void
+Schema::parse_compaction_policy(const String &policy, PropertiesPtr &props) {
+  init_schema_options_desc();
+
+  vector<String> args;
+
+  boost::split(args, policy, boost::is_any_of(" \t"));
+  HT_TRY("parsing compaction policy spec",
+    props->parse_args(args, compaction_policy_desc,
+                      &compaction_policy_hidden_desc,
+                      &compaction_policy_pos_desc));
+
+  String name = props->get_str("compaction-policy");
+
+  if (name == "merge-run" || name == "merge_run")
+    props->set("compaction-policy", String("merge-run"));
+  else if (name == "size-tiered" || name == "size_tiered") {
+    if (props->get_f64("size-ratio") <= 1.0)
+      HT_THROWF(Error::BAD_SCHEMA, "compaction policy size ratio must be "
+                "greater than 1: %f", props->get_f64("size-ratio"));
+    if (props->get_i32("min-stores") < 2)
+      HT_THROWF(Error::BAD_SCHEMA, "compaction policy min stores must be at "
+                "least 2: %d", (int)props->get_i32("min-stores"));
+    if (props->get_i32("max-stores") < props->get_i32("min-stores"))
+      HT_THROWF(Error::BAD_SCHEMA, "compaction policy max stores (%d) is "
+                "less than min stores (%d)", (int)props->get_i32("max-stores"),
+                (int)props->get_i32("min-stores"));
+    props->set("compaction-policy", String("size-tiered"));
+  }
+  else if (name == "time-window" || name == "time_window") {
+    if (props->get_i32("window") <= 0)
+      HT_THROWF(Error::BAD_SCHEMA, "compaction policy window must be "
+                "positive: %d", (int)props->get_i32("window"));
+    if (props->get_i32("min-stores") < 2)
+      HT_THROWF(Error::BAD_SCHEMA, "compaction policy min stores must be at "
+                "least 2: %d", (int)props->get_i32("min-stores"));
+    props->set("compaction-policy", String("time-window"));
+  }
+  else HT_THROWF(Error::BAD_SCHEMA, "unknown compaction policy: '%s'",
+                 name.c_str());
+}
+
+
+const PropertiesDesc &Schema::compaction_policy_spec_desc() {
+  init_schema_options_desc();
+  return compaction_policy_desc;
+}
+
+
 void Schema::validate_compressor(const String &compressor) {
   if (compressor.empty())
     return;
@@ -283,6 +386,22 @@ void Schema::validate_bloom_filter(const String &bloom_filter) {
 }
 
 
+void Schema::validate_compaction_policy(const String &compaction_policy) {
+  if (compaction_policy.empty())
+    return;
+
+  try {
+    PropertiesPtr props = new Properties();
+    parse_compaction_policy(compaction_policy, props);
+  }
+  catch (Exception &e) {
+    ostringstream oss;
+    oss << e;
+    set_error_string(oss.str());
+  }
+}
+
+
 /**
  */
 void Schema::start_element_handler(void *userdata,
@@ -324,7 +443,8 @@ void Schema::start_element_handler(void *userdata,
   else if (!strcasecmp(name, "MaxVersions") || !strcasecmp(name, "ttl")
            || !strcasecmp(name, "Name") || !strcasecmp(name, "Generation")
            || !strcasecmp(name, "deleted") || !strcasecmp(name, "renamed")
-           || !strcasecmp(name, "NewName") || !strcasecmp(name, "Counter"))
+           || !strcasecmp(name, "NewName") || !strcasecmp(name, "Counter")
+           || !strcasecmp(name, "MergeOperator"))
     ms_collected_text = "";
   else
     ms_schema->set_error_string(format("Unrecognized element - '%s'", name));
@@ -341,7 +461,8 @@ void Schema::end_element_handler(void *userdata, const XML_Char *name) {
   else if (!strcasecmp(name, "MaxVersions") || !strcasecmp(name, "ttl")
            || !strcasecmp(name, "Name") || !strcasecmp(name, "Generation")
            || !strcasecmp(name, "deleted") || !strcasecmp(name, "renamed")
-           || !strcasecmp(name, "NewName") || !strcasecmp(name, "Counter")) {
+           || !strcasecmp(name, "NewName") || !strcasecmp(name, "Counter")
+           || !strcasecmp(name, "MergeOperator")) {
     boost::trim(ms_collected_text);
     ms_schema->set_column_family_parameter(name, ms_collected_text.c_str());
   }
@@ -428,6 +549,7 @@ void Schema::close_column_family() {
               m_counter_flags.resize(256);
             m_counter_flags[m_open_column_family->id] = 1;
           }
+          set_merge_operator_flag(m_open_column_family);
         }
         m_open_access_group->columns.push_back(m_open_column_family);
         m_column_families.push_back(m_open_column_family);
@@ -490,6 +612,11 @@ void Schema::set_access_group_parameter(const char *param, const char *value) {
       boost::trim(m_open_access_group->bloom_filter);
       validate_bloom_filter(m_open_access_group->bloom_filter);
     }
+    else if (!strcasecmp(param, "compactionPolicy")) {
+      m_open_access_group->compaction_policy = value;
+      boost::trim(m_open_access_group->compaction_policy);
+      validate_compaction_policy(m_open_access_group->compaction_policy);
+    }
     else
       set_error_string((string)"Invalid AccessGroup attribute '" + param + "'");
   }
@@ -535,6 +662,11 @@ void Schema::set_column_family_parameter(const char *param, const char *value) {
       else
         m_open_column_family->counter = false;
     }
+    else if (!strcasecmp(param, "MergeOperator")) {
+      m_open_column_family->merge_operator = value;
+      if (*value && MergeOperator::get(value) == 0)
+        set_error_string(format("Unknown merge operator '%s'", value));
+    }
     else if (!strcasecmp(param, "id")) {
       m_open_column_family->id = atoi(value);
       if (m_open_column_family->id == 0)
@@ -606,11 +738,26 @@ void Schema::assign_ids() {
         m_counter_flags.resize(256);
       m_counter_flags[cf->id] = 1;
     }
+    set_merge_operator_flag(cf);
   }
   m_need_id_assignment = false;
 }
 
 
+void Schema::set_merge_operator_flag(ColumnFamily *cf) {
+  if (cf->merge_operator.empty())
+    return;
+  if (cf->counter) {
+    set_error_string(format("Column family '%s' cannot be both a counter and "
+                            "have a merge operator", cf->name.c_str()));
+    return;
+  }
+  if (m_merge_operators.empty())
+    m_merge_operators.resize(256, 0);
+  m_merge_operators[cf->id] = MergeOperator::get(cf->merge_operator);
+}
+
+
 void Schema::render(String &output, bool with_ids) {
   if (!is_valid()) {
     output = m_error_string;
@@ -651,6 +798,9 @@ void Schema::render(String &output, bool with_ids) {
     if (ag->bloom_filter != "")
       output += (String)" bloomFilter=\"" + ag->bloom_filter + "\"";
 
+    if (ag->compaction_policy != "")
+      output += (String)" compactionPolicy=\"" + ag->compaction_policy + "\"";
+
     output += ">\n";
 
     foreach(const ColumnFamily *cf, ag->columns) {
@@ -670,6 +820,10 @@ void Schema::render(String &output, bool with_ids) {
       else
         output += format("      <Counter>false</Counter>\n");
 
+      if (!cf->merge_operator.empty())
+        output += format("      <MergeOperator>%s</MergeOperator>\n",
+                         cf->merge_operator.c_str());
+
       if (cf->max_versions != 0)
         output += format("      <MaxVersions>%u</MaxVersions>\n",
                          cf->max_versions);
@@ -727,6 +881,9 @@ void Schema::render_hql_create_table(const String &table_name, String &output) {
     if (cf->counter)
       output += format(" COUNTER");
 
+    if (!cf->merge_operator.empty())
+      output += format(" MERGE_OPERATOR=%s", cf->merge_operator.c_str());
+
     if (cf->ttl != 0)
       output += format(" TTL=%d", (int)cf->ttl);
 
@@ -762,6 +919,10 @@ void Schema::render_hql_create_table(const String &table_name, String &output) {
       ag_string += format(" BLOOMFILTER=\"%s\"",
           ag->bloom_filter.c_str());
 
+    if (ag->compaction_policy != "")
+      ag_string += format(" COMPACTION_POLICY=\"%s\"",
+          ag->compaction_policy.c_str());
+
     if (!ag->columns.empty()) {
       bool display_comma = false;
       ag_string += " (";
@@ -32,20 +32,24 @@
 #include "Common/HashMap.h"
 #include "Common/Properties.h"
 
+#include "MergeOperator.h"
+
 
 namespace Hypertable {
 
   enum BloomFilterMode {
     BLOOM_FILTER_DISABLED,
     BLOOM_FILTER_ROWS,
-    BLOOM_FILTER_ROWS_COLS
+    BLOOM_FILTER_ROWS_COLS,
+    BLOOM_FILTER_ROWS_PREFIX
   };
 
   class Schema : public ReferenceCount {
   public:
     struct ColumnFamily {
       ColumnFamily() : name(), ag(), id(0), max_versions(0), ttl(0), generation(0),
-                       deleted(false), renamed(false), new_name(), counter(false) { return; }
+                       deleted(false), renamed(false), new_name(), counter(false),
+                       merge_operator() { return; }
       String   name;
       String   ag;
       uint32_t id;
@@ -56,13 +60,14 @@ namespace Hypertable {
       bool renamed;
       String new_name;
       bool counter;
+      String merge_operator;
     };
 
     typedef std::vector<ColumnFamily *> ColumnFamilies;
 
     struct AccessGroup {
       AccessGroup() : name(), in_memory(false), counter(false), replication(-1), blocksize(0),
-          bloom_filter(), columns() { }
+          bloom_filter(), compaction_policy(), columns() { }
 
       String   name;
       bool     in_memory;
@@ -71,6 +76,7 @@ namespace Hypertable {
       uint32_t blocksize;
       String compressor;
       String bloom_filter;
+      String compaction_policy;
       ColumnFamilies columns;
     };
 
@@ -90,12 +96,17 @@ namespace Hypertable {
     void validate_bloom_filter(const String &spec);
     static const PropertiesDesc &bloom_filter_spec_desc();
 
+    static void parse_compaction_policy(const String &spec, PropertiesPtr &);
+    void validate_compaction_policy(const String &spec);
+    static const PropertiesDesc &compaction_policy_spec_desc();
+
     void open_access_group();
     void close_access_group();
     void open_column_family();
     void close_column_family();
     void set_access_group_parameter(const char *param, const char *value);
     void set_column_family_parameter(const char *param, const char *value);
+    void set_merge_operator_flag(ColumnFamily *cf);
 
     void assign_ids();
     bool need_id_assignment() { return m_need_id_assignment; }
@@ -165,6 +176,13 @@ namespace Hypertable {
       return !m_counter_flags.empty() && (m_counter_flags[family] == 1);
     }
 
+    /** Returns the merge operator for the column family or 0 if its cells
+     * are versioned normally
+     */
+    MergeOperator *get_merge_operator(uint8_t family) {
+      return m_merge_operators.empty() ? 0 : m_merge_operators[family];
+    }
+
     void set_compressor(const String &compressor) { m_compressor = compressor; }
     const String &get_compressor() { return m_compressor; }
 
@@ -194,6 +212,7 @@ namespace Hypertable {
     size_t         m_max_column_family_id;
     String         m_compressor;
     std::vector<int>  m_counter_flags;
+    std::vector<MergeOperator *> m_merge_operators;
     uint32_t       m_group_commit_interval;
 
     static void
@@ -28,16 +28,52 @@ using namespace Hypertable;
 
 namespace {
   enum Group {
-    PRIMARY_GROUP = 0
+    PRIMARY_GROUP = 0,
+    LATENCY_GROUP = 1,
+    CODEC_GROUP = 2,
+    LOCAL_CACHE_GROUP = 3,
+    THROTTLE_GROUP = 4,
+    UPDATE_QUALIFY_GROUP = 5
   };
+
+  const char *latency_phase_names[StatsRangeServer::LATENCY_PHASE_COUNT] = {
+    "update_qualify_queue_wait",
+    "update_commit_queue_wait",
+    "update_response_queue_wait",
+    "commit_log_write",
+    "commit_log_sync",
+    "cell_cache_insert",
+    "scan_block_fill",
+    "block_cache_miss",
+    "update_qualify"
+  };
+}
+
+const char *StatsRangeServer::latency_phase_name(int phase) {
+  HT_ASSERT(phase >= 0 && phase < LATENCY_PHASE_COUNT);
+  return latency_phase_names[phase];
 }
 
-StatsRangeServer::StatsRangeServer() : StatsSerializable(RANGE_SERVER, 1), timestamp(TIMESTAMP_MIN) {
+StatsRangeServer::StatsRangeServer() : StatsSerializable(RANGE_SERVER, 6), timestamp(TIMESTAMP_MIN),
+    local_block_cache_capacity(0), local_block_cache_used(0),
+    local_block_cache_accesses(0), local_block_cache_hits(0),
+    update_throttle_level(0), updates_throttled(0), update_throttle_millis(0),
+    update_qualify_batches(0), update_range_lists(0), update_arena_bytes(0) {
   group_ids[0] = PRIMARY_GROUP;
+  group_ids[1] = LATENCY_GROUP;
+  group_ids[2] = CODEC_GROUP;
+  group_ids[3] = LOCAL_CACHE_GROUP;
+  group_ids[4] = THROTTLE_GROUP;
+  group_ids[5] = UPDATE_QUALIFY_GROUP;
+  clear_codec_mix();
 }
 
 
-StatsRangeServer::StatsRangeServer(PropertiesPtr &props) : StatsSerializable(RANGE_SERVER, 1), timestamp(TIMESTAMP_MIN) {
+StatsRangeServer::StatsRangeServer(PropertiesPtr &props) : StatsSerializable(RANGE_SERVER, 6), timestamp(TIMESTAMP_MIN),
+    local_block_cache_capacity(0), local_block_cache_used(0),
+    local_block_cache_accesses(0), local_block_cache_hits(0),
+    update_throttle_level(0), updates_throttled(0), update_throttle_millis(0),
+    update_qualify_batches(0), update_range_lists(0), update_arena_bytes(0) {
   const char *base, *ptr;
   String datadirs = props->get_str("Hypertable.RangeServer.Monitoring.DataDirectories");
   String dir;
@@ -60,6 +96,12 @@ StatsRangeServer::StatsRangeServer(PropertiesPtr &props) : StatsSerializable(RAN
                         StatsSystem::DISK|StatsSystem::SWAP|StatsSystem::NET|
                         StatsSystem::PROC | StatsSystem::FS, dirs);
   group_ids[0] = PRIMARY_GROUP;
+  group_ids[1] = LATENCY_GROUP;
+  group_ids[2] = CODEC_GROUP;
+  group_ids[3] = LOCAL_CACHE_GROUP;
+  group_ids[4] = THROTTLE_GROUP;
+  group_ids[5] = UPDATE_QUALIFY_GROUP;
+  clear_codec_mix();
 }
 
 StatsRangeServer::StatsRangeServer(const StatsRangeServer &other) : StatsSerializable(other.id, other.group_count) {
@@ -85,10 +127,25 @@ StatsRangeServer::StatsRangeServer(const StatsRangeServer &other) : StatsSeriali
   block_cache_available_memory = other.block_cache_available_memory;
   block_cache_accesses = other.block_cache_accesses;
   block_cache_hits = other.block_cache_hits;
+  local_block_cache_capacity = other.local_block_cache_capacity;
+  local_block_cache_used = other.local_block_cache_used;
+  local_block_cache_accesses = other.local_block_cache_accesses;
+  local_block_cache_hits = other.local_block_cache_hits;
+  update_throttle_level = other.update_throttle_level;
+  updates_throttled = other.updates_throttled;
+  update_throttle_millis = other.update_throttle_millis;
+  update_qualify_batches = other.update_qualify_batches;
+  update_range_lists = other.update_range_lists;
+  update_arena_bytes = other.update_arena_bytes;
   tracked_memory = other.tracked_memory;
   cpu_user = other.cpu_user;
   cpu_sys = other.cpu_sys;
   live = other.live;
+  for (int i=0; i<LATENCY_PHASE_COUNT; i++)
+    latency[i] = other.latency[i];
+  memcpy(codec_blocks, other.codec_blocks, sizeof(codec_blocks));
+  memcpy(codec_bytes, other.codec_bytes, sizeof(codec_bytes));
+  memcpy(codec_zbytes, other.codec_zbytes, sizeof(codec_zbytes));
   system = other.system;
   tables = other.tables;
 }
@@ -115,6 +172,16 @@ bool StatsRangeServer::operator==(const StatsRangeServer &other) const {
       block_cache_available_memory != other.block_cache_available_memory ||
       block_cache_accesses != other.block_cache_accesses ||
       block_cache_hits != other.block_cache_hits ||
+      local_block_cache_capacity != other.local_block_cache_capacity ||
+      local_block_cache_used != other.local_block_cache_used ||
+      local_block_cache_accesses != other.local_block_cache_accesses ||
+      local_block_cache_hits != other.local_block_cache_hits ||
+      update_throttle_level != other.update_throttle_level ||
+      updates_throttled != other.updates_throttled ||
+      update_throttle_millis != other.update_throttle_millis ||
+      update_qualify_batches != other.update_qualify_batches ||
+      update_range_lists != other.update_range_lists ||
+      update_arena_bytes != other.update_arena_bytes ||
       tracked_memory != other.tracked_memory ||
       !Serialization::equal(cpu_user, other.cpu_user) ||
       !Serialization::equal(cpu_sys, other.cpu_sys) ||
@@ -123,6 +190,14 @@ bool StatsRangeServer::operator==(const StatsRangeServer &other) const {
     return false;
   if (tables.size() != other.tables.size())
     return false;
+  for (int i=0; i<LATENCY_PHASE_COUNT; i++) {
+    if (latency[i] != other.latency[i])
+      return false;
+  }
+  if (memcmp(codec_blocks, other.codec_blocks, sizeof(codec_blocks)) ||
+      memcmp(codec_bytes, other.codec_bytes, sizeof(codec_bytes)) ||
+      memcmp(codec_zbytes, other.codec_zbytes, sizeof(codec_zbytes)))
+    return false;
   for (size_t i=0; i<tables.size(); i++) {
     if (tables[i] != other.tables[i])
       return false;
@@ -132,6 +207,12 @@ bool StatsRangeServer::operator==(const StatsRangeServer &other) const {
 
 
 
+void StatsRangeServer::clear_codec_mix() {
+  memset(codec_blocks, 0, sizeof(codec_blocks));
+  memset(codec_bytes, 0, sizeof(codec_bytes));
+  memset(codec_zbytes, 0, sizeof(codec_zbytes));
+}
+
 size_t StatsRangeServer::encoded_length_group(int group) const {
   if (group == PRIMARY_GROUP) {
     size_t len = Serialization::encoded_length_vstr(location) + \
@@ -143,6 +224,36 @@ size_t StatsRangeServer::encoded_length_group(int group) const {
       len += tables[i].encoded_length();
     return len;
   }
+  else if (group == LATENCY_GROUP) {
+    size_t len = Serialization::encoded_length_vi32(LATENCY_PHASE_COUNT);
+    for (int i=0; i<LATENCY_PHASE_COUNT; i++)
+      len += latency[i].encoded_length();
+    return len;
+  }
+  else if (group == CODEC_GROUP) {
+    size_t len = Serialization::encoded_length_vi32(BlockCompressionCodec::COMPRESSION_TYPE_LIMIT);
+    for (int i=0; i<BlockCompressionCodec::COMPRESSION_TYPE_LIMIT; i++)
+      len += Serialization::encoded_length_vi64(codec_blocks[i]) +
+        Serialization::encoded_length_vi64(codec_bytes[i]) +
+        Serialization::encoded_length_vi64(codec_zbytes[i]);
+    return len;
+  }
+  else if (group == LOCAL_CACHE_GROUP) {
+    return Serialization::encoded_length_vi64(local_block_cache_capacity) +
+      Serialization::encoded_length_vi64(local_block_cache_used) +
+      Serialization::encoded_length_vi64(local_block_cache_accesses) +
+      Serialization::encoded_length_vi64(local_block_cache_hits);
+  }
+  else if (group == THROTTLE_GROUP) {
+    return Serialization::encoded_length_vi32(update_throttle_level) +
+      Serialization::encoded_length_vi64(updates_throttled) +
+      Serialization::encoded_length_vi64(update_throttle_millis);
+  }
+  else if (group == UPDATE_QUALIFY_GROUP) {
+    return Serialization::encoded_length_vi64(update_qualify_batches) +
+      Serialization::encoded_length_vi64(update_range_lists) +
+      Serialization::encoded_length_vi64(update_arena_bytes);
+  }
   else
     HT_FATALF("Invalid group number (%d)", group);
   return 0;
@@ -180,6 +291,35 @@ void StatsRangeServer::encode_group(int group, uint8_t **bufp) const {
     for (size_t i=0; i<tables.size(); i++)
       tables[i].encode(bufp);
   }
+  else if (group == LATENCY_GROUP) {
+    Serialization::encode_vi32(bufp, LATENCY_PHASE_COUNT);
+    for (int i=0; i<LATENCY_PHASE_COUNT; i++)
+      latency[i].encode(bufp);
+  }
+  else if (group == CODEC_GROUP) {
+    Serialization::encode_vi32(bufp, BlockCompressionCodec::COMPRESSION_TYPE_LIMIT);
+    for (int i=0; i<BlockCompressionCodec::COMPRESSION_TYPE_LIMIT; i++) {
+      Serialization::encode_vi64(bufp, codec_blocks[i]);
+      Serialization::encode_vi64(bufp, codec_bytes[i]);
+      Serialization::encode_vi64(bufp, codec_zbytes[i]);
+    }
+  }
+  else if (group == LOCAL_CACHE_GROUP) {
+    Serialization::encode_vi64(bufp, local_block_cache_capacity);
+    Serialization::encode_vi64(bufp, local_block_cache_used);
+    Serialization::encode_vi64(bufp, local_block_cache_accesses);
+    Serialization::encode_vi64(bufp, local_block_cache_hits);
+  }
+  else if (group == THROTTLE_GROUP) {
+    Serialization::encode_vi32(bufp, update_throttle_level);
+    Serialization::encode_vi64(bufp, updates_throttled);
+    Serialization::encode_vi64(bufp, update_throttle_millis);
+  }
+  else if (group == UPDATE_QUALIFY_GROUP) {
+    Serialization::encode_vi64(bufp, update_qualify_batches);
+    Serialization::encode_vi64(bufp, update_range_lists);
+    Serialization::encode_vi64(bufp, update_arena_bytes);
+  }
   else
     HT_FATALF("Invalid group number (%d)", group);
 }
@@ -220,6 +360,46 @@ void StatsRangeServer::decode_group(int group, uint16_t len, const uint8_t **buf
       tables.push_back(table);
     }
   }
+  else if (group == LATENCY_GROUP) {
+    int phase_count = (int)Serialization::decode_vi32(bufp, remainp);
+    for (int i=0; i<phase_count; i++) {
+      // phases added by newer servers are decoded and dropped
+      LatencyHistogram histogram;
+      histogram.decode(bufp, remainp);
+      if (i < LATENCY_PHASE_COUNT)
+        latency[i] = histogram;
+    }
+  }
+  else if (group == CODEC_GROUP) {
+    int type_count = (int)Serialization::decode_vi32(bufp, remainp);
+    clear_codec_mix();
+    for (int i=0; i<type_count; i++) {
+      uint64_t blocks = Serialization::decode_vi64(bufp, remainp);
+      uint64_t bytes = Serialization::decode_vi64(bufp, remainp);
+      uint64_t zbytes = Serialization::decode_vi64(bufp, remainp);
+      if (i < BlockCompressionCodec::COMPRESSION_TYPE_LIMIT) {
+        codec_blocks[i] = blocks;
+        codec_bytes[i] = bytes;
+        codec_zbytes[i] = zbytes;
+      }
+    }
+  }
+  else if (group == LOCAL_CACHE_GROUP) {
+    local_block_cache_capacity = Serialization::decode_vi64(bufp, remainp);
+    local_block_cache_used = Serialization::decode_vi64(bufp, remainp);
+    local_block_cache_accesses = Serialization::decode_vi64(bufp, remainp);
+    local_block_cache_hits = Serialization::decode_vi64(bufp, remainp);
+  }
+  else if (group == THROTTLE_GROUP) {
+    update_throttle_level = Serialization::decode_vi32(bufp, remainp);
+    updates_throttled = Serialization::decode_vi64(bufp, remainp);
+    update_throttle_millis = Serialization::decode_vi64(bufp, remainp);
+  }
+  else if (group == UPDATE_QUALIFY_GROUP) {
+    update_qualify_batches = Serialization::decode_vi64(bufp, remainp);
+    update_range_lists = Serialization::decode_vi64(bufp, remainp);
+    update_arena_bytes = Serialization::decode_vi64(bufp, remainp);
+  }
   else {
     HT_WARNF("Unrecognized StatsRangeServer group %d, skipping...", group);
     (*bufp) += len;
@@ -26,6 +26,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include "Common/LatencyHistogram.h"
 #include "Common/Properties.h"
 #include "Common/ReferenceCount.h"
 #include "Common/StatsSerializable.h"
@@ -33,6 +34,7 @@
 #include "Common/StringExt.h"
 #include "Common/SystemInfo.h"
 
+#include "BlockCompressionCodec.h"
 #include "StatsTable.h"
 
 namespace Hypertable {
@@ -43,6 +45,21 @@ namespace Hypertable {
     
   public:
 
+    enum LatencyPhase {
+      LATENCY_UPDATE_QUALIFY_QUEUE_WAIT = 0,
+      LATENCY_UPDATE_COMMIT_QUEUE_WAIT,
+      LATENCY_UPDATE_RESPONSE_QUEUE_WAIT,
+      LATENCY_COMMIT_LOG_WRITE,
+      LATENCY_COMMIT_LOG_SYNC,
+      LATENCY_CELL_CACHE_INSERT,
+      LATENCY_SCAN_BLOCK_FILL,
+      LATENCY_BLOCK_CACHE_MISS,
+      LATENCY_UPDATE_QUALIFY,
+      LATENCY_PHASE_COUNT
+    };
+
+    static const char *latency_phase_name(int phase);
+
     StatsRangeServer();
 
     StatsRangeServer(PropertiesPtr &props);
@@ -57,6 +74,8 @@ namespace Hypertable {
       if (ver != version)
         version = ver;
     }
+    void clear_codec_mix();
+
     bool operator==(const StatsRangeServer &other) const;
     bool operator!=(const StatsRangeServer &other) const {
       return !(*this == other);
@@ -83,10 +102,30 @@ namespace Hypertable {
     uint64_t block_cache_available_memory;
     uint64_t block_cache_accesses;
     uint64_t block_cache_hits;
+    /** Second-tier block cache on local disk (zero when disabled) */
+    uint64_t local_block_cache_capacity;
+    uint64_t local_block_cache_used;
+    uint64_t local_block_cache_accesses;
+    uint64_t local_block_cache_hits;
+    /** Update throttle level (0-100), updates delayed and total delay */
+    int32_t  update_throttle_level;
+    uint64_t updates_throttled;
+    uint64_t update_throttle_millis;
+    /** Update batches qualified, per-range update lists allocated from
+     * their arenas, and arena bytes used (all cumulative) */
+    uint64_t update_qualify_batches;
+    uint64_t update_range_lists;
+    uint64_t update_arena_bytes;
     uint64_t tracked_memory;
     double   cpu_user;
     double   cpu_sys;
     bool     live;
+    /** Per-phase latency histograms (cumulative since server start) */
+    LatencyHistogram latency[LATENCY_PHASE_COUNT];
+    /** Cell store blocks written by the auto codec, per concrete codec */
+    uint64_t codec_blocks[BlockCompressionCodec::COMPRESSION_TYPE_LIMIT];
+    uint64_t codec_bytes[BlockCompressionCodec::COMPRESSION_TYPE_LIMIT];
+    uint64_t codec_zbytes[BlockCompressionCodec::COMPRESSION_TYPE_LIMIT];
 
     StatsSystem system;
     std::vector<StatsTable> tables;
@@ -55,7 +55,8 @@ namespace Hypertable {
   public:
     enum {
       FLAG_NO_LOG_SYNC             = Table::MUTATOR_FLAG_NO_LOG_SYNC,
-      FLAG_IGNORE_UNKNOWN_CFS      = Table::MUTATOR_FLAG_IGNORE_UNKNOWN_CFS
+      FLAG_IGNORE_UNKNOWN_CFS      = Table::MUTATOR_FLAG_IGNORE_UNKNOWN_CFS,
+      FLAG_COALESCE_UPDATES        = Table::MUTATOR_FLAG_COALESCE_UPDATES
     };
 
     /**
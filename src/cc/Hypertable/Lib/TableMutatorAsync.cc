@@ -72,7 +72,7 @@ TableMutatorAsync::TableMutatorAsync(PropertiesPtr &props, Comm *comm,
   uint32_t buffer_id = ++m_next_buffer_id;
   m_current_buffer = new TableMutatorAsyncScatterBuffer(m_comm, app_queue, this,
       &m_table_identifier, m_schema, m_range_locator, m_table->auto_refresh(), timeout_ms,
-      buffer_id);
+      buffer_id, (m_flags & Table::MUTATOR_FLAG_COALESCE_UPDATES) != 0);
   if (m_cb)
     m_cb->register_mutator(this);
 }
@@ -268,7 +268,8 @@ void TableMutatorAsync::flush(bool sync) {
       m_outstanding_buffers[m_current_buffer->get_id()] = m_current_buffer;
       m_current_buffer = new TableMutatorAsyncScatterBuffer(m_comm, m_app_queue, this,
           &m_table_identifier, m_schema, m_range_locator, m_table->auto_refresh(),
-          m_timeout_ms, buffer_id);
+          m_timeout_ms, buffer_id,
+          (m_flags & Table::MUTATOR_FLAG_COALESCE_UPDATES) != 0);
 
       m_memory_used = 0;
     }
@@ -299,6 +300,7 @@ void TableMutatorAsync::do_sync() {
         bool retry_failed;
         do {
           bool do_refresh = false;
+          bool throttled = false;
           retry_count++;
           sync_handler.get_errors(errors);
           for (size_t i=0; i<errors.size(); i++) {
@@ -306,12 +308,17 @@ void TableMutatorAsync::do_sync() {
                 (errors[i].error == Error::RANGESERVER_GENERATION_MISMATCH ||
                  (!m_mutated && errors[i].error == Error::RANGESERVER_TABLE_NOT_FOUND)))
               do_refresh = true;
+            else if (errors[i].error == Error::RANGESERVER_UPDATES_THROTTLED)
+              throttled = true;
             else
               HT_ERRORF("commit log sync error - %s - %s", errors[i].msg.c_str(),
                   Error::get_text(errors[i].error));
           }
           if (do_refresh)
             m_table->refresh(m_table_identifier, m_schema);
+          // back off while the range server's update queue is full
+          if (throttled)
+            poll(0, 0, retry_count * 1000);
           sync_handler.retry();
         }
         while ((retry_failed = (!sync_handler.wait_for_completion())) &&
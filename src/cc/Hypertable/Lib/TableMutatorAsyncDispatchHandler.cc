@@ -58,6 +58,9 @@ void TableMutatorAsyncDispatchHandler::handle(EventPtr &event_ptr) {
           (error == Error::RANGESERVER_GENERATION_MISMATCH ||
            error == Error::RANGESERVER_TABLE_NOT_FOUND))
         m_send_buffer->add_retries_all(true, error);
+      else if (error == Error::RANGESERVER_UPDATES_THROTTLED)
+        // update queue full, resent from a redo buffer after a back-off
+        m_send_buffer->add_retries_all();
       else
         m_send_buffer->add_errors_all(error);
     }
@@ -0,0 +1,78 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_TABLEMUTATORASYNCLASTRANGE_H
+#define HYPERTABLE_TABLEMUTATORASYNCLASTRANGE_H
+
+#include <cstring>
+
+#include "LocationCache.h"
+#include "RangeLocationInfo.h"
+#include "TableMutatorAsyncSendBuffer.h"
+
+namespace Hypertable {
+
+  /**
+   * Remembers the range most recently looked up by a scatter buffer and the
+   * send buffer for the server holding it.  The entry goes stale when the
+   * location cache invalidates any entry, which is how failed sends mark
+   * ranges that moved before their updates are redone.
+   */
+  class TableMutatorAsyncLastRange {
+  public:
+    TableMutatorAsyncLastRange() : m_send_buffer(0), m_invalidations(0) { }
+
+    /**
+     * Returns the remembered send buffer if row falls inside the remembered
+     * range and cache has invalidated nothing since, otherwise 0.  On a
+     * miss, the caller should fill in #info and call set().
+     *
+     * @param row row key
+     * @param cache location cache the range was looked up in
+     * @return send buffer for row, or 0 if the range must be looked up
+     */
+    TableMutatorAsyncSendBuffer *lookup(const char *row, LocationCache *cache) {
+      int invalidations = cache->invalidation_count();
+      if (m_send_buffer && m_invalidations == invalidations &&
+          strcmp(row, info.start_row.c_str()) > 0 &&
+          strcmp(row, info.end_row.c_str()) <= 0)
+        return m_send_buffer;
+      m_send_buffer = 0;
+      m_invalidations = invalidations;
+      return 0;
+    }
+
+    void set(TableMutatorAsyncSendBuffer *send_buffer) {
+      m_send_buffer = send_buffer;
+    }
+
+    void clear() { m_send_buffer = 0; }
+
+    RangeLocationInfo info;
+
+  private:
+    TableMutatorAsyncSendBuffer *m_send_buffer;
+    int m_invalidations;
+  };
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_TABLEMUTATORASYNCLASTRANGE_H
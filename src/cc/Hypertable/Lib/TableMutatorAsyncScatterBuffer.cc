@@ -37,13 +37,14 @@ using namespace Hypertable;
 TableMutatorAsyncScatterBuffer::TableMutatorAsyncScatterBuffer(Comm *comm,
     ApplicationQueuePtr &app_queue, TableMutatorAsync *mutator,
     const TableIdentifier *table_identifier, SchemaPtr &schema,
-    RangeLocatorPtr &range_locator, bool auto_refresh, uint32_t timeout_ms, uint32_t id)
+    RangeLocatorPtr &range_locator, bool auto_refresh, uint32_t timeout_ms, uint32_t id,
+    bool coalesce)
   : m_comm(comm), m_app_queue(app_queue), m_mutator(mutator), m_schema(schema),
     m_range_locator(range_locator), m_range_server(comm, timeout_ms),
     m_table_identifier(*table_identifier),
     m_full(false), m_resends(0), m_auto_refresh(auto_refresh), m_timeout_ms(timeout_ms),
     m_counter_value(9), m_timer(timeout_ms), m_id(id), m_memory_used(0), m_outstanding(false),
-    m_send_flags(0), m_wait_time(ms_init_redo_wait_time) {
+    m_send_flags(0), m_wait_time(ms_init_redo_wait_time), m_coalesce(coalesce) {
 
   m_loc_cache = m_range_locator->location_cache();
 
@@ -54,15 +55,24 @@ TableMutatorAsyncScatterBuffer::TableMutatorAsyncScatterBuffer(Comm *comm,
 }
 
 
-void
-TableMutatorAsyncScatterBuffer::set(const Key &key, const void *value, uint32_t value_len,
-    size_t incr_mem) {
-  RangeLocationInfo range_info;
+/**
+ * Returns the send buffer of the server holding the range that contains
+ * row.  Clients tend to write runs of keys that fall in the same range,
+ * so the last range looked up is checked first, which skips the location
+ * cache lookup.
+ */
+TableMutatorAsyncSendBuffer *
+TableMutatorAsyncScatterBuffer::get_send_buffer(const char *row) {
   TableMutatorAsyncSendBufferMap::const_iterator iter;
+  TableMutatorAsyncSendBuffer *send_buffer;
+  RangeLocationInfo &range_info = m_last_range.info;
 
-  if (!m_loc_cache->lookup(m_table_identifier.id, key.row, &range_info)) {
+  if ((send_buffer = m_last_range.lookup(row, m_loc_cache.get())) != 0)
+    return send_buffer;
+
+  if (!m_loc_cache->lookup(m_table_identifier.id, row, &range_info)) {
     m_timer.start();
-    m_range_locator->find_loop(&m_table_identifier, key.row, &range_info,
+    m_range_locator->find_loop(&m_table_identifier, row, &range_info,
         m_timer, false);
   }
 
@@ -76,8 +86,18 @@ TableMutatorAsyncScatterBuffer::set(const Key &key, const void *value, uint32_t
     (*iter).second->addr = range_info.addr;
   }
 
-  (*iter).second->key_offsets.push_back((*iter).second->accum.fill());
-  create_key_and_append((*iter).second->accum, key.flag, key.row,
+  m_last_range.set((*iter).second.get());
+  return (*iter).second.get();
+}
+
+
+void
+TableMutatorAsyncScatterBuffer::set(const Key &key, const void *value, uint32_t value_len,
+    size_t incr_mem) {
+  TableMutatorAsyncSendBuffer *send_buffer = get_send_buffer(key.row);
+
+  send_buffer->key_offsets.push_back(send_buffer->accum.fill());
+  create_key_and_append(send_buffer->accum, key.flag, key.row,
       key.column_family_code, key.column_qualifier, key.timestamp);
 
   // if the CF is a counter then re-encode value to 64 bit int
@@ -106,43 +126,29 @@ TableMutatorAsyncScatterBuffer::set(const Key &key, const void *value, uint32_t
      */
     if (counter_reset) {
       *m_counter_value.ptr++ = '=';
-      append_as_byte_string((*iter).second->accum, m_counter_value.base, 9);
+      append_as_byte_string(send_buffer->accum, m_counter_value.base, 9);
     }
     else
-      append_as_byte_string((*iter).second->accum, m_counter_value.base, 8);
+      append_as_byte_string(send_buffer->accum, m_counter_value.base, 8);
   }
   else
-    append_as_byte_string((*iter).second->accum, value, value_len);
+    append_as_byte_string(send_buffer->accum, value, value_len);
 
-  if ((*iter).second->accum.fill() > m_server_flush_limit)
+  if (send_buffer->accum.fill() > m_server_flush_limit)
     m_full = true;
   m_memory_used += incr_mem;
 }
 
 
 void TableMutatorAsyncScatterBuffer::set_delete(const Key &key, size_t incr_mem) {
-  RangeLocationInfo range_info;
-  TableMutatorAsyncSendBufferMap::const_iterator iter;
+  TableMutatorAsyncSendBuffer *send_buffer;
 
   if (key.flag == FLAG_INSERT)
     HT_THROW(Error::BAD_KEY, "Key flag is FLAG_INSERT, expected delete");
 
-  if (!m_loc_cache->lookup(m_table_identifier.id, key.row, &range_info)) {
-    m_timer.start();
-    m_range_locator->find_loop(&m_table_identifier, key.row, &range_info,
-        m_timer, false);
-  }
+  send_buffer = get_send_buffer(key.row);
 
-  iter = m_buffer_map.find(range_info.addr);
-
-  if (iter == m_buffer_map.end()) {
-    m_buffer_map[range_info.addr] = new TableMutatorAsyncSendBuffer(&m_table_identifier,
-        &m_completion_counter, m_range_locator.get());
-    iter = m_buffer_map.find(range_info.addr);
-    (*iter).second->addr = range_info.addr;
-  }
-
-  (*iter).second->key_offsets.push_back((*iter).second->accum.fill());
+  send_buffer->key_offsets.push_back(send_buffer->accum.fill());
   if (key.flag == FLAG_DELETE_COLUMN_FAMILY ||
       key.flag == FLAG_DELETE_CELL || key.flag == FLAG_DELETE_CELL_VERSION) {
     if (key.column_family_code == 0)
@@ -156,11 +162,11 @@ void TableMutatorAsyncScatterBuffer::set_delete(const Key &key, size_t incr_mem)
     }
   }
 
-  create_key_and_append((*iter).second->accum, key.flag, key.row,
+  create_key_and_append(send_buffer->accum, key.flag, key.row,
       key.column_family_code, key.column_qualifier, key.timestamp);
-  append_as_byte_string((*iter).second->accum, 0, 0);
+  append_as_byte_string(send_buffer->accum, 0, 0);
 
-  if ((*iter).second->accum.fill() > m_server_flush_limit)
+  if (send_buffer->accum.fill() > m_server_flush_limit)
     m_full = true;
   m_memory_used += incr_mem;
 }
@@ -168,113 +174,45 @@ void TableMutatorAsyncScatterBuffer::set_delete(const Key &key, size_t incr_mem)
 
 void
 TableMutatorAsyncScatterBuffer::set(SerializedKey key, ByteString value, size_t incr_mem) {
-  RangeLocationInfo range_info;
-  TableMutatorAsyncSendBufferMap::const_iterator iter;
   const uint8_t *ptr = key.ptr;
   size_t len = Serialization::decode_vi32(&ptr);
+  TableMutatorAsyncSendBuffer *send_buffer =
+    get_send_buffer((const char *)ptr+1);
 
-  if (!m_loc_cache->lookup(m_table_identifier.id, (const char *)ptr+1,
-        &range_info)) {
-    m_timer.start();
-    m_range_locator->find_loop(&m_table_identifier, (const char *)ptr+1,
-        &range_info, m_timer, false);
-  }
-
-  iter = m_buffer_map.find(range_info.addr);
+  send_buffer->key_offsets.push_back(send_buffer->accum.fill());
+  send_buffer->accum.add(key.ptr, (ptr-key.ptr)+len);
+  send_buffer->accum.add(value.ptr, value.length());
 
-  if (iter == m_buffer_map.end()) {
-    m_buffer_map[range_info.addr] = new TableMutatorAsyncSendBuffer(&m_table_identifier,
-        &m_completion_counter, m_range_locator.get());
-    iter = m_buffer_map.find(range_info.addr);
-    (*iter).second->addr = range_info.addr;
-  }
-
-  (*iter).second->key_offsets.push_back((*iter).second->accum.fill());
-  (*iter).second->accum.add(key.ptr, (ptr-key.ptr)+len);
-  (*iter).second->accum.add(value.ptr, value.length());
-
-  if ((*iter).second->accum.fill() > m_server_flush_limit)
+  if (send_buffer->accum.fill() > m_server_flush_limit)
     m_full = true;
   m_memory_used += incr_mem;
 }
 
 
-namespace {
-
-  struct SendRec {
-    SerializedKey key;
-    uint64_t offset;
-  };
-
-  inline bool operator<(const SendRec sr1, const SendRec sr2) {
-    const char *row1 = sr1.key.row();
-    const char *row2 = sr2.key.row();
-    int rval = strcmp(row1, row2);
-    if (rval == 0)
-      return sr1.offset < sr2.offset;
-    return rval < 0;
-  }
-}
-
-
 void TableMutatorAsyncScatterBuffer::send(uint32_t flags) {
   TableMutatorAsyncSendBufferPtr send_buffer;
-  std::vector<SendRec> send_vec;
-  uint8_t *ptr;
-  SerializedKey key;
-  SendRec send_rec;
-  size_t len;
   String range_location;
   bool outstanding=false;
 
   HT_ASSERT(!m_outstanding);
   m_completion_counter.set(m_buffer_map.size());
+  m_last_range.clear();
 
   for (TableMutatorAsyncSendBufferMap::const_iterator iter = m_buffer_map.begin();
        iter != m_buffer_map.end(); ++iter) {
     send_buffer = (*iter).second;
 
-    if ((len = send_buffer->accum.fill()) == 0) {
+    if (send_buffer->accum.fill() == 0) {
       m_completion_counter.decrement();
       continue;
     }
 
-    send_buffer->pending_updates.set(new uint8_t [len], len);
+    send_buffer->prepare_updates(m_schema.get(), m_coalesce);
 
-    if (send_buffer->resend()) {
-      memcpy(send_buffer->pending_updates.base,
-          send_buffer->accum.base, len);
-      send_buffer->send_count = send_buffer->retry_count;
-    }
-    else {
-      send_vec.clear();
-      send_vec.reserve(send_buffer->key_offsets.size());
-      for (size_t i=0; i<send_buffer->key_offsets.size(); i++) {
-        send_rec.key.ptr = send_buffer->accum.base
-          + send_buffer->key_offsets[i];
-        send_rec.offset = send_buffer->key_offsets[i];
-        send_vec.push_back(send_rec);
-      }
-      sort(send_vec.begin(), send_vec.end());
-
-      ptr = send_buffer->pending_updates.base;
-
-      for (size_t i=0; i<send_vec.size(); i++) {
-        key = send_vec[i].key;
-        key.next();  // skip key
-        key.next();  // skip value
-        memcpy(ptr, send_vec[i].key.ptr, key.ptr - send_vec[i].key.ptr);
-        ptr += key.ptr - send_vec[i].key.ptr;
-      }
-      HT_ASSERT((size_t)(ptr-send_buffer->pending_updates.base)==len);
+    if (!send_buffer->resend())
       send_buffer->dispatch_handler =
         new TableMutatorAsyncDispatchHandler(m_app_queue, m_mutator, m_id, send_buffer.get(),
                                              m_auto_refresh);
-      send_buffer->send_count = send_buffer->key_offsets.size();
-    }
-
-    send_buffer->accum.free();
-    send_buffer->key_offsets.clear();
 
     /**
      * Send update
@@ -345,7 +283,8 @@ TableMutatorAsyncScatterBuffer::create_redo_buffer(uint32_t id) {
     poll(0,0, m_wait_time);
     m_timer.stop();
     redo_buffer = new TableMutatorAsyncScatterBuffer(m_comm, m_app_queue, m_mutator,
-        &m_table_identifier, m_schema, m_range_locator, m_auto_refresh, m_timeout_ms, id);
+        &m_table_identifier, m_schema, m_range_locator, m_auto_refresh, m_timeout_ms, id,
+        m_coalesce);
     redo_buffer->m_timer = m_timer;
     redo_buffer->m_wait_time = m_wait_time + 2000;
 
@@ -473,6 +412,7 @@ void TableMutatorAsyncScatterBuffer::reset() {
   for (TableMutatorAsyncSendBufferMap::const_iterator iter = m_buffer_map.begin();
        iter != m_buffer_map.end(); ++iter)
     (*iter).second->reset();
+  m_last_range.clear();
   m_full = false;
   m_resends = 0;
   m_memory_used = 0;
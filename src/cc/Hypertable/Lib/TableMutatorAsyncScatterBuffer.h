@@ -46,6 +46,7 @@
 #include "Schema.h"
 #include "TableMutatorAsyncSendBuffer.h"
 #include "TableMutatorAsyncCompletionCounter.h"
+#include "TableMutatorAsyncLastRange.h"
 
 namespace Hypertable {
 
@@ -58,7 +59,7 @@ namespace Hypertable {
                                    const TableIdentifier *,
                                    SchemaPtr &, RangeLocatorPtr &, bool auto_refresh,
                                    uint32_t timeout_ms,
-                                   uint32_t id);
+                                   uint32_t id, bool coalesce=false);
     void set(const Key &, const void *value, uint32_t value_len, size_t incr_mem);
     void set_delete(const Key &key, size_t incr_mem);
     void set(SerializedKey key, ByteString value, size_t incr_mem);
@@ -94,6 +95,7 @@ namespace Hypertable {
 
   private:
     int set_failed_mutations();
+    TableMutatorAsyncSendBuffer *get_send_buffer(const char *row);
     typedef CommAddressMap<TableMutatorAsyncSendBufferPtr> TableMutatorAsyncSendBufferMap;
 
     Comm                *m_comm;
@@ -105,6 +107,7 @@ namespace Hypertable {
     RangeServerClient    m_range_server;
     TableIdentifierManaged m_table_identifier;
     TableMutatorAsyncSendBufferMap m_buffer_map;
+    TableMutatorAsyncLastRange m_last_range;
     TableMutatorAsyncCompletionCounter m_completion_counter;
     bool                 m_full;
     uint64_t             m_resends;
@@ -124,6 +127,7 @@ namespace Hypertable {
     bool                 m_outstanding;
     uint32_t             m_send_flags;
     uint32_t             m_wait_time;
+    bool                 m_coalesce;
     const static uint32_t ms_init_redo_wait_time=1000;
   };
 
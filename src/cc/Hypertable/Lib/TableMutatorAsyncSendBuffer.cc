@@ -0,0 +1,156 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+#include <set>
+
+#include "AsyncComm/CommAddress.h"
+#include "AsyncComm/DispatchHandler.h"
+
+#include "Common/DynamicBuffer.h"
+#include "Common/StaticBuffer.h"
+
+#include "Key.h"
+#include "RangeLocator.h"
+#include "Schema.h"
+#include "TableMutatorAsyncSendBuffer.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  struct SendRec {
+    SerializedKey key;
+    uint64_t offset;
+  };
+
+  inline bool operator<(const SendRec sr1, const SendRec sr2) {
+    const char *row1 = sr1.key.row();
+    const char *row2 = sr2.key.row();
+    int rval = strcmp(row1, row2);
+    if (rval == 0)
+      return sr1.offset < sr2.offset;
+    return rval < 0;
+  }
+
+  struct LtKeyBytes {
+    bool operator()(const SerializedKey k1, const SerializedKey k2) const {
+      const uint8_t *ptr1, *ptr2;
+      size_t len1 = k1.decode_length(&ptr1);
+      size_t len2 = k2.decode_length(&ptr2);
+      int rval = memcmp(ptr1, ptr2, std::min(len1, len2));
+      if (rval == 0)
+        return len1 < len2;
+      return rval < 0;
+    }
+  };
+
+  /**
+   * Drops inserts that are superseded by a later insert of the same cell
+   * (same row, column and timestamp, or both auto-assigned) in the sorted
+   * send vector, by clearing their key pointer.  Counter updates are
+   * never dropped since they accumulate.
+   */
+  void coalesce_superseded(std::vector<SendRec> &send_vec, Schema *schema) {
+    std::set<SerializedKey, LtKeyBytes> later;
+    Schema::ColumnFamily *cf;
+    Key key;
+    size_t i, j = 0;
+
+    while (j < send_vec.size()) {
+      i = j++;
+      while (j < send_vec.size() &&
+             !strcmp(send_vec[i].key.row(), send_vec[j].key.row()))
+        j++;
+      if (j - i < 2)
+        continue;
+      later.clear();
+      for (size_t k=j; k>i; k--) {
+        SendRec &rec = send_vec[k-1];
+        key.load(rec.key);
+        if (key.flag != FLAG_INSERT)
+          continue;
+        cf = schema->get_column_family(key.column_family_code);
+        if (cf && cf->counter)
+          continue;
+        if (!later.insert(rec.key).second)
+          rec.key.ptr = 0;
+      }
+    }
+  }
+}
+
+
+
+
+void TableMutatorAsyncSendBuffer::prepare_updates(Schema *schema, bool coalesce) {
+  std::vector<SendRec> send_vec;
+  SendRec send_rec;
+  SerializedKey key;
+  uint8_t *ptr;
+  size_t len = accum.fill();
+
+  pending_updates.set(new uint8_t [len], len);
+
+  if (resend()) {
+    memcpy(pending_updates.base, accum.base, len);
+    send_count = retry_count;
+  }
+  else {
+    send_vec.reserve(key_offsets.size());
+    for (size_t i=0; i<key_offsets.size(); i++) {
+      send_rec.key.ptr = accum.base + key_offsets[i];
+      send_rec.offset = key_offsets[i];
+      send_vec.push_back(send_rec);
+    }
+    // keys written in order need not be sorted
+    for (size_t i=1; i<send_vec.size(); i++) {
+      if (send_vec[i] < send_vec[i-1]) {
+        sort(send_vec.begin(), send_vec.end());
+        break;
+      }
+    }
+
+    if (coalesce)
+      coalesce_superseded(send_vec, schema);
+
+    ptr = pending_updates.base;
+    send_count = 0;
+
+    for (size_t i=0; i<send_vec.size(); i++) {
+      if (send_vec[i].key.ptr == 0)
+        continue;
+      key = send_vec[i].key;
+      key.next();  // skip key
+      key.next();  // skip value
+      memcpy(ptr, send_vec[i].key.ptr, key.ptr - send_vec[i].key.ptr);
+      ptr += key.ptr - send_vec[i].key.ptr;
+      send_count++;
+    }
+    HT_ASSERT((size_t)(ptr-pending_updates.base)<=len);
+    pending_updates.size = ptr-pending_updates.base;
+  }
+
+  accum.free();
+  key_offsets.clear();
+}
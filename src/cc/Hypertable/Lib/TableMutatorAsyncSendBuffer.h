@@ -28,6 +28,8 @@
 
 namespace Hypertable {
 
+  class Schema;
+
   struct FailedRegionAsync {
     int error;
     uint8_t *base;
@@ -106,6 +108,17 @@ namespace Hypertable {
 
     bool resend() { return retry_count > 0; }
 
+    /**
+     * Moves the accumulated updates into pending_updates and sets
+     * send_count.  Retries are copied as is; otherwise the updates are
+     * sorted by row and, if coalesce is set, inserts superseded by a later
+     * insert of the same cell are dropped.  Frees accum and key_offsets.
+     *
+     * @param schema table schema, used to recognize counter columns
+     * @param coalesce drop superseded inserts
+     */
+    void prepare_updates(Schema *schema, bool coalesce);
+
     std::vector<uint64_t> key_offsets;
     DynamicBuffer accum;
     StaticBuffer pending_updates;
@@ -40,7 +40,12 @@ TableScanner::TableScanner(Comm *comm, Table *table,
     uint32_t timeout_ms)
   : m_callback(this), m_cur_cells(0), m_cur_cells_index(0), m_cur_cells_size(0),
     m_error(Error::OK),
-    m_eos(false), m_bytes_scanned(0) {
+    m_eos(false), m_bytes_scanned(0), m_aggregated_index(0) {
+
+  if (scan_spec.aggregate != ScanSpec::AGGREGATE_NONE) {
+    m_aggregator = new ScanAggregator(scan_spec);
+    m_aggregated = new CellsBuilder;
+  }
 
   m_queue = new TableScannerQueue;
   ApplicationQueuePtr app_queue = (ApplicationQueue *)m_queue.get();
@@ -57,6 +62,37 @@ bool TableScanner::next(Cell &cell) {
     return true;
   }
 
+  if (m_aggregator) {
+    if (m_aggregated_index == m_aggregated->size() && !aggregate())
+      return false;
+    m_aggregated->get_cell(cell, m_aggregated_index++);
+    return true;
+  }
+
+  return next_raw(cell);
+}
+
+
+bool TableScanner::aggregate() {
+  Cell cell;
+
+  // a fresh builder releases the arena holding the groups already returned
+  m_aggregated = new CellsBuilder;
+  m_aggregated_index = 0;
+  while (m_aggregated->size() == 0) {
+    if (m_eos)
+      return false;
+    if (next_raw(cell))
+      m_aggregator->add(cell, *m_aggregated);
+    else
+      m_aggregator->finish(*m_aggregated);
+  }
+  return true;
+}
+
+
+bool TableScanner::next_raw(Cell &cell) {
+
   if (m_eos)
     return false;
 
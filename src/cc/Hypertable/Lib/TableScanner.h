@@ -27,6 +27,7 @@
 #include "TableScannerQueue.h"
 #include "TableScannerAsync.h"
 #include "TableCallback.h"
+#include "ScanAggregator.h"
 #include "ScanCells.h"
 
 namespace Hypertable {
@@ -116,6 +117,15 @@ namespace Hypertable {
      */
     void scan_error(int error, const String &error_msg);
 
+    /** Fetches the next cell as returned by the RangeServers */
+    bool next_raw(Cell &cell);
+
+    /**
+     * Feeds partial aggregates through m_aggregator until it has completed
+     * at least one group into m_aggregated, returns false at end of scan
+     */
+    bool aggregate();
+
     TableScannerQueuePtr m_queue;
     TableScannerAsyncPtr m_scanner;
     TableCallback m_callback;
@@ -127,6 +137,9 @@ namespace Hypertable {
     bool m_eos;
     Cell m_ungot;
     int64_t m_bytes_scanned;
+    ScanAggregatorPtr m_aggregator;
+    CellsBuilderPtr m_aggregated;
+    size_t m_aggregated_index;
   };
   typedef intrusive_ptr<TableScanner> TableScannerPtr;
 
@@ -0,0 +1,84 @@
+/** -*- c++ -*-
+ * Copyright (C) 2012 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+
+#include <boost/algorithm/string.hpp>
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include "Key.h"
+#include "TableSplitSpec.h"
+
+using namespace Hypertable;
+
+void TableSplitSpec::generate(const String &algorithm, uint32_t range_count,
+                              std::vector<String> &rows) {
+
+  rows.clear();
+
+  if (range_count < 1 || range_count > MAX_RANGES)
+    HT_THROWF(Error::BAD_KEY, "Invalid range count (%u), must be between 1 "
+              "and %u", (unsigned)range_count, (unsigned)MAX_RANGES);
+
+  if (boost::iequals(algorithm, "uniform")) {
+    if (range_count > 256)
+      HT_THROWF(Error::BAD_KEY, "Invalid range count (%u) for uniform split, "
+                "must not exceed 256", (unsigned)range_count);
+    // Rows may not contain '\0', so a boundary with a zero low byte is
+    // written as its one-byte prefix, which sorts in the same place
+    for (uint32_t i=1; i<range_count; i++) {
+      uint32_t boundary = (uint32_t)(((uint64_t)i << 16) / range_count);
+      String row(1, (char)(boundary >> 8));
+      if (boundary & 0xff)
+        row += (char)(boundary & 0xff);
+      rows.push_back(row);
+    }
+  }
+  else if (boost::iequals(algorithm, "hash")) {
+    for (uint32_t i=1; i<range_count; i++)
+      rows.push_back(format("%08x",
+          (unsigned)(((uint64_t)i << 32) / range_count)));
+  }
+  else
+    HT_THROWF(Error::BAD_KEY, "Unrecognized split algorithm '%s'",
+              algorithm.c_str());
+}
+
+
+void TableSplitSpec::normalize(std::vector<String> &rows) {
+
+  std::sort(rows.begin(), rows.end());
+  rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+  if (rows.size() >= MAX_RANGES)
+    HT_THROWF(Error::BAD_KEY, "Too many split rows (%d)", (int)rows.size());
+
+  if (!rows.empty()) {
+    if (rows.front().empty())
+      HT_THROW(Error::BAD_KEY, "Empty split row");
+    if (rows.back().compare(Key::END_ROW_MARKER) >= 0)
+      HT_THROW(Error::BAD_KEY, "Split row must sort before END_ROW_MARKER");
+  }
+}
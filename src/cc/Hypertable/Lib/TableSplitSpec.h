@@ -0,0 +1,64 @@
+/** -*- c++ -*-
+ * Copyright (C) 2012 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_TABLESPLITSPEC_H
+#define HYPERTABLE_TABLESPLITSPEC_H
+
+#include <vector>
+
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /**
+   * Computes the split rows that divide a new table into its initial
+   * ranges.  A table created with N split rows starts out with N+1
+   * ranges, the last of which ends at Key::END_ROW_MARKER.
+   */
+  class TableSplitSpec {
+  public:
+    /**
+     * Generates the split rows for range_count ranges of equal width.
+     * The "uniform" algorithm divides the space of the first two row
+     * bytes evenly and supports up to 256 ranges.  The "hash" algorithm
+     * divides the space of eight-digit lowercase hex prefixes, which
+     * suits tables whose rows start with a hex-encoded hash.
+     *
+     * @param algorithm "uniform" or "hash" (case insensitive)
+     * @param range_count number of ranges to create
+     * @param rows vector to receive the split rows
+     */
+    static void generate(const String &algorithm, uint32_t range_count,
+                         std::vector<String> &rows);
+
+    /**
+     * Sorts rows and removes duplicates, throwing Error::BAD_KEY if a
+     * row is empty or does not sort before Key::END_ROW_MARKER.
+     */
+    static void normalize(std::vector<String> &rows);
+
+    /** Maximum number of ranges a table may be created with */
+    static const uint32_t MAX_RANGES = 65536;
+  };
+
+}
+
+#endif // HYPERTABLE_TABLESPLITSPEC_H
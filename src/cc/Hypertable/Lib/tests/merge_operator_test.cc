@@ -0,0 +1,184 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cstring>
+#include <iostream>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/MergeOperator.h"
+#include "Hypertable/Lib/Schema.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const char *schema_xml =
+    "<Schema generation=\"1\">\n"
+    "  <AccessGroup name=\"default\">\n"
+    "    <ColumnFamily id=\"1\">\n"
+    "      <Generation>1</Generation>\n"
+    "      <Name>hi</Name>\n"
+    "      <MergeOperator>max</MergeOperator>\n"
+    "    </ColumnFamily>\n"
+    "    <ColumnFamily id=\"2\">\n"
+    "      <Generation>1</Generation>\n"
+    "      <Name>visitors</Name>\n"
+    "      <MergeOperator>hll</MergeOperator>\n"
+    "    </ColumnFamily>\n"
+    "    <ColumnFamily id=\"3\">\n"
+    "      <Generation>1</Generation>\n"
+    "      <Name>plain</Name>\n"
+    "    </ColumnFamily>\n"
+    "  </AccessGroup>\n"
+    "</Schema>\n";
+
+  const char *bad_schema_xml =
+    "<Schema>\n"
+    "  <AccessGroup name=\"default\">\n"
+    "    <ColumnFamily id=\"1\">\n"
+    "      <Name>hi</Name>\n"
+    "      <MergeOperator>median</MergeOperator>\n"
+    "    </ColumnFamily>\n"
+    "  </AccessGroup>\n"
+    "</Schema>\n";
+
+  const char *counter_schema_xml =
+    "<Schema>\n"
+    "  <AccessGroup name=\"default\">\n"
+    "    <ColumnFamily id=\"1\">\n"
+    "      <Name>hi</Name>\n"
+    "      <Counter>true</Counter>\n"
+    "      <MergeOperator>max</MergeOperator>\n"
+    "    </ColumnFamily>\n"
+    "  </AccessGroup>\n"
+    "</Schema>\n";
+
+  /** Merges values given newest first, the way the RangeServer does */
+  String merge(MergeOperator *op, const char **values) {
+    DynamicBuffer acc;
+    acc.set(values[0], strlen(values[0]));
+    for (size_t i=1; values[i]; i++)
+      op->merge(acc, (const uint8_t *)values[i], strlen(values[i]));
+    return String((const char *)acc.base, acc.fill());
+  }
+
+  void test_operators() {
+    MergeOperator *op;
+
+    HT_ASSERT(MergeOperator::get("median") == 0);
+    HT_ASSERT(MergeOperator::get("MAX") == MergeOperator::get("max"));
+
+    const char *numbers[] = { "9", "10", "-3", "7", 0 };
+    op = MergeOperator::get("max");
+    HT_ASSERT(merge(op, numbers) == "10");
+    op = MergeOperator::get("min");
+    HT_ASSERT(merge(op, numbers) == "-3");
+
+    const char *strings[] = { "pear", "apple", "zebra", 0 };
+    HT_ASSERT(merge(MergeOperator::get("max"), strings) == "zebra");
+    HT_ASSERT(merge(MergeOperator::get("min"), strings) == "apple");
+
+    // integers sort below everything else, so the result doesn't depend
+    // on the order in which the values are merged
+    const char *mixed1[] = { "2", "10", "1a", 0 };
+    const char *mixed2[] = { "1a", "2", "10", 0 };
+    const char *mixed3[] = { "10", "1a", "2", 0 };
+    HT_ASSERT(merge(MergeOperator::get("max"), mixed1) == "1a");
+    HT_ASSERT(merge(MergeOperator::get("max"), mixed2) == "1a");
+    HT_ASSERT(merge(MergeOperator::get("max"), mixed3) == "1a");
+    HT_ASSERT(merge(MergeOperator::get("min"), mixed1) == "2");
+    HT_ASSERT(merge(MergeOperator::get("min"), mixed2) == "2");
+    HT_ASSERT(merge(MergeOperator::get("min"), mixed3) == "2");
+
+    const char *pieces[] = { "c", "b", "a", 0 };
+    HT_ASSERT(merge(MergeOperator::get("append"), pieces) == "abc");
+
+    // hll: merging in different groupings gives the same sketch
+    op = MergeOperator::get("hll");
+    DynamicBuffer left, right, out;
+    String item;
+    left.set("item0", 5);
+    right.set("item500", 7);
+    for (int i=1; i<500; i++) {
+      item = format("item%d", i);
+      op->merge(left, (const uint8_t *)item.c_str(), item.length());
+      item = format("item%d", i+500);
+      op->merge(right, (const uint8_t *)item.c_str(), item.length());
+      // duplicates don't change the count
+      item = format("item%d", i);
+      op->merge(right, (const uint8_t *)item.c_str(), item.length());
+    }
+    HT_ASSERT(HyperLogLog::is_sketch(left.base, left.fill()));
+    op->merge(left, right.base, right.fill());
+    HT_ASSERT(op->finalize(left.base, left.fill(), out));
+    uint64_t estimate = strtoull(String((const char *)out.base,
+                                        out.fill()).c_str(), 0, 10);
+    cout << "hll estimate for 1000 distinct items: " << estimate << endl;
+    HT_ASSERT(estimate > 900 && estimate < 1100);
+
+    HT_ASSERT(op->finalize((const uint8_t *)"x", 1, out));
+    HT_ASSERT(String((const char *)out.base, out.fill()) == "1");
+  }
+
+  void test_schema() {
+    Schema *schema = Schema::new_instance(schema_xml, strlen(schema_xml));
+    HT_ASSERT(schema->is_valid());
+    HT_ASSERT(schema->get_merge_operator(1) == MergeOperator::get("max"));
+    HT_ASSERT(schema->get_merge_operator(2) == MergeOperator::get("hll"));
+    HT_ASSERT(schema->get_merge_operator(3) == 0);
+
+    String output;
+    schema->render(output, true);
+    Schema *schema2 = Schema::new_instance(output, output.length());
+    HT_ASSERT(schema2->is_valid());
+    HT_ASSERT(schema2->get_merge_operator(1) == MergeOperator::get("max"));
+
+    Schema copy(*schema2);
+    HT_ASSERT(copy.get_merge_operator(2) == MergeOperator::get("hll"));
+
+    output.clear();
+    schema->render_hql_create_table("t", output);
+    HT_ASSERT(output.find("hi MERGE_OPERATOR=max") != String::npos);
+    delete schema;
+    delete schema2;
+
+    schema = Schema::new_instance(bad_schema_xml, strlen(bad_schema_xml));
+    HT_ASSERT(!schema->is_valid());
+    delete schema;
+
+    schema = Schema::new_instance(counter_schema_xml,
+                                  strlen(counter_schema_xml));
+    HT_ASSERT(!schema->is_valid());
+    delete schema;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  test_operators();
+  test_schema();
+  return 0;
+}
@@ -97,6 +97,22 @@ namespace {
 
   MetaLog::DefinitionPtr g_test_definition = new MetaLog::TestDefinition();
 
+  /** DFS client that can be told to fail the next few appends */
+  class FailingClient : public DfsBroker::Client {
+  public:
+    FailingClient(const String &host, int port, uint32_t timeout_ms)
+      : DfsBroker::Client(host, port, timeout_ms), failing_appends(0) { }
+    using DfsBroker::Client::append;
+    virtual size_t append(int32_t fd, StaticBuffer &buffer, uint32_t flags) {
+      if (failing_appends > 0) {
+        failing_appends--;
+        HT_THROW(Error::DFSBROKER_IO_ERROR, "induced append failure");
+      }
+      return DfsBroker::Client::append(fd, buffer, flags);
+    }
+    int failing_appends;
+  };
+
   vector<MetaLog::EntityPtr> g_entities;
 
   void create_entities(int count) {
@@ -142,7 +158,7 @@ main(int ac, char *av[]) {
     String host = get_str("dfs-host");
     uint16_t port = get_i16("dfs-port");
 
-    DfsBroker::Client *client = new DfsBroker::Client(host, port, timeout);
+    FailingClient *client = new FailingClient(host, port, timeout);
 
     if (!client->wait_for_connection(timeout)) {
       HT_ERROR_OUT <<"Unable to connect to DFS: "<< host <<':'<< port << HT_END;
@@ -225,6 +241,46 @@ main(int ac, char *av[]) {
       HT_ASSERT(FileUtils::size("metalog_test3.out") == FileUtils::size("metalog_test2.golden"));
     }
 
+    /**
+     *  A failed append is retried in a new log file that holds all of the
+     *  live entities.  If that fails too the caller gets the error and the
+     *  next write tries a new file again.
+     */
+
+    MetaLog::Writer::skip_recover_entry = false;
+
+    {
+      String logdir = testdir + "/failure/" + g_test_definition->name();
+      vector<MetaLog::EntityPtr> entities;
+      for (int i=0; i<3; i++)
+        entities.push_back( new MetaLog::EntityGeneric(65536+i) );
+      writer = new MetaLog::Writer(fs, g_test_definition, logdir, entities);
+
+      client->failing_appends = 1;
+      writer->record_state(entities[1].get());
+
+      bool failed = false;
+      client->failing_appends = 2;
+      try {
+        writer->record_state(entities[0].get());
+      }
+      catch (Exception &e) {
+        HT_ASSERT(e.code() == Error::DFSBROKER_IO_ERROR);
+        failed = true;
+      }
+      HT_ASSERT(failed);
+
+      writer->record_state(entities[0].get());
+      writer->record_removal(entities[2].get());
+      writer = 0;
+
+      reader = new MetaLog::Reader(fs, g_test_definition, logdir);
+      entities.clear();
+      reader->get_entities(entities);
+      reader = 0;
+      HT_ASSERT(entities.size() == 2);
+    }
+
     if (!has("save"))
       fs->rmdir(testdir);
   }
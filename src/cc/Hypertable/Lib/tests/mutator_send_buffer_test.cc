@@ -0,0 +1,280 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cstring>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/LocationCache.h"
+#include "Hypertable/Lib/RangeLocator.h"
+#include "Hypertable/Lib/Schema.h"
+#include "Hypertable/Lib/TableMutatorAsyncLastRange.h"
+#include "Hypertable/Lib/TableMutatorAsyncSendBuffer.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  const char *schema_str =
+    "<Schema>\n"
+    "  <AccessGroup name=\"default\">\n"
+    "    <ColumnFamily id=\"1\">\n"
+    "      <Generation>1</Generation>\n"
+    "      <Name>a</Name>\n"
+    "      <deleted>false</deleted>\n"
+    "    </ColumnFamily>\n"
+    "    <ColumnFamily id=\"2\">\n"
+    "      <Generation>1</Generation>\n"
+    "      <Name>c</Name>\n"
+    "      <Counter>true</Counter>\n"
+    "      <deleted>false</deleted>\n"
+    "    </ColumnFamily>\n"
+    "  </AccessGroup>\n"
+    "</Schema>\n";
+
+  /** Appends an update the way TableMutatorAsyncScatterBuffer::set() does */
+  void add(TableMutatorAsyncSendBuffer &send_buffer, uint8_t flag,
+           const char *row, uint8_t family, const char *qualifier,
+           int64_t timestamp, const char *value) {
+    send_buffer.key_offsets.push_back(send_buffer.accum.fill());
+    create_key_and_append(send_buffer.accum, flag, row, family, qualifier,
+                          timestamp);
+    append_as_byte_string(send_buffer.accum, value, strlen(value));
+  }
+
+  /** Encoded length of one update, as it appears in pending_updates */
+  size_t update_length(uint8_t flag, const char *row, uint8_t family,
+                       const char *qualifier, int64_t timestamp,
+                       const char *value) {
+    DynamicBuffer buf;
+    create_key_and_append(buf, flag, row, family, qualifier, timestamp);
+    append_as_byte_string(buf, value, strlen(value));
+    return buf.fill();
+  }
+
+  /** Decodes pending_updates into "row/family:qualifier@ts=value;" form */
+  String pending(TableMutatorAsyncSendBuffer &send_buffer) {
+    const StaticBuffer &buf = send_buffer.pending_updates;
+    ByteString bs;
+    const uint8_t *value;
+    size_t value_len;
+    Key key;
+    String result;
+    uint32_t count = 0;
+
+    bs.ptr = buf.base;
+    while (bs.ptr < buf.base + buf.size) {
+      key.load((SerializedKey)bs);
+      bs.next();
+      value_len = bs.decode_length(&value);
+      bs.next();
+      result += format("%s%s/%d:%s", key.flag == FLAG_INSERT ? "" : "DEL ",
+                       key.row, (int)key.column_family_code,
+                       key.column_qualifier);
+      if (key.timestamp != AUTO_ASSIGN)
+        result += format("@%lld", (Lld)key.timestamp);
+      result += "=" + String((const char *)value, value_len) + ";";
+      count++;
+    }
+    HT_ASSERT(count == send_buffer.send_count);
+    return result;
+  }
+
+  void check(const String &got, const char *expected) {
+    if (got != expected) {
+      HT_ERRORF("Expected '%s', got '%s'", expected, got.c_str());
+      _exit(1);
+    }
+  }
+
+  void test_prepare_updates(Schema *schema) {
+    TableIdentifier tid("1");
+    TableMutatorAsyncCompletionCounter counter;
+
+    // duplicate inserts with auto-assigned timestamps, out of row order
+    {
+      TableMutatorAsyncSendBuffer send_buffer(&tid, &counter, 0);
+      add(send_buffer, FLAG_INSERT, "r2", 1, "q", AUTO_ASSIGN, "x");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "a");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "b");
+      add(send_buffer, FLAG_INSERT, "r2", 1, "q", AUTO_ASSIGN, "y");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "p", AUTO_ASSIGN, "c");
+      send_buffer.prepare_updates(schema, true);
+      check(pending(send_buffer), "r1/1:q=b;r1/1:p=c;r2/1:q=y;");
+      HT_ASSERT(send_buffer.send_count == 3);
+      HT_ASSERT(send_buffer.pending_updates.size ==
+                update_length(FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "b") +
+                update_length(FLAG_INSERT, "r1", 1, "p", AUTO_ASSIGN, "c") +
+                update_length(FLAG_INSERT, "r2", 1, "q", AUTO_ASSIGN, "y"));
+      HT_ASSERT(send_buffer.accum.fill() == 0);
+      HT_ASSERT(send_buffer.key_offsets.empty());
+    }
+
+    // explicit timestamps: only byte-identical keys supersede each other,
+    // and an auto-assigned timestamp never matches an explicit one
+    {
+      TableMutatorAsyncSendBuffer send_buffer(&tid, &counter, 0);
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", 5, "a");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", 6, "b");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "c");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", 5, "d");
+      send_buffer.prepare_updates(schema, true);
+      check(pending(send_buffer), "r1/1:q@6=b;r1/1:q=c;r1/1:q@5=d;");
+      HT_ASSERT(send_buffer.send_count == 3);
+      HT_ASSERT(send_buffer.pending_updates.size ==
+                update_length(FLAG_INSERT, "r1", 1, "q", 6, "b") +
+                update_length(FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "c") +
+                update_length(FLAG_INSERT, "r1", 1, "q", 5, "d"));
+    }
+
+    // deletes and counter updates are never dropped, and keep their order
+    {
+      TableMutatorAsyncSendBuffer send_buffer(&tid, &counter, 0);
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "a");
+      add(send_buffer, FLAG_DELETE_CELL, "r1", 1, "q", AUTO_ASSIGN, "");
+      add(send_buffer, FLAG_DELETE_CELL, "r1", 1, "q", AUTO_ASSIGN, "");
+      add(send_buffer, FLAG_INSERT, "r1", 2, "n", AUTO_ASSIGN, "1");
+      add(send_buffer, FLAG_INSERT, "r1", 2, "n", AUTO_ASSIGN, "2");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "b");
+      add(send_buffer, FLAG_DELETE_ROW, "r1", 0, "", AUTO_ASSIGN, "");
+      send_buffer.prepare_updates(schema, true);
+      check(pending(send_buffer), "DEL r1/1:q=;DEL r1/1:q=;r1/2:n=1;r1/2:n=2;"
+            "r1/1:q=b;DEL r1/0:=;");
+      HT_ASSERT(send_buffer.send_count == 6);
+    }
+
+    // without coalescing every update is sent
+    {
+      TableMutatorAsyncSendBuffer send_buffer(&tid, &counter, 0);
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "a");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "b");
+      size_t len = send_buffer.accum.fill();
+      send_buffer.prepare_updates(schema, false);
+      check(pending(send_buffer), "r1/1:q=a;r1/1:q=b;");
+      HT_ASSERT(send_buffer.send_count == 2);
+      HT_ASSERT(send_buffer.pending_updates.size == len);
+    }
+
+    // retries are resent as is, already coalesced by the first send
+    {
+      TableMutatorAsyncSendBuffer send_buffer(&tid, &counter, 0);
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "a");
+      add(send_buffer, FLAG_INSERT, "r1", 1, "q", AUTO_ASSIGN, "b");
+      send_buffer.retry_count = 2;
+      size_t len = send_buffer.accum.fill();
+      send_buffer.prepare_updates(schema, true);
+      check(pending(send_buffer), "r1/1:q=a;r1/1:q=b;");
+      HT_ASSERT(send_buffer.send_count == 2);
+      HT_ASSERT(send_buffer.pending_updates.size == len);
+    }
+  }
+
+  void insert_range(LocationCache &cache, const char *start_row,
+                    const char *end_row, const char *location) {
+    RangeLocationInfo range_info;
+    range_info.start_row = start_row;
+    range_info.end_row = end_row;
+    range_info.addr.set_proxy(location);
+    cache.insert("1", range_info);
+  }
+
+  /** Looks up row the way TableMutatorAsyncScatterBuffer::get_send_buffer() does */
+  TableMutatorAsyncSendBuffer *
+  get_send_buffer(TableMutatorAsyncLastRange &last_range, LocationCache &cache,
+                  const char *row, TableMutatorAsyncSendBuffer **send_buffers,
+                  int *lookups) {
+    TableMutatorAsyncSendBuffer *send_buffer;
+    if ((send_buffer = last_range.lookup(row, &cache)) != 0)
+      return send_buffer;
+    HT_ASSERT(cache.lookup("1", row, &last_range.info));
+    (*lookups)++;
+    send_buffer = send_buffers[last_range.info.addr.proxy == "rs1" ? 0 : 1];
+    last_range.set(send_buffer);
+    return send_buffer;
+  }
+
+  void test_last_range() {
+    TableIdentifier tid("1");
+    TableMutatorAsyncCompletionCounter counter;
+    TableMutatorAsyncSendBuffer send_buffer1(&tid, &counter, 0);
+    TableMutatorAsyncSendBuffer send_buffer2(&tid, &counter, 0);
+    TableMutatorAsyncSendBuffer *rs1 = &send_buffer1, *rs2 = &send_buffer2;
+    TableMutatorAsyncSendBuffer *send_buffers[2] = { rs1, rs2 };
+    TableMutatorAsyncLastRange last_range;
+    LocationCache cache(100);
+    int lookups = 0;
+
+    insert_range(cache, "", "m", "rs1");
+    insert_range(cache, "m", Key::END_ROW_MARKER, "rs2");
+
+    // rows inside the remembered range skip the location cache
+    HT_ASSERT(get_send_buffer(last_range, cache, "b", send_buffers, &lookups) == rs1);
+    HT_ASSERT(get_send_buffer(last_range, cache, "c", send_buffers, &lookups) == rs1);
+    HT_ASSERT(get_send_buffer(last_range, cache, "m", send_buffers, &lookups) == rs1);
+    HT_ASSERT(lookups == 1);
+
+    // the start row is exclusive
+    HT_ASSERT(get_send_buffer(last_range, cache, "n", send_buffers, &lookups) == rs2);
+    HT_ASSERT(lookups == 2);
+    HT_ASSERT(last_range.lookup("m", &cache) == 0);
+    HT_ASSERT(get_send_buffer(last_range, cache, "m", send_buffers, &lookups) == rs1);
+    HT_ASSERT(lookups == 3);
+
+    // send() and reset() clear it
+    last_range.clear();
+    HT_ASSERT(last_range.lookup("c", &cache) == 0);
+    HT_ASSERT(get_send_buffer(last_range, cache, "c", send_buffers, &lookups) == rs1);
+    HT_ASSERT(lookups == 4);
+
+    // a failed send invalidates the range before its updates are redone;
+    // the next row must see the new location
+    HT_ASSERT(cache.invalidate("1", "c"));
+    insert_range(cache, "", "m", "rs2");
+    HT_ASSERT(get_send_buffer(last_range, cache, "d", send_buffers, &lookups) == rs2);
+    HT_ASSERT(lookups == 5);
+    HT_ASSERT(get_send_buffer(last_range, cache, "e", send_buffers, &lookups) == rs2);
+    HT_ASSERT(lookups == 5);
+
+    // invalidating an unrelated range drops it too
+    HT_ASSERT(cache.invalidate("1", "x"));
+    HT_ASSERT(last_range.lookup("e", &cache) == 0);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  Schema *schema = Schema::new_instance(schema_str, strlen(schema_str));
+
+  if (!schema->is_valid()) {
+    HT_ERRORF("Schema Parse Error: %s", schema->get_error_string());
+    return 1;
+  }
+
+  test_prepare_updates(schema);
+  test_last_range();
+
+  delete schema;
+  return 0;
+}
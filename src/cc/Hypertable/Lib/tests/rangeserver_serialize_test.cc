@@ -45,11 +45,32 @@ int main(int argc, char *argv[]) {
   stats1->block_cache_available_memory = Random::number64();
   stats1->block_cache_accesses = Random::number64();
   stats1->block_cache_hits = Random::number64();
+  stats1->local_block_cache_capacity = Random::number64();
+  stats1->local_block_cache_used = Random::number64();
+  stats1->local_block_cache_accesses = Random::number64();
+  stats1->local_block_cache_hits = Random::number64();
+  stats1->update_throttle_level = Random::number32() % 101;
+  stats1->updates_throttled = Random::number64();
+  stats1->update_throttle_millis = Random::number64();
+  stats1->update_qualify_batches = Random::number64();
+  stats1->update_range_lists = Random::number64();
+  stats1->update_arena_bytes = Random::number64();
   stats1->tracked_memory = Random::number64();
   stats1->cpu_user = Random::uniform01();
   stats1->cpu_sys = Random::uniform01();
   stats1->live = (Random::number32() % 2) == 0;
 
+  for (int i=0; i<StatsRangeServer::LATENCY_PHASE_COUNT; i++) {
+    for (size_t j=0; j<100; j++)
+      stats1->latency[i].add(Random::number32() % 100000);
+  }
+
+  for (int i=0; i<BlockCompressionCodec::COMPRESSION_TYPE_LIMIT; i++) {
+    stats1->codec_blocks[i] = Random::number32();
+    stats1->codec_bytes[i] = Random::number64();
+    stats1->codec_zbytes[i] = Random::number64();
+  }
+
   stats1->system.refresh();
 
   StatsTable table_stat;
@@ -0,0 +1,86 @@
+/** -*- c++ -*-
+ * Copyright (C) 2012 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+
+#include <re2/re2.h>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/ScanSpec.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Checks the derived interval and that it covers sample matching rows */
+  void check(const char *regexp, const char *start, const char *end,
+             const char *rows[] = 0) {
+    String start_row, end_row;
+    bool found = ScanSpec::row_regexp_interval(regexp, start_row, end_row);
+
+    if (start == 0) {
+      HT_ASSERT(!found);
+      HT_ASSERT(start_row == "" && end_row == "");
+      return;
+    }
+
+    HT_ASSERT(found);
+    if (start_row != start || end_row != end)
+      HT_FATALF("%s: expected [%s, %s) got [%s, %s)", regexp, start, end,
+                start_row.c_str(), end_row.c_str());
+
+    RE2 re(regexp);
+    for (size_t i=0; rows && rows[i]; i++) {
+      HT_ASSERT(RE2::PartialMatch(rows[i], re));
+      HT_ASSERT(start_row <= rows[i]);
+      HT_ASSERT(end_row == "" || rows[i] < end_row);
+    }
+  }
+
+}
+
+int main(int argc, char *argv[]) {
+  const char *user_rows[] = { "user:1234:", "user:1234:\xff\xff",
+                              "user:1234:profile", 0 };
+  const char *short_rows[] = { "user:12345", "user:1234\xff", 0 };
+  const char *alt_rows[] = { "abc", "abd", "abdz", 0 };
+
+  check("^user:1234:.*", "user:1234:", "user:1234;", user_rows);
+  check("^user:1234", "user:1234", "user:1235", short_rows);
+  check("^abc|^abd", "ab", "ac", alt_rows);
+  check("^ab(c|d)", "ab", "ac", alt_rows);
+  check("^a\\|b", "a|b", "a|c");
+  check("^[|]x", "|x", "|y");
+
+  // unanchored or without a literal prefix
+  check("user:1234", 0, 0);
+  check("^abc|abd", 0, 0);
+  check("^(?i)abc", 0, 0);
+  check("^.*abc", 0, 0);
+  check("^\\Qa\\E", 0, 0);
+  check("^(", 0, 0);
+  check("", 0, 0);
+  check(0, 0, 0);
+
+  return 0;
+}
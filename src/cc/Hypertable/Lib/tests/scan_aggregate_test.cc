@@ -0,0 +1,178 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <cstring>
+
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/ScanAggregator.h"
+#include "Hypertable/Lib/ScanSpec.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Partial results as two ranges would return them */
+  struct Partial {
+    const char *row;
+    const char *family;
+    const char *qualifier;
+    const char *value;
+  };
+
+  String combine(int function, int group, const Partial *partials,
+                 CellsBuilder &out) {
+    ScanSpec spec;
+    spec.set_aggregate(function, group);
+    ScanAggregator aggregator(spec);
+    Cell cell;
+    out.clear();
+    for (size_t i=0; partials[i].row; i++) {
+      cell.row_key = partials[i].row;
+      cell.column_family = partials[i].family;
+      cell.column_qualifier = partials[i].qualifier;
+      cell.value = (const uint8_t *)partials[i].value;
+      cell.value_len = strlen(partials[i].value);
+      cell.timestamp = i;
+      aggregator.add(cell, out);
+    }
+    aggregator.finish(out);
+    String result;
+    for (size_t i=0; i<out.size(); i++) {
+      out.get_cell(cell, i);
+      result += format("%s/%s:%s=%s;", cell.row_key, cell.column_family,
+                       cell.column_qualifier,
+                       String((const char *)cell.value, cell.value_len).c_str());
+    }
+    return result;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  AggregateValue value;
+  DynamicBuffer result;
+
+  // RangeServer side
+  value.add_value(ScanSpec::AGGREGATE_SUM, (const uint8_t *)"12", 2);
+  value.add_value(ScanSpec::AGGREGATE_SUM, (const uint8_t *)"-2", 2);
+  value.result(ScanSpec::AGGREGATE_SUM, result);
+  HT_ASSERT(String((const char *)result.base, result.fill()) == "10");
+
+  // non-numeric values are rejected rather than counted as zero
+  const char *bad[] = { "abc", "12abc", "", "99999999999999999999", 0 };
+  for (size_t i=0; bad[i]; i++) {
+    bool thrown = false;
+    try {
+      value.add_value(ScanSpec::AGGREGATE_SUM, (const uint8_t *)bad[i],
+                      strlen(bad[i]));
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::BAD_SCAN_SPEC);
+      thrown = true;
+    }
+    HT_ASSERT(thrown);
+  }
+  value.result(ScanSpec::AGGREGATE_SUM, result);
+  HT_ASSERT(String((const char *)result.base, result.fill()) == "10");
+
+  AggregateValue extreme;
+  extreme.add_value(ScanSpec::AGGREGATE_MAX, (const uint8_t *)"9", 1);
+  extreme.add_value(ScanSpec::AGGREGATE_MAX, (const uint8_t *)"10", 2);
+  extreme.result(ScanSpec::AGGREGATE_MAX, result);
+  HT_ASSERT(String((const char *)result.base, result.fill()) == "10");
+
+  // client side
+  CellsBuilder cells;
+  Partial counts[] = {
+    { "", "a", "", "3" }, { "", "b", "", "1" }, { "", "a", "", "4" },
+    { 0, 0, 0, 0 }
+  };
+  HT_ASSERT(combine(ScanSpec::AGGREGATE_COUNT,
+                    ScanSpec::AGGREGATE_GROUP_COLUMN_FAMILY, counts, cells)
+            == "/a:=7;/b:=1;");
+
+  Partial rows[] = {
+    { "r1", "a", "", "5" }, { "r1", "b", "", "7" }, { "r2", "a", "", "2" },
+    { 0, 0, 0, 0 }
+  };
+  HT_ASSERT(combine(ScanSpec::AGGREGATE_MIN, ScanSpec::AGGREGATE_GROUP_ROW,
+                    rows, cells) == "r1/a:=5;r2/a:=2;");
+
+  // row groups are emitted as soon as the next row arrives
+  {
+    ScanSpec spec;
+    spec.set_aggregate(ScanSpec::AGGREGATE_SUM, ScanSpec::AGGREGATE_GROUP_ROW);
+    ScanAggregator aggregator(spec);
+    CellsBuilder out;
+    Cell cell;
+    cell.column_family = "a";
+    cell.column_qualifier = "";
+    cell.row_key = "r1";
+    cell.value = (const uint8_t *)"3";
+    cell.value_len = 1;
+    aggregator.add(cell, out);
+    // same row from the next range
+    aggregator.add(cell, out);
+    HT_ASSERT(out.size() == 0);
+    cell.row_key = "r2";
+    aggregator.add(cell, out);
+    HT_ASSERT(out.size() == 1);
+    out.get_cell(cell, 0);
+    HT_ASSERT(!strcmp(cell.row_key, "r1"));
+    HT_ASSERT(String((const char *)cell.value, cell.value_len) == "6");
+    aggregator.finish(out);
+    HT_ASSERT(out.size() == 2);
+  }
+
+  Partial qualifiers[] = {
+    { "", "a", "x", "5" }, { "", "a", "y", "2" }, { "", "a", "x", "7" },
+    { 0, 0, 0, 0 }
+  };
+  HT_ASSERT(combine(ScanSpec::AGGREGATE_SUM,
+                    ScanSpec::AGGREGATE_GROUP_QUALIFIER, qualifiers, cells)
+            == "/a:x=12;/a:y=2;");
+
+  // the aggregate spec survives serialization and copying
+  ScanSpecBuilder builder;
+  builder.add_column("a");
+  builder.set_aggregate(ScanSpec::AGGREGATE_MAX,
+                        ScanSpec::AGGREGATE_GROUP_QUALIFIER);
+  size_t len = builder.get().encoded_length();
+  uint8_t *buf = new uint8_t [len];
+  uint8_t *ptr = buf;
+  builder.get().encode(&ptr);
+  HT_ASSERT((size_t)(ptr - buf) == len);
+  const uint8_t *cptr = buf;
+  ScanSpec decoded(&cptr, &len);
+  HT_ASSERT(len == 0);
+  HT_ASSERT(decoded.aggregate == ScanSpec::AGGREGATE_MAX);
+  HT_ASSERT(decoded.aggregate_group == ScanSpec::AGGREGATE_GROUP_QUALIFIER);
+  delete [] buf;
+
+  ScanSpecBuilder copy(builder.get());
+  HT_ASSERT(copy.get().aggregate == ScanSpec::AGGREGATE_MAX);
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+/** -*- c++ -*-
+ * Copyright (C) 2012 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/TableSplitSpec.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  /** Checks that rows are strictly increasing and valid split rows */
+  void check_ordered(std::vector<String> &rows) {
+    for (size_t i=0; i<rows.size(); i++) {
+      HT_ASSERT(!rows[i].empty());
+      HT_ASSERT(rows[i].find('\0') == String::npos);
+      HT_ASSERT(rows[i] < Key::END_ROW_MARKER);
+      if (i > 0)
+        HT_ASSERT(rows[i-1] < rows[i]);
+    }
+    std::vector<String> copy = rows;
+    TableSplitSpec::normalize(copy);
+    HT_ASSERT(copy == rows);
+  }
+
+  bool throws_bad_key(const String &algorithm, uint32_t range_count) {
+    std::vector<String> rows;
+    try {
+      TableSplitSpec::generate(algorithm, range_count, rows);
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::BAD_KEY);
+      return true;
+    }
+    return false;
+  }
+
+}
+
+int main(int argc, char *argv[]) {
+  std::vector<String> rows;
+
+  TableSplitSpec::generate("hash", 4, rows);
+  HT_ASSERT(rows.size() == 3);
+  HT_ASSERT(rows[0] == "40000000");
+  HT_ASSERT(rows[1] == "80000000");
+  HT_ASSERT(rows[2] == "c0000000");
+
+  TableSplitSpec::generate("HASH", 1, rows);
+  HT_ASSERT(rows.empty());
+
+  TableSplitSpec::generate("hash", 1000, rows);
+  HT_ASSERT(rows.size() == 999);
+  check_ordered(rows);
+
+  TableSplitSpec::generate("uniform", 2, rows);
+  HT_ASSERT(rows.size() == 1);
+  HT_ASSERT(rows[0] == "\x80");
+
+  TableSplitSpec::generate("Uniform", 256, rows);
+  HT_ASSERT(rows.size() == 255);
+  HT_ASSERT(rows[0] == "\x01");
+  check_ordered(rows);
+
+  TableSplitSpec::generate("uniform", 3, rows);
+  HT_ASSERT(rows.size() == 2);
+  check_ordered(rows);
+
+  HT_ASSERT(throws_bad_key("uniform", 257));
+  HT_ASSERT(throws_bad_key("hash", 0));
+  HT_ASSERT(throws_bad_key("hash", TableSplitSpec::MAX_RANGES + 1));
+  HT_ASSERT(throws_bad_key("random", 4));
+
+  rows.clear();
+  rows.push_back("m");
+  rows.push_back("c");
+  rows.push_back("m");
+  rows.push_back("x");
+  TableSplitSpec::normalize(rows);
+  HT_ASSERT(rows.size() == 3);
+  HT_ASSERT(rows[0] == "c" && rows[1] == "m" && rows[2] == "x");
+
+  rows.push_back("");
+  try {
+    TableSplitSpec::normalize(rows);
+    HT_ASSERT(!"empty split row accepted");
+  }
+  catch (Exception &e) {
+    HT_ASSERT(e.code() == Error::BAD_KEY);
+  }
+
+  rows.clear();
+  rows.push_back(Key::END_ROW_MARKER);
+  try {
+    TableSplitSpec::normalize(rows);
+    HT_ASSERT(!"END_ROW_MARKER split row accepted");
+  }
+  catch (Exception &e) {
+    HT_ASSERT(e.code() == Error::BAD_KEY);
+  }
+
+  return 0;
+}
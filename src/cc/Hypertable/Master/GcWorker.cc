@@ -23,6 +23,9 @@
 #include <unistd.h>
 #include <boost/algorithm/string.hpp>
 
+#include "Common/Stopwatch.h"
+#include "Common/Thread.h"
+
 #include "Context.h"
 #include "GcWorker.h"
 
@@ -33,18 +36,44 @@ extern "C" {
 using namespace Hypertable;
 using namespace std;
 
-GcWorker::GcWorker(ContextPtr &context) : m_context(context) {
+GcWorker::GcWorker(ContextPtr &context, bool dryrun)
+  : m_context(context), m_dryrun(dryrun), m_next_item(0),
+    m_scan_failed(false), m_cells_scanned(0), m_orphans(0),
+    m_files_removed(0), m_remove_errors(0), m_bytes_reclaimed(0) {
   m_tables_dir = context->props->get_str("Hypertable.Directory");
   boost::trim_if(m_tables_dir, boost::is_any_of("/"));
   m_tables_dir = String("/") + m_tables_dir + "/tables/";
+  m_concurrency = context->props->get_i32("Hypertable.Master.Gc.Concurrency");
+  if (m_concurrency < 1)
+    m_concurrency = 1;
+  m_scan_directories =
+    context->props->get_bool("Hypertable.Master.Gc.ScanDirectories");
 }
 
 void GcWorker::gc() {
   try {
-    CountMap files_map;
-    scan_metadata(files_map);
-    // TODO: scan_directories(files_map); // fsckish, slower
-    reap(files_map);
+    Stopwatch stopwatch;
+    compute_scan_partitions();
+    run_threads(&GcWorker::scan_partitions, m_partition_ends.size()+1);
+    if (m_scan_failed) {
+      HT_ERROR("MasterGc: METADATA scan incomplete, skipping file removal");
+      return;
+    }
+    double scan_time = stopwatch.elapsed();
+    if (m_scan_directories) {
+      collect_directories();
+      run_threads(&GcWorker::scan_directories, m_directories.size());
+    }
+    reap();
+    double elapsed = stopwatch.elapsed();
+    HT_INFOF("MasterGc: scanned %llu cells in %lu partitions (%.3fs), "
+             "tracked %lu files; removed %lu/%lu files (%lu orphaned), "
+             "%lu failed, reclaimed %llu bytes in %.3fs (%.1f files/s)",
+             (Llu)m_cells_scanned, (Lu)(m_partition_ends.size()+1),
+             scan_time, (Lu)m_files_map.size(), (Lu)m_files_removed,
+             (Lu)m_garbage.size(), (Lu)m_orphans, (Lu)m_remove_errors,
+             (Llu)m_bytes_reclaimed,
+             elapsed, elapsed > 0.0 ? (double)m_files_removed / elapsed : 0.0);
   }
   catch (Exception &e) {
     HT_ERRORF("Error: caught exception while gc'ing: %s", e.what());
@@ -52,13 +81,106 @@ void GcWorker::gc() {
 }
 
 
-void GcWorker::scan_metadata(CountMap &files_map) {
+/**
+ * Runs <code>method</code> in up to m_concurrency threads, each of which
+ * pulls work item indexes from next_item() until <code>items</code> have
+ * been handed out.
+ */
+void GcWorker::run_threads(void (GcWorker::*method)(), size_t items) {
+  size_t thread_count = std::min((size_t)m_concurrency, items);
+
+  m_next_item = 0;
+
+  if (thread_count <= 1) {
+    (this->*method)();
+    return;
+  }
+
+  ThreadGroup threads;
+  for (size_t i=0; i<thread_count; i++)
+    threads.create_thread(ThreadRunner(this, method));
+  threads.join_all();
+}
+
+bool GcWorker::next_item(size_t limit, size_t *indexp) {
+  ScopedLock lock(m_mutex);
+  if (m_scan_failed || m_next_item >= limit)
+    return false;
+  *indexp = m_next_item++;
+  return true;
+}
+
+
+/**
+ * Splits the METADATA scan at the end rows of the METADATA ranges (read
+ * from the rows of table 0/0), so each scanner is served by a single
+ * range.
+ */
+void GcWorker::compute_scan_partitions() {
+  ScanSpec scan_spec;
+  RowInterval ri;
+  String start_row = format("%s:", TableIdentifier::METADATA_ID);
+  String end_row = start_row + Key::END_ROW_MARKER;
+
+  scan_spec.max_versions = 1;
+  scan_spec.columns.push_back("StartRow");
+  ri.start = start_row.c_str();
+  ri.end = end_row.c_str();
+  scan_spec.row_intervals.push_back(ri);
+
+  TableScannerPtr scanner = m_context->metadata_table->create_scanner(scan_spec);
+  Cell cell;
+
+  m_partition_ends.clear();
+  while (scanner->next(cell)) {
+    const char *range_end = cell.row_key + start_row.length();
+    if (!strcmp(range_end, Key::END_ROW_MARKER))
+      continue;
+    if (m_partition_ends.empty() || m_partition_ends.back() != range_end)
+      m_partition_ends.push_back(range_end);
+  }
+}
+
+void GcWorker::scan_partitions() {
+  size_t i;
+  size_t partition_count = m_partition_ends.size() + 1;
+
+  while (next_item(partition_count, &i)) {
+    CountMap files_map;
+    String start_row = i ? m_partition_ends[i-1] : String();
+    String end_row = i < m_partition_ends.size() ?
+      m_partition_ends[i] : String(Key::END_ROW_MARKER);
+    try {
+      scan_metadata(start_row, i == 0, end_row, files_map);
+    }
+    catch (Exception &e) {
+      HT_ERRORF("MasterGc: problem scanning METADATA partition %lu - %s",
+                (Lu)i, e.what());
+      ScopedLock lock(m_mutex);
+      m_scan_failed = true;
+      continue;
+    }
+    ScopedLock lock(m_mutex);
+    foreach (const CountMap::value_type &v, files_map)
+      insert_file(m_files_map, v.first, v.second);
+  }
+}
+
+void GcWorker::scan_metadata(const String &start_row, bool start_inclusive,
+                             const String &end_row, CountMap &files_map) {
   TableScannerPtr scanner;
   ScanSpec scan_spec;
+  RowInterval ri;
 
   scan_spec.columns.clear();
   scan_spec.columns.push_back("Files");
 
+  ri.start = start_row.c_str();
+  ri.start_inclusive = start_inclusive;
+  ri.end = end_row.c_str();
+  ri.end_inclusive = true;
+  scan_spec.row_intervals.push_back(ri);
+
   scanner = m_context->metadata_table->create_scanner(scan_spec);
 
   TableMutatorPtr mutator = m_context->metadata_table->create_mutator();
@@ -68,10 +190,13 @@ void GcWorker::scan_metadata(CountMap &files_map) {
   string last_cq;
   int64_t last_time = 0;
   bool found_valid_files = true;
+  uint64_t cell_count = 0;
 
-  HT_DEBUG("MasterGc: scanning metadata...");
+  HT_DEBUGF("MasterGc: scanning metadata (%s, %s]...", start_row.c_str(),
+            end_row.c_str());
 
   while (scanner->next(cell)) {
+    cell_count++;
     if (strcmp("Files", cell.column_family)) {
       HT_ERRORF("Unexpected column family '%s', while scanning METADATA",
                 cell.column_family);
@@ -117,6 +242,9 @@ void GcWorker::scan_metadata(CountMap &files_map) {
     delete_row(last_row, mutator);
 
   mutator->flush();
+
+  ScopedLock lock(m_mutex);
+  m_cells_scanned += cell_count;
 }
 
 void GcWorker::delete_row(const std::string &row, TableMutatorPtr &mutator) {
@@ -131,7 +259,8 @@ void GcWorker::delete_row(const std::string &row, TableMutatorPtr &mutator) {
 
   HT_DEBUGF("MasterGc: Deleting row %s", (char *)key.row);
 
-  mutator->set_delete(key);
+  if (!m_dryrun)
+    mutator->set_delete(key);
 }
 
 void GcWorker::delete_cell(const Cell &cell, TableMutatorPtr &mutator) {
@@ -141,7 +270,8 @@ void GcWorker::delete_cell(const Cell &cell, TableMutatorPtr &mutator) {
 
   KeySpec key(cell.row_key, cell.column_family, cell.column_qualifier,
               cell.timestamp, FLAG_DELETE_CELL);
-  mutator->set_delete(key);
+  if (!m_dryrun)
+    mutator->set_delete(key);
 }
 
 
@@ -172,29 +302,135 @@ void GcWorker::insert_file(CountMap &map, const char *fname, int c) {
     (*ret.first).second += c;
 }
 
+
+namespace {
+
+  /**
+   * Parses the numeric suffix of a CellStore file name ("cs<N>").
+   * Returns false for anything else.
+   */
+  bool parse_cellstore_id(const char *name, uint32_t *idp) {
+    if (strncmp(name, "cs", 2) || !isdigit(name[2]))
+      return false;
+    char *end;
+    *idp = (uint32_t)strtoul(name+2, &end, 10);
+    return *end == 0;
+  }
+
+}
+
+/**
+ * Gathers the range directories that hold at least one live CellStore,
+ * along with the highest live CellStore id in each.
+ */
+void GcWorker::collect_directories() {
+  std::map<String, DirectoryInfo> directories;
+  uint32_t id;
+
+  foreach (const CountMap::value_type &v, m_files_map) {
+    const char *slash = strrchr(v.first, '/');
+    if (slash == 0 || !parse_cellstore_id(slash+1, &id))
+      continue;
+    DirectoryInfo &info = directories[String(v.first, slash - v.first)];
+    if (v.second > 0) {
+      if (!info.has_live || id > info.max_live_id)
+        info.max_live_id = id;
+      info.has_live = true;
+    }
+  }
+
+  m_directories.clear();
+  m_directory_info.clear();
+  for (std::map<String, DirectoryInfo>::iterator iter = directories.begin();
+       iter != directories.end(); ++iter) {
+    if (iter->second.has_live) {
+      m_directories.push_back(iter->first);
+      m_directory_info.push_back(iter->second);
+    }
+  }
+}
+
+/**
+ * Lists range directories and records CellStores that are not referenced
+ * from METADATA.  A CellStore is only treated as orphaned if a live
+ * CellStore with a higher id exists in the same directory, since ids are
+ * handed out in increasing order and a higher unreferenced file may be
+ * the output of a compaction that hasn't updated METADATA yet.
+ * Directories without live CellStores (e.g. ranges that are still being
+ * loaded after a split) are left alone.
+ */
+void GcWorker::scan_directories() {
+  std::vector<String> listing;
+  std::vector<String> orphans;
+  size_t i;
+  uint32_t id;
+
+  while (next_item(m_directories.size(), &i)) {
+    const String &dir = m_directories[i];
+    try {
+      m_context->dfs->readdir(m_tables_dir + dir, listing);
+    }
+    catch (Exception &e) {
+      HT_WARNF("MasterGc: unable to list %s%s - %s", m_tables_dir.c_str(),
+               dir.c_str(), e.what());
+      continue;
+    }
+    orphans.clear();
+    foreach (const String &entry, listing) {
+      if (!parse_cellstore_id(entry.c_str(), &id) ||
+          id >= m_directory_info[i].max_live_id)
+        continue;
+      String name = dir + "/" + entry;
+      if (m_files_map.find(name.c_str()) == m_files_map.end())
+        orphans.push_back(name);
+    }
+    if (!orphans.empty()) {
+      ScopedLock lock(m_mutex);
+      m_garbage.insert(m_garbage.end(), orphans.begin(), orphans.end());
+      m_orphans += orphans.size();
+    }
+  }
+}
+
 /**
  * Currently only stale cs files and range directories are reaped
  * Table directories probably should be obtained when removing
  * rows in METADATA
  */
-void GcWorker::reap(CountMap &files_map) {
-  size_t nf = 0, nf_done = 0, nd = 0, nd_done = 0;
-
-  foreach (const CountMap::value_type &v, files_map) {
-    if (!v.second) {
-      HT_INFOF("MasterGc: removing file %s", v.first);
-      try {
-        m_context->dfs->remove(m_tables_dir + v.first);
-        ++nf_done;
-      }
-      catch (Exception &e) {
-        HT_WARNF("%s", e.what());
-      }
-      ++nf;
-    }
+void GcWorker::reap() {
+  foreach (const CountMap::value_type &v, m_files_map) {
+    if (!v.second)
+      m_garbage.push_back(v.first);
   }
 
-  HT_DEBUGF("MasterGc: removed %lu/%lu files; %lu/%lu directories",
-            (Lu)nf_done, (Lu)nf, (Lu)nd_done, (Lu)nd);
+  run_threads(&GcWorker::remove_files, m_garbage.size());
 }
 
+void GcWorker::remove_files() {
+  size_t i;
+  int64_t length;
+
+  while (next_item(m_garbage.size(), &i)) {
+    String fname = m_tables_dir + m_garbage[i];
+    HT_INFOF("MasterGc: removing file %s", fname.c_str());
+    if (m_dryrun)
+      continue;
+    try {
+      length = m_context->dfs->length(fname);
+    }
+    catch (Exception &e) {
+      length = 0;
+    }
+    try {
+      m_context->dfs->remove(fname);
+      ScopedLock lock(m_mutex);
+      m_files_removed++;
+      m_bytes_reclaimed += length;
+    }
+    catch (Exception &e) {
+      HT_WARNF("%s", e.what());
+      ScopedLock lock(m_mutex);
+      m_remove_errors++;
+    }
+  }
+}
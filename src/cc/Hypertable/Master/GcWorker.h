@@ -22,7 +22,10 @@
 #ifndef HYPERTABLE_GCWORKER_H
 #define HYPERTABLE_GCWORKER_H
 
+#include <vector>
+
 #include "Common/CstrHashMap.h"
+#include "Common/Mutex.h"
 
 #include "Hypertable/Lib/Client.h"
 
@@ -32,21 +35,72 @@ namespace Hypertable {
 
   typedef CstrHashMap<int> CountMap; // filename -> reference count
 
+  /**
+   * Garbage collects CellStore files that are no longer referenced from
+   * the METADATA Files column.  METADATA is scanned with one scanner per
+   * METADATA range, and file removals are issued from a bounded pool of
+   * threads (Hypertable.Master.Gc.Concurrency).  When
+   * Hypertable.Master.Gc.ScanDirectories is set, range directories are
+   * also listed to find orphaned CellStores that were never recorded in
+   * METADATA.
+   */
   class GcWorker {
   public:
-    GcWorker(ContextPtr &context);
+    GcWorker(ContextPtr &context, bool dryrun=false);
     void gc();
 
   private:
-    void scan_metadata(CountMap &files_map);
+    class ThreadRunner {
+    public:
+      ThreadRunner(GcWorker *worker, void (GcWorker::*method)())
+        : m_worker(worker), m_method(method) { }
+      void operator()() { (m_worker->*m_method)(); }
+    private:
+      GcWorker *m_worker;
+      void (GcWorker::*m_method)();
+    };
+
+    struct DirectoryInfo {
+      DirectoryInfo() : max_live_id(0), has_live(false) { }
+      uint32_t max_live_id;
+      bool has_live;
+    };
+
+    void run_threads(void (GcWorker::*method)(), size_t items);
+    bool next_item(size_t limit, size_t *indexp);
+    void compute_scan_partitions();
+    void scan_partitions();
+    void scan_metadata(const String &start_row, bool start_inclusive,
+                       const String &end_row, CountMap &files_map);
     void delete_row(const std::string &row, TableMutatorPtr &mutator);
     void delete_cell(const Cell &cell, TableMutatorPtr &mutator);
     void insert_files(CountMap &map, const char *buf, size_t len, int c=0);
     void insert_file(CountMap &map, const char *fname, int c);
-    void reap(CountMap &files_map);
+    void collect_directories();
+    void scan_directories();
+    void reap();
+    void remove_files();
 
     ContextPtr m_context;
     String     m_tables_dir;
+    int32_t    m_concurrency;
+    bool       m_scan_directories;
+    bool       m_dryrun;
+
+    Mutex      m_mutex;
+    size_t     m_next_item;
+    bool       m_scan_failed;
+    CountMap   m_files_map;
+    std::vector<String> m_partition_ends;
+    std::vector<String> m_directories;
+    std::vector<DirectoryInfo> m_directory_info;
+    std::vector<String> m_garbage;
+
+    uint64_t   m_cells_scanned;
+    size_t     m_orphans;
+    size_t     m_files_removed;
+    size_t     m_remove_errors;
+    uint64_t   m_bytes_reclaimed;
   };
 
 } // namespace Hypertable
@@ -105,7 +105,46 @@ bool LoadBalancer::wait_for_complete(RangeMoveSpecPtr &move, uint32_t timeout_mi
   return true;
 }
 
+void LoadBalancer::get_incomplete_moves(std::vector<RangeMoveSpecPtr> &moves) {
+  ScopedLock lock(m_mutex);
+  moves.clear();
+  foreach (const RangeMoveSpecPtr &move, m_current_set) {
+    if (!move->complete)
+      moves.push_back(move);
+  }
+}
+
 void LoadBalancer::set_balanced() {
     m_context->set_servers_balanced(m_unbalanced_servers);
 }
 
+
+bool LoadBalancer::assign_to_servers(size_t range_count,
+                                     std::vector<String> &locations) {
+  std::vector<RangeServerConnectionPtr> servers;
+  String first;
+  size_t start = 0;
+
+  locations.clear();
+
+  // Start from the server next in line so that consecutive tables don't
+  // all begin on the same server
+  if (!Utility::next_available_server(m_context, first))
+    return false;
+
+  m_context->get_connected_servers(servers);
+  if (servers.empty())
+    return false;
+
+  for (start=0; start<servers.size(); start++) {
+    if (servers[start]->location() == first)
+      break;
+  }
+  if (start == servers.size())
+    start = 0;
+
+  for (size_t i=0; i<range_count; i++)
+    locations.push_back(servers[(start+i) % servers.size()]->location());
+
+  return true;
+}
@@ -69,8 +69,21 @@ namespace Hypertable {
     virtual bool move_complete(const TableIdentifier &table, const RangeSpec &range, int32_t error=0);
     virtual bool wait_for_complete(RangeMoveSpecPtr &move, uint32_t timeout_millis);
 
+    /** Fills <code>moves</code> with the registered moves that have not
+     * completed yet */
+    virtual void get_incomplete_moves(std::vector<RangeMoveSpecPtr> &moves);
+
     virtual void set_balanced();
-    //String assign_to_server(TableIdentifier &tid, RangeIdentifier &rid) = 0;
+
+    /**
+     * Chooses a server for each of range_count new ranges, spreading
+     * them evenly over the connected servers.
+     *
+     * @param range_count number of ranges to place
+     * @param locations vector to receive one location per range
+     * @return false if no server is available
+     */
+    virtual bool assign_to_servers(size_t range_count, std::vector<String> &locations);
     //void range_move_loaded(TableIdentifier &tid, RangeIdentifier &rid) = 0;
     //void range_relinquish_acknowledged(TableIdentifier &tid, RangeIdentifier &rid) = 0;
     //time_t maintenance_interval() = 0;
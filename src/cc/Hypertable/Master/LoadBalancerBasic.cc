@@ -23,6 +23,7 @@
 #include <boost/algorithm/string.hpp>
 
 #include "LoadBalancerBasic.h"
+#include "LoadBalancerBasicDistributeCost.h"
 #include "LoadBalancerBasicDistributeLoad.h"
 #include "LoadBalancerBasicDistributeTableRanges.h"
 
@@ -36,6 +37,7 @@ using namespace std;
 
 LoadBalancerBasic::LoadBalancerBasic(ContextPtr context) : LoadBalancer(context), m_waiting_for_servers(false) {
   m_enabled = context->props->get_bool("Hypertable.LoadBalancer.Enable");
+  m_cost_aware = context->props->get_bool("Hypertable.LoadBalancer.CostAware.Enable");
 }
 
 
@@ -129,17 +131,25 @@ void LoadBalancerBasic::calculate_balance_plan(const String &algo, BalancePlanPt
     }
     else if (algorithm.compare("LOAD")==0)
       mode = BALANCE_MODE_DISTRIBUTE_LOAD;
+    else if (algorithm.compare("COST")==0)
+      mode = BALANCE_MODE_DISTRIBUTE_COST;
     else
       HT_THROW(Error::NOT_IMPLEMENTED, (String)"Unknown LoadBalancer algorithm '" + algorithm
-          + "' supported algorithms are 'TABLE_RANGES', 'LOAD'");
+          + "' supported algorithms are 'TABLE_RANGES', 'LOAD', 'COST'");
   }
 
   // TODO: write a factory class to create the sub balancer objects
 
-  if (mode == BALANCE_MODE_DISTRIBUTE_LOAD && !m_waiting_for_servers) {
+  if (mode == BALANCE_MODE_DISTRIBUTE_COST && !m_waiting_for_servers)
+    distribute_cost(balance_plan);
+  else if (mode == BALANCE_MODE_DISTRIBUTE_LOAD && !m_waiting_for_servers) {
+    if (m_cost_aware)
+      mode = BALANCE_MODE_DISTRIBUTE_COST;
     distribute_load(now, balance_plan);
   }
   else {
+    // new servers get their share of table ranges before load is looked at
+    mode = BALANCE_MODE_DISTRIBUTE_TABLE_RANGES;
     time_duration td = now - m_wait_time_start;
     if (m_waiting_for_servers && td.total_milliseconds() > m_balance_wait)
       m_waiting_for_servers = false;
@@ -152,6 +162,8 @@ void LoadBalancerBasic::calculate_balance_plan(const String &algo, BalancePlanPt
     if (mode == BALANCE_MODE_DISTRIBUTE_LOAD) {
       HT_INFO_OUT << "LoadBalancerBasic mode=BALANCE_MODE_DISTRIBUTE_LOAD" << HT_END;
     }
+    else if (mode == BALANCE_MODE_DISTRIBUTE_COST)
+      HT_INFO_OUT << "LoadBalancerBasic mode=BALANCE_MODE_DISTRIBUTE_COST" << HT_END;
     else
       HT_INFO_OUT << "LoadBalancerBasic mode=BALANCE_MODE_DISTRIBUTE_TABLE_RANGES" << HT_END;
     HT_INFO_OUT << "BalancePlan created, move " << balance_plan->moves.size() << " ranges"
@@ -173,12 +185,25 @@ void LoadBalancerBasic::distribute_load(const ptime &now, BalancePlanPtr &balanc
       << m_balance_window_start << ", m_balance_window_end="
       << m_balance_window_end << HT_END;
 
+  if (m_cost_aware) {
+    distribute_cost(balance_plan);
+    return;
+  }
+
   LoadBalancerBasicDistributeLoad planner(m_balance_loadavg_threshold,
                                           m_context->rs_metrics_table);
   planner.compute_plan(balance_plan);
   return;
 }
 
+void LoadBalancerBasic::distribute_cost(BalancePlanPtr &balance_plan) {
+  LoadBalancerBasicDistributeCost planner(m_context->props,
+                                          m_context->rs_metrics_table);
+  std::vector<RangeMoveSpecPtr> in_progress;
+  get_incomplete_moves(in_progress);
+  planner.compute_plan(balance_plan, in_progress);
+}
+
 void LoadBalancerBasic::distribute_table_ranges(vector<RangeServerStatistics> &range_server_stats, BalancePlanPtr &balance_plan) {
   // no need to check if its time to do balance, we have empty servers, so do balance
   LoadBalancerBasicDistributeTableRanges  planner(m_context->metadata_table);
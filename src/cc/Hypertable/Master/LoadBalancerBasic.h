@@ -38,7 +38,8 @@ namespace Hypertable {
     public:
     enum {
       BALANCE_MODE_DISTRIBUTE_LOAD             = 1,
-      BALANCE_MODE_DISTRIBUTE_TABLE_RANGES     = 2
+      BALANCE_MODE_DISTRIBUTE_TABLE_RANGES     = 2,
+      BALANCE_MODE_DISTRIBUTE_COST             = 3
     };
     LoadBalancerBasic(ContextPtr context);
 
@@ -52,12 +53,14 @@ namespace Hypertable {
     private:
       void calculate_balance_plan(const String &algorithm, BalancePlanPtr &plan);
       void distribute_load(const boost::posix_time::ptime &now, BalancePlanPtr &plan);
+      void distribute_cost(BalancePlanPtr &plan);
       void distribute_table_ranges(vector<RangeServerStatistics> &range_server_stats,
                                    BalancePlanPtr &plan);
       void get_unbalanced_servers(const std::vector<RangeServerStatistics> &stats);
 
       Mutex m_data_mutex;
       bool m_enabled;
+      bool m_cost_aware;
       bool  m_waiting_for_servers;
       std::vector <RangeServerStatistics> m_range_server_stats;
       ptime m_wait_time_start;
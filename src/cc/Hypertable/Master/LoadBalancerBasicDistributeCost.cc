@@ -0,0 +1,419 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+#include "Common/Compat.h"
+
+#include <cmath>
+#include <set>
+
+#include "LoadBalancerBasicDistributeCost.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+  // Fixed cost charged for every move so that idle ranges aren't free
+  const double MOVE_OVERHEAD_COST = 1024.0 * 1024.0;
+  // Seconds of writes assumed to stall while a range is being moved
+  const double MOVE_STALL_SECONDS = 10.0;
+}
+
+
+LoadBalancerBasicDistributeCost::LoadBalancerBasicDistributeCost(PropertiesPtr &props,
+                                                                 TablePtr &table)
+  : m_table(table), m_loaded(false) {
+  m_weights[RESOURCE_LOADAVG] =
+    props->get_f64("Hypertable.LoadBalancer.CostAware.Weight.Loadavg");
+  m_weights[RESOURCE_MEMORY] =
+    props->get_f64("Hypertable.LoadBalancer.CostAware.Weight.Memory");
+  m_weights[RESOURCE_DISK] =
+    props->get_f64("Hypertable.LoadBalancer.CostAware.Weight.Disk");
+  m_weights[RESOURCE_WRITE_RATE] =
+    props->get_f64("Hypertable.LoadBalancer.CostAware.Weight.WriteRate");
+  m_score_threshold =
+    props->get_f64("Hypertable.LoadBalancer.CostAware.ScoreThreshold");
+  m_max_move_cost =
+    (double)props->get_i64("Hypertable.LoadBalancer.CostAware.MaxMoveCost");
+}
+
+
+const char *LoadBalancerBasicDistributeCost::resource_name(int resource) {
+  switch (resource) {
+  case RESOURCE_LOADAVG:    return "loadavg";
+  case RESOURCE_MEMORY:     return "memory";
+  case RESOURCE_DISK:       return "disk";
+  case RESOURCE_WRITE_RATE: return "write_rate";
+  default:
+    break;
+  }
+  return "unknown";
+}
+
+
+void LoadBalancerBasicDistributeCost::load_metrics() {
+  vector<ServerMetrics> server_metrics;
+  RSMetrics rs_metrics(m_table);
+
+  m_servers.clear();
+  m_ranges.clear();
+
+  rs_metrics.get_server_metrics(server_metrics);
+
+  foreach(const ServerMetrics &sm, server_metrics) {
+    if (sm.get_measurements().empty()) {
+      HT_INFO_OUT << "Leaving server " << sm.get_id() << " out of the cost "
+                  << "model, it has no measurements" << HT_END;
+      continue;
+    }
+    RangeMetricsMap range_metrics;
+    rs_metrics.get_range_metrics(sm.get_id().c_str(), range_metrics);
+    add_server(sm, range_metrics);
+  }
+
+  m_loaded = true;
+}
+
+
+void LoadBalancerBasicDistributeCost::add_server(const ServerMetrics &sm,
+    const RangeMetricsMap &range_metrics) {
+  const vector<ServerMeasurement> &measurements = sm.get_measurements();
+
+  m_loaded = true;
+
+  if (measurements.empty())
+    return;
+
+  ServerState &server = m_servers[sm.get_id()];
+
+  server.id = sm.get_id();
+
+  foreach(const ServerMeasurement &measurement, measurements) {
+    server.resources[RESOURCE_LOADAVG] += measurement.loadavg;
+    server.resources[RESOURCE_WRITE_RATE] += measurement.bytes_written_rate;
+    server.loadestimate += measurement.bytes_written_rate +
+      measurement.bytes_scanned_rate;
+  }
+  server.resources[RESOURCE_LOADAVG] /= measurements.size();
+  server.resources[RESOURCE_WRITE_RATE] /= measurements.size();
+  server.loadestimate /= measurements.size();
+
+  foreach(const RangeMetricsMap::value_type &vv, range_metrics) {
+    const vector<RangeMeasurement> &range_measurements = vv.second.get_measurements();
+    RangeState range;
+    bool start_row_set;
+
+    if (range_measurements.empty())
+      continue;
+
+    range.server_id = server.id;
+    range.table_id = vv.second.get_table_id();
+    range.start_row = vv.second.get_start_row(&start_row_set);
+    range.end_row = vv.second.get_end_row();
+    range.moveable = vv.second.is_moveable();
+
+    // rates are averaged, sizes are taken from the latest measurement
+    const RangeMeasurement *latest = &range_measurements[0];
+    foreach(const RangeMeasurement &measurement, range_measurements) {
+      range.loadestimate += measurement.byte_read_rate + measurement.byte_write_rate;
+      range.resources[RESOURCE_WRITE_RATE] += measurement.byte_write_rate;
+      if (measurement.timestamp > latest->timestamp)
+        latest = &measurement;
+    }
+    range.loadestimate /= range_measurements.size();
+    range.resources[RESOURCE_WRITE_RATE] /= range_measurements.size();
+    range.resources[RESOURCE_MEMORY] = latest->memory_used;
+    range.resources[RESOURCE_DISK] = latest->disk_used;
+
+    server.resources[RESOURCE_MEMORY] += range.resources[RESOURCE_MEMORY];
+    server.resources[RESOURCE_DISK] += range.resources[RESOURCE_DISK];
+
+    // give the range its share of the server loadavg
+    if (server.loadestimate > 0)
+      range.resources[RESOURCE_LOADAVG] = server.resources[RESOURCE_LOADAVG] *
+        (range.loadestimate / server.loadestimate);
+
+    m_ranges.push_back(range);
+  }
+}
+
+
+void LoadBalancerBasicDistributeCost::compute_plan(BalancePlanPtr &balance_plan,
+        const std::vector<RangeMoveSpecPtr> &in_progress) {
+  double means[RESOURCE_COUNT];
+  std::multimap<String, size_t> ranges_by_server;
+  std::set<String> exhausted;
+  double budget = m_max_move_cost;
+
+  if (!m_loaded)
+    load_metrics();
+
+  if (m_servers.size() < 2) {
+    HT_INFO_OUT << "No balancing required, num_servers=" << m_servers.size()
+                << HT_END;
+    return;
+  }
+
+  // a move still in flight shows its range on the source server; once the
+  // range is reported elsewhere (or not at all) it no longer costs anything
+  if (!in_progress.empty()) {
+    std::set<String> pending;
+    foreach(const RangeMoveSpecPtr &move, in_progress)
+      pending.insert(format("%s:%s:%s", move->source_location.c_str(),
+                            move->table.id, move->range.end_row));
+    for (size_t i=0; i<m_ranges.size(); i++) {
+      RangeState &range = m_ranges[i];
+      if (pending.count(format("%s:%s:%s", range.server_id.c_str(),
+              range.table_id.c_str(), range.end_row.c_str()))) {
+        budget -= move_cost(range);
+        range.moved = true;
+      }
+    }
+    if (budget <= 0) {
+      HT_INFO_OUT << "Moves in progress use up max_move_cost="
+                  << m_max_move_cost << ", not adding moves" << HT_END;
+      return;
+    }
+  }
+
+  compute_means(m_servers, means);
+  for (ServerMap::iterator iter = m_servers.begin(); iter != m_servers.end(); ++iter)
+    iter->second.score = score(iter->second.resources, means);
+
+  for (size_t i=0; i<m_ranges.size(); i++)
+    ranges_by_server.insert(std::make_pair(m_ranges[i].server_id, i));
+
+  HT_INFO_OUT << "mean_loadavg=" << means[RESOURCE_LOADAVG] << ", mean_memory="
+              << means[RESOURCE_MEMORY] << ", mean_disk=" << means[RESOURCE_DISK]
+              << ", mean_write_rate=" << means[RESOURCE_WRITE_RATE]
+              << ", num_servers=" << m_servers.size() << ", score_threshold="
+              << m_score_threshold << ", max_move_cost=" << m_max_move_cost << HT_END;
+
+  while (true) {
+    ServerState *source = 0;
+    ServerState *destination = 0;
+
+    for (ServerMap::iterator iter = m_servers.begin(); iter != m_servers.end(); ++iter) {
+      if (exhausted.count(iter->first) == 0 &&
+          (source == 0 || iter->second.score > source->score))
+        source = &iter->second;
+      if (destination == 0 || iter->second.score < destination->score)
+        destination = &iter->second;
+    }
+
+    if (source == 0 || source == destination ||
+        source->score < 1.0 + m_score_threshold)
+      break;
+
+    // pick the range that lowers the peak score the most per unit of cost
+    double best_ratio = 0, best_cost = 0;
+    RangeState *best = 0;
+    std::pair<std::multimap<String, size_t>::iterator,
+              std::multimap<String, size_t>::iterator> bound =
+      ranges_by_server.equal_range(source->id);
+
+    for (; bound.first != bound.second; ++bound.first) {
+      RangeState &range = m_ranges[bound.first->second];
+      double source_resources[RESOURCE_COUNT];
+      double destination_resources[RESOURCE_COUNT];
+
+      if (!range.moveable || range.moved)
+        continue;
+
+      double cost = move_cost(range);
+      if (cost > budget)
+        continue;
+
+      for (int i=0; i<RESOURCE_COUNT; i++) {
+        source_resources[i] = std::max(0.0, source->resources[i] - range.resources[i]);
+        destination_resources[i] = destination->resources[i] + range.resources[i];
+      }
+
+      double new_peak = std::max(score(source_resources, means),
+                                 score(destination_resources, means));
+      if (new_peak >= source->score)
+        continue;
+
+      double ratio = (source->score - new_peak) / cost;
+      if (ratio > best_ratio) {
+        best_ratio = ratio;
+        best_cost = cost;
+        best = &range;
+      }
+    }
+
+    if (best == 0) {
+      exhausted.insert(source->id);
+      continue;
+    }
+
+    RangeMoveSpecPtr move = new RangeMoveSpec(source->id.c_str(),
+        destination->id.c_str(), best->table_id.c_str(),
+        best->start_row.c_str(), best->end_row.c_str());
+    HT_DEBUG_OUT << "Added move to plan: " << *(move.get()) << " cost="
+                 << best_cost << HT_END;
+    balance_plan->moves.push_back(move);
+    budget -= best_cost;
+
+    apply_move(m_servers, *best, destination->id);
+    source->score = score(source->resources, means);
+    destination->score = score(destination->resources, means);
+  }
+
+  HT_INFO_OUT << "Cost-aware plan has " << balance_plan->moves.size()
+              << " moves, total cost including moves in progress "
+              << (m_max_move_cost - budget) << HT_END;
+}
+
+
+void LoadBalancerBasicDistributeCost::simulate(BalancePlanPtr &plan, std::ostream &out) {
+  double means[RESOURCE_COUNT];
+  double peak_before, stddev_before, peak_after, stddev_after;
+  double total_cost = 0;
+  std::map<String, double> scores_before;
+  std::map<String, size_t> range_index;
+
+  if (!m_loaded)
+    load_metrics();
+
+  ServerMap servers = m_servers;
+  std::vector<RangeState> ranges = m_ranges;
+
+  compute_means(servers, means);
+  summarize(servers, means, &peak_before, &stddev_before);
+  for (ServerMap::iterator iter = servers.begin(); iter != servers.end(); ++iter)
+    scores_before[iter->first] = iter->second.score;
+
+  for (size_t i=0; i<ranges.size(); i++)
+    range_index[ranges[i].table_id + ":" + ranges[i].end_row] = i;
+
+  foreach(RangeMoveSpecPtr &move, plan->moves) {
+    std::map<String, size_t>::iterator iter =
+      range_index.find(String(move->table.id) + ":" + move->range.end_row);
+    if (iter == range_index.end()) {
+      out << "Skipping move of unknown range " << *move.get() << "\n";
+      continue;
+    }
+    if (servers.find(move->dest_location) == servers.end()) {
+      out << "Skipping move to unknown server " << *move.get() << "\n";
+      continue;
+    }
+    RangeState &range = ranges[iter->second];
+    if (range.server_id != move->source_location)
+      out << "Warning: range " << *move.get() << " is on " << range.server_id << "\n";
+    total_cost += move_cost(range);
+    apply_move(servers, range, move->dest_location);
+  }
+
+  summarize(servers, means, &peak_after, &stddev_after);
+
+  out << "Simulation: " << plan->moves.size() << " moves, total cost "
+      << total_cost << "\n";
+  for (ServerMap::iterator iter = servers.begin(); iter != servers.end(); ++iter) {
+    out << "  " << iter->first << " score " << scores_before[iter->first]
+        << " -> " << iter->second.score;
+    for (int i=0; i<RESOURCE_COUNT; i++)
+      out << " " << resource_name(i) << "=" << iter->second.resources[i];
+    out << "\n";
+  }
+  out << "  peak score " << peak_before << " -> " << peak_after
+      << ", score stddev " << stddev_before << " -> " << stddev_after << endl;
+}
+
+
+void LoadBalancerBasicDistributeCost::compute_means(const ServerMap &servers,
+                                                    double *means) {
+  for (int i=0; i<RESOURCE_COUNT; i++)
+    means[i] = 0;
+  if (servers.empty())
+    return;
+  for (ServerMap::const_iterator iter = servers.begin(); iter != servers.end(); ++iter) {
+    for (int i=0; i<RESOURCE_COUNT; i++)
+      means[i] += iter->second.resources[i];
+  }
+  for (int i=0; i<RESOURCE_COUNT; i++)
+    means[i] /= servers.size();
+}
+
+
+/**
+ * Weighted mean of the server's resources relative to the cluster mean.
+ * Resources that nobody uses (mean of zero) or that have a weight of zero
+ * are left out.
+ */
+double LoadBalancerBasicDistributeCost::score(const double *resources,
+                                              const double *means) {
+  double total = 0, weight = 0;
+  for (int i=0; i<RESOURCE_COUNT; i++) {
+    if (means[i] > 0 && m_weights[i] > 0) {
+      total += m_weights[i] * (resources[i] / means[i]);
+      weight += m_weights[i];
+    }
+  }
+  return weight > 0 ? total / weight : 0;
+}
+
+
+double LoadBalancerBasicDistributeCost::move_cost(const RangeState &range) {
+  return MOVE_OVERHEAD_COST + range.resources[RESOURCE_MEMORY] +
+    MOVE_STALL_SECONDS * range.resources[RESOURCE_WRITE_RATE];
+}
+
+
+void LoadBalancerBasicDistributeCost::apply_move(ServerMap &servers, RangeState &range,
+                                                 const String &destination) {
+  ServerMap::iterator src_iter = servers.find(range.server_id);
+  ServerMap::iterator dst_iter = servers.find(destination);
+
+  HT_ASSERT(dst_iter != servers.end());
+
+  for (int i=0; i<RESOURCE_COUNT; i++) {
+    if (src_iter != servers.end())
+      src_iter->second.resources[i] =
+        std::max(0.0, src_iter->second.resources[i] - range.resources[i]);
+    dst_iter->second.resources[i] += range.resources[i];
+  }
+  if (src_iter != servers.end())
+    src_iter->second.loadestimate =
+      std::max(0.0, src_iter->second.loadestimate - range.loadestimate);
+  dst_iter->second.loadestimate += range.loadestimate;
+
+  range.server_id = destination;
+  range.moved = true;
+}
+
+
+void LoadBalancerBasicDistributeCost::summarize(ServerMap &servers, const double *means,
+                                                double *peakp, double *stddevp) {
+  double sum = 0, sum_squares = 0;
+
+  *peakp = 0;
+  for (ServerMap::iterator iter = servers.begin(); iter != servers.end(); ++iter) {
+    iter->second.score = score(iter->second.resources, means);
+    *peakp = std::max(*peakp, iter->second.score);
+    sum += iter->second.score;
+    sum_squares += iter->second.score * iter->second.score;
+  }
+
+  *stddevp = 0;
+  if (!servers.empty()) {
+    double mean = sum / servers.size();
+    *stddevp = sqrt(std::max(0.0, sum_squares / servers.size() - mean * mean));
+  }
+}
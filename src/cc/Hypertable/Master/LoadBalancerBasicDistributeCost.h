@@ -0,0 +1,149 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_LOADBALANCERBASICDISTRIBUTECOST_H
+#define HYPERTABLE_LOADBALANCERBASICDISTRIBUTECOST_H
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "Common/Properties.h"
+#include "Common/String.h"
+#include "Hypertable/Lib/BalancePlan.h"
+#include "Hypertable/Lib/Client.h"
+
+#include "RSMetrics.h"
+#include "RangeMetrics.h"
+#include "ServerMetrics.h"
+
+namespace Hypertable {
+
+  /**
+   * Computes a balance plan from a multi-resource model of the cluster.
+   * Every server is described by its loadavg, memory, disk and write rate,
+   * each normalized by the cluster mean and combined into a weighted score
+   * (1.0 means "average").  Moves are picked greedily off the highest scoring
+   * server, preferring the range that lowers the peak score the most per
+   * unit of move cost, where the cost of a move grows with the range's
+   * CellCache size (which must be compacted and pins commit log until it is)
+   * and its write rate.  The total cost of the moves in flight, those of
+   * earlier plans that have not completed plus those of the new plan, is
+   * capped so that the balancer can't move many big, hot ranges at once.
+   */
+  class LoadBalancerBasicDistributeCost {
+  public:
+    enum {
+      RESOURCE_LOADAVG    = 0,
+      RESOURCE_MEMORY     = 1,
+      RESOURCE_DISK       = 2,
+      RESOURCE_WRITE_RATE = 3,
+      RESOURCE_COUNT      = 4
+    };
+
+    class ServerState {
+    public:
+      ServerState() : loadestimate(0), score(0) {
+        memset(resources, 0, sizeof(resources));
+      }
+      String id;
+      double loadestimate;
+      double resources[RESOURCE_COUNT];
+      double score;
+    };
+
+    class RangeState {
+    public:
+      RangeState() : loadestimate(0), moveable(false), moved(false) {
+        memset(resources, 0, sizeof(resources));
+      }
+      String server_id;
+      String table_id;
+      String start_row;
+      String end_row;
+      double loadestimate;
+      double resources[RESOURCE_COUNT];
+      bool moveable;
+      bool moved;
+    };
+
+    typedef std::map<String, ServerState> ServerMap;
+
+    LoadBalancerBasicDistributeCost(PropertiesPtr &props, TablePtr &table);
+
+    /** Reads server and range metrics from the RS_METRICS table */
+    void load_metrics();
+
+    /**
+     * Adds a server and its ranges to the model.  A server without
+     * measurements has no known load, so it is left out rather than
+     * treated as idle, which would make it the target of every move.
+     */
+    void add_server(const ServerMetrics &server_metrics,
+                    const RangeMetricsMap &range_metrics);
+
+    /**
+     * Loads metrics (if not already loaded) and adds moves to the plan.
+     * Moves in <code>in_progress</code> whose range is still reported on
+     * its source server are charged against MaxMoveCost and their ranges
+     * are not moved again.
+     *
+     * @param balance_plan plan to receive the new moves
+     * @param in_progress moves of earlier plans that have not completed
+     */
+    void compute_plan(BalancePlanPtr &balance_plan,
+                      const std::vector<RangeMoveSpecPtr> &in_progress
+                      = std::vector<RangeMoveSpecPtr>());
+
+    /**
+     * Applies the moves in <code>plan</code> to the model and writes a
+     * per-server report of the scores before and after, along with the
+     * peak score, score standard deviation and total move cost.
+     */
+    void simulate(BalancePlanPtr &plan, std::ostream &out);
+
+    static const char *resource_name(int resource);
+
+    /** Cost of moving <code>range</code>, charged against MaxMoveCost */
+    double move_cost(const RangeState &range);
+
+    const ServerMap &get_servers() const { return m_servers; }
+
+  private:
+    void compute_means(const ServerMap &servers, double *means);
+    double score(const double *resources, const double *means);
+    void apply_move(ServerMap &servers, RangeState &range,
+                    const String &destination);
+    void summarize(ServerMap &servers, const double *means, double *peakp,
+                   double *stddevp);
+
+    TablePtr &m_table;
+    double m_weights[RESOURCE_COUNT];
+    double m_score_threshold;
+    double m_max_move_cost;
+    bool m_loaded;
+    ServerMap m_servers;
+    std::vector<RangeState> m_ranges;
+  }; // LoadBalancerBasicDistributeCost
+
+} // namespace Hypertable
+
+#endif // HYPERTABLE_LOADBALANCERBASICDISTRIBUTECOST_H
@@ -37,11 +37,11 @@ using namespace Hypertable;
 using namespace Hypertable::MetaLog;
 
 uint16_t DefinitionMaster::version() {
-  return 1;
+  return 2;
 }
 
 bool DefinitionMaster::supported_version(uint16_t ver) {
-  return ver == 1;
+  return ver == 1 || ver == 2;
 }
 
 const char *DefinitionMaster::name() {
@@ -63,7 +63,7 @@ Entity *DefinitionMaster::create(uint16_t log_version, const EntityHeader &heade
   else if (header.type == EntityType::OPERATION_DROP_NAMESPACE)
     return new OperationDropNamespace(m_context, header);
   else if (header.type == EntityType::OPERATION_CREATE_TABLE)
-    return new OperationCreateTable(m_context, header);
+    return new OperationCreateTable(m_context, header, log_version);
   else if (header.type == EntityType::OPERATION_DROP_TABLE)
     return new OperationDropTable(m_context, header);
   else if (header.type == EntityType::OPERATION_RENAME_TABLE)
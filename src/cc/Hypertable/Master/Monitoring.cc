@@ -233,6 +233,15 @@ void Monitoring::add(std::vector<RangeServerStatistics> &stats) {
     update_rangeserver_rrd(rrd_file, rrd_data);
     add_table_stats(stats[i].stats->tables,stats[i].fetch_timestamp);
 
+    // Latency histograms are cumulative; report the interval since the
+    // previous fetch unless the server restarted in between
+    for (int j=0; j<StatsRangeServer::LATENCY_PHASE_COUNT; j++) {
+      (*iter).second->latency[j] = stats[i].stats->latency[j];
+      if ((*iter).second->stats &&
+          (*iter).second->stats->latency[j].count <= stats[i].stats->latency[j].count)
+        (*iter).second->latency[j].subtract((*iter).second->stats->latency[j]);
+    }
+
     (*iter).second->stats = stats[i].stats;
     (*iter).second->fetch_error = stats[i].fetch_error;
     (*iter).second->fetch_error_msg = stats[i].fetch_error_msg;
@@ -656,7 +665,10 @@ namespace {
     " \"cores\": \"%d\", \"skew\": \"%d\", \"os\": \"%s\", \"osVersion\": \"%s\","
     " \"vendor\": \"%s\", \"vendorVersion\": \"%s\", \"ram\": \"%.2f\","
     " \"disk\": \"%.2f\", \"diskUsePct\": \"%u\", \"rangeCount\": \"%llu\","
-    " \"lastContact\": \"%s\", \"lastError\": \"%s\"}";
+    " \"lastContact\": \"%s\", \"lastError\": \"%s\", \"latency\": {%s}}";
+  const char *rs_latency_format =
+    "\"%s\": {\"count\": \"%llu\", \"mean\": \"%.1f\", \"p50\": \"%llu\","
+    " \"p90\": \"%llu\", \"p99\": \"%llu\", \"max\": \"%llu\"}";
 
   const char *master_json = "{\"MasterSummary\": {\"version\": \"%s\"}}\n";
 
@@ -686,8 +698,10 @@ void Monitoring::dump_rangeserver_summary_json(std::vector<RangeServerStatistics
   String contact_time;
   uint64_t range_count;
   const char *version_string = "";
+  String latency_str;
 
   for (size_t i=0; i<stats.size(); i++) {
+    latency_str.clear();
     if (stats[i].stats) {
       double numerator=0.0, denominator=0.0;
       ram = stats[i].stats->system.mem_stat.ram / 1000.0;
@@ -707,6 +721,17 @@ void Monitoring::dump_rangeserver_summary_json(std::vector<RangeServerStatistics
       boost::trim(contact_time);
       range_count = stats[i].stats->range_count;
       version_string = stats[i].stats->version.c_str();
+      for (int j=0; j<StatsRangeServer::LATENCY_PHASE_COUNT; j++) {
+        const LatencyHistogram &hist = stats[i].latency[j];
+        if (j > 0)
+          latency_str += ", ";
+        latency_str += format(rs_latency_format,
+                              StatsRangeServer::latency_phase_name(j),
+                              (Llu)hist.count, hist.mean(),
+                              (Llu)hist.percentile(0.5),
+                              (Llu)hist.percentile(0.9),
+                              (Llu)hist.percentile(0.99), (Llu)hist.max());
+      }
     }
     else {
       ram = 0.0;
@@ -739,7 +764,8 @@ void Monitoring::dump_rangeserver_summary_json(std::vector<RangeServerStatistics
                    disk_use_pct,
                    (Llu)range_count,
                    contact_time.c_str(),
-                   error_str.c_str());
+                   error_str.c_str(),
+                   latency_str.c_str());
 
     if (i != 0)
       str += String(",\n    ") + entry;
@@ -28,7 +28,9 @@
 #include "Hyperspace/Session.h"
 
 #include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/TableSplitSpec.h"
 
+#include "LoadBalancer.h"
 #include "OperationCreateTable.h"
 #include "Utility.h"
 
@@ -38,19 +40,20 @@ using namespace Hypertable;
 using namespace Hyperspace;
 
 OperationCreateTable::OperationCreateTable(ContextPtr &context, const String &name, const String &schema)
-  : Operation(context, MetaLog::EntityType::OPERATION_CREATE_TABLE), m_name(name), m_schema(schema) {
+  : Operation(context, MetaLog::EntityType::OPERATION_CREATE_TABLE), m_log_version(0),
+    m_name(name), m_schema(schema) {
   initialize_dependencies();
 }
 
 OperationCreateTable::OperationCreateTable(ContextPtr &context,
-                                           const MetaLog::EntityHeader &header_)
-  : Operation(context, header_) {
-  if (m_table.id && *m_table.id != 0)
-    m_range_name = format("%s[..%s]", m_table.id, Key::END_ROW_MARKER);
+                                           const MetaLog::EntityHeader &header_,
+                                           uint16_t log_version)
+  : Operation(context, header_), m_log_version(log_version) {
 }
 
 OperationCreateTable::OperationCreateTable(ContextPtr &context, EventPtr &event)
-  : Operation(context, event, MetaLog::EntityType::OPERATION_CREATE_TABLE) {
+  : Operation(context, event, MetaLog::EntityType::OPERATION_CREATE_TABLE),
+    m_log_version(0) {
   const uint8_t *ptr = event->payload;
   size_t remaining = event->payload_len;
   decode_request(&ptr, &remaining);
@@ -67,13 +70,29 @@ void OperationCreateTable::initialize_dependencies() {
   m_dependencies.insert(Dependency::SYSTEM);
 }
 
+/**
+ * Adds the name of each initial range to m_dependencies, so that moves of
+ * those ranges wait for the table to be created.  Caller must hold m_mutex.
+ */
+void OperationCreateTable::add_range_dependencies() {
+  String start_row;
+  for (size_t i=0; i<m_split_rows.size(); i++) {
+    m_dependencies.insert(format("%s[%s..%s]", m_table.id, start_row.c_str(),
+                                 m_split_rows[i].c_str()));
+    start_row = m_split_rows[i];
+  }
+  m_dependencies.insert(format("%s[%s..%s]", m_table.id, start_row.c_str(),
+                               Key::END_ROW_MARKER));
+}
+
 void OperationCreateTable::execute() {
   bool is_namespace;
   RangeSpec range;
   int32_t state = get_state();
 
-  HT_INFOF("Entering CreateTable-%lld(%s, location=%s) state=%s",
-           (Lld)header.id, m_name.c_str(), m_location.c_str(), OperationState::get_text(state));
+  HT_INFOF("Entering CreateTable-%lld(%s, ranges=%d) state=%s",
+           (Lld)header.id, m_name.c_str(), (int)m_split_rows.size()+1,
+           OperationState::get_text(state));
 
   switch (state) {
 
@@ -81,6 +100,15 @@ void OperationCreateTable::execute() {
     // Check to see if namespace exists
     if (m_context->namemap->exists_mapping(m_name, &is_namespace))
       complete_error(Error::NAME_ALREADY_IN_USE, "");
+    try {
+      TableSplitSpec::normalize(m_split_rows);
+      if (!m_split_rows.empty() && boost::algorithm::starts_with(m_name, "/sys/"))
+        HT_THROW(Error::BAD_KEY, "System tables cannot be created pre-split");
+    }
+    catch (Exception &e) {
+      complete_error(e);
+      return;
+    }
     set_state(OperationState::ASSIGN_ID);
     m_context->mml_writer->record_state(this);
     HT_MAYBE_FAIL("create-table-INITIAL");
@@ -101,16 +129,15 @@ void OperationCreateTable::execute() {
     set_state(OperationState::WRITE_METADATA);
 
   case OperationState::WRITE_METADATA:
-    Utility::create_table_write_metadata(m_context, &m_table);
+    Utility::create_table_write_metadata(m_context, &m_table, m_split_rows);
     HT_MAYBE_FAIL("create-table-WRITE_METADATA-a");
-    m_range_name = format("%s[..%s]", m_table.id, Key::END_ROW_MARKER);
     {
       ScopedLock lock(m_mutex);
       m_dependencies.clear();
       m_dependencies.insert(Dependency::SERVERS);
       m_dependencies.insert(Dependency::METADATA);
       m_dependencies.insert(Dependency::SYSTEM);
-      m_dependencies.insert(m_range_name);
+      add_range_dependencies();
       m_state = OperationState::ASSIGN_LOCATION;
     }
     m_context->mml_writer->record_state(this);
@@ -118,15 +145,16 @@ void OperationCreateTable::execute() {
     return;
 
   case OperationState::ASSIGN_LOCATION:
-    if (!Utility::next_available_server(m_context, m_location))
+    if (!m_context->balancer->assign_to_servers(m_split_rows.size()+1, m_locations))
       return;
     {
       ScopedLock lock(m_mutex);
       m_dependencies.clear();
       m_dependencies.insert(Dependency::METADATA);
       m_dependencies.insert(Dependency::SYSTEM);
-      m_dependencies.insert(m_location);
-      m_dependencies.insert(m_range_name);
+      foreach (const String &location, m_locations)
+        m_dependencies.insert(location);
+      add_range_dependencies();
       m_state = OperationState::LOAD_RANGE;
     }
     m_context->mml_writer->record_state(this);
@@ -134,17 +162,24 @@ void OperationCreateTable::execute() {
     return;
 
   case OperationState::LOAD_RANGE:
-    try {
-      range.start_row = 0;
-      range.end_row = Key::END_ROW_MARKER;
-      Utility::create_table_load_range(m_context, m_location, &m_table, range, false);
-      HT_MAYBE_FAIL("create-table-LOAD_RANGE-a");
-    }
-    catch (Exception &e) {
-      if (!m_context->reassigned(&m_table, range, m_location))
-        HT_THROW2(e.code(), e, format("Loading %s range %s on server %s",
-                                      m_name.c_str(), m_range_name.c_str(), m_location.c_str()));
-      // if reassigned, it was properly loaded and then moved, so continue on
+    HT_ASSERT(m_locations.size() == m_split_rows.size()+1);
+    for (size_t i=0; i<m_locations.size(); i++) {
+      range.start_row = (i == 0) ? 0 : m_split_rows[i-1].c_str();
+      range.end_row = (i < m_split_rows.size()) ? m_split_rows[i].c_str()
+                                                 : Key::END_ROW_MARKER;
+      try {
+        Utility::create_table_load_range(m_context, m_locations[i], &m_table,
+                                         range, false, m_locations.size());
+        HT_MAYBE_FAIL("create-table-LOAD_RANGE-a");
+      }
+      catch (Exception &e) {
+        if (!m_context->reassigned(&m_table, range, m_locations[i]))
+          HT_THROW2(e.code(), e, format("Loading %s range %s[%s..%s] on server %s",
+                                        m_name.c_str(), m_table.id,
+                                        range.start_row ? range.start_row : "",
+                                        range.end_row, m_locations[i].c_str()));
+        // if reassigned, it was properly loaded and then moved, so continue on
+      }
     }
     {
       ScopedLock lock(m_mutex);
@@ -179,32 +214,74 @@ void OperationCreateTable::display_state(std::ostream &os) {
   os << " name=" << m_name << " ";
   if (m_table.id)
     os << m_table << " ";
-  os << " location=" << m_location << " ";
+  os << " ranges=" << m_split_rows.size()+1 << " locations=";
+  for (size_t i=0; i<m_locations.size(); i++)
+    os << (i ? "," : "") << m_locations[i];
+  os << " ";
 }
 
+/**
+ * The state is encoded as name, schema, table, location of the first
+ * range, followed (since MML version 2) by the split rows and the
+ * locations of all ranges.
+ */
 size_t OperationCreateTable::encoded_state_length() const {
-  return Serialization::encoded_length_vstr(m_name) +
+  size_t length = Serialization::encoded_length_vstr(m_name) +
     Serialization::encoded_length_vstr(m_schema) +
     m_table.encoded_length() +
-    Serialization::encoded_length_vstr(m_location);
+    Serialization::encoded_length_vstr(m_locations.empty() ? "" : m_locations[0]);
+  length += 4;
+  foreach (const String &row, m_split_rows)
+    length += Serialization::encoded_length_vstr(row);
+  length += 4;
+  foreach (const String &location, m_locations)
+    length += Serialization::encoded_length_vstr(location);
+  return length;
 }
 
 void OperationCreateTable::encode_state(uint8_t **bufp) const {
   Serialization::encode_vstr(bufp, m_name);
   Serialization::encode_vstr(bufp, m_schema);
   m_table.encode(bufp);
-  Serialization::encode_vstr(bufp, m_location);
+  Serialization::encode_vstr(bufp, m_locations.empty() ? "" : m_locations[0]);
+  Serialization::encode_i32(bufp, m_split_rows.size());
+  foreach (const String &row, m_split_rows)
+    Serialization::encode_vstr(bufp, row);
+  Serialization::encode_i32(bufp, m_locations.size());
+  foreach (const String &location, m_locations)
+    Serialization::encode_vstr(bufp, location);
 }
 
 void OperationCreateTable::decode_state(const uint8_t **bufp, size_t *remainp) {
-  decode_request(bufp, remainp);
+  String location;
+  m_name = Serialization::decode_vstr(bufp, remainp);
+  m_schema = Serialization::decode_vstr(bufp, remainp);
   m_table.decode(bufp, remainp);
-  m_location = Serialization::decode_vstr(bufp, remainp);
+  location = Serialization::decode_vstr(bufp, remainp);
+  m_split_rows.clear();
+  m_locations.clear();
+  if (m_log_version >= 2) {
+    size_t count = Serialization::decode_i32(bufp, remainp);
+    for (size_t i=0; i<count; i++)
+      m_split_rows.push_back(Serialization::decode_vstr(bufp, remainp));
+    count = Serialization::decode_i32(bufp, remainp);
+    for (size_t i=0; i<count; i++)
+      m_locations.push_back(Serialization::decode_vstr(bufp, remainp));
+  }
+  else if (!location.empty())
+    m_locations.push_back(location);
 }
 
 void OperationCreateTable::decode_request(const uint8_t **bufp, size_t *remainp) {
   m_name = Serialization::decode_vstr(bufp, remainp);
   m_schema = Serialization::decode_vstr(bufp, remainp);
+  m_split_rows.clear();
+  // Split rows are absent from requests sent by older clients
+  if (*remainp) {
+    size_t count = Serialization::decode_i32(bufp, remainp);
+    for (size_t i=0; i<count; i++)
+      m_split_rows.push_back(Serialization::decode_vstr(bufp, remainp));
+  }
 }
 
 const String OperationCreateTable::name() {
@@ -214,4 +291,3 @@ const String OperationCreateTable::name() {
 const String OperationCreateTable::label() {
   return String("CreateTable ") + m_name;
 }
-
@@ -29,7 +29,8 @@ namespace Hypertable {
   class OperationCreateTable : public Operation {
   public:
     OperationCreateTable(ContextPtr &context, const String &name, const String &schema);
-    OperationCreateTable(ContextPtr &context, const MetaLog::EntityHeader &header_);
+    OperationCreateTable(ContextPtr &context, const MetaLog::EntityHeader &header_,
+                         uint16_t log_version);
     OperationCreateTable(ContextPtr &context, EventPtr &event);
     virtual ~OperationCreateTable() { }
 
@@ -44,11 +45,13 @@ namespace Hypertable {
 
   private:
     void initialize_dependencies();
+    void add_range_dependencies();
+    uint16_t m_log_version;
     String m_name;
     String m_schema;
+    std::vector<String> m_split_rows;
     TableIdentifierManaged m_table;
-    String m_location;
-    String m_range_name;
+    std::vector<String> m_locations;
   };
 
   typedef intrusive_ptr<OperationCreateTable> OperationCreateTablePtr;
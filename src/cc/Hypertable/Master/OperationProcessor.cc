@@ -24,7 +24,6 @@
 
 #include <sstream>
 
-#include "boost/graph/topological_sort.hpp"
 #include "boost/graph/graphviz.hpp"
 
 #include "OperationInitialize.h"
@@ -37,10 +36,9 @@ using namespace boost;
 
 
 OperationProcessor::ThreadContext::ThreadContext(ContextPtr &mctx)
-  : master_context(mctx), current_blocked(0), busy_count(0),
+  : master_context(mctx), current_blocked(0), next_level(0), busy_count(0),
     need_order_recompute(false), shutdown(false), paused(false) {
   current_iter = current.end();
-  execution_order_iter = execution_order.end();
 }
 
 OperationProcessor::ThreadContext::~ThreadContext() {
@@ -49,7 +47,6 @@ OperationProcessor::ThreadContext::~ThreadContext() {
 
 OperationProcessor::OperationProcessor(ContextPtr &context, size_t thread_count) 
   : m_context(context) {
-  m_context.execution_order_iter = m_context.execution_order.end();
   m_context.op = this;
   Worker worker(m_context);
   for (size_t i=0; i<thread_count; ++i)
@@ -116,6 +113,7 @@ void OperationProcessor::add_operation_internal(OperationPtr &operation) {
   put(m_context.ops, v, operation);
   put(m_context.busy, v, false);
   m_context.live.insert(v);
+  m_context.levels[0].insert(v);
 
   add_dependencies(v, operation);
 }
@@ -140,7 +138,7 @@ void OperationProcessor::wait_for_idle() {
   ScopedLock lock(m_context.mutex);
   while (m_context.busy_count > 0 ||
          m_context.need_order_recompute ||
-         m_context.execution_order_iter != m_context.execution_order.end())
+         m_context.order_pending())
     m_context.idle_cond.wait(lock);
 }
 
@@ -148,7 +146,7 @@ bool OperationProcessor::timed_wait_for_idle(boost::xtime expire_time) {
   ScopedLock lock(m_context.mutex);
   while (m_context.busy_count > 0 ||
          m_context.need_order_recompute ||
-         m_context.execution_order_iter != m_context.execution_order.end()) {
+         m_context.order_pending()) {
     if (!m_context.idle_cond.timed_wait(lock, expire_time))
       return false;
   }
@@ -171,22 +169,18 @@ void OperationProcessor::wake_up() {
 
 void OperationProcessor::unblock(const String &name) {
   ScopedLock lock(m_context.mutex);
-  std::pair<DependencyIndex::iterator, DependencyIndex::iterator> bound;
   bool unblocked_something = false;
 
-  for (bound = m_context.obstruction_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    if (m_context.ops[bound.first->second]->unblock())
+  foreach (Vertex v, m_context.obstruction_index.find(name))
+    if (m_context.ops[v]->unblock())
       unblocked_something = true;
 
-  for (bound = m_context.exclusivity_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    if (m_context.ops[bound.first->second]->unblock())
+  foreach (Vertex v, m_context.exclusivity_index.find(name))
+    if (m_context.ops[v]->unblock())
       unblocked_something = true;
 
-  for (bound = m_context.dependency_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    if (m_context.ops[bound.first->second]->unblock())
+  foreach (Vertex v, m_context.dependency_index.find(name))
+    if (m_context.ops[v]->unblock())
       unblocked_something = true;
 
   if (unblocked_something) {
@@ -221,8 +215,7 @@ void OperationProcessor::Worker::operator()() {
             current_needs_loading = 
               m_context.current_active.empty() && m_context.current_blocked == 0;
 
-          if (current_needs_loading &&
-              m_context.execution_order_iter != m_context.execution_order.end()) {
+          if (current_needs_loading && m_context.order_pending()) {
             if (load_current()) {
               if (m_context.shutdown)
                 return;
@@ -324,28 +317,21 @@ void OperationProcessor::add_exclusivity(Vertex v, const String &name) {
   GraphTraits::in_edge_iterator in_i, in_end;
   DependencySet names;
   Vertex src;
-  std::pair<DependencyIndex::iterator, DependencyIndex::iterator> bound;
 
   // Check obstructions index and add link (v -> obstruction)
-  for (bound = m_context.obstruction_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    add_edge(v, bound.first->second);
+  foreach (Vertex u, m_context.obstruction_index.find(name))
+    add_edge(v, u);
 
   // Check dependency index and add link (dependency -> v)
-  for (bound = m_context.dependency_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    add_edge(bound.first->second, v);
+  foreach (Vertex u, m_context.dependency_index.find(name))
+    add_edge(u, v);
 
   // Return now if this exclusivity already exists
-  for (bound = m_context.exclusivity_index.equal_range(name);
-       bound.first != bound.second; ++bound.first) {
-    if (v == bound.first->second)
-      return;
-  }
+  if (m_context.exclusivity_index.contains(name, v))
+    return;
 
-  for (DependencyIndex::iterator iter = m_context.exclusivity_index.lower_bound(name);
-       iter != m_context.exclusivity_index.end() && iter->first == name; ++iter) {
-    tie(in_i, in_end) = in_edges(iter->second, m_context.graph);
+  foreach (Vertex u, m_context.exclusivity_index.find(name)) {
+    tie(in_i, in_end) = in_edges(u, m_context.graph);
     for (; in_i != in_end; ++in_i) {
       src = source(*in_i, m_context.graph);
       m_context.ops[src]->exclusivities(names);
@@ -353,30 +339,25 @@ void OperationProcessor::add_exclusivity(Vertex v, const String &name) {
         break;
     }
     if (in_i == in_end) {
-      HT_ASSERT(v != iter->second);
-      add_edge_permanent(v, iter->second);
+      HT_ASSERT(v != u);
+      add_edge_permanent(v, u);
       break;
     }
   }
 
-  m_context.exclusivity_index.insert(DependencyIndex::value_type(name, v));
+  m_context.exclusivity_index.insert(name, v);
 }
 
 
 void OperationProcessor::add_dependency(Vertex v, const String &name) {
-  std::pair<DependencyIndex::iterator, DependencyIndex::iterator> bound;
 
   // Return immediately if dependency already exists
-  for (bound = m_context.dependency_index.equal_range(name);
-       bound.first != bound.second; ++bound.first) {
-    if (bound.first->second == v)
-      return;
-  }
+  if (m_context.dependency_index.contains(name, v))
+    return;
 
   // Check exclusivity index and add link (v -> exclusivity)
-  for (bound = m_context.exclusivity_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    add_edge(v, bound.first->second);
+  foreach (Vertex u, m_context.exclusivity_index.find(name))
+    add_edge(v, u);
 
   // Add perpetual operations if necessary
   if (!m_context.perpetual_ops.empty()) {
@@ -397,83 +378,80 @@ void OperationProcessor::add_dependency(Vertex v, const String &name) {
   }
 
   // Check obstruction index and add link (v -> obstruction)
-  for (bound = m_context.obstruction_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    add_edge(v, bound.first->second);
+  foreach (Vertex u, m_context.obstruction_index.find(name))
+    add_edge(v, u);
 
-  m_context.dependency_index.insert(DependencyIndex::value_type(name, v));
+  m_context.dependency_index.insert(name, v);
 }
 
 
 void OperationProcessor::add_obstruction(Vertex v, const String &name) {
-  std::pair<DependencyIndex::iterator, DependencyIndex::iterator> bound;
 
   // Return immediately if obstruction already exists
-  for (bound = m_context.obstruction_index.equal_range(name);
-       bound.first != bound.second; ++bound.first) {
-    if (bound.first->second == v)
-      return;
-  }
+  if (m_context.obstruction_index.contains(name, v))
+    return;
 
   // Check exclusivity index and add link (exclusivity -> v)
-  for (bound = m_context.exclusivity_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    add_edge(bound.first->second, v);
+  foreach (Vertex u, m_context.exclusivity_index.find(name))
+    add_edge(u, v);
 
   // Check dependency index and add link (dependency -> v)
-  for (bound = m_context.dependency_index.equal_range(name);
-       bound.first != bound.second; ++bound.first)
-    add_edge(bound.first->second, v);
+  foreach (Vertex u, m_context.dependency_index.find(name))
+    add_edge(u, v);
 
-  m_context.obstruction_index.insert(DependencyIndex::value_type(name, v));
+  m_context.obstruction_index.insert(name, v);
 }
 
 
 void OperationProcessor::purge_from_dependency_index(Vertex v) {
-  DependencyIndex::iterator iter, del_iter;
-
-  // Purge from dependency index
-  iter = m_context.dependency_index.begin();
-  while (iter != m_context.dependency_index.end()) {
-    if (iter->second == v) {
-      del_iter = iter++;
-      m_context.dependency_index.erase(del_iter);
-    }
-    else
-      ++iter;
-  }
+  m_context.dependency_index.purge(v);
 }
 
 
 void OperationProcessor::purge_from_exclusivity_index(Vertex v) {
-  DependencyIndex::iterator iter, del_iter;
-
-  // Purge from exclusivity index
-  iter = m_context.exclusivity_index.begin();
-  while (iter != m_context.exclusivity_index.end()) {
-    if (iter->second == v) {
-      del_iter = iter++;
-      m_context.exclusivity_index.erase(del_iter);
-    }
-    else
-      ++iter;
-  }
+  m_context.exclusivity_index.purge(v);
 }
 
 
 void OperationProcessor::purge_from_obstruction_index(Vertex v) {
-  DependencyIndex::iterator iter, del_iter;
-
-  // Purge from obstruction index
-  iter = m_context.obstruction_index.begin();
-  while (iter != m_context.obstruction_index.end()) {
-    if (iter->second == v) {
-      del_iter = iter++;
-      m_context.obstruction_index.erase(del_iter);
-    }
-    else
-      ++iter;
+  m_context.obstruction_index.purge(v);
+}
+
+
+const OperationProcessor::VertexSet &
+OperationProcessor::DependencyIndex::find(const String &name) const {
+  NameMap::const_iterator iter = m_names.find(name);
+  return iter == m_names.end() ? m_empty : iter->second;
+}
+
+
+bool OperationProcessor::DependencyIndex::contains(const String &name,
+                                                   Vertex v) const {
+  NameMap::const_iterator iter = m_names.find(name);
+  return iter != m_names.end() && iter->second.count(v) > 0;
+}
+
+
+void OperationProcessor::DependencyIndex::insert(const String &name, Vertex v) {
+  m_names[name].insert(v);
+  m_vertices[v].insert(name);
+}
+
+
+void OperationProcessor::DependencyIndex::purge(Vertex v) {
+  VertexMap::iterator iter = m_vertices.find(v);
+
+  if (iter == m_vertices.end())
+    return;
+
+  foreach (const String &name, iter->second) {
+    NameMap::iterator name_iter = m_names.find(name);
+    HT_ASSERT(name_iter != m_names.end());
+    name_iter->second.erase(v);
+    if (name_iter->second.empty())
+      m_names.erase(name_iter);
   }
+  m_vertices.erase(iter);
 }
 
 
@@ -481,31 +459,106 @@ void OperationProcessor::add_edge(Vertex v, Vertex u) {
   std::pair<Edge, bool> ep = ::add_edge(v, u, m_context.graph);
   HT_ASSERT(ep.second);
   put(m_context.permanent, ep.first, false);
+  update_exec_time(v);
 }
 
 void OperationProcessor::add_edge_permanent(Vertex v, Vertex u) {
   std::pair<Edge, bool> ep = ::add_edge(v, u, m_context.graph);
   HT_ASSERT(ep.second);
   put(m_context.permanent, ep.first, true);
+  update_exec_time(v);
+}
+
+
+/**
+ * Recomputes the execution time of <code>v</code> (one more than the
+ * maximum execution time of the vertices it points to) and propagates any
+ * change back through its in-edges.  Only the ancestors of a changed vertex
+ * are visited, so adding or removing an operation no longer requires a full
+ * topological sort of the graph.
+ */
+void OperationProcessor::update_exec_time(Vertex v) {
+  std::vector<Vertex> stack;
+  GraphTraits::out_edge_iterator out_i, out_end;
+  GraphTraits::in_edge_iterator in_i, in_end;
+  Vertex u;
+  int exec_time;
+
+  stack.push_back(v);
+
+  while (!stack.empty()) {
+    u = stack.back();
+    stack.pop_back();
+
+    exec_time = 0;
+    for (tie(out_i, out_end) = out_edges(u, m_context.graph);
+         out_i != out_end; ++out_i)
+      exec_time = (std::max)(exec_time,
+                             m_context.exec_time[target(*out_i, m_context.graph)] + 1);
+
+    if (exec_time == m_context.exec_time[u])
+      continue;
+
+    // An execution time this large can only come from a cycle
+    HT_ASSERT((size_t)exec_time < m_context.live.size());
+
+    set_exec_time(u, exec_time);
+
+    for (tie(in_i, in_end) = in_edges(u, m_context.graph); in_i != in_end; ++in_i)
+      stack.push_back(source(*in_i, m_context.graph));
+  }
+}
+
+
+void OperationProcessor::set_exec_time(Vertex v, int exec_time) {
+  remove_from_levels(v);
+  m_context.exec_time[v] = exec_time;
+  m_context.levels[exec_time].insert(v);
+}
+
+
+void OperationProcessor::remove_from_levels(Vertex v) {
+  LevelIndex::iterator iter = m_context.levels.find(m_context.exec_time[v]);
+  HT_ASSERT(iter != m_context.levels.end());
+  iter->second.erase(v);
+  if (iter->second.empty())
+    m_context.levels.erase(iter);
 }
 
+
 void OperationProcessor::graphviz_output(String &output) {
   ScopedLock lock(m_context.mutex);
   std::ostringstream oss;
+
+  // assign vertex indexes for the writer
+  property_map<OperationGraph, vertex_index_t>::type index = get(vertex_index, m_context.graph);
+  int i=0;
+  std::pair<GraphTraits::vertex_iterator, GraphTraits::vertex_iterator> vp;
+  for (vp = vertices(m_context.graph); vp.first != vp.second; ++vp.first)
+    put(index, *vp.first, i++);
+
   write_graphviz(oss, m_context.graph, make_label_writer(m_context.label));
   output = oss.str();
 }
 
 
 void OperationProcessor::Worker::retire_operation(Vertex v, OperationPtr &operation) {
+  std::vector<Vertex> sources;
+  GraphTraits::in_edge_iterator in_i, in_end;
+
   m_context.op->purge_from_obstruction_index(v);
   m_context.op->purge_from_dependency_index(v);
   m_context.op->purge_from_exclusivity_index(v);
-  if (in_degree(v, m_context.graph) > 0)
+  for (tie(in_i, in_end) = in_edges(v, m_context.graph); in_i != in_end; ++in_i)
+    sources.push_back(source(*in_i, m_context.graph));
+  if (!sources.empty())
     m_context.need_order_recompute = true;
+  m_context.op->remove_from_levels(v);
   clear_vertex(v, m_context.graph);
   remove_vertex(v, m_context.graph);
   m_context.live.erase(v);
+  foreach (Vertex u, sources)
+    m_context.op->update_exec_time(u);
   if (operation->exclusive())
     m_context.exclusive_ops.erase(operation->name());
   //HT_INFOF("Retiring op %p vertex %p", operation.get(), v);
@@ -524,14 +577,26 @@ void OperationProcessor::Worker::retire_operation(Vertex v, OperationPtr &operat
 
 void OperationProcessor::Worker::update_operation(Vertex v, OperationPtr &operation) {
   not_permanent np(m_context);
+  std::vector<Vertex> sources;
+  GraphTraits::in_edge_iterator in_i, in_end;
 
   m_context.op->purge_from_obstruction_index(v);
   m_context.op->purge_from_dependency_index(v);
 
+  for (tie(in_i, in_end) = in_edges(v, m_context.graph); in_i != in_end; ++in_i) {
+    if (np(*in_i))
+      sources.push_back(source(*in_i, m_context.graph));
+  }
+
   remove_in_edge_if(v, np, m_context.graph);
   remove_out_edge_if(v, np, m_context.graph);
 
   m_context.op->add_dependencies(v, operation);
+
+  // Execution times of v and of the vertices that pointed to it may drop
+  m_context.op->update_exec_time(v);
+  foreach (Vertex u, sources)
+    m_context.op->update_exec_time(u);
   
   m_context.need_order_recompute = true;
   m_context.current_iter = m_context.current.end();
@@ -539,62 +604,17 @@ void OperationProcessor::Worker::update_operation(Vertex v, OperationPtr &operat
 }
 
 
+/**
+ * Execution times and the level index are maintained incrementally as
+ * edges are added and removed, so all that's left to do here is to rewind
+ * the scheduler to the lowest level.
+ */
 void OperationProcessor::Worker::recompute_order() {
 
-  // re-assign vertex indexes
-  property_map<OperationGraph, vertex_index_t>::type index = get(vertex_index, m_context.graph);
-  int i=0;
-  std::pair<GraphTraits::vertex_iterator, GraphTraits::vertex_iterator> vp;
-  for (vp = vertices(m_context.graph); vp.first != vp.second; ++vp.first)
-    put(index, *vp.first, i++);
-
-  /** uncomment for DEBUG output **/
-  //write_graphviz(std::cout, m_context.graph, make_label_writer(m_context.label));
-
-  m_context.execution_order.clear();
-  topological_sort(m_context.graph, std::back_inserter(m_context.execution_order));
-
-  ExecutionList::iterator iter;
-
-  for (iter = m_context.execution_order.begin(); iter != m_context.execution_order.end(); ++iter) {
-    HT_ASSERT(m_context.live.count(iter->vertex) > 0);
-    //HT_ASSERT(!m_context.ops[*iter]->is_complete());
-    m_context.exec_time[iter->vertex] = 0;
-  }
-
-  for (iter = m_context.execution_order.begin(); iter != m_context.execution_order.end(); ++iter) {
-    // Walk through the out_edges an calculate the maximum time.
-    if (out_degree (iter->vertex, m_context.graph) > 0) {
-      OperationGraph::out_edge_iterator j, j_end;
-      int maxdist=0;
-      for (boost::tie(j, j_end) = out_edges(iter->vertex, m_context.graph); j != j_end; ++j)
-        maxdist=(std::max)(m_context.exec_time[target(*j, m_context.graph)], maxdist);
-      m_context.exec_time[iter->vertex] = maxdist+1;
-    }
-  }
-
-  // Sort execution order
-  std::vector<struct vertex_info> vvec;
-  for (iter = m_context.execution_order.begin(); iter != m_context.execution_order.end(); ++iter) {
-    iter->taken = m_context.busy[iter->vertex];
-    vvec.push_back(*iter);
-  }
-
-  std::set<Vertex> vset;
-
-  struct ltvertexinfo ltvi(m_context);
-  std::sort(vvec.begin(), vvec.end(), ltvi);
-  m_context.execution_order.clear();
-  for (size_t i=0; i<vvec.size(); i++) {
-    HT_ASSERT(vset.count(vvec[i].vertex) == 0);
-    vset.insert(vvec[i].vertex);
-    m_context.execution_order.push_back(vvec[i]);
-  }
-
-  m_context.execution_order_iter = m_context.execution_order.begin();
+  m_context.next_level = 0;
 
   m_context.need_order_recompute = false;
-  if (m_context.execution_order.empty())
+  if (m_context.levels.empty())
     m_context.idle_cond.notify_all();
 
 }
@@ -602,24 +622,26 @@ void OperationProcessor::Worker::recompute_order() {
 
 bool OperationProcessor::Worker::load_current() {
   size_t blocked = 0;
-  size_t retired = 0;
+  LevelIndex::iterator level_iter =
+    m_context.levels.lower_bound(m_context.next_level);
+
+  HT_ASSERT(level_iter != m_context.levels.end());
 
   m_context.current.clear();
   m_context.current_active.clear();
   m_context.current_blocked = 0;
-  for (int time_slot = m_context.exec_time[m_context.execution_order_iter->vertex];
-       m_context.execution_order_iter != m_context.execution_order.end() && time_slot == m_context.exec_time[m_context.execution_order_iter->vertex];
-       ++m_context.execution_order_iter) {
-    // If live, add it to the current set
-    if (m_context.live.count(m_context.execution_order_iter->vertex) > 0) {
-      m_context.current.push_back(*m_context.execution_order_iter);
-      m_context.current_active.insert(m_context.execution_order_iter->vertex);
-      if (!m_context.execution_order_iter->taken &&
-          m_context.ops[m_context.execution_order_iter->vertex]->is_blocked())
+  m_context.next_level = level_iter->first + 1;
+
+  // Operations that are already running go to the front of the list
+  foreach (Vertex v, level_iter->second) {
+    if (m_context.busy[v])
+      m_context.current.push_front(vertex_info(v, true));
+    else {
+      m_context.current.push_back(vertex_info(v));
+      if (m_context.ops[v]->is_blocked())
         blocked++;
     }
-    else
-      retired++;
+    m_context.current_active.insert(v);
   }
 
   //HT_INFOF("current size = %lu, blocked = %lu", m_context.current.size(), blocked);
@@ -111,7 +111,27 @@ namespace Hypertable {
     };
     typedef std::list<vertex_info> ExecutionList;
 
-    typedef std::multimap<const String, Vertex> DependencyIndex;
+    /**
+     * Maps dependency names to the set of vertices registered under them.
+     * A reverse mapping from vertex to names is kept as well so that a
+     * vertex can be purged without scanning the whole index.
+     */
+    class DependencyIndex {
+    public:
+      const VertexSet &find(const String &name) const;
+      bool contains(const String &name, Vertex v) const;
+      void insert(const String &name, Vertex v);
+      void purge(Vertex v);
+    private:
+      typedef hash_map<String, VertexSet> NameMap;
+      typedef std::map<Vertex, StringSet> VertexMap;
+      NameMap m_names;
+      VertexMap m_vertices;
+      VertexSet m_empty;
+    };
+
+    /** Live vertices bucketed by execution time (longest path to a sink) */
+    typedef std::map<int, VertexSet> LevelIndex;
 
     void add_dependencies(Vertex v, OperationPtr &operation);
     void add_exclusivity(Vertex v, const String &name);
@@ -122,6 +142,9 @@ namespace Hypertable {
     void purge_from_obstruction_index(Vertex v);
     void add_edge(Vertex v, Vertex u);
     void add_edge_permanent(Vertex v, Vertex u);
+    void update_exec_time(Vertex v);
+    void set_exec_time(Vertex v, int exec_time);
+    void remove_from_levels(Vertex v);
 
     typedef std::set<OperationPtr> PerpetualSet;
 
@@ -140,8 +163,8 @@ namespace Hypertable {
       StringSet exclusive_ops;
       ExecutionList current;
       ExecutionList::iterator current_iter;
-      ExecutionList execution_order;
-      ExecutionList::iterator execution_order_iter;
+      LevelIndex levels;
+      int next_level;
       DependencyIndex exclusivity_index;
       DependencyIndex dependency_index;
       DependencyIndex obstruction_index;
@@ -157,6 +180,9 @@ namespace Hypertable {
       boost::property_map<OperationGraph, label_t>::type label;
       boost::property_map<OperationGraph, busy_t>::type busy;
       boost::property_map<OperationGraph, permanent_t>::type permanent;
+      bool order_pending() {
+        return levels.lower_bound(next_level) != levels.end();
+      }
     };
 
     struct not_permanent {
@@ -167,16 +193,6 @@ namespace Hypertable {
       ThreadContext &m_context;
     };
 
-    struct ltvertexinfo {
-      ltvertexinfo(ThreadContext &context) : m_context(context) { }
-      inline bool operator() (const vertex_info &vi1, const vertex_info &vi2) {
-        if (m_context.exec_time[vi1.vertex] == m_context.exec_time[vi2.vertex])
-          return vi1.taken && !vi2.taken;
-        return m_context.exec_time[vi1.vertex] < m_context.exec_time[vi2.vertex];
-      }
-      ThreadContext &m_context;
-    };
-
     class Worker {
     public:
       Worker(ThreadContext &context) : m_context(context) { return; }
@@ -44,6 +44,9 @@ namespace Hypertable {
     int64_t fetch_duration;
     int fetch_error;
     String fetch_error_msg;
+    /** Latency samples recorded between the last two fetches; the
+     * server reports cumulative histograms */
+    LatencyHistogram latency[StatsRangeServer::LATENCY_PHASE_COUNT];
   };
 
 }
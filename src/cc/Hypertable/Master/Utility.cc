@@ -211,6 +211,12 @@ void create_table_in_hyperspace(ContextPtr &context, const String &name,
 
 
 void create_table_write_metadata(ContextPtr &context, TableIdentifier *table) {
+  create_table_write_metadata(context, table, std::vector<String>());
+}
+
+
+void create_table_write_metadata(ContextPtr &context, TableIdentifier *table,
+                                 const std::vector<String> &split_rows) {
 
   if (context->test_mode) {
     HT_WARN("Skipping create_table_write_metadata due to TEST MODE");
@@ -219,19 +225,30 @@ void create_table_write_metadata(ContextPtr &context, TableIdentifier *table) {
 
   TableMutatorPtr mutator_ptr = context->metadata_table->create_mutator();
 
-  String metadata_key_str = String(table->id) + ":" + Key::END_ROW_MARKER;
+  String metadata_key_str;
   String start_row;
   KeySpec key;
-  key.row = metadata_key_str.c_str();
-  key.row_len = metadata_key_str.length();
   key.column_qualifier = 0;
   key.column_qualifier_len = 0;
   key.column_family = "StartRow";
 
+  // One METADATA row per initial range, keyed by its end row
+  for (size_t i=0; i<split_rows.size(); i++) {
+    metadata_key_str = String(table->id) + ":" + split_rows[i];
+    key.row = metadata_key_str.c_str();
+    key.row_len = metadata_key_str.length();
+    mutator_ptr->set(key, start_row.c_str(), start_row.length());
+    start_row = split_rows[i];
+  }
+
+  metadata_key_str = String(table->id) + ":" + Key::END_ROW_MARKER;
+  key.row = metadata_key_str.c_str();
+  key.row_len = metadata_key_str.length();
+
   if (table->is_metadata())
     mutator_ptr->set(key, Key::END_ROOT_ROW, strlen(Key::END_ROOT_ROW));
   else
-    mutator_ptr->set(key, 0, 0);
+    mutator_ptr->set(key, start_row.c_str(), start_row.length());
 
   mutator_ptr->flush();
 }
@@ -248,7 +265,7 @@ bool next_available_server(ContextPtr &context, String &location) {
 }
 
 
-void create_table_load_range(ContextPtr &context, const String &location, TableIdentifier *table, RangeSpec &range, bool needs_compaction) {
+void create_table_load_range(ContextPtr &context, const String &location, TableIdentifier *table, RangeSpec &range, bool needs_compaction, size_t range_count) {
   RangeServerClient rsc(context->comm);
   CommAddress addr;
 
@@ -268,8 +285,16 @@ void create_table_load_range(ContextPtr &context, const String &location, TableI
 
     if (table->is_metadata() || !context->props->get_bool("Hypertable.Master.Split.SoftLimitEnabled"))
       range_state.soft_limit = context->range_split_size;
-    else
-      range_state.soft_limit = context->range_split_size / std::min(64, (int)context->server_count()*2);
+    else {
+      // The soft limit makes a new table split early until it has about
+      // two ranges per server.  A pre-split table starts with range_count
+      // ranges, so each one only needs to split that much less often.
+      size_t divisor = std::min(64, (int)context->server_count()*2);
+      if (range_count >= divisor)
+        range_state.soft_limit = context->range_split_size;
+      else
+        range_state.soft_limit = (context->range_split_size * range_count) / divisor;
+    }
     rsc.load_range(addr, *table, range, 0, range_state, needs_compaction);
   }
   catch (Exception &e) {
@@ -39,10 +39,12 @@ namespace Hypertable {
     extern void create_table_in_hyperspace(ContextPtr &context, const String &name,
                                            const String &schema_str, TableIdentifierManaged *table);
     extern void create_table_write_metadata(ContextPtr &context, TableIdentifier *table);
+    extern void create_table_write_metadata(ContextPtr &context, TableIdentifier *table,
+                                            const std::vector<String> &split_rows);
     extern bool next_available_server(ContextPtr &context, String &location);
     extern void create_table_load_range(ContextPtr &context, const String &location,
                                         TableIdentifier *table, RangeSpec &range,
-                                        bool needs_compaction);
+                                        bool needs_compaction, size_t range_count=1);
     extern int64_t range_hash_code(const TableIdentifier &table, const RangeSpec &range, const char *qualifier=0);
     extern String range_hash_string(const TableIdentifier &table, const RangeSpec &range, const char *qualifier=0);
 
@@ -59,6 +59,10 @@ main(int ac, char *av[]) {
   try {
     init_with_policy<AppPolicy>(ac, av);
 
+    if (has("full"))
+      properties->set("Hypertable.Master.Gc.ScanDirectories", true);
+
+    context = new Context();
     context->comm = Comm::instance();
     context->conn_manager = new ConnectionManager(context->comm);
     context->props = properties;
@@ -71,7 +75,7 @@ main(int ac, char *av[]) {
     ns = client->open_namespace("sys");
     context->metadata_table = ns->open_table("METADATA");
 
-    GcWorker worker(context);
+    GcWorker worker(context, has("dryrun"));
 
     worker.gc();
 
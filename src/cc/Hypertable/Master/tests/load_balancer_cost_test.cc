@@ -0,0 +1,181 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+#include "Common/Compat.h"
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/Master/LoadBalancerBasicDistributeCost.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const int64_t RANGE_MEMORY = 100 * 1024 * 1024;
+  const int64_t RANGE_DISK = 1024 * 1024 * 1024;
+  const double RANGE_WRITE_RATE = 1024 * 1024;
+
+  PropertiesPtr make_props(int64_t max_move_cost) {
+    PropertiesPtr props = new Properties;
+    props->set("Hypertable.LoadBalancer.CostAware.Weight.Loadavg", 1.0);
+    props->set("Hypertable.LoadBalancer.CostAware.Weight.Memory", 1.0);
+    props->set("Hypertable.LoadBalancer.CostAware.Weight.Disk", 1.0);
+    props->set("Hypertable.LoadBalancer.CostAware.Weight.WriteRate", 1.0);
+    props->set("Hypertable.LoadBalancer.CostAware.ScoreThreshold", 0.25);
+    props->set("Hypertable.LoadBalancer.CostAware.MaxMoveCost", max_move_cost);
+    return props;
+  }
+
+  /**
+   * Adds a server with <code>num_ranges</code> identical ranges, each
+   * contributing a loadavg of 1 and RANGE_WRITE_RATE bytes/s of writes
+   */
+  void add_server(LoadBalancerBasicDistributeCost &planner, const char *id,
+                  int num_ranges) {
+    ServerMetrics server(id);
+    RangeMetricsMap ranges;
+    String str;
+
+    str = format("2:1000:%d:0:%f:0:0:0:0:0:0:0", num_ranges,
+                 num_ranges * RANGE_WRITE_RATE);
+    server.add_measurement(str.c_str(), str.length());
+
+    for (int i=0; i<num_ranges; i++) {
+      String end_row = format("%s-%02d", id, i);
+      RangeMetrics range(id, "2", end_row.c_str());
+      String start_row = format("%s-%02d", id, i-1);
+      range.set_start_row(start_row.c_str(), start_row.length());
+      str = format("2:1000:%lld:%lld:0:%f:0:0:0:0:0", (Lld)RANGE_DISK,
+                   (Lld)RANGE_MEMORY, RANGE_WRITE_RATE);
+      range.add_measurement(str.c_str(), str.length());
+      ranges.insert(RangeMetricsMap::value_type(end_row, range));
+    }
+
+    planner.add_server(server, ranges);
+  }
+
+  size_t plan_moves(int64_t max_move_cost,
+                    const vector<RangeMoveSpecPtr> &in_progress
+                    = vector<RangeMoveSpecPtr>()) {
+    PropertiesPtr props = make_props(max_move_cost);
+    TablePtr table;
+    LoadBalancerBasicDistributeCost planner(props, table);
+    BalancePlanPtr plan = new BalancePlan;
+
+    add_server(planner, "rs1", 6);
+    add_server(planner, "rs2", 0);
+    planner.compute_plan(plan, in_progress);
+
+    foreach(RangeMoveSpecPtr &move, plan->moves) {
+      HT_ASSERT(move->source_location == "rs1");
+      HT_ASSERT(move->dest_location == "rs2");
+      foreach(const RangeMoveSpecPtr &pending, in_progress)
+        HT_ASSERT(strcmp(move->range.end_row, pending->range.end_row));
+    }
+    return plan->moves.size();
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  // balanced servers produce no moves
+  {
+    PropertiesPtr props = make_props(2000000000LL);
+    TablePtr table;
+    LoadBalancerBasicDistributeCost planner(props, table);
+    BalancePlanPtr plan = new BalancePlan;
+
+    add_server(planner, "rs1", 3);
+    add_server(planner, "rs2", 3);
+    planner.compute_plan(plan);
+    HT_ASSERT(plan->moves.empty());
+  }
+
+  // a server without measurements is not a move target
+  {
+    PropertiesPtr props = make_props(2000000000LL);
+    TablePtr table;
+    LoadBalancerBasicDistributeCost planner(props, table);
+    BalancePlanPtr plan = new BalancePlan;
+    RangeMetricsMap no_ranges;
+
+    add_server(planner, "rs1", 4);
+    add_server(planner, "rs2", 4);
+    planner.add_server(ServerMetrics("rs3"), no_ranges);
+    HT_ASSERT(planner.get_servers().size() == 2);
+    planner.compute_plan(plan);
+    HT_ASSERT(plan->moves.empty());
+  }
+
+  // the hot server sheds ranges until it is within the threshold: its score
+  // goes 2.0 -> 1.67 -> 1.33 -> 1.0 against a cluster mean of 3 ranges
+  {
+    PropertiesPtr props = make_props(2000000000LL);
+    TablePtr table;
+    LoadBalancerBasicDistributeCost planner(props, table);
+    BalancePlanPtr plan = new BalancePlan;
+
+    add_server(planner, "rs1", 6);
+    add_server(planner, "rs2", 0);
+    planner.compute_plan(plan);
+    HT_ASSERT(plan->moves.size() == 3);
+
+    const LoadBalancerBasicDistributeCost::ServerMap &servers =
+      planner.get_servers();
+    HT_ASSERT(servers.find("rs1")->second.score < 1.25);
+    HT_ASSERT(servers.find("rs2")->second.score < 1.25);
+  }
+
+  // the total cost of a plan is capped by MaxMoveCost
+  {
+    PropertiesPtr props = make_props(0);
+    TablePtr table;
+    LoadBalancerBasicDistributeCost planner(props, table);
+    LoadBalancerBasicDistributeCost::RangeState range;
+    range.resources[LoadBalancerBasicDistributeCost::RESOURCE_MEMORY] =
+      RANGE_MEMORY;
+    range.resources[LoadBalancerBasicDistributeCost::RESOURCE_WRITE_RATE] =
+      RANGE_WRITE_RATE;
+    double cost = planner.move_cost(range);
+
+    // memory to compact plus stalled writes on top of the fixed overhead
+    HT_ASSERT(cost > RANGE_MEMORY + RANGE_WRITE_RATE);
+    HT_ASSERT(plan_moves((int64_t)(2 * cost) + 1) == 2);
+    HT_ASSERT(plan_moves((int64_t)cost) == 1);
+    HT_ASSERT(plan_moves((int64_t)cost - 1) == 0);
+
+    // moves of earlier plans that are still in flight count against it
+    vector<RangeMoveSpecPtr> in_progress;
+    in_progress.push_back(new RangeMoveSpec("rs1", "rs2", "2", "rs1--1",
+                                            "rs1-00"));
+    HT_ASSERT(plan_moves((int64_t)(2 * cost) + 1, in_progress) == 1);
+    HT_ASSERT(plan_moves((int64_t)cost, in_progress) == 0);
+
+    // once the range is reported on its destination it no longer does
+    in_progress[0]->source_location = "rs3";
+    HT_ASSERT(plan_moves((int64_t)(2 * cost) + 1, in_progress) == 2);
+  }
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+#include "Common/Stopwatch.h"
+
+#include <cstdlib>
+#include <iostream>
+
+#include "DfsBroker/Lib/Client.h"
+
+#include "Hypertable/Lib/Config.h"
+
+#include "Hypertable/Master/Context.h"
+#include "Hypertable/Master/MetaLogDefinitionMaster.h"
+#include "Hypertable/Master/OperationProcessor.h"
+#include "Hypertable/Master/RemovalManager.h"
+#include "Hypertable/Master/ResponseManager.h"
+
+using namespace Hypertable;
+using namespace Config;
+
+namespace {
+
+  struct AppPolicy : Config::Policy {
+    static void init_options() {
+      cmdline_desc("Usage: %s [options]\n\n"
+                   "  This program measures OperationProcessor scheduling\n"
+                   "  throughput by enqueueing synthetic operations with\n"
+                   "  random dependencies and waiting for them to drain.\n"
+                   "\nOptions").add_options()
+        ("count", i32()->default_value(100000), "Number of operations")
+        ("dependencies", i32()->default_value(3),
+         "Maximum number of dependencies per operation")
+        ("batch-size", i32()->default_value(1000),
+         "Number of operations added per add_operations() call")
+        ("seed", i32()->default_value(1), "Random number generator seed")
+        ;
+    }
+  };
+
+  typedef Meta::list<GenericServerPolicy, DfsClientPolicy,
+                     HyperspaceClientPolicy, DefaultCommPolicy, AppPolicy> Policies;
+
+  /**
+   * Operation that completes on its first execution, so that the benchmark
+   * measures scheduling overhead rather than operation work.
+   */
+  class OperationBenchmark : public Operation {
+  public:
+    OperationBenchmark(ContextPtr &context, int32_t number)
+      : Operation(context, MetaLog::EntityType::OPERATION_TEST),
+        m_number(number) {
+      set_state(OperationState::STARTED);
+      m_exclusivities.insert(format("op-%d", (int)m_number));
+    }
+    virtual void execute() { set_state(OperationState::COMPLETE); }
+    virtual const String name() { return "OperationBenchmark"; }
+    virtual const String label() { return format("OperationBenchmark-%d", (int)m_number); }
+    virtual void display_state(std::ostream &os) { os << " number=" << m_number << " "; }
+    virtual size_t encoded_state_length() const { return 4; }
+    virtual void encode_state(uint8_t **bufp) const { Serialization::encode_i32(bufp, m_number); }
+    virtual void decode_state(const uint8_t **bufp, size_t *remainp) { decode_request(bufp, remainp); }
+    virtual void decode_request(const uint8_t **bufp, size_t *remainp) {
+      m_number = Serialization::decode_i32(bufp, remainp);
+    }
+  private:
+    int32_t m_number;
+  };
+
+} // local namespace
+
+
+int main(int argc, char **argv) {
+
+  try {
+    init_with_policies<Policies>(argc, argv);
+    ContextPtr context = new Context();
+    std::vector<MetaLog::EntityPtr> entities;
+    std::vector<OperationPtr> operations;
+    int32_t count = get_i32("count");
+    int32_t max_dependencies = get_i32("dependencies");
+    int32_t batch_size = get_i32("batch-size");
+    size_t edges = 0;
+
+    srandom(get_i32("seed"));
+
+    context->comm = Comm::instance();
+    context->conn_manager = new ConnectionManager(context->comm);
+    context->props = properties;
+    context->dfs = new DfsBroker::Client(context->conn_manager, context->props);
+    context->toplevel_dir = properties->get_str("Hypertable.Directory");
+    String log_dir = context->toplevel_dir + "/servers/master/log";
+    boost::trim_if(context->toplevel_dir, boost::is_any_of("/"));
+    context->toplevel_dir = String("/") + context->toplevel_dir;
+    context->mml_definition = new MetaLog::DefinitionMaster(context, "master");
+    context->mml_writer = new MetaLog::Writer(context->dfs, context->mml_definition,
+                                              log_dir + "/" + context->mml_definition->name(),
+                                              entities);
+
+    ResponseManagerContext *rmctx = new ResponseManagerContext(context->mml_writer);
+    context->response_manager = new ResponseManager(rmctx);
+    Thread response_manager_thread(*context->response_manager);
+
+    context->removal_manager = new RemovalManager(context->mml_writer);
+
+    // Build the operations up front so that only scheduling gets timed
+    for (int32_t i=0; i<count; i++) {
+      OperationPtr operation = new OperationBenchmark(context, i);
+      int32_t ndeps = (i > 0) ? random() % (max_dependencies+1) : 0;
+      for (int32_t j=0; j<ndeps; j++) {
+        operation->add_dependency(format("op-%d", (int)(random() % i)));
+        edges++;
+      }
+      operations.push_back(operation);
+    }
+
+    context->op = new OperationProcessor(context, 4);
+
+    Stopwatch stopwatch;
+    std::vector<OperationPtr> batch;
+
+    for (size_t i=0; i<operations.size(); i+=batch_size) {
+      batch.assign(operations.begin()+i,
+                   operations.begin()+std::min(operations.size(), i+batch_size));
+      context->op->add_operations(batch);
+    }
+    double add_seconds = stopwatch.elapsed();
+
+    context->op->wait_for_empty();
+    stopwatch.stop();
+
+    std::cout << "operations: " << count << "\n"
+              << "dependencies: " << edges << "\n"
+              << "enqueue time: " << add_seconds << "s\n"
+              << "total time: " << stopwatch.elapsed() << "s\n"
+              << "throughput: " << (double)count / stopwatch.elapsed()
+              << " ops/s" << std::endl;
+
+    context->op->shutdown();
+    context->op->join();
+
+    context->response_manager->shutdown();
+    response_manager_thread.join();
+    delete rmctx;
+    delete context->response_manager;
+
+    context->removal_manager->shutdown();
+    delete context->removal_manager;
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    _exit(1);
+  }
+  return 0;
+}
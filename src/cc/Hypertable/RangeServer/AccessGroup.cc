@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "Common/Error.h"
+#include "Common/Time.h"
 #include "Common/md5.h"
 
 #include "AccessGroup.h"
@@ -34,7 +35,7 @@
 #include "CellCacheScanner.h"
 #include "CellStoreFactory.h"
 #include "CellStoreReleaseCallback.h"
-#include "CellStoreV5.h"
+#include "CellStoreV6.h"
 #include "Global.h"
 #include "MaintenanceFlag.h"
 #include "MergeScannerAccessGroup.h"
@@ -52,6 +53,7 @@ AccessGroup::AccessGroup(const TableIdentifier *identifier,
     m_compression_ratio(1.0), m_earliest_cached_revision(TIMESTAMP_MAX),
     m_earliest_cached_revision_saved(TIMESTAMP_MAX),
     m_latest_stored_revision(TIMESTAMP_MIN), m_collisions(0),
+    m_bytes_flushed(0), m_bytes_written(0), m_expire_ttl(0),
     m_file_tracker(identifier, schema, range, ag->name), m_is_root(false),
     m_recovering(false), m_needs_merging(false) {
 
@@ -88,6 +90,8 @@ AccessGroup::AccessGroup(const TableIdentifier *identifier,
   }
   m_bloom_filter_disabled = BLOOM_FILTER_DISABLED ==
       m_cellstore_props->get<BloomFilterMode>("bloom-filter-mode");
+
+  compaction_policy_initialize(ag);
 }
 
 
@@ -123,11 +127,104 @@ void AccessGroup::update_schema(SchemaPtr &schema,
       }
     }
 
+    compaction_policy_initialize(ag);
+
     // Update schema ptr
     m_schema = schema;
   }
 }
 
+
+void AccessGroup::compaction_policy_initialize(Schema::AccessGroup *ag) {
+  PropertiesPtr props = new Properties();
+
+  if (ag->compaction_policy.size())
+    Schema::parse_compaction_policy(ag->compaction_policy, props);
+  else {
+    assert(Config::properties); // requires Config::init* first
+    Schema::parse_compaction_policy(Config::get_str("Hypertable.RangeServer"
+        ".AccessGroup.DefaultCompactionPolicy"), props);
+  }
+  m_compaction_policy = CompactionPolicy::create(props);
+
+  /**
+   * CellStores can be dropped once their newest cell has outlived the
+   * longest TTL of the access group, provided every column family has one
+   */
+  m_expire_ttl = 0;
+  if (m_compaction_policy->drop_expired()) {
+    foreach(Schema::ColumnFamily *cf, ag->columns) {
+      if (cf->deleted)
+        continue;
+      if (cf->ttl == 0) {
+        m_expire_ttl = 0;
+        break;
+      }
+      if ((int64_t)cf->ttl * 1000000000LL > m_expire_ttl)
+        m_expire_ttl = (int64_t)cf->ttl * 1000000000LL;
+    }
+  }
+  m_garbage_tracker.set_expire_by_file(m_expire_ttl != 0);
+}
+
+
+/**
+ * A CellStore has expired once its newest cell has outlived the longest
+ * TTL.  The trailer's expiration time is honored as well, since older
+ * CellStores may under-report their newest timestamp.
+ */
+bool AccessGroup::is_expired(const CellStoreInfo &info, int64_t now) {
+  if (m_expire_ttl == 0 || info.timestamp_max == TIMESTAMP_MIN)
+    return false;
+  return std::max(info.expiration_time, info.timestamp_max + m_expire_ttl) < now;
+}
+
+
+/**
+ * Drops the CellStores whose cells have all expired.  They are removed
+ * from the live file set without being read; any scanner still using one
+ * keeps it open until it is destroyed.
+ */
+void AccessGroup::drop_expired_cellstores() {
+  std::vector<String> removed_files;
+  std::vector<int> removed_file_ids;
+  int64_t now = get_ts64();
+
+  {
+    ScopedLock lock(m_mutex);
+    if (m_in_memory || m_expire_ttl == 0)
+      return;
+
+    std::vector<CellStoreInfo> live_stores;
+    for (size_t i=0; i<m_stores.size(); i++) {
+      if (is_expired(m_stores[i], now)) {
+        removed_files.push_back(m_stores[i].cs->get_filename());
+        removed_file_ids.push_back(m_stores[i].cs->get_file_id());
+      }
+      else
+        live_stores.push_back(m_stores[i]);
+    }
+
+    if (removed_files.empty())
+      return;
+
+    m_stores.swap(live_stores);
+    recompute_compression_ratio();
+    m_needs_merging = needs_merging();
+  }
+
+  m_file_tracker.update_live("", removed_files, m_next_cs_id);
+  m_file_tracker.update_files_column();
+
+  if (Global::local_block_cache) {
+    foreach (int file_id, removed_file_ids)
+      Global::local_block_cache->purge(file_id);
+  }
+
+  HT_INFOF("Dropped %d expired CellStores from %s(%s)",
+           (int)removed_files.size(), m_range_name.c_str(), m_name.c_str());
+}
+
 /**
  * This should be called with the CellCache locked Also, at the end of
  * compaction processing, when m_cell_cache gets reset to a new value, the
@@ -139,27 +236,29 @@ void AccessGroup::add(const Key &key, const ByteString value) {
   if (key.revision > m_latest_stored_revision || Global::ignore_clock_skew_errors) {
     if (key.revision < m_earliest_cached_revision)
       m_earliest_cached_revision = key.revision;
-    if (m_schema->column_is_counter(key.column_family_code))
-      return m_cell_cache->add_counter(key, value);
-    else
-      return m_cell_cache->add(key, value);
+    add_to_cell_cache(key, value);
   }
   else if (!m_recovering) {
     HT_ERROR("Revision (clock) skew detected! May result in data loss.");
-    if (m_schema->column_is_counter(key.column_family_code))
-      return m_cell_cache->add_counter(key, value);
-    else
-      return m_cell_cache->add(key, value);
+    add_to_cell_cache(key, value);
   }
   else if (m_in_memory) {
-    if (m_schema->column_is_counter(key.column_family_code))
-      return m_cell_cache->add_counter(key, value);
-    else
-      return m_cell_cache->add(key, value);
+    add_to_cell_cache(key, value);
   }
 }
 
 
+void AccessGroup::add_to_cell_cache(const Key &key, const ByteString value) {
+  MergeOperator *merge_op;
+  if (m_schema->column_is_counter(key.column_family_code))
+    m_cell_cache->add_counter(key, value);
+  else if ((merge_op = m_schema->get_merge_operator(key.column_family_code)))
+    m_cell_cache->add_merge(key, value, merge_op);
+  else
+    m_cell_cache->add(key, value);
+}
+
+
 CellListScanner *AccessGroup::create_scanner(ScanContextPtr &scan_context) {
   bool all = scan_context->spec ? scan_context->spec->return_deletes : false;
   MergeScanner *scanner = new MergeScannerAccessGroup(scan_context, all);
@@ -182,7 +281,7 @@ CellListScanner *AccessGroup::create_scanner(ScanContextPtr &scan_context) {
       scanner->add_scanner(m_immutable_cache->create_scanner(scan_context));
 
     if (!m_in_memory) {
-      bool bloom_filter_disabled;
+      uint8_t bloom_filter_mode;
 
       for (size_t i=0; i<m_stores.size(); ++i) {
 
@@ -190,14 +289,16 @@ CellListScanner *AccessGroup::create_scanner(ScanContextPtr &scan_context) {
             scan_context->time_interval.second < m_stores[i].timestamp_min)
           continue;
 
-        bloom_filter_disabled = boost::any_cast<uint8_t>(m_stores[i].cs->get_trailer()->get("bloom_filter_mode")) == BLOOM_FILTER_DISABLED;
+        bloom_filter_mode = boost::any_cast<uint8_t>(m_stores[i].cs->get_trailer()->get("bloom_filter_mode"));
 
         initial_bytes_read = m_stores[i].cs->bytes_read();
 
         // Query bloomfilter only if it is enabled and a start row has been specified
-        // (ie query is not something like select bar from foo;)
-        if (bloom_filter_disabled ||
-            !scan_context->single_row ||
+        // (ie query is not something like select bar from foo;).  Row prefix
+        // filters are also queried for multi-row scans
+        if (bloom_filter_mode == BLOOM_FILTER_DISABLED ||
+            (!scan_context->single_row &&
+             bloom_filter_mode != BLOOM_FILTER_ROWS_PREFIX) ||
             scan_context->start_row == "") {
           if (m_stores[i].shadow_cache) {
             scanner->add_scanner(m_stores[i].shadow_cache->create_scanner(scan_context));
@@ -450,6 +551,17 @@ AccessGroup::MaintenanceData *AccessGroup::get_maintenance_data(ByteArena &arena
 
   mdata->gc_needed = m_garbage_tracker.check_needed(mdata->deletes, mdata->mem_used, now);
   mdata->needs_merging = m_needs_merging;
+  if (!mdata->needs_merging && m_expire_ttl && !m_in_memory) {
+    int64_t now_ns = (int64_t)now * 1000000000LL;
+    for (size_t i=0; i<m_stores.size(); i++) {
+      if (is_expired(m_stores[i], now_ns)) {
+        mdata->needs_merging = true;
+        break;
+      }
+    }
+  }
+  mdata->bytes_flushed = m_bytes_flushed;
+  mdata->bytes_written = m_bytes_written;
 
   mdata->maintenance_flags = 0;
 
@@ -489,6 +601,103 @@ void AccessGroup::add_cell_store(CellStorePtr &cellstore) {
   m_file_tracker.add_live_noupdate(cellstore->get_filename());
 }
 
+CellStorePtr AccessGroup::open_staged_cell_store(const String &staged_file) {
+  String table_dir = format("%s/tables/%s/", Global::toplevel_dir.c_str(),
+                            m_identifier.id);
+
+  {
+    ScopedLock lock(m_mutex);
+    if (m_in_memory)
+      HT_THROWF(Error::NOT_ALLOWED, "Unable to import %s into IN_MEMORY "
+                "access group %s", staged_file.c_str(), m_full_name.c_str());
+  }
+
+  if (staged_file.compare(0, table_dir.length(), table_dir))
+    HT_THROWF(Error::NOT_ALLOWED, "Staged CellStore %s is not under %s",
+              staged_file.c_str(), table_dir.c_str());
+
+  return CellStoreFactory::open(staged_file, m_start_row.c_str(),
+                                m_end_row.c_str());
+}
+
+
+bool AccessGroup::has_cell_store(const String &fname) {
+  ScopedLock lock(m_mutex);
+  foreach (CellStoreInfo &info, m_stores) {
+    if (info.cs->get_filename() == fname)
+      return true;
+  }
+  return false;
+}
+
+
+void AccessGroup::add_live_file(const String &fname) {
+  std::vector<String> removed_files;
+  uint32_t next_cs_id;
+  {
+    ScopedLock lock(m_mutex);
+    next_cs_id = m_next_cs_id;
+  }
+  m_file_tracker.update_live(fname, removed_files, next_cs_id);
+}
+
+
+void AccessGroup::remove_live_file(const String &fname) {
+  std::vector<String> removed_files(1, fname);
+  uint32_t next_cs_id;
+  {
+    ScopedLock lock(m_mutex);
+    next_cs_id = m_next_cs_id;
+  }
+  m_file_tracker.update_live("", removed_files, next_cs_id);
+}
+
+
+void AccessGroup::attach_cell_store(CellStorePtr &cellstore) {
+  add_cell_store(cellstore);
+
+  ScopedLock lock(m_mutex);
+  m_needs_merging = needs_merging();
+}
+
+
+void AccessGroup::get_hot_blocks(HotBlockMap &hot_blocks) {
+  ScopedLock lock(m_mutex);
+
+  foreach (CellStoreInfo &info, m_stores) {
+    std::vector<int64_t> offsets;
+    info.cs->get_cached_blocks(offsets);
+    if (!offsets.empty())
+      hot_blocks[info.cs->get_filename()].swap(offsets);
+  }
+}
+
+
+void AccessGroup::get_blocks_to_warm(const HotBlockMap &hot_blocks,
+                                     WarmBlockList &blocks) {
+  ScopedLock lock(m_mutex);
+  std::vector<std::pair<int64_t, int64_t> > store_blocks;
+  WarmBlock block;
+
+  if (m_in_memory)
+    return;
+
+  foreach (CellStoreInfo &info, m_stores) {
+    HotBlockMap::const_iterator iter = hot_blocks.find(info.cs->get_filename());
+    if (iter == hot_blocks.end())
+      continue;
+    store_blocks.clear();
+    info.cs->get_blocks_to_warm(iter->second, store_blocks);
+    block.cs = info.cs;
+    for (size_t i=0; i<store_blocks.size(); i++) {
+      block.offset = store_blocks[i].first;
+      block.length = store_blocks[i].second;
+      blocks.push_back(block);
+    }
+  }
+}
+
+
 void AccessGroup::compute_garbage_stats(uint64_t *input_bytesp, uint64_t *output_bytesp) {
   ScanContextPtr scan_context = new ScanContext(m_schema);
   MergeScannerPtr mscanner = new MergeScannerAccessGroup(scan_context);
@@ -530,6 +739,8 @@ void AccessGroup::run_compaction(int maintenance_flags) {
   size_t merge_offset=0, merge_length=0;
   String added_file;
 
+  drop_expired_cellstores();
+
   while (abort_loop) {
     ScopedLock lock(m_mutex);
     if (m_in_memory) {
@@ -586,6 +797,7 @@ void AccessGroup::run_compaction(int maintenance_flags) {
     String cs_file;
 
     int64_t max_num_entries = 0;
+    int64_t cache_entries = 0;
 
     {
       ScopedLock lock(m_mutex);
@@ -622,9 +834,10 @@ void AccessGroup::run_compaction(int maintenance_flags) {
         }
       }
 
-      cellstore = new CellStoreV5(Global::dfs.get(), m_schema.get());
+      cellstore = new CellStoreV6(Global::dfs.get(), m_schema.get());
 
       max_num_entries = m_immutable_cache ? m_immutable_cache->size() : 0;
+      cache_entries = merging ? 0 : max_num_entries;
 
       if (m_in_memory) {
         mscanner = new MergeScannerAccessGroup(scan_context);
@@ -639,7 +852,7 @@ void AccessGroup::run_compaction(int maintenance_flags) {
         for (size_t i=merge_offset; i<merge_offset+merge_length; i++) {
           HT_ASSERT(m_stores[i].cs);
           mscanner->add_scanner(m_stores[i].cs->create_scanner(scan_context));
-          int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV5::SPLIT) ? 2: 1;
+          int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2: 1;
           max_num_entries += (boost::any_cast<int64_t>
               (m_stores[i].cs->get_trailer()->get("total_entries")))/divisor;
         }
@@ -652,7 +865,7 @@ void AccessGroup::run_compaction(int maintenance_flags) {
         for (size_t i=0; i<m_stores.size(); i++) {
           HT_ASSERT(m_stores[i].cs);
           mscanner->add_scanner(m_stores[i].cs->create_scanner(scan_context));
-          int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV5::SPLIT) ? 2: 1;
+          int divisor = (boost::any_cast<uint32_t>(m_stores[i].cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2: 1;
           max_num_entries += (boost::any_cast<int64_t>
               (m_stores[i].cs->get_trailer()->get("total_entries")))/divisor;
         }
@@ -670,20 +883,32 @@ void AccessGroup::run_compaction(int maintenance_flags) {
       scanner->forward();
     }
 
-    CellStoreTrailerV5 *trailer = dynamic_cast<CellStoreTrailerV5 *>(cellstore->get_trailer());
+    CellStoreTrailerV6 *trailer = dynamic_cast<CellStoreTrailerV6 *>(cellstore->get_trailer());
 
     if (major && mscanner)
-      trailer->flags |= CellStoreTrailerV5::MAJOR_COMPACTION;
+      trailer->flags |= CellStoreTrailerV6::MAJOR_COMPACTION;
 
     if (maintenance_flags & MaintenanceFlag::SPLIT)
-      trailer->flags |= CellStoreTrailerV5::SPLIT;
+      trailer->flags |= CellStoreTrailerV6::SPLIT;
 
     cellstore->finalize(&m_identifier);
 
+    /**
+     * Account for write amplification.  Bytes written on behalf of the
+     * immutable cache count as flushed; for major compactions the share
+     * is estimated from the entry counts.
+     */
+    int64_t bytes_written = cellstore->disk_usage();
+    int64_t bytes_flushed = 0;
+    if (cache_entries > 0 && max_num_entries > 0)
+      bytes_flushed = (int64_t)((double)bytes_written *
+          std::min(1.0, (double)cache_entries / (double)max_num_entries));
+
     /**
      * Install new CellCache and CellStore and update Live file tracker
      */
     std::vector<String> removed_files;
+    std::vector<int> removed_file_ids;
     {
       ScopedLock lock(m_mutex);
 
@@ -692,8 +917,10 @@ void AccessGroup::run_compaction(int maintenance_flags) {
         new_stores.reserve(m_stores.size() - (merge_length-1));
         for (size_t i=0; i<merge_offset; i++)
           new_stores.push_back(m_stores[i]);
-        for (size_t i=merge_offset; i<merge_offset+merge_length; i++)
+        for (size_t i=merge_offset; i<merge_offset+merge_length; i++) {
           removed_files.push_back(m_stores[i].cs->get_filename());
+          removed_file_ids.push_back(m_stores[i].cs->get_file_id());
+        }
         new_stores.push_back(cellstore);
         added_file = cellstore->get_filename();
         for (size_t i=merge_offset+merge_length; i<m_stores.size(); i++)
@@ -726,8 +953,10 @@ void AccessGroup::run_compaction(int maintenance_flags) {
         if (m_in_memory) {
           m_immutable_cache = filtered_cache;
           merge_caches(false);
-          for (size_t i=0; i<m_stores.size(); i++)
+          for (size_t i=0; i<m_stores.size(); i++) {
             removed_files.push_back(m_stores[i].cs->get_filename());
+            removed_file_ids.push_back(m_stores[i].cs->get_file_id());
+          }
           m_stores.clear();
         }
         else {
@@ -739,8 +968,10 @@ void AccessGroup::run_compaction(int maintenance_flags) {
 
           /** Drop the compacted CellStores from the stores vector **/
           if (major || gc) {
-            for (size_t i=0; i<m_stores.size(); i++)
+            for (size_t i=0; i<m_stores.size(); i++) {
               removed_files.push_back(m_stores[i].cs->get_filename());
+              removed_file_ids.push_back(m_stores[i].cs->get_file_id());
+            }
             m_stores.clear();
           }
         }
@@ -768,18 +999,28 @@ void AccessGroup::run_compaction(int maintenance_flags) {
       }
 
       recompute_compression_ratio();
+
+      m_bytes_written += bytes_written;
+      m_bytes_flushed += bytes_flushed;
     }
 
     m_file_tracker.update_live(added_file, removed_files, m_next_cs_id);
     m_file_tracker.update_files_column();
 
+    // blocks of files that are no longer live won't be read again
+    if (Global::local_block_cache) {
+      foreach (int file_id, removed_file_ids)
+        Global::local_block_cache->purge(file_id);
+    }
+
     if (merging)
       m_needs_merging = find_merge_run();
     else
       m_earliest_cached_revision_saved = TIMESTAMP_MAX;
 
-    HT_INFOF("Finished Compaction of %s(%s) to %s", m_range_name.c_str(),
-             m_name.c_str(), added_file.c_str());
+    HT_INFOF("Finished Compaction of %s(%s) to %s (write amplification "
+             "%.2f)", m_range_name.c_str(), m_name.c_str(), added_file.c_str(),
+             m_bytes_flushed ? (double)m_bytes_written / m_bytes_flushed : 0.0);
 
   }
   catch (Exception &e) {
@@ -1041,101 +1282,34 @@ void AccessGroup::recompute_compression_ratio() {
 }
 
 
+void AccessGroup::get_store_info(std::vector<CompactionPolicy::StoreInfo> &stores) {
+  stores.reserve(m_stores.size());
+  for (size_t i=0; i<m_stores.size(); i++)
+    stores.push_back(CompactionPolicy::StoreInfo(m_stores[i].cs->disk_usage(),
+                                                 m_stores[i].timestamp_min,
+                                                 m_stores[i].timestamp_max));
+}
+
+
 bool AccessGroup::find_merge_run(size_t *indexp, size_t *lenp) {
-  size_t index = 0;
-  size_t count = 0;
-  size_t i = 0;
-  int64_t running_total = 0;
+  std::vector<CompactionPolicy::StoreInfo> stores;
 
   if (m_in_memory || m_stores.size() == 0)
     return false;
 
-  do {
-    count++;
-    running_total += m_stores[i].cs->disk_usage();
-
-    if (running_total >= Global::cellstore_target_size_max) {
-      if (count > (size_t)Global::merge_cellstore_run_length_threshold) {
-        if (indexp)
-          *indexp = index;
-        if (lenp)
-           *lenp = count-1;
-        return true;
-      }
-      index = i+1;
-      count = 0;
-      running_total = 0;
-    }
-    else if (running_total >= Global::cellstore_target_size_min &&
-             count > 1) {
-      if (indexp)
-        *indexp = index;
-      if (lenp)
-        *lenp = count;
-      return true;
-    }
-    i++;
-  } while (i < m_stores.size());
-
-  if (count > (size_t)Global::merge_cellstore_run_length_threshold) {
-    if (indexp)
-      *indexp = index;
-    if (lenp)
-      *lenp = count;
-    return true;
-  }
-
-  return false;
+  get_store_info(stores);
+  return m_compaction_policy->find_merge_run(stores, indexp, lenp);
 }
 
 
 bool AccessGroup::needs_merging() {
-  size_t count = 0;
-  int i = 0;
-  int64_t running_total = 0;
+  std::vector<CompactionPolicy::StoreInfo> stores;
 
   if (m_in_memory || m_stores.size() == 0)
     return false;
 
-  for (i = m_stores.size()-1; i>=0; i--) {
-    count++;
-    running_total += m_stores[i].cs->disk_usage();
-    if (running_total >= Global::cellstore_target_size_max)
-      break;
-    else if (running_total >= Global::cellstore_target_size_min &&
-             (m_stores.size() - i) > 1)
-      return true;
-  }
-
-  if (i < 0 && count > (size_t)Global::merge_cellstore_run_length_threshold)
-    return true;
-
-  /** Search from the beginning **/
-
-  i = 0;
-  count = 0;
-  running_total = 0;
-  do {
-    count++;
-    running_total += m_stores[i].cs->disk_usage();
-
-    if (running_total >= Global::cellstore_target_size_max) {
-      if (count > (size_t)Global::merge_cellstore_run_length_threshold)
-        return true;
-      count = 0;
-      running_total = 0;
-    }
-    else if (running_total >= Global::cellstore_target_size_min &&
-             count > 1) {
-      return true;
-    }
-    i++;
-  } while (i < (int)m_stores.size());
-
-  if (count > (size_t)Global::merge_cellstore_run_length_threshold)
-    return true;
-
-  return false;
+  get_store_info(stores);
+  return m_compaction_policy->needs_merging(stores);
 }
 
 namespace {
@@ -1212,5 +1386,9 @@ std::ostream &Hypertable::operator<<(std::ostream &os, const AccessGroup::Mainte
   os << "in_memory=" << (mdata.in_memory ? "true" : "false") << "\n";
   os << "gc_needed=" << (mdata.gc_needed ? "true" : "false") << "\n";
   os << "needs_merging=" << (mdata.needs_merging ? "true" : "false") << "\n";
+  os << "bytes_flushed=" << mdata.bytes_flushed << "\n";
+  os << "bytes_written=" << mdata.bytes_written << "\n";
+  os << "write_amplification=" << (mdata.bytes_flushed ?
+      (double)mdata.bytes_written / mdata.bytes_flushed : 0.0) << "\n";
   return os;
 }
@@ -24,6 +24,7 @@
 
 #include <queue>
 #include <set>
+#include <map>
 #include <vector>
 #include <cstdio>
 #include <ctime>
@@ -43,14 +44,26 @@
 #include "AccessGroupGarbageTracker.h"
 #include "CellCache.h"
 #include "CellStore.h"
-#include "CellStoreTrailerV5.h"
+#include "CellStoreTrailerV6.h"
 #include "CellStoreInfo.h"
+#include "CompactionPolicy.h"
 #include "LiveFileTracker.h"
 #include "MaintenanceFlag.h"
 
 
 namespace Hypertable {
 
+  /** Cached block offsets, keyed by CellStore file name */
+  typedef std::map<String, std::vector<int64_t> > HotBlockMap;
+
+  /** A block to be read into the block cache by the CacheWarmer */
+  struct WarmBlock {
+    CellStorePtr cs;
+    int64_t offset;
+    int64_t length;
+  };
+  typedef std::vector<WarmBlock> WarmBlockList;
+
   class AccessGroup : public CellList {
 
   public:
@@ -96,6 +109,8 @@ namespace Hypertable {
       uint32_t bloom_filter_maybes;
       uint32_t bloom_filter_fps;
       uint64_t shadow_cache_memory;
+      uint64_t bytes_flushed;
+      uint64_t bytes_written;
       bool     in_memory;
       bool     gc_needed;
       bool     needs_merging;
@@ -146,6 +161,54 @@ namespace Hypertable {
     void space_usage(int64_t *memp, int64_t *diskp);
     void add_cell_store(CellStorePtr &cellstore);
 
+    /**
+     * Opens a CellStore built outside of the range server (bulk ingest).
+     * The file is attached where it lies, so it must be under this table's
+     * directory where the 'Files' column can name it; the first compaction
+     * rewrites its contents into the access group directory.  The store is
+     * not added to the access group.
+     *
+     * @param staged_file DFS path of the staged CellStore file
+     * @return the opened CellStore
+     */
+    CellStorePtr open_staged_cell_store(const String &staged_file);
+
+    /** Returns true if fname is one of this access group's CellStores */
+    bool has_cell_store(const String &fname);
+
+    /**
+     * Adds fname to, or removes it from, the live file set without
+     * touching the CellStores, ahead of writing the 'Files' column.
+     */
+    void add_live_file(const String &fname);
+    void remove_live_file(const String &fname);
+
+    /** Returns the contents of the 'Files' column for the live file set */
+    void get_file_list(String &file_list) {
+      m_file_tracker.get_file_list(file_list, true);
+    }
+
+    /**
+     * Adds a CellStore returned by open_staged_cell_store(), whose file has
+     * already been added with add_live_file() and recorded in METADATA.
+     */
+    void attach_cell_store(CellStorePtr &cellstore);
+
+    /**
+     * Adds the blocks of this access group's CellStores that are in the
+     * block cache to hot_blocks.
+     */
+    void get_hot_blocks(HotBlockMap &hot_blocks);
+
+    /**
+     * Appends the blocks in hot_blocks that belong to this access group's
+     * CellStores and aren't cached yet to blocks.  The block index is only
+     * read here, under the access group lock; the blocks themselves are
+     * read afterwards with CellStore::warm_block().
+     */
+    void get_blocks_to_warm(const HotBlockMap &hot_blocks,
+                            WarmBlockList &blocks);
+
     void compute_garbage_stats(uint64_t *input_bytesp, uint64_t *output_bytesp);
 
     void run_compaction(int maintenance_flags);
@@ -198,8 +261,13 @@ namespace Hypertable {
 
   private:
 
+    void add_to_cell_cache(const Key &key, const ByteString value);
     void merge_caches(bool reset_earliest_cached_revision=true);
     void range_dir_initialize();
+    void compaction_policy_initialize(Schema::AccessGroup *ag);
+    void drop_expired_cellstores();
+    bool is_expired(const CellStoreInfo &info, int64_t now);
+    void get_store_info(std::vector<CompactionPolicy::StoreInfo> &stores);
     void recompute_compression_ratio();
     bool find_merge_run(size_t *indexp=0, size_t *lenp=0);
     bool needs_merging();
@@ -220,6 +288,8 @@ namespace Hypertable {
     String               m_range_name;
     std::vector<CellStoreInfo> m_stores;
     PropertiesPtr        m_cellstore_props;
+    CompactionPolicyPtr  m_compaction_policy;
+    int64_t              m_expire_ttl;
     CellCachePtr         m_cell_cache;
     CellCachePtr         m_immutable_cache;
     uint32_t             m_next_cs_id;
@@ -230,6 +300,8 @@ namespace Hypertable {
     int64_t              m_earliest_cached_revision_saved;
     int64_t              m_latest_stored_revision;
     uint64_t             m_collisions;
+    uint64_t             m_bytes_flushed;
+    uint64_t             m_bytes_written;
     LiveFileTracker      m_file_tracker;
     AccessGroupGarbageTracker m_garbage_tracker;
     bool                 m_is_root;
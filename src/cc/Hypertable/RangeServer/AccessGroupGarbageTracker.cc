@@ -36,7 +36,8 @@ AccessGroupGarbageTracker::AccessGroupGarbageTracker()
   : m_elapsed_target(0), m_minimum_elapsed_target(0), m_delete_count(0),
     m_expirable_accumulated(0), m_data_accumulated(0), m_min_ttl(0),
     m_max_ttl(0), m_last_cache_size(-1), m_in_memory(false),
-    m_have_max_versions(false), m_need_collection(false) {
+    m_have_max_versions(false), m_need_collection(false),
+    m_expire_by_file(false) {
   m_minimum_data_target = properties->get_i64("Hypertable.RangeServer.Range.SplitSize") / 10;
   m_data_target = m_minimum_data_target;
   m_last_clear_time = time(0);
@@ -85,7 +86,8 @@ bool AccessGroupGarbageTracker::check_needed(int64_t cached_data, time_t now) {
   if (((m_have_max_versions || m_delete_count > 0) &&
        m_data_accumulated >= m_data_target) ||
       ((m_expirable_accumulated+cached_data) >= m_minimum_data_target &&
-       m_min_ttl > 0 && (now-m_last_clear_time) >= m_elapsed_target))
+       m_min_ttl > 0 && !m_expire_by_file &&
+       (now-m_last_clear_time) >= m_elapsed_target))
     return true;
   return false;
 }
@@ -105,6 +107,7 @@ bool AccessGroupGarbageTracker::check_needed(uint32_t additional_deletes,
        && (m_data_accumulated+additional_data) >= m_data_target) ||
       ((m_expirable_accumulated+cached_data) >= m_minimum_data_target 
        && m_min_ttl > 0 
+       && !m_expire_by_file
        && (now-m_last_clear_time) >= m_elapsed_target))
     return true;
   return false;
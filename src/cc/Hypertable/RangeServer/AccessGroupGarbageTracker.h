@@ -39,6 +39,14 @@ namespace Hypertable {
     void accumulate_data(int64_t amount) { m_data_accumulated += amount; }
     void accumulate_expirable(int64_t amount) { m_expirable_accumulated += amount; }
 
+    /**
+     * Tells the tracker that expired data is reclaimed by dropping whole
+     * CellStores, so TTL expiry alone no longer calls for collection
+     *
+     * @param value true if expired CellStores are dropped
+     */
+    void set_expire_by_file(bool value) { m_expire_by_file = value; }
+
     /**
      * Determines if there is likelihood of needed garbage collection
      *
@@ -93,6 +101,7 @@ namespace Hypertable {
     bool m_in_memory;
     bool m_have_max_versions;
     bool m_need_collection;
+    bool m_expire_by_file;
   };
 
 } // namespace Hypertable
@@ -0,0 +1,179 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+#include "Common/Serialization.h"
+#include "Common/StaticBuffer.h"
+
+#include "Hypertable/Lib/CommitLogReader.h"
+
+#include "CacheWarmer.h"
+#include "Global.h"
+
+using namespace Hypertable;
+using namespace Serialization;
+
+
+CacheWarmer::CacheWarmer() : m_shutdown(false) {
+  m_thread = new Thread(Worker(this));
+}
+
+
+void CacheWarmer::save(Range *range, const String &transfer_log_dir) {
+  HotBlockMap hot_blocks;
+  String fname = transfer_log_dir + "/" + CommitLogReader::HOT_BLOCKS_FILE;
+  size_t len = 4;
+  size_t count = 0;
+
+  try {
+    range->get_hot_blocks(hot_blocks);
+    if (hot_blocks.empty())
+      return;
+
+    for (HotBlockMap::iterator iter = hot_blocks.begin();
+         iter != hot_blocks.end(); ++iter) {
+      len += encoded_length_vstr(iter->first) + 4 + 8*iter->second.size();
+      count += iter->second.size();
+    }
+
+    DynamicBuffer buf(len);
+    encode_i32(&buf.ptr, hot_blocks.size());
+    for (HotBlockMap::iterator iter = hot_blocks.begin();
+         iter != hot_blocks.end(); ++iter) {
+      encode_vstr(&buf.ptr, iter->first);
+      encode_i32(&buf.ptr, iter->second.size());
+      foreach (int64_t offset, iter->second)
+        encode_i64(&buf.ptr, offset);
+    }
+
+    StaticBuffer sbuf(buf);
+    int fd = Global::log_dfs->create(fname, Filesystem::OPEN_FLAG_OVERWRITE,
+                                     -1, -1, -1);
+    Global::log_dfs->append(fd, sbuf, Filesystem::O_FLUSH);
+    Global::log_dfs->close(fd);
+
+    HT_INFOF("Saved %d cached blocks of %s to %s", (int)count,
+             range->get_name().c_str(), fname.c_str());
+  }
+  catch (Exception &e) {
+    HT_WARN_OUT << "Problem saving cached blocks of " << range->get_name()
+                << " - " << e << HT_END;
+  }
+}
+
+
+void CacheWarmer::add(RangePtr &range, const String &transfer_log_dir) {
+  ScopedLock lock(m_mutex);
+  Request request;
+  request.range = range;
+  request.transfer_log_dir = transfer_log_dir;
+  m_queue.push_back(request);
+  m_cond.notify_one();
+}
+
+
+void CacheWarmer::shutdown() {
+  {
+    ScopedLock lock(m_mutex);
+    m_shutdown = true;
+    m_queue.clear();
+    m_cond.notify_one();
+  }
+  m_thread->join();
+  delete m_thread;
+  m_thread = 0;
+}
+
+
+void CacheWarmer::run() {
+  Request request;
+
+  while (true) {
+    {
+      ScopedLock lock(m_mutex);
+      while (m_queue.empty() && !m_shutdown)
+        m_cond.wait(lock);
+      if (m_shutdown)
+        return;
+      request = m_queue.front();
+      m_queue.pop_front();
+    }
+    warm(request);
+    request.range = 0;
+  }
+}
+
+
+void CacheWarmer::warm(Request &request) {
+  String fname = request.transfer_log_dir + "/" +
+    CommitLogReader::HOT_BLOCKS_FILE;
+  HotBlockMap hot_blocks;
+
+  try {
+    if (!Global::log_dfs->exists(fname))
+      return;
+
+    size_t len = Global::log_dfs->length(fname);
+    DynamicBuffer buf(len);
+    int fd = Global::log_dfs->open(fname);
+    size_t nread = Global::log_dfs->read(fd, buf.base, len);
+    Global::log_dfs->close(fd);
+    Global::log_dfs->remove(fname);
+
+    const uint8_t *ptr = buf.base;
+    size_t remain = nread;
+    size_t file_count = decode_i32(&ptr, &remain);
+    for (size_t i=0; i<file_count; i++) {
+      std::vector<int64_t> &offsets = hot_blocks[decode_vstr(&ptr, &remain)];
+      size_t block_count = decode_i32(&ptr, &remain);
+      for (size_t j=0; j<block_count; j++)
+        offsets.push_back(decode_i64(&ptr, &remain));
+    }
+
+    int64_t start_time = get_ts64();
+    WarmBlockList blocks;
+    size_t loaded = 0;
+
+    request.range->get_blocks_to_warm(hot_blocks, blocks);
+
+    // Only the reads happen here, outside of the access group locks, so
+    // check for shutdown between blocks
+    foreach (WarmBlock &block, blocks) {
+      {
+        ScopedLock lock(m_mutex);
+        if (m_shutdown)
+          break;
+      }
+      if (!block.cs->warm_block(block.offset, block.length))
+        break;
+      loaded++;
+    }
+
+    HT_INFOF("Warmed %d blocks of %s in %lld ms", (int)loaded,
+             request.range->get_name().c_str(),
+             (Lld)((get_ts64() - start_time) / 1000000LL));
+  }
+  catch (Exception &e) {
+    HT_WARN_OUT << "Problem warming block cache for "
+                << request.range->get_name() << " - " << e << HT_END;
+  }
+}
@@ -0,0 +1,88 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_CACHEWARMER_H
+#define HYPERTABLE_CACHEWARMER_H
+
+#include <list>
+
+#include <boost/thread/condition.hpp>
+
+#include "Common/Mutex.h"
+#include "Common/String.h"
+#include "Common/Thread.h"
+
+#include "Range.h"
+
+namespace Hypertable {
+
+  /**
+   * Carries the block cache contents of a range across a move.  Before a
+   * range is relinquished, save() records which of its blocks are in the
+   * block cache into the range's transfer log directory.  The destination
+   * server passes the directory to add() after loading the range, and a
+   * single background thread reads those blocks back into its block
+   * cache.  Warming stops when the cache has no free space left, so it
+   * never evicts anything.
+   */
+  class CacheWarmer {
+  public:
+    CacheWarmer();
+
+    /**
+     * Records the cached blocks of range in transfer_log_dir.  Failures
+     * are logged and otherwise ignored.
+     */
+    static void save(Range *range, const String &transfer_log_dir);
+
+    /** Queues range for warming from the blocks saved in transfer_log_dir */
+    void add(RangePtr &range, const String &transfer_log_dir);
+
+    /** Stops the warming thread, abandoning queued ranges */
+    void shutdown();
+
+  private:
+    class Worker {
+    public:
+      Worker(CacheWarmer *warmer) : m_warmer(warmer) { }
+      void operator()() { m_warmer->run(); }
+    private:
+      CacheWarmer *m_warmer;
+    };
+
+    struct Request {
+      RangePtr range;
+      String transfer_log_dir;
+    };
+
+    void run();
+    void warm(Request &request);
+
+    Mutex              m_mutex;
+    boost::condition   m_cond;
+    std::list<Request> m_queue;
+    bool               m_shutdown;
+    Thread            *m_thread;
+  };
+
+}
+
+#endif // HYPERTABLE_CACHEWARMER_H
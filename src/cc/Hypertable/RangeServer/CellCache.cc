@@ -40,7 +40,7 @@ using namespace std;
 CellCache::CellCache()
   : m_arena(), m_cell_map(std::less<const SerializedKey>(), Alloc(m_arena)),
     m_deletes(0), m_collisions(0), m_key_bytes(0), m_value_bytes(0),
-    m_frozen(false), m_have_counter_deletes(false) {
+    m_frozen(false), m_have_counter_deletes(false), m_have_merge_deletes(false) {
   assert(Config::properties); // requires Config::init* first
   m_arena.set_page_size((size_t)
       Config::get_i32("Hypertable.RangeServer.AccessGroup.CellCache.PageSize"));
@@ -158,6 +158,77 @@ void CellCache::add_counter(const Key &key, const ByteString value) {
 
 
 
+void CellCache::add_merge(const Key &key, const ByteString value,
+                          MergeOperator *merge_op) {
+
+  // Deletes make eager merging unsafe, leave it to the merge scanner
+  if (m_have_merge_deletes || key.flag != FLAG_INSERT) {
+    add(key, value);
+    m_have_merge_deletes = true;
+    return;
+  }
+
+  CellMap::iterator iter = m_cell_map.lower_bound(key.serial);
+
+  if (iter == m_cell_map.end()) {
+    add(key, value);
+    return;
+  }
+
+  const uint8_t *ptr;
+
+  size_t len = (*iter).first.decode_length(&ptr);
+
+  // If the lengths differ, assume they're different keys and do a normal add
+  if (len + (ptr-(*iter).first.ptr) != key.length) {
+    add(key, value);
+    return;
+  }
+
+  if (memcmp(ptr+1, key.row, (key.flag_ptr+1)-(const uint8_t *)key.row)) {
+    add(key, value);
+    return;
+  }
+
+  ByteString old_value;
+  old_value.ptr = (*iter).first.ptr + (*iter).second;
+
+  const uint8_t *old_ptr, *new_ptr;
+  size_t old_len = old_value.decode_length(&old_ptr);
+  size_t new_len = value.decode_length(&new_ptr);
+
+  DynamicBuffer merged;
+  merged.set(new_ptr, new_len);
+  merge_op->merge(merged, old_ptr, old_len);
+
+  /*
+   * If the merged value fits in place, overwrite the old value and copy
+   * the timestamp/revision info from the insert key to the one in the map
+   */
+  if (merged.fill() == old_len) {
+    size_t offset = (key.flag_ptr-((const uint8_t *)key.serial.ptr)) + 1;
+    len = (*iter).second - offset;
+    memcpy(((uint8_t *)(*iter).first.ptr) + offset, key.flag_ptr+1, len);
+    memcpy((uint8_t *)old_ptr, merged.base, old_len);
+    return;
+  }
+
+  // Otherwise replace the old entry with a new one, backing the old entry
+  // out of the byte counts (its arena space isn't reclaimed until the
+  // cache is compacted)
+  m_key_bytes -= (*iter).second;
+  m_value_bytes -= old_value.length();
+  m_cell_map.erase(iter);
+
+  DynamicBuffer buf(merged.fill() + 5);
+  Serialization::encode_vi32(&buf.ptr, merged.fill());
+  buf.add_unchecked(merged.base, merged.fill());
+  ByteString merged_value;
+  merged_value.ptr = buf.base;
+  add(key, merged_value);
+}
+
+
 const char *CellCache::get_split_row() {
   assert(!"CellCache::get_split_row not implemented!");
   return 0;
@@ -30,6 +30,7 @@
 #include "CellListScanner.h"
 #include "CellList.h"
 
+#include "Hypertable/Lib/MergeOperator.h"
 #include "Hypertable/Lib/SerializedKey.h"
 
 #include "CellCacheAllocator.h"
@@ -67,6 +68,13 @@ namespace Hypertable {
 
     virtual void add_counter(const Key &key, const ByteString value);
 
+    /** Adds a cell to a column family with a merge operator.  If the cache
+     * already holds a value for the same cell, the two values are merged
+     * and only the result is kept.
+     */
+    virtual void add_merge(const Key &key, const ByteString value,
+                           MergeOperator *merge_op);
+
     virtual const char *get_split_row();
 
     virtual void get_split_rows(std::vector<std::string> &split_rows);
@@ -147,6 +155,7 @@ namespace Hypertable {
     int64_t            m_value_bytes;
     bool               m_frozen;
     bool               m_have_counter_deletes;
+    bool               m_have_merge_deletes;
 
   };
 
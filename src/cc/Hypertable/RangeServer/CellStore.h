@@ -187,6 +187,15 @@ namespace Hypertable {
      */
     virtual KeyDecompressor *create_key_decompressor();
 
+    /**
+     * Returns the number of keys between restart points in the data
+     * blocks of this cell store, or 0 if the data blocks carry no restart
+     * table (see CellStoreBlockRestarts)
+     *
+     * @return restart interval of data blocks
+     */
+    virtual uint16_t block_restart_interval() { return 0; }
+
     /**
      * Sets the cell store files replaced by this CellStore
      */
@@ -267,6 +276,37 @@ namespace Hypertable {
      */
     virtual bool restricted_range() = 0;
 
+    /**
+     * Appends the offsets of this cell store's blocks that are currently
+     * held in the block cache.  This reads the block index, so the caller
+     * must hold the access group lock.
+     *
+     * @param offsets vector to append the block offsets to
+     */
+    virtual void get_cached_blocks(std::vector<int64_t> &offsets) { }
+
+    /**
+     * Appends the (offset, compressed length) of each block at the given
+     * offsets that is not already in the block cache.  This reads the
+     * block index, so the caller must hold the access group lock.
+     *
+     * @param offsets block offsets, as returned by get_cached_blocks()
+     * @param blocks vector to append the blocks to
+     */
+    virtual void get_blocks_to_warm(const std::vector<int64_t> &offsets,
+                  std::vector<std::pair<int64_t, int64_t> > &blocks) { }
+
+    /**
+     * Reads a block returned by get_blocks_to_warm() into the block cache.
+     * The block index isn't touched, so this can be called without the
+     * access group lock.  Nothing already cached is evicted.
+     *
+     * @param offset block offset
+     * @param zlength compressed block length
+     * @return false if the block cache has no room left for the block
+     */
+    virtual bool warm_block(int64_t offset, int64_t zlength) { return false; }
+
     /**
      * Returns the number of "uncompressed" bytes read from the underlying
      * filesystem.
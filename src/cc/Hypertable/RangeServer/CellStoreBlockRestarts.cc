@@ -0,0 +1,93 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Serialization.h"
+
+#include "CellStoreBlockRestarts.h"
+
+using namespace Hypertable;
+
+
+void CellStoreBlockRestarts::write(DynamicBuffer &buf,
+                                   const std::vector<uint32_t> &offsets) {
+  buf.ensure(4 * (offsets.size() + 1));
+  for (size_t i=0; i<offsets.size(); i++)
+    Serialization::encode_i32(&buf.ptr, offsets[i]);
+  Serialization::encode_i32(&buf.ptr, offsets.size());
+}
+
+
+const uint8_t *CellStoreBlockRestarts::load(const uint8_t *base,
+                                            const uint8_t *end) {
+  const uint8_t *ptr;
+  size_t remaining = 4;
+
+  if (end - base < 4)
+    HT_THROW(Error::RANGESERVER_CORRUPT_CELLSTORE,
+             "Data block too small for restart table");
+
+  ptr = end - 4;
+  m_count = Serialization::decode_i32(&ptr, &remaining);
+
+  if (m_count == 0 || (size_t)(end - base) < 4 * (m_count + 1))
+    HT_THROWF(Error::RANGESERVER_CORRUPT_CELLSTORE,
+              "Bad restart point count (%lu) in data block", (Lu)m_count);
+
+  m_base = base;
+  m_offsets = end - 4 * (m_count + 1);
+  return m_offsets;
+}
+
+
+uint32_t CellStoreBlockRestarts::offset(size_t i) {
+  const uint8_t *ptr = m_offsets + 4*i;
+  size_t remaining = 4;
+  return Serialization::decode_i32(&ptr, &remaining);
+}
+
+
+const uint8_t *CellStoreBlockRestarts::seek(KeyDecompressor *decompressor,
+                                            SerializedKey key) {
+  size_t lo = 0, hi = m_count, mid;
+  const uint8_t *value = 0;
+
+  // invariant: key at restart point lo is less than key
+  while (hi - lo > 1) {
+    mid = lo + (hi - lo) / 2;
+    decompressor->reset();
+    value = decompressor->add(m_base + offset(mid));
+    if (decompressor->less_than(key))
+      lo = mid;
+    else {
+      hi = mid;
+      value = 0;
+    }
+  }
+
+  if (value == 0) {
+    decompressor->reset();
+    value = decompressor->add(m_base + offset(lo));
+  }
+  return value;
+}
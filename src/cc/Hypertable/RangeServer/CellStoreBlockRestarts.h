@@ -0,0 +1,87 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_CELLSTOREBLOCKRESTARTS_H
+#define HYPERTABLE_CELLSTOREBLOCKRESTARTS_H
+
+#include <vector>
+
+#include "Common/DynamicBuffer.h"
+
+#include "Hypertable/Lib/SerializedKey.h"
+
+#include "KeyDecompressor.h"
+
+namespace Hypertable {
+
+  /**
+   * Restart point table stored at the end of CellStoreV6 data blocks.
+   * Every N-th key of a block is written without prefix compression (a
+   * "restart point") and the block ends with the offsets of those keys
+   * followed by their count, all as 32-bit integers:
+   *
+   * <pre>
+   *   [key/value entries][offset 0]..[offset n-1][n]
+   * </pre>
+   *
+   * Decoding can begin at any restart point, so a seek within a block is a
+   * binary search over the restart points followed by a scan of at most N
+   * keys.
+   */
+  class CellStoreBlockRestarts {
+  public:
+    CellStoreBlockRestarts() : m_base(0), m_offsets(0), m_count(0) { }
+
+    /** Appends the restart table for <code>offsets</code> to a block */
+    static void write(DynamicBuffer &buf, const std::vector<uint32_t> &offsets);
+
+    /** Reads the restart table at the end of an inflated block.
+     *
+     * @param base start of the block
+     * @param end end of the block
+     * @return end of the key/value entries
+     */
+    const uint8_t *load(const uint8_t *base, const uint8_t *end);
+
+    /** Positions the decompressor at the last restart point whose key is
+     * less than <code>key</code>.  The first key of the block must already
+     * be known to be less than <code>key</code>.
+     *
+     * @param decompressor key decompressor to load
+     * @param key key to seek to
+     * @return pointer to the value of the loaded key
+     */
+    const uint8_t *seek(KeyDecompressor *decompressor, SerializedKey key);
+
+    size_t count() { return m_count; }
+
+  private:
+    uint32_t offset(size_t i);
+
+    const uint8_t *m_base;
+    const uint8_t *m_offsets;
+    size_t m_count;
+  };
+
+}
+
+#endif // HYPERTABLE_CELLSTOREBLOCKRESTARTS_H
@@ -23,7 +23,7 @@
 #define HYPERTABLE_CELLSTOREINFO_H
 
 #include "CellCache.h"
-#include "CellStoreV5.h"
+#include "CellStoreV6.h"
 
 namespace Hypertable {
 
@@ -49,7 +49,7 @@ namespace Hypertable {
     void init_from_trailer() {
       int divisor = 0;
       try {
-        divisor = (boost::any_cast<uint32_t>(cs->get_trailer()->get("flags")) & CellStoreTrailerV5::SPLIT) ? 2 : 1;
+        divisor = (boost::any_cast<uint32_t>(cs->get_trailer()->get("flags")) & CellStoreTrailerV6::SPLIT) ? 2 : 1;
         cell_count = boost::any_cast<int64_t>(cs->get_trailer()->get("total_entries")) / divisor;
         timestamp_min = boost::any_cast<int64_t>(cs->get_trailer()->get("timestamp_min"));
         timestamp_max = boost::any_cast<int64_t>(cs->get_trailer()->get("timestamp_max"));
@@ -63,6 +63,12 @@ namespace Hypertable {
         timestamp_max = TIMESTAMP_MIN;
         expirable_data = 0;
       }
+      try {
+        expiration_time = boost::any_cast<int64_t>(cs->get_trailer()->get("expiration_time"));
+      }
+      catch (std::exception &e) {
+        expiration_time = TIMESTAMP_MAX;
+      }
       try {
         if (divisor) {
           key_bytes = boost::any_cast<int64_t>(cs->get_trailer()->get("key_bytes")) / divisor;
@@ -87,6 +93,7 @@ namespace Hypertable {
     uint32_t bloom_filter_fps;
     int64_t timestamp_min;
     int64_t timestamp_max;
+    int64_t expiration_time;
     int64_t expirable_data;
     int64_t total_data;
   };
@@ -28,6 +28,7 @@
 #include "Hypertable/Lib/BlockCompressionHeader.h"
 #include "Global.h"
 #include "CellStoreBlockIndexArray.h"
+#include "LatencyStats.h"
 
 #include "CellStoreScannerIntervalBlockIndex.h"
 
@@ -59,6 +60,9 @@ CellStoreScannerIntervalBlockIndex<IndexT>::CellStoreScannerIntervalBlockIndex(C
 
   if (m_start_key) {
     const uint8_t *ptr;
+    // binary search the restart points before scanning forward
+    if (m_restarts.count() > 1 && m_key_decompressor->less_than(m_start_key))
+      m_cur_value.ptr = m_restarts.seek(m_key_decompressor, m_start_key);
     while (m_key_decompressor->less_than(m_start_key)) {
       ptr = m_cur_value.ptr + m_cur_value.length();
       if (ptr >= m_block.end) {
@@ -209,6 +213,8 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
     if (!Global::block_cache->checkout(m_file_id, (uint32_t)m_block.offset,
                                       (uint8_t **)&m_block.base, &len)) {
       bool second_try = false;
+      bool from_dfs = false;
+      int64_t miss_start_ts = get_ts64();
     try_again:
       try {
         DynamicBuffer buf(m_block.zlength);
@@ -216,8 +222,13 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
         if (second_try)
           m_fd = m_cellstore->reopen_fd();
 
-        /** Read compressed block **/
-        Global::dfs->pread(m_fd, buf.ptr, m_block.zlength, m_block.offset);
+        /** Read compressed block, from the local cache tier if present **/
+        if (second_try || !Global::local_block_cache ||
+            !Global::local_block_cache->read(m_file_id, m_block.offset,
+                                             buf.ptr, m_block.zlength)) {
+          Global::dfs->pread(m_fd, buf.ptr, m_block.zlength, m_block.offset);
+          from_dfs = true;
+        }
 
         buf.ptr += m_block.zlength;
         /** inflate compressed block **/
@@ -230,6 +241,11 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
         if (!header.check_magic(CellStore::DATA_BLOCK_MAGIC))
           HT_THROW(Error::BLOCK_COMPRESSOR_BAD_MAGIC,
                    "Error inflating cell store block - magic string mismatch");
+
+        // offer the verified compressed block to the local cache tier
+        if (from_dfs && Global::local_block_cache)
+          Global::local_block_cache->insert(m_file_id, m_block.offset,
+                                            buf.base, m_block.zlength);
       }
       catch (Exception &e) {
         HT_ERROR_OUT <<"Error reading cell store (fd=" << m_fd << " file="
@@ -260,9 +276,13 @@ bool CellStoreScannerIntervalBlockIndex<IndexT>::fetch_next_block(bool eob) {
                     "offset=%lld", m_file_id, (Lld)m_block.offset);
         }
       }
+      LatencyStats::record(StatsRangeServer::LATENCY_BLOCK_CACHE_MISS,
+                           miss_start_ts);
     }
     m_key_decompressor->reset();
     m_block.end = m_block.base + len;
+    if (m_cellstore->block_restart_interval())
+      m_block.end = m_restarts.load(m_block.base, m_block.end);
     m_cur_value.ptr = m_key_decompressor->add(m_block.base);
 
     return true;
@@ -25,6 +25,7 @@
 #include "Common/DynamicBuffer.h"
 
 #include "CellStore.h"
+#include "CellStoreBlockRestarts.h"
 #include "CellStoreScannerInterval.h"
 #include "ScanContext.h"
 
@@ -62,6 +63,7 @@ namespace Hypertable {
     DynamicBuffer         m_key_buf;
     BlockCompressionCodec *m_zcodec;
     KeyDecompressor      *m_key_decompressor;
+    CellStoreBlockRestarts m_restarts;
     int32_t               m_fd;
     bool                  m_check_for_range_end;
     int                   m_file_id;
@@ -109,6 +109,9 @@ CellStoreScannerIntervalReadahead<IndexT>::CellStoreScannerIntervalReadahead(Cel
 
   if (start_key) {
     const uint8_t *ptr;
+    // binary search the restart points before scanning forward
+    if (m_restarts.count() > 1 && m_key_decompressor->less_than(start_key))
+      m_cur_value.ptr = m_restarts.seek(m_key_decompressor, start_key);
     while (m_key_decompressor->less_than(start_key)) {
       ptr = m_cur_value.ptr + m_cur_value.length();
       if (ptr >= m_block.end) {
@@ -297,6 +300,8 @@ bool CellStoreScannerIntervalReadahead<IndexT>::fetch_next_block_readahead(bool
 
     m_key_decompressor->reset();
     m_block.end = m_block.base + len;
+    if (m_cellstore->block_restart_interval())
+      m_block.end = m_restarts.load(m_block.base, m_block.end);
     m_cur_value.ptr = m_key_decompressor->add(m_block.base);
 
     return true;
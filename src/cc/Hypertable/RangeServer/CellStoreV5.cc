@@ -200,6 +200,19 @@ CellStoreV5::create(const char *fname, size_t max_entries,
   m_trailer.compression_type = CompressorFactory::parse_block_codec_spec(
       compressor, m_compressor_args);
 
+  if (m_trailer.compression_type == BlockCompressionCodec::AUTO) {
+    // config defaults go first so the access group spec can override them
+    BlockCompressionCodec::Args args;
+    args.push_back("--objective");
+    args.push_back(Config::get_str("Hypertable.RangeServer.CellStore"
+                                   ".AutoCompressor.Objective"));
+    args.push_back("--sample-interval");
+    args.push_back(format("%d", Config::get_i32("Hypertable.RangeServer"
+                          ".CellStore.AutoCompressor.SampleInterval")));
+    args.insert(args.end(), m_compressor_args.begin(), m_compressor_args.end());
+    m_compressor_args.swap(args);
+  }
+
   m_compressor = CompressorFactory::create_block_codec(
       (BlockCompressionCodec::Type)m_trailer.compression_type,
       m_compressor_args);
@@ -0,0 +1,51 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include "CompactionPolicy.h"
+#include "CompactionPolicyMergeRun.h"
+#include "CompactionPolicySizeTiered.h"
+#include "CompactionPolicyTimeWindow.h"
+#include "Global.h"
+
+using namespace Hypertable;
+
+CompactionPolicy *CompactionPolicy::create(PropertiesPtr &props) {
+  String name = props->get_str("compaction-policy");
+
+  if (name == "merge-run")
+    return new CompactionPolicyMergeRun(Global::cellstore_target_size_min,
+                                        Global::cellstore_target_size_max,
+                                        Global::merge_cellstore_run_length_threshold);
+  else if (name == "size-tiered")
+    return new CompactionPolicySizeTiered(props->get_f64("size-ratio"),
+                                          props->get_i32("min-stores"),
+                                          props->get_i32("max-stores"));
+  else if (name == "time-window")
+    return new CompactionPolicyTimeWindow((int64_t)props->get_i32("window")
+                                          * 1000000000LL,
+                                          props->get_i32("min-stores"));
+
+  HT_THROWF(Error::BAD_SCHEMA, "unknown compaction policy: '%s'", name.c_str());
+}
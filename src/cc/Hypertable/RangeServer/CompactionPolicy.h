@@ -0,0 +1,95 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_COMPACTIONPOLICY_H
+#define HYPERTABLE_COMPACTIONPOLICY_H
+
+#include <vector>
+
+#include "Common/Properties.h"
+#include "Common/ReferenceCount.h"
+
+namespace Hypertable {
+
+  /**
+   * Decides which CellStores of an access group a merging compaction
+   * combines.  Policies see only a summary of each CellStore, in the
+   * order the stores are kept (oldest first), and select a run of
+   * adjacent stores so that the merged store can take the run's place.
+   */
+  class CompactionPolicy : public ReferenceCount {
+  public:
+
+    /** Summary of a CellStore as seen by a policy */
+    class StoreInfo {
+    public:
+      StoreInfo(int64_t size_, int64_t timestamp_min_=0,
+                int64_t timestamp_max_=0)
+        : size(size_), timestamp_min(timestamp_min_),
+          timestamp_max(timestamp_max_) { }
+      int64_t size;
+      int64_t timestamp_min;
+      int64_t timestamp_max;
+    };
+
+    virtual ~CompactionPolicy() { }
+
+    /**
+     * Finds the run of CellStores to merge next.
+     *
+     * @param stores summary of each CellStore, oldest first
+     * @param indexp address of variable to hold the index of the first
+     *        store in the run (may be NULL)
+     * @param lenp address of variable to hold the run length (may be NULL)
+     * @return true if a run was found
+     */
+    virtual bool find_merge_run(const std::vector<StoreInfo> &stores,
+                                size_t *indexp=0, size_t *lenp=0) = 0;
+
+    /**
+     * Returns true if a merging compaction is warranted.  Defaults to
+     * find_merge_run() but may be overridden with a cheaper check.
+     */
+    virtual bool needs_merging(const std::vector<StoreInfo> &stores) {
+      return find_merge_run(stores);
+    }
+
+    /**
+     * Returns true if CellStores whose cells have all outlived their TTL
+     * may be dropped without being read.
+     */
+    virtual bool drop_expired() { return false; }
+
+    /** Returns the policy name as it appears in the schema */
+    virtual const char *name() = 0;
+
+    /**
+     * Creates the policy described by props, which holds the result of
+     * Schema::parse_compaction_policy().
+     */
+    static CompactionPolicy *create(PropertiesPtr &props);
+  };
+
+  typedef intrusive_ptr<CompactionPolicy> CompactionPolicyPtr;
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICY_H
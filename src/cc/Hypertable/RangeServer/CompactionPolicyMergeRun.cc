@@ -0,0 +1,121 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include "CompactionPolicyMergeRun.h"
+
+using namespace Hypertable;
+
+bool CompactionPolicyMergeRun::find_merge_run(const std::vector<StoreInfo> &stores,
+                                              size_t *indexp, size_t *lenp) {
+  size_t index = 0;
+  size_t count = 0;
+  size_t i = 0;
+  int64_t running_total = 0;
+
+  if (stores.empty())
+    return false;
+
+  do {
+    count++;
+    running_total += stores[i].size;
+
+    if (running_total >= m_target_size_max) {
+      if (count > m_run_length_threshold) {
+        if (indexp)
+          *indexp = index;
+        if (lenp)
+           *lenp = count-1;
+        return true;
+      }
+      index = i+1;
+      count = 0;
+      running_total = 0;
+    }
+    else if (running_total >= m_target_size_min && count > 1) {
+      if (indexp)
+        *indexp = index;
+      if (lenp)
+        *lenp = count;
+      return true;
+    }
+    i++;
+  } while (i < stores.size());
+
+  if (count > m_run_length_threshold) {
+    if (indexp)
+      *indexp = index;
+    if (lenp)
+      *lenp = count;
+    return true;
+  }
+
+  return false;
+}
+
+
+bool CompactionPolicyMergeRun::needs_merging(const std::vector<StoreInfo> &stores) {
+  size_t count = 0;
+  int i = 0;
+  int64_t running_total = 0;
+
+  if (stores.empty())
+    return false;
+
+  for (i = stores.size()-1; i>=0; i--) {
+    count++;
+    running_total += stores[i].size;
+    if (running_total >= m_target_size_max)
+      break;
+    else if (running_total >= m_target_size_min && (stores.size() - i) > 1)
+      return true;
+  }
+
+  if (i < 0 && count > m_run_length_threshold)
+    return true;
+
+  /** Search from the beginning **/
+
+  i = 0;
+  count = 0;
+  running_total = 0;
+  do {
+    count++;
+    running_total += stores[i].size;
+
+    if (running_total >= m_target_size_max) {
+      if (count > m_run_length_threshold)
+        return true;
+      count = 0;
+      running_total = 0;
+    }
+    else if (running_total >= m_target_size_min && count > 1) {
+      return true;
+    }
+    i++;
+  } while (i < (int)stores.size());
+
+  if (count > m_run_length_threshold)
+    return true;
+
+  return false;
+}
@@ -0,0 +1,54 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_COMPACTIONPOLICYMERGERUN_H
+#define HYPERTABLE_COMPACTIONPOLICYMERGERUN_H
+
+#include "CompactionPolicy.h"
+
+namespace Hypertable {
+
+  /**
+   * The original merging compaction policy.  It merges a run of adjacent
+   * CellStores once their combined size reaches the CellStore target
+   * size, or once a run grows longer than the run length threshold.
+   */
+  class CompactionPolicyMergeRun : public CompactionPolicy {
+  public:
+    CompactionPolicyMergeRun(int64_t target_size_min, int64_t target_size_max,
+                             int32_t run_length_threshold)
+      : m_target_size_min(target_size_min), m_target_size_max(target_size_max),
+        m_run_length_threshold(run_length_threshold) { }
+
+    virtual bool find_merge_run(const std::vector<StoreInfo> &stores,
+                                size_t *indexp=0, size_t *lenp=0);
+    virtual bool needs_merging(const std::vector<StoreInfo> &stores);
+    virtual const char *name() { return "merge-run"; }
+
+  private:
+    int64_t m_target_size_min;
+    int64_t m_target_size_max;
+    size_t  m_run_length_threshold;
+  };
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICYMERGERUN_H
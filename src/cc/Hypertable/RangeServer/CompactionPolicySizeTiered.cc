@@ -0,0 +1,86 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+
+#include "CompactionPolicySizeTiered.h"
+
+using namespace Hypertable;
+
+bool CompactionPolicySizeTiered::find_merge_run(const std::vector<StoreInfo> &stores,
+                                                size_t *indexp, size_t *lenp) {
+  size_t best_index = 0;
+  size_t best_len = 0;
+  double best_average = 0.0;
+
+  // Among runs of similarly sized stores long enough to merge, pick the
+  // one with the smallest stores; it is the cheapest to rewrite
+  for (size_t i=0; i<stores.size(); i++) {
+    int64_t smallest = std::max(stores[i].size, (int64_t)1);
+    int64_t largest = smallest;
+    int64_t total = stores[i].size;
+    size_t j;
+    for (j=i+1; j<stores.size(); j++) {
+      int64_t size = std::max(stores[j].size, (int64_t)1);
+      if ((double)std::max(largest, size) >
+          (double)std::min(smallest, size) * m_size_ratio)
+        break;
+      smallest = std::min(smallest, size);
+      largest = std::max(largest, size);
+      total += stores[j].size;
+    }
+    size_t len = j - i;
+    if (len >= m_min_stores &&
+        (best_len == 0 || (double)total / len < best_average)) {
+      best_index = i;
+      best_len = len;
+      best_average = (double)total / len;
+    }
+  }
+
+  // Too many stores and no tier to merge, so merge the adjacent stores
+  // with the smallest combined size down to max_stores
+  if (best_len == 0 && stores.size() > m_max_stores) {
+    size_t len = stores.size() - m_max_stores + 1;
+    int64_t best_total = 0;
+    for (size_t i=0; i+len <= stores.size(); i++) {
+      int64_t total = 0;
+      for (size_t j=i; j<i+len; j++)
+        total += stores[j].size;
+      if (best_len == 0 || total < best_total) {
+        best_index = i;
+        best_len = len;
+        best_total = total;
+      }
+    }
+  }
+
+  if (best_len == 0)
+    return false;
+
+  if (indexp)
+    *indexp = best_index;
+  if (lenp)
+    *lenp = best_len;
+  return true;
+}
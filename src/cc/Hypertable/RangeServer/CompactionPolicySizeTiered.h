@@ -0,0 +1,56 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_COMPACTIONPOLICYSIZETIERED_H
+#define HYPERTABLE_COMPACTIONPOLICYSIZETIERED_H
+
+#include "CompactionPolicy.h"
+
+namespace Hypertable {
+
+  /**
+   * Size-tiered merging compaction policy.  It merges a run of at least
+   * min_stores adjacent CellStores whose sizes are within size_ratio of
+   * each other, so data is rewritten about once per size tier instead of
+   * each time a store is added.  If the access group has more than
+   * max_stores CellStores and no such run exists, it merges the adjacent
+   * stores with the smallest combined size to get back to max_stores.
+   */
+  class CompactionPolicySizeTiered : public CompactionPolicy {
+  public:
+    CompactionPolicySizeTiered(double size_ratio, size_t min_stores,
+                               size_t max_stores)
+      : m_size_ratio(size_ratio), m_min_stores(min_stores),
+        m_max_stores(max_stores) { }
+
+    virtual bool find_merge_run(const std::vector<StoreInfo> &stores,
+                                size_t *indexp=0, size_t *lenp=0);
+    virtual const char *name() { return "size-tiered"; }
+
+  private:
+    double m_size_ratio;
+    size_t m_min_stores;
+    size_t m_max_stores;
+  };
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICYSIZETIERED_H
@@ -0,0 +1,58 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include "CompactionPolicyTimeWindow.h"
+
+using namespace Hypertable;
+
+bool CompactionPolicyTimeWindow::find_merge_run(const std::vector<StoreInfo> &stores,
+                                                size_t *indexp, size_t *lenp) {
+  int64_t current;
+  size_t i, j;
+
+  if (stores.empty())
+    return false;
+
+  current = window_of(stores[0]);
+  for (i=1; i<stores.size(); i++) {
+    if (window_of(stores[i]) > current)
+      current = window_of(stores[i]);
+  }
+
+  for (i=0; i<stores.size(); i=j) {
+    int64_t window = window_of(stores[i]);
+    for (j=i+1; j<stores.size(); j++) {
+      if (window_of(stores[j]) != window)
+        break;
+    }
+    if (j - i >= ((window == current) ? m_min_stores : 2)) {
+      if (indexp)
+        *indexp = i;
+      if (lenp)
+        *lenp = j - i;
+      return true;
+    }
+  }
+
+  return false;
+}
@@ -0,0 +1,59 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_COMPACTIONPOLICYTIMEWINDOW_H
+#define HYPERTABLE_COMPACTIONPOLICYTIMEWINDOW_H
+
+#include "CompactionPolicy.h"
+
+namespace Hypertable {
+
+  /**
+   * Time-window merging compaction policy for append-only time series.
+   * CellStores are grouped into fixed width windows by the newest
+   * timestamp they hold and only adjacent stores of the same window are
+   * merged.  Past windows are merged down to a single store while the
+   * current window (the newest one present) waits for min_stores stores,
+   * so data is rewritten roughly once after its window closes.  CellStores
+   * whose cells have all expired are dropped without being read.
+   */
+  class CompactionPolicyTimeWindow : public CompactionPolicy {
+  public:
+    CompactionPolicyTimeWindow(int64_t window, size_t min_stores)
+      : m_window(window), m_min_stores(min_stores) { }
+
+    virtual bool find_merge_run(const std::vector<StoreInfo> &stores,
+                                size_t *indexp=0, size_t *lenp=0);
+    virtual bool drop_expired() { return true; }
+    virtual const char *name() { return "time-window"; }
+
+  private:
+    int64_t window_of(const StoreInfo &store) {
+      return store.timestamp_max / m_window;
+    }
+
+    int64_t m_window;
+    size_t m_min_stores;
+  };
+
+}
+
+#endif // HYPERTABLE_COMPACTIONPOLICYTIMEWINDOW_H
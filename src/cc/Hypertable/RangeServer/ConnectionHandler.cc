@@ -54,6 +54,7 @@ extern "C" {
 #include "RequestHandlerReplayUpdate.h"
 #include "RequestHandlerReplayCommit.h"
 #include "RequestHandlerDropRange.h"
+#include "RequestHandlerAttachCellStores.h"
 #include "RequestHandlerRelinquishRange.h"
 #include "RequestHandlerClose.h"
 #include "RequestHandlerCommitLogSync.h"
@@ -234,6 +235,11 @@ void ConnectionHandler::handle(EventPtr &event) {
                                                         event);
         break;
 
+      case RangeServerProtocol::COMMAND_ATTACH_CELL_STORES:
+        handler = new RequestHandlerAttachCellStores(m_comm, m_range_server_ptr.get(),
+                                                     event);
+        break;
+
       default:
         HT_THROWF(PROTOCOL_ERROR, "Unimplemented command (%llu)",
                   (Llu)event->header.command);
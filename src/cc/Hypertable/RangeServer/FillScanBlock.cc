@@ -20,12 +20,159 @@
  */
 
 #include "Common/Compat.h"
+
+#include <map>
+
+#include "Hypertable/Lib/ScanAggregator.h"
+
 #include "FillScanBlock.h"
 
 namespace Hypertable {
 
+  namespace {
+
+    struct AggregateGroup {
+      String row;
+      uint8_t column_family_code;
+      String column_qualifier;
+      AggregateValue value;
+    };
+    typedef std::map<String, AggregateGroup> AggregateGroupMap;
+
+    void append_groups(AggregateGroupMap &groups, int function,
+                       DynamicBuffer &dbuf) {
+      DynamicBuffer result;
+      for (AggregateGroupMap::iterator iter = groups.begin();
+           iter != groups.end(); ++iter) {
+        AggregateGroup &group = iter->second;
+        group.value.result(function, result);
+        create_key_and_append(dbuf, FLAG_INSERT, group.row.c_str(),
+                              group.column_family_code,
+                              group.column_qualifier.c_str(),
+                              group.value.timestamp, group.value.timestamp);
+        append_as_byte_string(dbuf, result.base, result.fill());
+      }
+      groups.clear();
+    }
+
+    /**
+     * Evaluates the scan's aggregate function instead of returning cells.
+     * Row groups are complete once the row changes, so they are returned
+     * as they finish and the block stops at a row boundary once it is
+     * full.  Column family and qualifier groups stay open until the range
+     * is exhausted, so once <code>buffer_size</code> bytes of cells have
+     * been folded in they are returned as partials and the next block
+     * starts new ones; the client combines partials anyway.
+     */
+    bool fill_aggregate_block(CellListScannerPtr &scanner, DynamicBuffer &dbuf,
+                              int64_t buffer_size) {
+      ScanContext *scan_context = scanner->scan_context();
+      int function = scan_context->spec->aggregate;
+      int grouping = scan_context->spec->aggregate_group;
+      AggregateGroupMap groups;
+      AggregateGroupMap::iterator iter;
+      String group_key, last_row, last_qualifier;
+      int64_t last_timestamp = TIMESTAMP_NULL;
+      int64_t bytes_aggregated = 0;
+      int last_family = -1;
+      DynamicBuffer converted;
+      MergeOperator *merge_op;
+      const uint8_t *vptr;
+      size_t vlen;
+      Key key;
+      ByteString value;
+      bool more;
+      uint8_t *ptr;
+
+      dbuf.reserve(4 + 1024);
+      dbuf.ptr = dbuf.base + 4;
+
+      while ((more = scanner->get(key, value))) {
+        if (grouping == ScanSpec::AGGREGATE_GROUP_ROW && !groups.empty() &&
+            strcmp(key.row, groups.begin()->second.row.c_str())) {
+          append_groups(groups, function, dbuf);
+          if ((int64_t)dbuf.fill() - 4 >= buffer_size)
+            break;
+        }
+
+        // only live cells are aggregated; drop duplicates like FillScanBlock
+        if (key.flag != FLAG_INSERT ||
+            (key.timestamp == last_timestamp &&
+             key.column_family_code == last_family &&
+             last_row == key.row && last_qualifier == key.column_qualifier)) {
+          scanner->forward();
+          continue;
+        }
+        last_timestamp = key.timestamp;
+        last_family = key.column_family_code;
+        last_row = key.row;
+        last_qualifier = key.column_qualifier;
+
+        // aggregate the value the client would have seen
+        vlen = value.decode_length(&vptr);
+        CellFilterInfo &info = scan_context->family_info[key.column_family_code];
+        if (info.counter && vlen == 8) {
+          String count = format("%lld",
+              (Lld)(int64_t)Serialization::decode_i64(&vptr, &vlen));
+          converted.set(count.c_str(), count.length());
+          vptr = converted.base;
+          vlen = converted.fill();
+        }
+        else if ((merge_op = info.merge_op) &&
+                 merge_op->finalize(vptr, vlen, converted)) {
+          vptr = converted.base;
+          vlen = converted.fill();
+        }
+
+        if (grouping == ScanSpec::AGGREGATE_GROUP_ROW)
+          group_key = key.row;
+        else if (grouping == ScanSpec::AGGREGATE_GROUP_COLUMN_FAMILY)
+          group_key = String(1, (char)key.column_family_code);
+        else
+          group_key = String(1, (char)key.column_family_code)
+            + key.column_qualifier;
+
+        // AggregateGroup holds a DynamicBuffer, so construct it in place
+        iter = groups.find(group_key);
+        AggregateGroup &group =
+          (iter == groups.end()) ? groups[group_key] : iter->second;
+        if (iter == groups.end()) {
+          if (grouping == ScanSpec::AGGREGATE_GROUP_ROW)
+            group.row = key.row;
+          group.column_family_code = key.column_family_code;
+          if (grouping == ScanSpec::AGGREGATE_GROUP_QUALIFIER)
+            group.column_qualifier = key.column_qualifier;
+        }
+        group.value.add_value(function, vptr, vlen);
+        if (key.timestamp > group.value.timestamp)
+          group.value.timestamp = key.timestamp;
+
+        scanner->forward();
+
+        if (grouping != ScanSpec::AGGREGATE_GROUP_ROW) {
+          bytes_aggregated += key.length + vlen;
+          if (bytes_aggregated >= buffer_size)
+            break;
+        }
+      }
+
+      // for row grouping this is the last row, for the others whatever has
+      // been folded into this block
+      append_groups(groups, function, dbuf);
+
+      ptr = dbuf.base;
+      Serialization::encode_i32(&ptr, dbuf.fill() - 4);
+
+      return more;
+    }
+
+  }
+
   bool
   FillScanBlock(CellListScannerPtr &scanner, DynamicBuffer &dbuf, int64_t buffer_size) {
+    if (scanner->scan_context()->spec->aggregate != ScanSpec::AGGREGATE_NONE)
+      return fill_aggregate_block(scanner, dbuf, buffer_size);
+
     Key key, last_key;
     ByteString value;
     size_t value_len;
@@ -38,6 +185,8 @@ namespace Hypertable {
     bool keys_only = scan_context->spec->keys_only;
     char numbuf[17];
     DynamicBuffer counter_value;
+    DynamicBuffer merged_value;
+    MergeOperator *merge_op;
     bool counter;
     String empty_value("");
 
@@ -87,6 +236,21 @@ namespace Hypertable {
           append_as_byte_string(counter_value, numbuf, value_len);
           value_len = counter_value.fill();
         }
+        else if ((merge_op = scan_context->family_info[key.column_family_code].merge_op)
+                 && key.flag == FLAG_INSERT) {
+          // let the merge operator produce the client-visible value
+          const uint8_t *decode;
+          size_t len = value.decode_length(&decode);
+          if (merge_op->finalize(decode, len, merged_value)) {
+            counter = true;
+            counter_value.clear();
+            append_as_byte_string(counter_value, merged_value.base,
+                                  merged_value.fill());
+            value_len = counter_value.fill();
+          }
+          else
+            value_len = value.length();
+        }
         else
           value_len = value.length();
       }
@@ -53,10 +53,12 @@ namespace Hypertable {
   int32_t                Global::cell_cache_scanner_cache_size = 0;
   ScannerMap             Global::scanner_map;
   FileBlockCache        *Global::block_cache = 0;
+  LocalBlockCache       *Global::local_block_cache = 0;
   TablePtr               Global::metadata_table = 0;
   TablePtr               Global::rs_metrics_table = 0;
   int64_t                Global::range_metadata_split_size = 0;
   MemoryTracker         *Global::memory_tracker = 0;
+  UpdateThrottle        *Global::update_throttle = 0;
   int64_t                Global::log_prune_threshold_min = 0;
   int64_t                Global::log_prune_threshold_max = 0;
   int64_t                Global::cellstore_target_size_min = 0;
@@ -70,4 +72,9 @@ namespace Hypertable {
   int32_t                Global::metrics_interval = 0;
   int32_t                Global::merge_cellstore_run_length_threshold = 0;
   bool                   Global::ignore_clock_skew_errors = false;
+  int32_t                Global::cellstore_open_concurrency = 1;
+  int32_t                Global::range_split_load_threshold = 0;
+  int32_t                Global::range_load_sample_interval = 1;
+  int32_t                Global::range_load_sample_rows = 1000;
+  bool                   Global::block_cache_warming = false;
 }
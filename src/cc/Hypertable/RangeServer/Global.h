@@ -41,11 +41,13 @@
 #include "Hypertable/Lib/Types.h"
 
 #include "FileBlockCache.h"
+#include "LocalBlockCache.h"
 #include "LocationInitializer.h"
 #include "MaintenanceQueue.h"
 #include "MemoryTracker.h"
 #include "ScannerMap.h"
 #include "TableInfo.h"
+#include "UpdateThrottle.h"
 
 namespace Hypertable {
 
@@ -75,10 +77,12 @@ namespace Hypertable {
     static int32_t        cell_cache_scanner_cache_size;
     static ScannerMap     scanner_map;
     static Hypertable::FileBlockCache *block_cache;
+    static Hypertable::LocalBlockCache *local_block_cache;
     static TablePtr       metadata_table;
     static TablePtr       rs_metrics_table;
     static int64_t        range_metadata_split_size;
     static Hypertable::MemoryTracker *memory_tracker;
+    static Hypertable::UpdateThrottle *update_throttle;
     static int64_t        log_prune_threshold_min;
     static int64_t        log_prune_threshold_max;
     static int64_t        cellstore_target_size_min;
@@ -96,6 +100,11 @@ namespace Hypertable {
     static int32_t        metrics_interval;
     static int32_t        merge_cellstore_run_length_threshold;
     static bool           ignore_clock_skew_errors;
+    static int32_t        cellstore_open_concurrency;
+    static int32_t        range_split_load_threshold;
+    static int32_t        range_load_sample_interval;
+    static int32_t        range_load_sample_rows;
+    static bool           block_cache_warming;
   };
 
 } // namespace Hypertable
@@ -22,8 +22,11 @@
 #ifndef HYPERSPACE_GROUPCOMMITINTERFACE_H
 #define HYPERSPACE_GROUPCOMMITINTERFACE_H
 
+#include <new>
 #include <vector>
 
+#include "Common/PageArena.h"
+#include "Common/PageArenaAllocator.h"
 #include "Common/ReferenceCount.h"
 #include "Common/StaticBuffer.h"
 
@@ -53,6 +56,11 @@ namespace Hypertable {
     uint32_t len;
   };
 
+  /**
+   * One client update message.  Heap-allocated by RangeServer::update()
+   * and GroupCommit::add(), before any UpdateContext (and its arena)
+   * exists, and deleted by the owning TableUpdate.
+   */
   class UpdateRequest {
   public:
     UpdateRequest() : count(0), error(0) { }
@@ -70,10 +78,23 @@ namespace Hypertable {
     uint64_t len;
   };
 
+  typedef std::vector<RangeUpdate, PageArenaAllocator<RangeUpdate> > RangeUpdateVector;
+
+  /**
+   * Updates destined for one range.  Allocated, along with its update
+   * vector, from the UpdateContext arena; owners must call the destructor
+   * explicitly instead of deleting it.
+   */
   class RangeUpdateList {
   public:
-    RangeUpdateList() : starting_update_count(0), last_request(0), transfer_buf_reset_offset(0),
-                        latest_transfer_revision(TIMESTAMP_MIN), range_blocked(false) { }
+    RangeUpdateList(CharArena &arena)
+      : updates(RangeUpdateVector::allocator_type(arena)),
+        starting_update_count(0), last_request(0), transfer_buf_reset_offset(0),
+        latest_transfer_revision(TIMESTAMP_MIN), range_blocked(false) { }
+
+    static RangeUpdateList *create(CharArena &arena) {
+      return new (arena.alloc_aligned(sizeof(RangeUpdateList))) RangeUpdateList(arena);
+    }
     void reset_updates(UpdateRequest *request) {
       if (request == last_request) {
         if (starting_update_count < updates.size())
@@ -91,7 +112,7 @@ namespace Hypertable {
         updates.push_back(update);
     }
     RangePtr range;
-    std::vector<RangeUpdate> updates;
+    RangeUpdateVector updates;
     size_t starting_update_count;
     UpdateRequest *last_request;
     DynamicBuffer transfer_buf;
@@ -101,6 +122,11 @@ namespace Hypertable {
     bool range_blocked;
   };
 
+  /**
+   * Updates for one table within an UpdateContext.  Heap-allocated, like
+   * UpdateRequest, when the request is decoded; only the RangeUpdateLists
+   * in #range_map come from the context arena.
+   */
   class TableUpdate {
   public:
     TableUpdate() : flags(0), commit_interval(0), total_count(0),
@@ -111,7 +137,7 @@ namespace Hypertable {
       foreach (UpdateRequest *r, requests)
 	delete r;
       for (hash_map<Range *, RangeUpdateList *>::iterator iter = range_map.begin(); iter != range_map.end(); ++iter)
-	delete (*iter).second;
+	(*iter).second->~RangeUpdateList();
     }
     TableIdentifier id;
     std::vector<UpdateRequest *> requests;
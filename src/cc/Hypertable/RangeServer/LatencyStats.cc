@@ -0,0 +1,103 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+
+#include <vector>
+
+#include <boost/thread/tss.hpp>
+
+#include "Common/Mutex.h"
+
+#include "LatencyStats.h"
+
+using namespace Hypertable;
+
+namespace {
+
+  struct ThreadHistograms {
+    /** Held by the owning thread while adding and by collect() while
+     * merging */
+    Mutex mutex;
+    LatencyHistogram histograms[StatsRangeServer::LATENCY_PHASE_COUNT];
+  };
+
+  Mutex registry_mutex;
+
+  /** Every set of per-thread histograms ever handed out.  Sets are never
+   * freed, so their (cumulative) counts remain visible to collect()
+   * after the owning thread exits. */
+  std::vector<ThreadHistograms *> registry;
+
+  /** Sets released by exited threads, available for reuse */
+  std::vector<ThreadHistograms *> free_list;
+
+  void release_thread_histograms(ThreadHistograms *th) {
+    ScopedLock lock(registry_mutex);
+    free_list.push_back(th);
+  }
+
+  boost::thread_specific_ptr<ThreadHistograms>
+      thread_histograms(release_thread_histograms);
+
+  ThreadHistograms *get_thread_histograms() {
+    ThreadHistograms *th = thread_histograms.get();
+    if (th == 0) {
+      {
+        ScopedLock lock(registry_mutex);
+        if (free_list.empty()) {
+          th = new ThreadHistograms();
+          registry.push_back(th);
+        }
+        else {
+          th = free_list.back();
+          free_list.pop_back();
+        }
+      }
+      thread_histograms.reset(th);
+    }
+    return th;
+  }
+
+}
+
+
+void LatencyStats::add(int phase, uint64_t micros) {
+  HT_ASSERT(phase >= 0 && phase < StatsRangeServer::LATENCY_PHASE_COUNT);
+  ThreadHistograms *th = get_thread_histograms();
+  ScopedLock lock(th->mutex);
+  th->histograms[phase].add(micros);
+}
+
+
+void LatencyStats::collect(LatencyHistogram *histograms) {
+  for (int i=0; i<StatsRangeServer::LATENCY_PHASE_COUNT; i++)
+    histograms[i].clear();
+
+  ScopedLock lock(registry_mutex);
+
+  foreach (ThreadHistograms *th, registry) {
+    ScopedLock th_lock(th->mutex);
+    for (int i=0; i<StatsRangeServer::LATENCY_PHASE_COUNT; i++)
+      histograms[i].merge(th->histograms[i]);
+  }
+}
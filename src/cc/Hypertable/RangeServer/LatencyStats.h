@@ -0,0 +1,71 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_LATENCYSTATS_H
+#define HYPERTABLE_LATENCYSTATS_H
+
+#include "Common/LatencyHistogram.h"
+#include "Common/Time.h"
+
+#include "Hypertable/Lib/StatsRangeServer.h"
+
+namespace Hypertable {
+
+  /**
+   * Per-phase latency histograms for the update and scan pipelines.
+   * Each thread records into its own set of histograms, guarded by a
+   * per-thread mutex that is only contended while collect() merges it.
+   * The histograms are cumulative since server start; consumers that
+   * want per-interval figures keep their own baseline and subtract it.
+   */
+  class LatencyStats {
+  public:
+
+    /** Records a sample for <code>phase</code>.
+     *
+     * @param phase one of StatsRangeServer::LatencyPhase
+     * @param micros latency in microseconds
+     */
+    static void add(int phase, uint64_t micros);
+
+    /** Records the time elapsed since <code>start_ts</code> for
+     * <code>phase</code>.
+     *
+     * @param phase one of StatsRangeServer::LatencyPhase
+     * @param start_ts start time as returned by get_ts64()
+     */
+    static void record(int phase, int64_t start_ts) {
+      int64_t elapsed = get_ts64() - start_ts;
+      add(phase, (elapsed > 0) ? (uint64_t)elapsed / 1000 : 0);
+    }
+
+    /** Merges the per-thread histograms and stores the cumulative
+     * totals into <code>histograms</code>, which must have
+     * StatsRangeServer::LATENCY_PHASE_COUNT entries.  Calling this has
+     * no side effects, so concurrent consumers do not disturb each other.
+     */
+    static void collect(LatencyHistogram *histograms);
+  };
+
+}
+
+#endif // HYPERTABLE_LATENCYSTATS_H
@@ -0,0 +1,252 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+extern "C" {
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+#include "Common/Checksum.h"
+#include "Common/Error.h"
+#include "Common/FileUtils.h"
+#include "Common/Logger.h"
+
+#include "LocalBlockCache.h"
+
+using namespace Hypertable;
+
+namespace {
+  /** Average block size used to size the miss history */
+  const int64_t TYPICAL_BLOCK_SIZE = 65536;
+  const size_t MIN_MISS_HISTORY = 1024;
+}
+
+LocalBlockCache::LocalBlockCache(const String &directory, int64_t capacity,
+                                 bool admit_on_first_miss)
+  : m_fd(-1), m_capacity(capacity), m_head(0), m_used(0),
+    m_admit_on_first_miss(admit_on_first_miss), m_accesses(0), m_hits(0) {
+
+  HT_ASSERT(capacity > 0);
+
+  if (!FileUtils::mkdirs(directory))
+    HT_THROWF(Error::LOCAL_IO_ERROR, "Unable to create local block cache "
+              "directory '%s'", directory.c_str());
+
+  m_filename = directory + "/block_cache";
+
+  // the index is not persisted, so start from an empty file
+  if ((m_fd = ::open(m_filename.c_str(), O_RDWR|O_CREAT|O_TRUNC, 0644)) < 0)
+    HT_THROWF(Error::LOCAL_IO_ERROR, "Unable to open local block cache file "
+              "'%s' - %s", m_filename.c_str(), strerror(errno));
+
+  m_miss_history = std::max(MIN_MISS_HISTORY,
+                            (size_t)(capacity / TYPICAL_BLOCK_SIZE));
+
+  HT_INFOF("Local block cache %s capacity=%lld", m_filename.c_str(),
+           (Lld)m_capacity);
+}
+
+
+LocalBlockCache::~LocalBlockCache() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+    FileUtils::unlink(m_filename);
+  }
+}
+
+
+bool LocalBlockCache::read(int file_id, int64_t file_offset, uint8_t *buf,
+                           uint32_t length) {
+  BlockKey key(file_id, file_offset);
+  int64_t position;
+  uint32_t checksum;
+
+  {
+    ScopedLock lock(m_mutex);
+    EntryMap::iterator iter = m_entries.find(key);
+    m_accesses++;
+    if (iter == m_entries.end() || !iter->second.valid ||
+        iter->second.length != length)
+      return false;
+    position = iter->second.position;
+    checksum = iter->second.checksum;
+  }
+
+  if (FileUtils::pread(m_fd, buf, length, position) != (ssize_t)length)
+    return false;
+
+  // a mismatch means the slot was overwritten underneath us or is corrupt
+  if (crc32c(buf, length) != checksum) {
+    ScopedLock lock(m_mutex);
+    EntryMap::iterator iter = m_entries.find(key);
+    if (iter != m_entries.end() && iter->second.position == position &&
+        iter->second.checksum == checksum) {
+      HT_WARNF("Checksum mismatch in local block cache (file_id=%d, "
+               "offset=%lld), dropping block", file_id, (Lld)file_offset);
+      erase(iter);
+    }
+    return false;
+  }
+
+  ScopedLock lock(m_mutex);
+  m_hits++;
+  return true;
+}
+
+
+void LocalBlockCache::insert(int file_id, int64_t file_offset,
+                             const uint8_t *buf, uint32_t length) {
+  BlockKey key(file_id, file_offset);
+  int64_t position;
+
+  if (length == 0 || (int64_t)length > m_capacity)
+    return;
+
+  // reserve a slot at the head of the ring
+  {
+    ScopedLock lock(m_mutex);
+    if (m_entries.find(key) != m_entries.end() || !admit(key))
+      return;
+    if (m_head + length > m_capacity)
+      m_head = 0;
+    position = m_head;
+    evict(position, position + length);
+    m_head += length;
+    Entry &entry = m_entries[key];
+    entry.position = position;
+    entry.length = length;
+    entry.checksum = 0;
+    entry.valid = false;
+    m_positions[position] = key;
+  }
+
+  uint32_t checksum = crc32c(buf, length);
+  const uint8_t *ptr = buf;
+  size_t nleft = length;
+  ssize_t nwritten;
+  off_t offset = position;
+
+  while (nleft > 0) {
+    if ((nwritten = ::pwrite(m_fd, ptr, nleft, offset)) < 0) {
+      if (errno == EINTR)
+        continue;
+      break;
+    }
+    nleft -= nwritten;
+    ptr += nwritten;
+    offset += nwritten;
+  }
+
+  ScopedLock lock(m_mutex);
+  EntryMap::iterator iter = m_entries.find(key);
+
+  // evicted while being written
+  if (iter == m_entries.end() || iter->second.position != position)
+    return;
+
+  if (nleft > 0) {
+    HT_ERRORF("Problem writing local block cache file '%s' - %s",
+              m_filename.c_str(), strerror(errno));
+    erase(iter);
+    return;
+  }
+
+  iter->second.checksum = checksum;
+  iter->second.valid = true;
+  m_used += length;
+}
+
+
+void LocalBlockCache::purge(int file_id) {
+  ScopedLock lock(m_mutex);
+  EntryMap::iterator iter =
+    m_entries.lower_bound(BlockKey(file_id, std::numeric_limits<int64_t>::min()));
+  while (iter != m_entries.end() && iter->first.first == file_id)
+    erase(iter++);
+}
+
+
+void LocalBlockCache::get_stats(uint64_t *capacityp, uint64_t *usedp,
+                                uint64_t *accessesp, uint64_t *hitsp) {
+  ScopedLock lock(m_mutex);
+  *capacityp = m_capacity;
+  *usedp = m_used;
+  *accessesp = m_accesses;
+  *hitsp = m_hits;
+}
+
+
+bool LocalBlockCache::admit(const BlockKey &key) {
+  if (m_admit_on_first_miss)
+    return true;
+
+  // admit blocks that missed before and are still in the miss history
+  if (m_missed.erase(key))
+    return true;
+
+  m_missed.insert(key);
+  m_missed_fifo.push_back(key);
+  while (m_missed_fifo.size() > m_miss_history) {
+    m_missed.erase(m_missed_fifo.front());
+    m_missed_fifo.pop_front();
+  }
+  return false;
+}
+
+
+void LocalBlockCache::evict(int64_t start, int64_t end) {
+  std::map<int64_t, BlockKey>::iterator iter = m_positions.lower_bound(start);
+
+  // the slot just before start may extend into the region
+  if (iter != m_positions.begin()) {
+    std::map<int64_t, BlockKey>::iterator prev = iter;
+    --prev;
+    EntryMap::iterator entry_iter = m_entries.find(prev->second);
+    if (entry_iter != m_entries.end() &&
+        entry_iter->second.position + entry_iter->second.length > start)
+      erase(entry_iter);
+  }
+
+  while (iter != m_positions.end() && iter->first < end) {
+    EntryMap::iterator entry_iter = m_entries.find((iter++)->second);
+    if (entry_iter != m_entries.end())
+      erase(entry_iter);
+  }
+}
+
+
+void LocalBlockCache::erase(EntryMap::iterator iter) {
+  if (iter->second.valid)
+    m_used -= iter->second.length;
+  std::map<int64_t, BlockKey>::iterator pos_iter =
+    m_positions.find(iter->second.position);
+  if (pos_iter != m_positions.end() && pos_iter->second == iter->first)
+    m_positions.erase(pos_iter);
+  m_entries.erase(iter);
+}
@@ -0,0 +1,118 @@
+/** -*- c++ -*-
+ * Copyright (C) 2008 Doug Judd (Zvents, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#ifndef HYPERTABLE_LOCALBLOCKCACHE_H
+#define HYPERTABLE_LOCALBLOCKCACHE_H
+
+#include <deque>
+#include <map>
+#include <set>
+
+#include "Common/Mutex.h"
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /**
+   * Second cache tier for cell store blocks, kept in a file on local
+   * (ideally solid state) storage.  Blocks are stored exactly as they were
+   * read from the DFS, i.e. compressed, and a CRC32C of each block is kept
+   * in memory and verified on every read.  The file is written as a ring:
+   * new blocks are appended at the head and overwrite the oldest blocks when
+   * it wraps.  The index lives in memory only, so the file is truncated when
+   * the cache is created.
+   *
+   * A block is admitted when it misses for the second time within the
+   * recent miss history, so that a single scan over cold data does not
+   * flush the cache.  Blocks are keyed by (file id, offset), file ids are
+   * unique within the process, and purge() drops all blocks of a file once
+   * the file is no longer live.
+   */
+  class LocalBlockCache {
+  public:
+    /**
+     * @param directory directory that holds the cache file
+     * @param capacity size of the cache file in bytes
+     * @param admit_on_first_miss admit every block instead of only blocks
+     *        that missed before
+     */
+    LocalBlockCache(const String &directory, int64_t capacity,
+                    bool admit_on_first_miss);
+    ~LocalBlockCache();
+
+    /** Reads a cached block.
+     *
+     * @param file_id cell store file id
+     * @param file_offset offset of block within the cell store
+     * @param buf buffer to read the block into
+     * @param length length of the block
+     * @return true if the block was found and its checksum verified
+     */
+    bool read(int file_id, int64_t file_offset, uint8_t *buf, uint32_t length);
+
+    /** Offers a block that was just read from the DFS, the block is written
+     * to the cache if the admission policy accepts it.
+     */
+    void insert(int file_id, int64_t file_offset, const uint8_t *buf,
+                uint32_t length);
+
+    /** Drops all blocks of the given file */
+    void purge(int file_id);
+
+    void get_stats(uint64_t *capacityp, uint64_t *usedp,
+                   uint64_t *accessesp, uint64_t *hitsp);
+
+  private:
+    typedef std::pair<int, int64_t> BlockKey;
+
+    struct Entry {
+      int64_t position;
+      uint32_t length;
+      uint32_t checksum;
+      bool valid;
+    };
+
+    typedef std::map<BlockKey, Entry> EntryMap;
+
+    bool admit(const BlockKey &key);
+    void evict(int64_t start, int64_t end);
+    void erase(EntryMap::iterator iter);
+
+    Mutex     m_mutex;
+    String    m_filename;
+    int       m_fd;
+    int64_t   m_capacity;
+    int64_t   m_head;
+    int64_t   m_used;
+    bool      m_admit_on_first_miss;
+    size_t    m_miss_history;
+    EntryMap  m_entries;
+    std::map<int64_t, BlockKey> m_positions;
+    std::set<BlockKey> m_missed;
+    std::deque<BlockKey> m_missed_fifo;
+    uint64_t  m_accesses;
+    uint64_t  m_hits;
+  };
+
+}
+
+#endif // HYPERTABLE_LOCALBLOCKCACHE_H
@@ -167,8 +167,13 @@ MaintenancePrioritizer::schedule_splits_and_relinquishes(RangeStatsVector &range
         range_data[i]->maintenance_flags |= MaintenanceFlag::RELINQUISH;
       }
       else if (range_data[i]->needs_split) {
-	HT_INFOF("Adding maintenance for range %s because disk_total %d exceeds split threshold",
-		 range_data[i]->range->get_name().c_str(), (int)disk_total);
+        if (range_data[i]->load_split)
+          HT_INFOF("Adding maintenance for range %s because its access rate "
+                   "exceeds the load split threshold",
+                   range_data[i]->range->get_name().c_str());
+        else
+	  HT_INFOF("Adding maintenance for range %s because disk_total %d exceeds split threshold",
+		   range_data[i]->range->get_name().c_str(), (int)disk_total);
 	memory_state.decrement_needed(mem_total);
 	range_data[i]->priority = priority++;
 	range_data[i]->maintenance_flags |= MaintenanceFlag::SPLIT;
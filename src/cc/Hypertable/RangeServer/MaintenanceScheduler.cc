@@ -143,7 +143,7 @@ void MaintenanceScheduler::schedule() {
 
   Global::maintenance_queue->clear();
 
-  m_stats_gatherer->fetch(range_data);
+  m_stats_gatherer->fetch(range_data, 0, 0, true);
 
   if (range_data.empty()) {
     m_scheduling_needed = false;
@@ -37,6 +37,7 @@ MergeScannerAccessGroup::MergeScannerAccessGroup(ScanContextPtr &scan_ctx,
     m_revs_count(0), m_revs_limit(0), m_prev_key(0), m_prev_cf(-1), 
     m_no_forward(false), m_count_present(false), 
     m_skip_remaining_counter(false), m_counted_value(12),
+    m_merge_op(0), m_merged_value(0),
     m_delete_present(false), m_deleted_row(0),
     m_deleted_column_family(0), m_deleted_cell(0), m_deleted_cell_version(0)
 { 
@@ -85,7 +86,8 @@ MergeScannerAccessGroup::do_initialize()
 
     // Only need to worry about counters if this scanner scans over a 
     // single access group since no counter will span multiple access grps
-    counter = m_scan_context_ptr->family_info[sstate.key.column_family_code].counter;
+    counter = m_scan_context_ptr->family_info[
+        sstate.key.column_family_code].merges_versions();
 
     if (sstate.key.timestamp < cell_cutoff
         || (sstate.key.timestamp < m_start_timestamp)) {
@@ -183,15 +185,22 @@ MergeScannerAccessGroup::do_initialize()
         }
       }
       // row regexp
-      if (m_scan_context_ptr->row_regexp)
-        if (!RE2::PartialMatch(sstate.key.row, 
-            *(m_scan_context_ptr->row_regexp))) {
+      if (m_scan_context_ptr->row_regexp) {
+        bool cached, match;
+        m_regexp_cache.check_rowkey(sstate.key.row, &cached, &match);
+        if (!cached) {
+          match = RE2::PartialMatch(sstate.key.row,
+                      *(m_scan_context_ptr->row_regexp));
+          m_regexp_cache.set_rowkey(sstate.key.row, match);
+        }
+        if (!match) {
           m_queue.pop();
           sstate.scanner->forward();
           if (sstate.scanner->get(sstate.key, sstate.value))
             m_queue.push(sstate);
           continue;
         }
+      }
       // column qualifier doesn't match
       if (!m_scan_context_ptr->family_info[
           sstate.key.column_family_code].qualifier_matches(sstate.key.column_qualifier)) {
@@ -203,7 +212,7 @@ MergeScannerAccessGroup::do_initialize()
       }
       // filter by value regexp last since its probly the most expensive
       if (m_scan_context_ptr->value_regexp &&
-          !m_scan_context_ptr->family_info[sstate.key.column_family_code].counter) {
+          !m_scan_context_ptr->family_info[sstate.key.column_family_code].merges_versions()) {
         const uint8_t *dptr;
         if (!RE2::PartialMatch(re2::StringPiece((const char *)sstate.value.str(),
                             sstate.value.decode_length(&dptr)), 
@@ -291,7 +300,8 @@ MergeScannerAccessGroup::do_forward()
       // we only need to care about counters for a MergeScanner which is 
       // merging over a single access group since no counter will span 
       // multiple access groups
-      counter = m_scan_context_ptr->family_info[sstate.key.column_family_code].counter;
+      counter = m_scan_context_ptr->family_info[
+        sstate.key.column_family_code].merges_versions();
 
       cell_cutoff = m_scan_context_ptr->family_info[
         sstate.key.column_family_code].cutoff_time;
@@ -462,7 +472,7 @@ MergeScannerAccessGroup::do_forward()
 
         // filter but value regexp last since its probly the most expensive
         if (m_scan_context_ptr->value_regexp &&
-            !m_scan_context_ptr->family_info[sstate.key.column_family_code].counter) {
+            !m_scan_context_ptr->family_info[sstate.key.column_family_code].merges_versions()) {
           const uint8_t *dptr;
           if (!RE2::PartialMatch(re2::StringPiece((const char *)sstate.value.str(),
                             sstate.value.decode_length(&dptr)), 
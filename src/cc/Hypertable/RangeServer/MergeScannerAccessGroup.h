@@ -192,6 +192,11 @@ namespace Hypertable {
         return;
       const uint8_t *decode;
       size_t remain = value.decode_length(&decode);
+      // values arrive newest first, so fold each one in as the older value
+      if (m_merge_op) {
+        m_merge_op->merge(m_merged_value, decode, remain);
+        return;
+      }
       // value must be encoded 64 bit int
       if (remain != 8 && remain != 9) {
         HT_FATAL_OUT << "Expected counter to be encoded 64 bit int but "
@@ -207,10 +212,19 @@ namespace Hypertable {
     }
 
     inline void finish_count() {
-      uint8_t *ptr = m_counted_value.base;
+      if (m_merge_op) {
+        m_counted_value.clear();
+        m_counted_value.ensure(m_merged_value.fill() + 5);
+        Serialization::encode_vi32(&m_counted_value.ptr, m_merged_value.fill());
+        m_counted_value.add_unchecked(m_merged_value.base,
+                                      m_merged_value.fill());
+      }
+      else {
+        uint8_t *ptr = m_counted_value.base;
 
-      *ptr++ = 8;  // length
-      Serialization::encode_i64(&ptr, m_count);
+        *ptr++ = 8;  // length
+        Serialization::encode_i64(&ptr, m_count);
+      }
 
       m_prev_key.set(m_counted_key.row, m_counted_key.len_cell());
       m_prev_cf = m_counted_key.column_family_code;
@@ -223,6 +237,7 @@ namespace Hypertable {
     
       m_count_present = true;
       m_count = 0;
+      m_skip_remaining_counter = false;
     
       m_counted_key_buffer.clear();
       m_counted_key_buffer.ensure(key.length);
@@ -230,6 +245,15 @@ namespace Hypertable {
       serial.ptr = m_counted_key_buffer.base;
 
       m_counted_key.load(serial);
+
+      m_merge_op = m_scan_context_ptr->family_info[
+          key.column_family_code].merge_op;
+      if (m_merge_op) {
+        const uint8_t *decode;
+        size_t len = value.decode_length(&decode);
+        m_merged_value.set(decode, len);
+        return;
+      }
       increment_count(key, value);
     }
 
@@ -252,6 +276,8 @@ namespace Hypertable {
     uint64_t      m_count;
     Key           m_counted_key;
     DynamicBuffer m_counted_value;
+    MergeOperator *m_merge_op;
+    DynamicBuffer m_merged_value;
     int64_t       m_cell_cutoff;
     int64_t       m_start_timestamp;
     int64_t       m_end_timestamp;
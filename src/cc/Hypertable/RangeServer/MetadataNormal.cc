@@ -122,6 +122,27 @@ void MetadataNormal::write_files(const String &ag_name, const String &files) {
 }
 
 
+void MetadataNormal::write_files(const std::vector<String> &ag_names,
+                                 const std::vector<String> &files) {
+  TableMutatorPtr mutator;
+  KeySpec key;
+
+  HT_ASSERT(ag_names.size() == files.size());
+
+  mutator = Global::metadata_table->create_mutator();
+
+  for (size_t i=0; i<ag_names.size(); i++) {
+    key.row = m_metadata_key.c_str();
+    key.row_len = m_metadata_key.length();
+    key.column_family = "Files";
+    key.column_qualifier = ag_names[i].c_str();
+    key.column_qualifier_len = ag_names[i].length();
+    mutator->set(key, (uint8_t *)files[i].c_str(), files[i].length());
+  }
+  mutator->flush();
+}
+
+
 void MetadataNormal::write_files(const String &ag_name, const String &files, uint32_t nextcsid) {
   TableMutatorPtr mutator;
   KeySpec key;
@@ -42,6 +42,13 @@ namespace Hypertable {
     virtual void write_files(const String &ag_name, const String &files);
     virtual void write_files(const String &ag_name, const String &files, uint32_t nextcsid);
 
+    /**
+     * Writes the 'Files' column of several access groups with a single
+     * mutator flush, so that they change together.
+     */
+    void write_files(const std::vector<String> &ag_names,
+                     const std::vector<String> &files);
+
   private:
 
     class AgMetadata {
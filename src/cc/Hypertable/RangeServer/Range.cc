@@ -22,6 +22,7 @@
 #include "Common/Compat.h"
 #include <cassert>
 #include <string>
+#include <set>
 #include <vector>
 
 extern "C" {
@@ -38,10 +39,12 @@ extern "C" {
 #include "Common/md5.h"
 #include "Common/Random.h"
 #include "Common/StringExt.h"
+#include "Common/Thread.h"
 
 #include "Hypertable/Lib/CommitLog.h"
 #include "Hypertable/Lib/CommitLogReader.h"
 
+#include "CacheWarmer.h"
 #include "CellStoreFactory.h"
 #include "Global.h"
 #include "MergeScannerRange.h"
@@ -64,7 +67,9 @@ Range::Range(MasterClientPtr &master_client,
     m_split_off_high(false), m_added_inserts(0), m_range_set(range_set),
     m_error(Error::OK), m_dropped(false), m_capacity_exceeded_throttle(false),
     m_relinquish(false), m_removed_from_working_set(false), m_maintenance_generation(0),
-    m_load_metrics(identifier->id, range->start_row, range->end_row) {
+    m_load_metrics(identifier->id, range->start_row, range->end_row),
+    m_load_sketch(Global::range_load_sample_interval, Global::range_load_sample_rows),
+    m_load_sketch_time(time(0)), m_load_split(false), m_size_split(false) {
   m_metalog_entity = new MetaLog::EntityRange(*identifier, *range, *state, needs_compaction);
   initialize();
 }
@@ -78,7 +83,9 @@ Range::Range(MasterClientPtr &master_client, SchemaPtr &schema,
     m_split_threshold(0), m_split_off_high(false), m_added_inserts(0), m_range_set(range_set),
     m_error(Error::OK), m_dropped(false), m_capacity_exceeded_throttle(false),
     m_relinquish(false), m_removed_from_working_set(false), m_maintenance_generation(0),
-    m_load_metrics(range_entity->table.id, range_entity->spec.start_row, range_entity->spec.end_row) {
+    m_load_metrics(range_entity->table.id, range_entity->spec.start_row, range_entity->spec.end_row),
+    m_load_sketch(Global::range_load_sample_interval, Global::range_load_sample_rows),
+    m_load_sketch_time(time(0)), m_load_split(false), m_size_split(false) {
   initialize();
 }
 
@@ -253,20 +260,18 @@ void Range::update_schema(SchemaPtr &schema) {
  */
 void Range::load_cell_stores(Metadata *metadata) {
   AccessGroup *ag;
-  CellStorePtr cellstore;
   const char *base, *ptr, *end;
-  std::vector<String> csvec;
+  std::vector<CellStoreOpenRequest> requests;
   String ag_name;
   String files;
   String file_str;
-  bool need_update;
   uint32_t nextcsid;
 
   metadata->reset_files_scan();
 
+  String file_basename = Global::toplevel_dir + "/tables/";
+
   while (metadata->get_next_files(ag_name, files, &nextcsid)) {
-    csvec.clear();
-    need_update = false;
 
     if ((ag = m_access_group_map[ag_name]) == 0) {
       HT_ERRORF("Unrecognized access group name '%s' found in METADATA for "
@@ -286,61 +291,111 @@ void Range::load_cell_stores(Metadata *metadata) {
       file_str = String(base, ptr-base);
       boost::trim(file_str);
 
-      if (!file_str.empty()) {
-        if (file_str[0] == '#') {
-          ++ptr;
-          base = ptr;
-          need_update = true;
-          continue;
-        }
-
-        csvec.push_back(file_str);
+      if (!file_str.empty() && file_str[0] != '#') {
+        requests.push_back(CellStoreOpenRequest());
+        requests.back().ag = ag;
+        requests.back().name = file_str;
+        requests.back().path = file_basename + file_str;
       }
       ++ptr;
       base = ptr;
     }
+  }
 
-    files = "";
+  open_cell_stores(requests);
 
-    String file_basename = Global::toplevel_dir + "/tables/";
+  bool skip_not_found = Config::properties->get_bool("Hypertable.RangeServer.CellStore.SkipNotFound");
 
-    bool skip_not_found = Config::properties->get_bool("Hypertable.RangeServer.CellStore.SkipNotFound");
+  // add in METADATA order, the access groups rely on it for merging
+  foreach (CellStoreOpenRequest &request, requests) {
 
-    for (size_t i=0; i<csvec.size(); i++) {
+    if (request.error != Error::OK) {
+      if (skip_not_found &&
+          (request.error == Error::DFSBROKER_FILE_NOT_FOUND ||
+           request.error == Error::DFSBROKER_BAD_FILENAME)) {
+        HT_WARNF("CellStore file '%s' not found, skipping", request.name.c_str());
+        continue;
+      }
+      HT_FATALF("Problem opening CellStore file '%s' - %s", request.name.c_str(),
+                Error::get_text(request.error));
+    }
 
-      files += csvec[i] + ";\n";
+    int64_t revision = boost::any_cast<int64_t>
+      (request.cellstore->get_trailer()->get("revision"));
+    if (revision > m_latest_revision)
+      m_latest_revision = revision;
 
-      HT_INFOF("Loading CellStore %s", csvec[i].c_str());
+    request.ag->add_cell_store(request.cellstore);
+  }
 
-      try {
-        cellstore = CellStoreFactory::open(file_basename + csvec[i], m_metalog_entity->spec.start_row, m_metalog_entity->spec.end_row);
-      }
-      catch (Exception &e) {
-        if (skip_not_found &&
-            (e.code() == Error::DFSBROKER_FILE_NOT_FOUND ||
-             e.code() == Error::DFSBROKER_BAD_FILENAME)) {
-          HT_WARNF("CellStore file '%s' not found, skipping", csvec[i].c_str());
-          continue;
+}
+
+
+namespace {
+
+  /**
+   * Opens the CellStores of a range, pulling requests off a shared index
+   * so that up to Global::cellstore_open_concurrency trailers are read
+   * from the DFS at once.
+   */
+  class CellStoreOpener {
+  public:
+    CellStoreOpener(std::vector<Range::CellStoreOpenRequest> &requests,
+                    size_t *nextp, Mutex *mutexp, const char *start_row,
+                    const char *end_row)
+      : m_requests(requests), m_nextp(nextp), m_mutexp(mutexp),
+        m_start_row(start_row), m_end_row(end_row) { }
+
+    void operator()() {
+      size_t i;
+      while (true) {
+        {
+          ScopedLock lock(*m_mutexp);
+          if (*m_nextp >= m_requests.size())
+            return;
+          i = (*m_nextp)++;
+        }
+        Range::CellStoreOpenRequest &request = m_requests[i];
+        HT_INFOF("Loading CellStore %s", request.name.c_str());
+        try {
+          request.cellstore = CellStoreFactory::open(request.path, m_start_row,
+                                                     m_end_row);
+        }
+        catch (Exception &e) {
+          request.error = e.code();
         }
-        HT_FATALF("Problem opening CellStore file '%s' - %s", csvec[i].c_str(),
-                  Error::get_text(e.code()));
       }
+    }
 
-      int64_t revision = boost::any_cast<int64_t>
-        (cellstore->get_trailer()->get("revision"));
-      if (revision > m_latest_revision)
-        m_latest_revision = revision;
+  private:
+    std::vector<Range::CellStoreOpenRequest> &m_requests;
+    size_t *m_nextp;
+    Mutex *m_mutexp;
+    const char *m_start_row;
+    const char *m_end_row;
+  };
 
-      ag->add_cell_store(cellstore);
-    }
+}
 
-    /** this causes startup deadlock (and is not needed) ..
-    if (need_update)
-      metadata->write_files(ag_name, files);
-    */
 
+void Range::open_cell_stores(std::vector<CellStoreOpenRequest> &requests) {
+  size_t next = 0;
+  Mutex mutex;
+  size_t thread_count = std::min(requests.size(),
+      (size_t)std::max(Global::cellstore_open_concurrency, 1));
+  CellStoreOpener opener(requests, &next, &mutex,
+                         m_metalog_entity->spec.start_row,
+                         m_metalog_entity->spec.end_row);
+
+  if (thread_count <= 1) {
+    opener();
+    return;
   }
 
+  ThreadGroup threads;
+  for (size_t i=0; i<thread_count; i++)
+    threads.create_thread(opener);
+  threads.join_all();
 }
 
 
@@ -365,6 +420,9 @@ void Range::add(const Key &key, const ByteString value) {
   else
     m_added_deletes[key.flag]++;
 
+  if (Global::range_split_load_threshold > 0)
+    m_load_sketch.record(key.row);
+
   if (key.revision > m_revision)
     m_revision = key.revision;
 }
@@ -378,6 +436,8 @@ CellListScanner *Range::create_scanner(ScanContextPtr &scan_ctx) {
     ScopedLock lock(m_schema_mutex);
     ag_vector = m_access_group_vector;
     m_scans++;
+    if (Global::range_split_load_threshold > 0 && !scan_ctx->start_row.empty())
+      m_load_sketch.record(scan_ctx->start_row.c_str());
   }
 
   try {
@@ -428,6 +488,7 @@ bool Range::cancel_maintenance() {
 
 
 Range::MaintenanceData *Range::get_maintenance_data(ByteArena &arena, time_t now,
+                                                    bool check_load_split,
                                                     TableMutator *mutator) {
   MaintenanceData *mdata = (MaintenanceData *)arena.alloc( sizeof(MaintenanceData) );
   AccessGroup::MaintenanceData **tailp = 0;
@@ -445,6 +506,22 @@ Range::MaintenanceData *Range::get_maintenance_data(ByteArena &arena, time_t now
     mdata->load_factors.bytes_written = m_bytes_written;
     mdata->load_factors.cells_written = m_cells_written;
     mdata->schema_generation = m_metalog_entity->table.generation;
+
+    // Split for load only when the sampled load can actually be divided.
+    // Checking decays the sketch, so only the maintenance scheduler does it.
+    if (check_load_split && now > m_load_sketch_time) {
+      uint64_t threshold = 0;
+      if (Global::range_split_load_threshold > 0 &&
+          !m_metalog_entity->table.is_system())
+        threshold = (uint64_t)Global::range_split_load_threshold;
+      m_load_split =
+        m_load_sketch.check_split(now - m_load_sketch_time, threshold,
+                                  m_metalog_entity->spec.start_row,
+                                  m_metalog_entity->spec.end_row,
+                                  m_load_split_row);
+      m_load_sketch_time = now;
+    }
+    mdata->load_split = m_load_split;
   }
 
   mdata->range = this;
@@ -501,7 +578,12 @@ Range::MaintenanceData *Range::get_maintenance_data(ByteArena &arena, time_t now
   if (tailp)
     (*tailp)->next = 0;
 
-  if (size >= m_split_threshold)
+  {
+    ScopedLock lock(m_mutex);
+    m_size_split = size >= m_split_threshold;
+  }
+
+  if (size >= m_split_threshold || mdata->load_split)
     mdata->needs_split = true;
 
   if (size > Global::range_maximum_size) {
@@ -644,6 +726,10 @@ void Range::relinquish_compact_and_finish() {
       m_metalog_entity->table.generation = m_schema->get_generation();
     }
 
+    // Hand the cached blocks to whoever loads the range next
+    if (Global::block_cache_warming)
+      CacheWarmer::save(this, m_metalog_entity->state.transfer_log);
+
     // Record "move" in sys/RS_METRICS
     if (Global::rs_metrics_table) {
       TableMutatorPtr mutator = Global::rs_metrics_table->create_mutator();
@@ -774,17 +860,46 @@ void Range::split_install_log() {
   if (cancel_maintenance())
     HT_THROW(Error::CANCELLED, "");
 
-  for (size_t i=0; i<ag_vector.size(); i++)
-    ag_vector[i]->get_split_rows(split_rows, false);
+  /**
+   * Ranges split because of load are split at the load median so that
+   * each half takes some of the traffic
+   */
+  {
+    ScopedLock lock(m_schema_mutex);
+    if (m_load_split) {
+      HT_INFOF("Splitting %s at load median '%s'", m_name.c_str(),
+               m_load_split_row.c_str());
+      split_rows.push_back(m_load_split_row);
+    }
+  }
 
   /**
-   * If we didn't get at least one row from each Access Group, then try again
-   * the hard way (scans CellCache for middle row)
+   * A split requested only because of load must not fall back to the
+   * size based split row, or a range that is small but hot would be split
+   * at an arbitrary row (or flagged as a row overflow)
    */
+  if (split_rows.empty()) {
+    ScopedLock lock(m_mutex);
+    if (!m_size_split) {
+      HT_INFOF("Load on %s can no longer be divided, skipping split",
+               m_name.c_str());
+      HT_THROW(Error::CANCELLED, "");
+    }
+  }
 
-  if (split_rows.size() < ag_vector.size()) {
+  if (split_rows.empty()) {
     for (size_t i=0; i<ag_vector.size(); i++)
-      ag_vector[i]->get_split_rows(split_rows, true);
+      ag_vector[i]->get_split_rows(split_rows, false);
+
+    /**
+     * If we didn't get at least one row from each Access Group, then try again
+     * the hard way (scans CellCache for middle row)
+     */
+
+    if (split_rows.size() < ag_vector.size()) {
+      for (size_t i=0; i<ag_vector.size(); i++)
+        ag_vector[i]->get_split_rows(split_rows, true);
+    }
   }
   sort(split_rows.begin(), split_rows.end());
 
@@ -1034,6 +1149,14 @@ void Range::split_compact_and_shrink() {
     }
   }
 
+  // Samples from the half that moved away no longer apply
+  {
+    ScopedLock lock(m_schema_mutex);
+    m_load_sketch.clear();
+    m_load_split = false;
+    m_load_split_row.clear();
+  }
+
   if (m_split_off_high) {
     /** Create DFS directories for this range **/
     {
@@ -1270,6 +1393,128 @@ void Range::purge_memory(MaintenanceFlag::Map &subtask_map) {
 }
 
 
+void Range::attach_cell_stores(const String &start_row, const String &end_row,
+                               const std::vector<String> &ag_names,
+                               const std::vector<String> &files) {
+  RangeMaintenanceGuard::Activator activator(m_maintenance_guard);
+  std::vector<AccessGroup *> ags, attach_ags;
+  std::vector<CellStorePtr> stores;
+
+  HT_ASSERT(ag_names.size() == files.size());
+
+  // The files must have been partitioned on the current boundaries
+  {
+    ScopedLock lock(m_mutex);
+    if (start_row != m_metalog_entity->spec.start_row ||
+        end_row != m_metalog_entity->spec.end_row)
+      HT_THROWF(Error::RANGESERVER_RANGE_MISMATCH, "%s is now [%s..%s]",
+                m_name.c_str(), m_metalog_entity->spec.start_row,
+                m_metalog_entity->spec.end_row);
+  }
+
+  {
+    ScopedLock lock(m_schema_mutex);
+    foreach (const String &name, ag_names) {
+      AccessGroupMap::iterator iter = m_access_group_map.find(name);
+      if (iter == m_access_group_map.end())
+        HT_THROWF(Error::BAD_SCHEMA, "Unknown access group '%s' for range %s",
+                  name.c_str(), m_name.c_str());
+      ags.push_back(iter->second);
+    }
+  }
+
+  // Open every file before changing anything, so that a bad file leaves
+  // both the range and the staged files as they were.  Files attached by
+  // an earlier attempt whose response was lost are skipped.
+  for (size_t i=0; i<files.size(); i++) {
+    if (ags[i]->has_cell_store(files[i])) {
+      HT_INFOF("%s already attached to range %s", files[i].c_str(),
+               m_name.c_str());
+      continue;
+    }
+    attach_ags.push_back(ags[i]);
+    stores.push_back(ags[i]->open_staged_cell_store(files[i]));
+  }
+
+  if (stores.empty())
+    return;
+
+  // Record all of the files with a single METADATA write.  Once it is done
+  // the files belong to the range, even if this server goes down before
+  // they are added below.
+  for (size_t i=0; i<stores.size(); i++)
+    attach_ags[i]->add_live_file(stores[i]->get_filename());
+
+  try {
+    std::vector<String> ag_list, file_lists;
+    std::set<AccessGroup *> written;
+    foreach (AccessGroup *ag, attach_ags) {
+      if (!written.insert(ag).second)
+        continue;
+      ag_list.push_back(ag->get_name());
+      file_lists.push_back("");
+      ag->get_file_list(file_lists.back());
+    }
+    MetadataNormal metadata(&m_metalog_entity->table,
+                            m_metalog_entity->spec.end_row);
+    metadata.write_files(ag_list, file_lists);
+  }
+  catch (Exception &e) {
+    for (size_t i=0; i<stores.size(); i++)
+      attach_ags[i]->remove_live_file(stores[i]->get_filename());
+    throw;
+  }
+
+  // New scanners see either none or all of the stores
+  {
+    Barrier::ScopedActivator block_scans(m_scan_barrier);
+    for (size_t i=0; i<stores.size(); i++) {
+      int64_t revision = boost::any_cast<int64_t>
+        (stores[i]->get_trailer()->get("revision"));
+      attach_ags[i]->attach_cell_store(stores[i]);
+      ScopedLock lock(m_mutex);
+      if (revision > m_latest_revision)
+        m_latest_revision = revision;
+    }
+  }
+
+  {
+    ScopedLock lock(m_mutex);
+    m_maintenance_generation++;
+  }
+
+  HT_INFOF("Attached %d cell stores to range %s", (int)stores.size(),
+           m_name.c_str());
+}
+
+
+void Range::get_hot_blocks(HotBlockMap &hot_blocks) {
+  AccessGroupVector ag_vector(0);
+
+  {
+    ScopedLock lock(m_schema_mutex);
+    ag_vector = m_access_group_vector;
+  }
+
+  for (size_t i=0; i<ag_vector.size(); i++)
+    ag_vector[i]->get_hot_blocks(hot_blocks);
+}
+
+
+void Range::get_blocks_to_warm(const HotBlockMap &hot_blocks,
+                               WarmBlockList &blocks) {
+  AccessGroupVector ag_vector(0);
+
+  {
+    ScopedLock lock(m_schema_mutex);
+    ag_vector = m_access_group_vector;
+  }
+
+  for (size_t i=0; i<ag_vector.size() && !cancel_maintenance(); i++)
+    ag_vector[i]->get_blocks_to_warm(hot_blocks, blocks);
+}
+
+
 /**
  * This method is called when the range is offline so no locking is needed
  */
@@ -1439,5 +1684,6 @@ std::ostream &Hypertable::operator<<(std::ostream &os, const Range::MaintenanceD
   os << "relinquish=" << (mdata.relinquish ? "true" : "false") << "\n";
   os << "needs_major_compaction=" << (mdata.needs_major_compaction ? "true" : "false") << "\n";
   os << "needs_split=" << (mdata.needs_split ? "true" : "false") << "\n";
+  os << "load_split=" << (mdata.load_split ? "true" : "false") << "\n";
   return os;
 }
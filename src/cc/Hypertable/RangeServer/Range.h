@@ -47,6 +47,7 @@
 #include "RangeMaintenanceGuard.h"
 #include "RangeSet.h"
 #include "RangeTransferInfo.h"
+#include "RowLoadSketch.h"
 
 namespace Hypertable {
 
@@ -57,6 +58,17 @@ namespace Hypertable {
 
   public:
 
+    /** A CellStore to be opened when the range is loaded */
+    class CellStoreOpenRequest {
+    public:
+      CellStoreOpenRequest() : ag(0), error(Error::OK) { }
+      AccessGroup *ag;
+      String name;
+      String path;
+      CellStorePtr cellstore;
+      int error;
+    };
+
     class MaintenanceData {
     public:
       int64_t compactable_memory() {
@@ -99,6 +111,7 @@ namespace Hypertable {
       bool     relinquish;
       bool     needs_major_compaction;
       bool     needs_split;
+      bool     load_split;
     };
 
     typedef std::map<String, AccessGroup *> AccessGroupMap;
@@ -151,7 +164,8 @@ namespace Hypertable {
 
     void replay_transfer_log(CommitLogReader *commit_log_reader);
 
-    MaintenanceData *get_maintenance_data(ByteArena &arena, time_t now, TableMutator *mutator);
+    MaintenanceData *get_maintenance_data(ByteArena &arena, time_t now,
+                                          bool check_load_split, TableMutator *mutator);
 
     void wait_for_maintenance_to_complete() {
       m_maintenance_guard.wait_for_complete();
@@ -167,6 +181,34 @@ namespace Hypertable {
 
     void purge_memory(MaintenanceFlag::Map &subtask_map);
 
+    /**
+     * Attaches CellStores built offline (bulk ingest) to the range.  All
+     * files are opened first, then recorded in the 'Files' METADATA column
+     * of their access groups with a single write, and then made visible to
+     * scans all at once.  The files stay where they were staged.  Files
+     * that are already attached are skipped, so a retry is harmless.  The
+     * commit log is not involved.
+     *
+     * @param start_row start row the files were partitioned on
+     * @param end_row end row the files were partitioned on
+     * @param ag_names access group of each file
+     * @param files DFS paths of the staged CellStore files
+     */
+    void attach_cell_stores(const String &start_row, const String &end_row,
+                            const std::vector<String> &ag_names,
+                            const std::vector<String> &files);
+
+    /** Collects the cached blocks of all access groups */
+    void get_hot_blocks(HotBlockMap &hot_blocks);
+
+    /**
+     * Collects the uncached blocks among those recorded by
+     * get_hot_blocks(), possibly on another server, so that they can be
+     * read into the block cache.
+     */
+    void get_blocks_to_warm(const HotBlockMap &hot_blocks,
+                            WarmBlockList &blocks);
+
     void schedule_relinquish() { m_relinquish = true; }
     bool get_relinquish() const { return m_relinquish; }
 
@@ -312,6 +354,8 @@ namespace Hypertable {
 
     void load_cell_stores(Metadata *metadata);
 
+    void open_cell_stores(std::vector<CellStoreOpenRequest> &requests);
+
     bool cancel_maintenance();
 
     void relinquish_install_log();
@@ -363,6 +407,11 @@ namespace Hypertable {
     bool             m_removed_from_working_set;
     int64_t          m_maintenance_generation;
     LoadMetricsRange m_load_metrics;
+    RowLoadSketch    m_load_sketch;
+    time_t           m_load_sketch_time;
+    bool             m_load_split;
+    String           m_load_split_row;
+    bool             m_size_split;
   };
 
   typedef intrusive_ptr<Range> RangePtr;
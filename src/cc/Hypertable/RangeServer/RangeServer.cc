@@ -26,6 +26,7 @@
 #include <cstring>
 #include <iostream>
 #include <fstream>
+#include <set>
 
 #include <boost/algorithm/string.hpp>
 
@@ -48,9 +49,13 @@ extern "C" {
 #include "Common/HashMap.h"
 #include "Common/md5.h"
 #include "Common/Random.h"
+#include "Common/Stopwatch.h"
 #include "Common/StringExt.h"
 #include "Common/SystemInfo.h"
+#include "Common/Thread.h"
 
+#include "Hypertable/Lib/BlockCompressionCodecAuto.h"
+#include "Hypertable/Lib/BlockCompressionHeader.h"
 #include "Hypertable/Lib/CommitLog.h"
 #include "Hypertable/Lib/Key.h"
 #include "Hypertable/Lib/MetaLogDefinition.h"
@@ -67,6 +72,7 @@ extern "C" {
 #include "Global.h"
 #include "GroupCommit.h"
 #include "HandlerFactory.h"
+#include "LatencyStats.h"
 #include "LocationInitializer.h"
 #include "MaintenanceQueue.h"
 #include "MaintenanceScheduler.h"
@@ -89,12 +95,14 @@ using namespace Hypertable::Property;
 
 RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
     ApplicationQueuePtr &app_queue, Hyperspace::SessionPtr &hyperspace)
-  : m_update_commit_queue_count(0), m_root_replay_finished(false),
+  : m_update_commit_queue_count(0), m_update_qualify_batches(0),
+    m_update_range_lists(0), m_update_arena_bytes(0),
+    m_root_replay_finished(false),
     m_metadata_replay_finished(false), m_system_replay_finished(false),
     m_replay_finished(false), m_props(props), m_verbose(false),
     m_shutdown(false), m_comm(conn_mgr->get_comm()), m_conn_manager(conn_mgr),
     m_app_queue(app_queue), m_hyperspace(hyperspace), m_timer_handler(0),
-    m_group_commit_timer_handler(0), m_query_cache(0),
+    m_group_commit_timer_handler(0), m_query_cache(0), m_cache_warmer(0),
     m_last_revision(TIMESTAMP_MIN), m_last_metrics_update(0),
     m_loadavg_accum(0.0), m_page_in_accum(0), m_page_out_accum(0),
     m_metric_samples(0), m_pending_metrics_updates(0)
@@ -109,6 +117,9 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   Global::range_split_size = cfg.get_i64("Range.SplitSize");
   Global::range_maximum_size = cfg.get_i64("Range.MaximumSize");
   Global::range_metadata_split_size = cfg.get_i64("Range.MetadataSplitSize", Global::range_split_size);
+  Global::range_split_load_threshold = cfg.get_i32("Range.LoadSplit.Threshold");
+  Global::range_load_sample_interval = cfg.get_i32("Range.LoadSplit.SampleInterval");
+  Global::range_load_sample_rows = cfg.get_i32("Range.LoadSplit.SampleRows");
   Global::access_group_garbage_compaction_threshold = cfg.get_i32("AccessGroup.GarbageThreshold.Percentage");
   Global::access_group_max_mem = cfg.get_i64("AccessGroup.MaxMemory");
   Global::enable_shadow_cache = cfg.get_bool("AccessGroup.ShadowCache");
@@ -139,6 +150,16 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
 
   Global::merge_cellstore_run_length_threshold = cfg.get_i32("CellStore.Merge.RunLengthThreshold");
   Global::ignore_clock_skew_errors = cfg.get_bool("IgnoreClockSkewErrors");
+  Global::cellstore_open_concurrency = cfg.get_i32("CellStore.OpenConcurrency");
+  m_replay_load_concurrency = cfg.get_i32("Recovery.LoadConcurrency");
+
+  String block_checksum = cfg.get_str("BlockChecksum");
+  if (block_checksum == "crc32c")
+    BlockCompressionHeader::set_default_checksum_type(
+        BlockCompressionHeader::CHECKSUM_CRC32C);
+  else if (block_checksum != "fletcher32")
+    HT_THROWF(Error::CONFIG_BAD_VALUE, "Unrecognized block checksum '%s' "
+              "(expected fletcher32 or crc32c)", block_checksum.c_str());
 
   std::vector<int64_t> collector_periods(2);
   int64_t interval = (int64_t)cfg.get_i32("Maintenance.Interval");
@@ -196,6 +217,8 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   m_max_clock_skew = cfg.get_i32("ClockSkew.Max");
 
   m_update_delay = cfg.get_i32("UpdateDelay", 0);
+  m_update_qualify_queue_limit =
+    (size_t)cfg.get_i32("UpdateThrottle.MaxQueuedUpdates");
 
   int64_t block_cache_min = cfg.get_i64("BlockCache.MinMemory");
   int64_t block_cache_max;
@@ -219,6 +242,24 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
 
   Global::block_cache = new FileBlockCache(block_cache_min, block_cache_max);
 
+  Global::block_cache_warming = cfg.get_bool("BlockCache.WarmOnMove");
+  if (Global::block_cache_warming)
+    m_cache_warmer = new CacheWarmer();
+
+  String local_cache_dir = cfg.get_str("BlockCache.Local.Directory");
+  if (!local_cache_dir.empty()) {
+    try {
+      Global::local_block_cache =
+        new LocalBlockCache(local_cache_dir,
+                            cfg.get_i64("BlockCache.Local.Capacity"),
+                            cfg.get_bool("BlockCache.Local.AdmitOnFirstMiss"));
+    }
+    catch (Exception &e) {
+      HT_ERRORF("Unable to create local block cache in '%s' - %s",
+                local_cache_dir.c_str(), e.what());
+    }
+  }
+
   int64_t query_cache_memory = cfg.get_i64("QueryCache.MaxMemory");
   if (query_cache_memory > 0) {
     // reduce query cache if required
@@ -233,6 +274,11 @@ RangeServer::RangeServer(PropertiesPtr &props, ConnectionManagerPtr &conn_mgr,
   Global::memory_tracker = new MemoryTracker(Global::block_cache);
   Global::memory_tracker->add(query_cache_memory);
 
+  Global::update_throttle =
+    new UpdateThrottle(cfg.get_i32("UpdateThrottle.LowWatermark"),
+                       cfg.get_i32("UpdateThrottle.MaxDelay"),
+                       cfg.get_i32("UpdateThrottle.Horizon"));
+
   Global::protocol = new Hypertable::RangeServerProtocol();
 
   DfsBroker::Client *dfsclient = new DfsBroker::Client(conn_mgr, props);
@@ -368,8 +414,19 @@ void RangeServer::shutdown() {
     foreach (Thread *thread, m_update_threads)
       thread->join();
 
+    delete Global::update_throttle;
+    Global::update_throttle = 0;
+
+    if (m_cache_warmer) {
+      m_cache_warmer->shutdown();
+      delete m_cache_warmer;
+      m_cache_warmer = 0;
+    }
+
     Global::range_locator = 0;
     delete Global::block_cache;
+    delete Global::local_block_cache;
+    Global::local_block_cache = 0;
 
     if (Global::rsml_writer) {
       Global::rsml_writer->close();
@@ -505,6 +562,61 @@ namespace {
 }
 
 
+namespace {
+
+  /**
+   * Replay loads ranges from a shared list so that the CellStore trailers
+   * of several ranges are read from the DFS at once.
+   */
+  class ReplayLoadRunner {
+  public:
+    ReplayLoadRunner(RangeServer *rs,
+                     std::vector<MetaLog::EntityRange *> &entities,
+                     size_t *nextp, Mutex *mutexp)
+      : m_rs(rs), m_entities(entities), m_nextp(nextp), m_mutexp(mutexp) { }
+
+    void operator()() {
+      size_t i;
+      while (true) {
+        {
+          ScopedLock lock(*m_mutexp);
+          if (*m_nextp >= m_entities.size())
+            return;
+          i = (*m_nextp)++;
+        }
+        m_rs->replay_load_range(0, m_entities[i], false);
+      }
+    }
+
+  private:
+    RangeServer *m_rs;
+    std::vector<MetaLog::EntityRange *> &m_entities;
+    size_t *m_nextp;
+    Mutex *m_mutexp;
+  };
+
+}
+
+
+void RangeServer::replay_load_ranges(std::vector<MetaLog::EntityRange *> &entities) {
+  size_t next = 0;
+  Mutex mutex;
+  size_t thread_count = std::min(entities.size(),
+      (size_t)std::max(m_replay_load_concurrency, 1));
+  ReplayLoadRunner runner(this, entities, &next, &mutex);
+
+  if (thread_count <= 1) {
+    runner();
+    return;
+  }
+
+  ThreadGroup threads;
+  for (size_t i=0; i<thread_count; i++)
+    threads.create_thread(runner);
+  threads.join_all();
+}
+
+
 void RangeServer::local_recover() {
   MetaLog::DefinitionPtr rsml_definition =
       new MetaLog::DefinitionRangeServer(Global::location_initializer->get().c_str());
@@ -516,10 +628,13 @@ void RangeServer::local_recover() {
   std::vector<RangePtr> rangev;
   std::vector<MetaLog::EntityPtr> entities;
   MetaLog::EntityRange *range_entity;
+  std::vector<MetaLog::EntityRange *> load_entities;
   int priority = 0;
 
   try {
     std::vector<MaintenanceTask*> maintenance_tasks;
+    Stopwatch stopwatch(false);
+    double load_time, replay_time;
     boost::xtime now;
     boost::xtime_get(&now, boost::TIME_UTC);
 
@@ -555,18 +670,24 @@ void RangeServer::local_recover() {
       // clear the replay map
       m_replay_map->clear();
 
+      stopwatch.reset();
+      stopwatch.start();
+      replay_time = 0;
+      load_entities.clear();
       foreach(MetaLog::EntityPtr &entity, entities) {
         range_entity = dynamic_cast<MetaLog::EntityRange *>(entity.get());
         if (range_entity->table.is_metadata() &&
-            range_entity->spec.end_row && !strcmp(range_entity->spec.end_row, Key::END_ROOT_ROW)) {
-          replay_load_range(0, range_entity, false);
-        }
+            range_entity->spec.end_row && !strcmp(range_entity->spec.end_row, Key::END_ROOT_ROW))
+          load_entities.push_back(range_entity);
       }
+      replay_load_ranges(load_entities);
+      load_time = stopwatch.elapsed();
 
       if (!m_replay_map->empty()) {
         root_log_reader = new CommitLogReader(Global::log_dfs,
                                               Global::log_dir + "/root");
         replay_log(root_log_reader);
+        replay_time = stopwatch.elapsed() - load_time;
 
         // Perform any range specific post-replay tasks
         rangev.clear();
@@ -604,6 +725,9 @@ void RangeServer::local_recover() {
 	Global::maintenance_queue->wait_for_empty();
 	maintenance_tasks.clear();
       }
+      HT_INFOF("Recovered %d ROOT ranges: load=%.3fs replay=%.3fs "
+               "finalize=%.3fs", (int)load_entities.size(), load_time,
+               replay_time, stopwatch.elapsed() - load_time - replay_time);
 
       /**
        * Then recover other METADATA ranges
@@ -613,19 +737,25 @@ void RangeServer::local_recover() {
       // clear the replay map
       m_replay_map->clear();
 
+      stopwatch.reset();
+      stopwatch.start();
+      replay_time = 0;
+      load_entities.clear();
       foreach(MetaLog::EntityPtr &entity, entities) {
         range_entity = dynamic_cast<MetaLog::EntityRange *>(entity.get());
         if (range_entity->table.is_metadata() &&
             !(range_entity->spec.end_row &&
-              !strcmp(range_entity->spec.end_row, Key::END_ROOT_ROW))) {
-          replay_load_range(0, range_entity, false);
-        }
+              !strcmp(range_entity->spec.end_row, Key::END_ROOT_ROW)))
+          load_entities.push_back(range_entity);
       }
+      replay_load_ranges(load_entities);
+      load_time = stopwatch.elapsed();
 
       if (!m_replay_map->empty()) {
         metadata_log_reader =
           new CommitLogReader(Global::log_dfs, Global::log_dir + "/metadata");
         replay_log(metadata_log_reader);
+        replay_time = stopwatch.elapsed() - load_time;
 
         // Perform any range specific post-replay tasks
         rangev.clear();
@@ -665,6 +795,9 @@ void RangeServer::local_recover() {
 	Global::maintenance_queue->wait_for_empty();
 	maintenance_tasks.clear();
       }
+      HT_INFOF("Recovered %d METADATA ranges: load=%.3fs replay=%.3fs "
+               "finalize=%.3fs", (int)load_entities.size(), load_time,
+               replay_time, stopwatch.elapsed() - load_time - replay_time);
 
       /**
        * Then recover SYSTEM ranges
@@ -674,16 +807,23 @@ void RangeServer::local_recover() {
       // clear the replay map
       m_replay_map->clear();
 
+      stopwatch.reset();
+      stopwatch.start();
+      replay_time = 0;
+      load_entities.clear();
       foreach(MetaLog::EntityPtr &entity, entities) {
         range_entity = dynamic_cast<MetaLog::EntityRange *>(entity.get());
         if (range_entity->table.is_system() && !range_entity->table.is_metadata())
-          replay_load_range(0, range_entity, false);
+          load_entities.push_back(range_entity);
       }
+      replay_load_ranges(load_entities);
+      load_time = stopwatch.elapsed();
 
       if (!m_replay_map->empty()) {
         system_log_reader =
           new CommitLogReader(Global::log_dfs, Global::log_dir + "/system");
         replay_log(system_log_reader);
+        replay_time = stopwatch.elapsed() - load_time;
 
         // Perform any range specific post-replay tasks
         rangev.clear();
@@ -723,6 +863,9 @@ void RangeServer::local_recover() {
 	Global::maintenance_queue->wait_for_empty();
 	maintenance_tasks.clear();
       }
+      HT_INFOF("Recovered %d SYSTEM ranges: load=%.3fs replay=%.3fs "
+               "finalize=%.3fs", (int)load_entities.size(), load_time,
+               replay_time, stopwatch.elapsed() - load_time - replay_time);
 
       /**
        * Then recover the USER ranges
@@ -732,16 +875,23 @@ void RangeServer::local_recover() {
       // clear the replay map
       m_replay_map->clear();
 
+      stopwatch.reset();
+      stopwatch.start();
+      replay_time = 0;
+      load_entities.clear();
       foreach(MetaLog::EntityPtr &entity, entities) {
         range_entity = dynamic_cast<MetaLog::EntityRange *>(entity.get());
         if (!range_entity->table.is_system())
-          replay_load_range(0, range_entity, false);
+          load_entities.push_back(range_entity);
       }
+      replay_load_ranges(load_entities);
+      load_time = stopwatch.elapsed();
 
       if (!m_replay_map->empty()) {
         user_log_reader = new CommitLogReader(Global::log_dfs,
                                               Global::log_dir + "/user");
         replay_log(user_log_reader);
+        replay_time = stopwatch.elapsed() - load_time;
 
         // Perform any range specific post-replay tasks
         rangev.clear();
@@ -780,6 +930,9 @@ void RangeServer::local_recover() {
 	Global::maintenance_queue->wait_for_empty();
 	maintenance_tasks.clear();
       }
+      HT_INFOF("Recovered %d USER ranges: load=%.3fs replay=%.3fs "
+               "finalize=%.3fs", (int)load_entities.size(), load_time,
+               replay_time, stopwatch.elapsed() - load_time - replay_time);
 
 
     }
@@ -1268,9 +1421,13 @@ RangeServer::create_scanner(ResponseCallbackCreateScanner *cb,
     decrement_needed = false;
 
     uint64_t cells_scanned, cells_returned, bytes_scanned, bytes_returned;
+    int64_t fill_start_ts = get_ts64();
 
     more = FillScanBlock(scanner, rbuf, m_scanner_buffer_size);
 
+    LatencyStats::record(StatsRangeServer::LATENCY_SCAN_BLOCK_FILL,
+                         fill_start_ts);
+
     MergeScanner *mscanner = dynamic_cast<MergeScanner*>(scanner.get());
 
     assert(mscanner);
@@ -1380,9 +1537,13 @@ RangeServer::fetch_scanblock(ResponseCallbackFetchScanblock *cb,
     }
 
     uint64_t cells_scanned, cells_returned, bytes_scanned, bytes_returned;
+    int64_t fill_start_ts = get_ts64();
 
     more = FillScanBlock(scanner, rbuf, m_scanner_buffer_size);
 
+    LatencyStats::record(StatsRangeServer::LATENCY_SCAN_BLOCK_FILL,
+                         fill_start_ts);
+
     MergeScanner *mscanner = dynamic_cast<MergeScanner*>(scanner.get());
 
     assert(mscanner);
@@ -1716,6 +1877,9 @@ RangeServer::load_range(ResponseCallback *cb, const TableIdentifier *table,
       HT_INFOF("Successfully loaded range %s[%s..%s]", table->id,
                range_spec->start_row, range_spec->end_row);
 
+    if (m_cache_warmer && transfer_log_dir && *transfer_log_dir)
+      m_cache_warmer->add(range, transfer_log_dir);
+
   }
   catch (Hypertable::Exception &e) {
     HT_ERROR_OUT << e << HT_END;
@@ -1886,6 +2050,16 @@ RangeServer::commit_log_sync(ResponseCallback *cb, const TableIdentifier *table)
       return;
   }
 
+  // Turn user updates away while the qualify queue is full
+  if (!table->is_system() && update_qualify_queue_full()) {
+    delete table_update;
+    if ((error = cb->error(Error::RANGESERVER_UPDATES_THROTTLED,
+                           format("Update queue full (%u batches)",
+                                  (unsigned)m_update_qualify_queue_limit))) != Error::OK)
+      HT_ERRORF("Problem sending error response - %s", Error::get_text(error));
+    return;
+  }
+
   m_live_map->get(table, table_update->table_info);
 
   // verify schema
@@ -1966,6 +2140,17 @@ RangeServer::update(ResponseCallbackUpdate *cb, const TableIdentifier *table,
     }
   }
 
+  // Turn user updates away while the qualify queue is full, the client
+  // retries them after a back-off.  Replying keeps this worker free.
+  if (!table->is_system() && update_qualify_queue_full()) {
+    delete table_update;
+    if ((error = cb->error(Error::RANGESERVER_UPDATES_THROTTLED,
+                           format("Update queue full (%u batches)",
+                                  (unsigned)m_update_qualify_queue_limit))) != Error::OK)
+      HT_ERRORF("Problem sending error response - %s", Error::get_text(error));
+    return;
+  }
+
   m_live_map->get(table, table_update->table_info);
 
   // verify schema
@@ -2017,6 +2202,7 @@ RangeServer::batch_update(std::vector<TableUpdate *> &updates, boost::xtime expi
   // Enqueue update
   {
     ScopedLock lock(m_update_qualify_queue_mutex);
+    uc->enqueue_ts = get_ts64();
     m_update_qualify_queue.push_back(uc);
     m_update_qualify_queue_cond.notify_all();
   }
@@ -2043,20 +2229,79 @@ void RangeServer::update_qualify_and_transform() {
   CommitLogPtr transfer_log;
   RangeUpdate range_update;
   RangePtr range;
+  int64_t qualify_start_ts;
 
   while (true) {
 
-    // Dequeue next update
+    // Dequeue the first update that is ready.  Throttled user updates are
+    // left in the queue with a not-before time rather than slept on, so
+    // that other updates, including system table updates, keep flowing.
+    // Later updates touching the same table as a waiting one wait behind
+    // it, to keep each table's updates in order.  While the throttle is
+    // saturated only system table updates are dequeued, so that
+    // maintenance can still write to METADATA and bring memory back under
+    // the limit.  System-only batches are never delayed and so may overtake
+    // deferred user batches; each table's updates still stay in FIFO order.
     {
       ScopedLock lock(m_update_qualify_queue_mutex);
-      while (m_update_qualify_queue.empty() && !m_shutdown)
-	m_update_qualify_queue_cond.wait(lock);
-      if (m_shutdown)
-	return;
-      uc = m_update_qualify_queue.front();
-      m_update_qualify_queue.pop_front();
+      std::list<UpdateContext *>::iterator iter;
+      while (true) {
+        while (m_update_qualify_queue.empty() && !m_shutdown)
+          m_update_qualify_queue_cond.wait(lock);
+        if (m_shutdown)
+          return;
+
+        bool saturated = Global::update_throttle->saturated();
+        int64_t now = get_ts64();
+        int64_t wake_ts = now + 100000000LL;
+        std::set<String> waiting_tables;
+
+        for (iter = m_update_qualify_queue.begin();
+             iter != m_update_qualify_queue.end(); ++iter) {
+          UpdateContext *candidate = *iter;
+          bool blocked = false;
+          foreach (TableUpdate *table_update, candidate->updates) {
+            if (waiting_tables.count(table_update->id.id))
+              blocked = true;
+          }
+          if (!blocked && candidate->system_only())
+            break;
+          bool ready = !saturated && !blocked;
+          if (ready && !candidate->throttled) {
+            uint32_t delay_millis = 0;
+            foreach (TableUpdate *table_update, candidate->updates) {
+              if (!table_update->id.is_system())
+                delay_millis = std::max(delay_millis,
+                    Global::update_throttle->delay(table_update->id.id,
+                        table_update->total_buffer_size));
+            }
+            candidate->throttled = true;
+            candidate->not_before = now + (int64_t)delay_millis * 1000000LL;
+          }
+          if (ready && candidate->not_before <= now)
+            break;
+          if (ready)
+            wake_ts = std::min(wake_ts, candidate->not_before);
+          foreach (TableUpdate *table_update, candidate->updates)
+            waiting_tables.insert(table_update->id.id);
+        }
+        if (iter != m_update_qualify_queue.end())
+          break;
+
+        boost::xtime retry_time;
+        boost::xtime_get(&retry_time, boost::TIME_UTC);
+        xtime_add_millis(retry_time,
+                         (uint32_t)((wake_ts - now + 999999LL) / 1000000LL));
+        m_update_qualify_queue_cond.timed_wait(lock, retry_time);
+      }
+      uc = *iter;
+      m_update_qualify_queue.erase(iter);
     }
 
+    LatencyStats::record(StatsRangeServer::LATENCY_UPDATE_QUALIFY_QUEUE_WAIT,
+                         uc->enqueue_ts);
+    qualify_start_ts = get_ts64();
+
     rulist = 0;
     transfer_bufp = 0;
     go_buf_reset_offset = 0;
@@ -2113,6 +2358,11 @@ void RangeServer::update_qualify_and_transform() {
       table_update->id.encode(&table_update->go_buf.ptr);
       table_update->go_buf.set_mark();
 
+      // Consecutive keys, even across requests, usually land in the same
+      // range, so the last range looked up is reused while rows fall in it
+      range = 0;
+      rulist = 0;
+
       foreach (UpdateRequest *request, table_update->requests) {
 
 	uc->total_updates++;
@@ -2143,8 +2393,11 @@ void RangeServer::update_qualify_and_transform() {
 	  }
 
 	  // Look for containing range, add to stop mods if not found
-	  if (!table_update->table_info->find_containing_range(row, range,
+	  if ((!range || strcmp(row, start_row.c_str()) <= 0 ||
+	       (end_row != "" && strcmp(row, end_row.c_str()) > 0)) &&
+	      !table_update->table_info->find_containing_range(row, range,
 							       start_row, end_row)) {
+	    range = 0;
 	    if (uc->send_back.error != Error::RANGESERVER_OUT_OF_RANGE
 		&& uc->send_back.count > 0) {
 	      request->send_back_vector.push_back(uc->send_back);
@@ -2161,10 +2414,13 @@ void RangeServer::update_qualify_and_transform() {
 	    continue;
 	  }
 
-	  if ((rulist = table_update->range_map[range.get()]) == 0) {
-	    rulist = new RangeUpdateList();
-	    rulist->range = range;
-	    table_update->range_map[range.get()] = rulist;
+	  if (rulist == 0 || rulist->range.get() != range.get()) {
+	    if ((rulist = table_update->range_map[range.get()]) == 0) {
+	      rulist = RangeUpdateList::create(uc->arena);
+	      uc->range_lists++;
+	      rulist->range = range;
+	      table_update->range_map[range.get()] = rulist;
+	    }
 	  }
 
 	  if (table_update->wait_for_metadata_recovery && !rulist->range->is_root()) {
@@ -2227,7 +2483,9 @@ void RangeServer::update_qualify_and_transform() {
 	      rulist->range->end_row() != end_row) {
 	    rulist->range->decrement_update_counter();
 	    table_update->range_map.erase(rulist->range.get());
-	    delete rulist;
+	    rulist->~RangeUpdateList();
+	    rulist = 0;
+	    range = 0;
 	    continue;
 	  }
 
@@ -2420,12 +2678,22 @@ void RangeServer::update_qualify_and_transform() {
 
     uc->last_revision = m_last_revision;
 
+    range = 0;
+    rulist = 0;
+
+    LatencyStats::record(StatsRangeServer::LATENCY_UPDATE_QUALIFY,
+                         qualify_start_ts);
+
     // Enqueue update
     {
       ScopedLock lock(m_update_commit_queue_mutex);
+      uc->enqueue_ts = get_ts64();
       m_update_commit_queue.push_back(uc);
       m_update_commit_queue_cond.notify_all();
       m_update_commit_queue_count++;
+      m_update_qualify_batches++;
+      m_update_range_lists += uc->range_lists;
+      m_update_arena_bytes += uc->arena.used();
     }
   }
 }
@@ -2456,6 +2724,9 @@ void RangeServer::update_commit() {
       m_update_commit_queue_count--;
     }
 
+    LatencyStats::record(StatsRangeServer::LATENCY_UPDATE_COMMIT_QUEUE_WAIT,
+                         uc->enqueue_ts);
+
     committed_transfer_data = 0;
     user_log_needs_syncing = false;
 
@@ -2463,10 +2734,13 @@ void RangeServer::update_commit() {
      * Commit ROOT mutations
      */
     if (uc->root_buf.ptr > uc->root_buf.mark) {
+      int64_t write_start_ts = get_ts64();
       if ((error = Global::root_log->write(uc->root_buf, uc->last_revision)) != Error::OK) {
 	HT_FATALF("Problem writing %d bytes to ROOT commit log - %s",
 		  (int)uc->root_buf.fill(), Error::get_text(error));
       }
+      LatencyStats::record(StatsRangeServer::LATENCY_COMMIT_LOG_WRITE,
+                           write_start_ts);
     }
 
     foreach (TableUpdate *table_update, uc->updates) {
@@ -2511,6 +2785,7 @@ void RangeServer::update_commit() {
 	  log = Global::system_log;
 	}
 
+	int64_t write_start_ts = get_ts64();
 	if ((error = log->write(table_update->go_buf, uc->last_revision, sync)) != Error::OK) {
 	  table_update->error_msg = format("Problem writing %d bytes to commit log (%s) - %s",
 					   (int)table_update->go_buf.fill(),
@@ -2520,6 +2795,8 @@ void RangeServer::update_commit() {
 	  table_update->error = error;
 	  continue;
 	}
+	LatencyStats::record(StatsRangeServer::LATENCY_COMMIT_LOG_WRITE,
+			     write_start_ts);
       }
       else if (table_update->sync)
 	user_log_needs_syncing = true;
@@ -2540,6 +2817,7 @@ void RangeServer::update_commit() {
     // Now sync the USER commit log if needed
     if (do_sync) {
       size_t retry_count = 0;
+      int64_t sync_start_ts = get_ts64();
       uc->total_syncs++;
       while ((error = Global::user_log->sync()) != Error::OK) {
 	HT_ERRORF("Problem sync'ing user log fragment (%s) - %s",
@@ -2549,15 +2827,19 @@ void RangeServer::update_commit() {
 	  break;
 	poll(0, 0, 10000);
       }
+      LatencyStats::record(StatsRangeServer::LATENCY_COMMIT_LOG_SYNC,
+                           sync_start_ts);
     }
 
     // Enqueue update
     {
       ScopedLock lock(m_update_response_queue_mutex);
+      int64_t now = get_ts64();
       coalesce_queue.push_back(uc);
       while (!coalesce_queue.empty()) {
 	uc = coalesce_queue.front();
 	coalesce_queue.pop_front();
+	uc->enqueue_ts = now;
 	m_update_response_queue.push_back(uc);
       }
       coalesce_amount = 0;
@@ -2586,6 +2868,9 @@ void RangeServer::update_add_and_respond() {
       m_update_response_queue.pop_front();
     }
 
+    LatencyStats::record(StatsRangeServer::LATENCY_UPDATE_RESPONSE_QUEUE_WAIT,
+                         uc->enqueue_ts);
+
     /**
      *  Insert updates into Ranges
      */
@@ -2599,6 +2884,7 @@ void RangeServer::update_add_and_respond() {
 	foreach (RangeUpdate &update, (*iter).second->updates) {
 	  Range *rangep = (*iter).first;
 	  Locker<Range> lock(*rangep);
+	  int64_t insert_start_ts = get_ts64();
 	  uint8_t *ptr = update.bufp->base + update.offset;
 	  uint8_t *end = ptr + update.len;
 
@@ -2625,6 +2911,8 @@ void RangeServer::update_add_and_respond() {
 	      m_query_cache->invalidate(table_update->id.id, key_comps.row);
 	    last_row = key_comps.row;
 	  }
+	  LatencyStats::record(StatsRangeServer::LATENCY_CELL_CACHE_INSERT,
+			       insert_start_ts);
 	  rangep->add_cells_written(count);
 	}
       }
@@ -2928,6 +3216,10 @@ void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb) {
   m_stats->cpu_user = m_stats->system.cpu_stat.user;
   m_stats->cpu_sys = m_stats->system.cpu_stat.sys;
   m_stats->live = m_replay_finished;
+  LatencyStats::collect(m_stats->latency);
+  BlockCompressionCodecAuto::get_codec_mix(m_stats->codec_blocks,
+                                           m_stats->codec_bytes,
+                                           m_stats->codec_zbytes);
 
   if (m_query_cache)
     m_query_cache->get_stats(&m_stats->query_cache_max_memory,
@@ -2941,6 +3233,12 @@ void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb) {
                                    &m_stats->block_cache_accesses,
                                    &m_stats->block_cache_hits);
 
+  if (Global::local_block_cache)
+    Global::local_block_cache->get_stats(&m_stats->local_block_cache_capacity,
+                                         &m_stats->local_block_cache_used,
+                                         &m_stats->local_block_cache_accesses,
+                                         &m_stats->local_block_cache_hits);
+
   TableMutatorPtr mutator;
   if (now > m_next_metrics_update) {
     ScopedLock lock(m_mutex);
@@ -3084,6 +3382,30 @@ void RangeServer::get_statistics(ResponseCallbackGetStatistics *cb) {
     m_stats->block_cache_hits = 0;
   }
 
+  if (Global::local_block_cache) {
+    Global::local_block_cache->get_stats(&m_stats->local_block_cache_capacity,
+                                         &m_stats->local_block_cache_used,
+                                         &m_stats->local_block_cache_accesses,
+                                         &m_stats->local_block_cache_hits);
+  }
+  else {
+    m_stats->local_block_cache_capacity = 0;
+    m_stats->local_block_cache_used = 0;
+    m_stats->local_block_cache_accesses = 0;
+    m_stats->local_block_cache_hits = 0;
+  }
+
+  Global::update_throttle->get_stats(&m_stats->update_throttle_level,
+                                     &m_stats->updates_throttled,
+                                     &m_stats->update_throttle_millis);
+
+  {
+    ScopedLock lock(m_update_commit_queue_mutex);
+    m_stats->update_qualify_batches = m_update_qualify_batches;
+    m_stats->update_range_lists = m_update_range_lists;
+    m_stats->update_arena_bytes = m_update_arena_bytes;
+  }
+
   /**
    * If created a mutator above, write data to sys/RS_METRICS
    */
@@ -3196,43 +3518,52 @@ RangeServer::replay_load_range(ResponseCallback *cb,
 
   try {
 
-    /** Get TableInfo from replay map, or copy it from live map, or create if
-     * doesn't exist **/
-    if (!m_replay_map->get(range_entity->table.id, table_info)) {
-      table_info = new TableInfo(m_master_client, &range_entity->table, schema);
-      register_table = true;
-    }
+    {
+      // Serializes TableInfo creation when ranges are replay loaded
+      // concurrently during local recovery
+      ScopedLock lock(m_replay_load_mutex);
+
+      /** Get TableInfo from replay map, or copy it from live map, or create if
+       * doesn't exist **/
+      if (!m_replay_map->get(range_entity->table.id, table_info)) {
+        table_info = new TableInfo(m_master_client, &range_entity->table, schema);
+        register_table = true;
+      }
 
-    if (!m_live_map->get(range_entity->table.id, live_table_info))
-      live_table_info = table_info;
+      if (!m_live_map->get(range_entity->table.id, live_table_info))
+        live_table_info = table_info;
 
-    // Verify schema, this will create the Schema object and add it to
-    // table_info if it doesn't exist
-    verify_schema(table_info, range_entity->table.generation);
+      // Verify schema, this will create the Schema object and add it to
+      // table_info if it doesn't exist
+      verify_schema(table_info, range_entity->table.generation);
 
-    if (register_table)
-      m_replay_map->set(range_entity->table.id, table_info);
+      if (register_table)
+        m_replay_map->set(range_entity->table.id, table_info);
 
-    /**
-     * Make sure this range is not already loaded
-     */
-    if (table_info->get_range(&range_entity->spec, range) ||
-        live_table_info->get_range(&range_entity->spec, range))
-      HT_THROWF(Error::RANGESERVER_RANGE_ALREADY_LOADED, "%s[%s..%s]",
-                range_entity->table.id, range_entity->spec.start_row, range_entity->spec.end_row);
+      /**
+       * Make sure this range is not already loaded
+       */
+      if (table_info->get_range(&range_entity->spec, range) ||
+          live_table_info->get_range(&range_entity->spec, range))
+        HT_THROWF(Error::RANGESERVER_RANGE_ALREADY_LOADED, "%s[%s..%s]",
+                  range_entity->table.id, range_entity->spec.start_row, range_entity->spec.end_row);
+    }
 
     /**
      * Lazily create sys/METADATA table pointer
      */
     if (!Global::metadata_table) {
       ScopedLock lock(m_mutex);
-      uint32_t timeout_ms = m_props->get_i32("Hypertable.Request.Timeout");
-      if (!Global::range_locator)
-        Global::range_locator = new Hypertable::RangeLocator(m_props, m_conn_manager,
-                                                             Global::hyperspace, timeout_ms);
-      Global::metadata_table = new Table(m_props, Global::range_locator, m_conn_manager,
-          Global::hyperspace, m_app_queue, m_namemap, TableIdentifier::METADATA_NAME,
-          0, timeout_ms);
+      // double-check locking, ranges may be replay loaded concurrently
+      if (!Global::metadata_table) {
+        uint32_t timeout_ms = m_props->get_i32("Hypertable.Request.Timeout");
+        if (!Global::range_locator)
+          Global::range_locator = new Hypertable::RangeLocator(m_props, m_conn_manager,
+                                                               Global::hyperspace, timeout_ms);
+        Global::metadata_table = new Table(m_props, Global::range_locator, m_conn_manager,
+            Global::hyperspace, m_app_queue, m_namemap, TableIdentifier::METADATA_NAME,
+            0, timeout_ms);
+      }
     }
 
     schema = table_info->get_schema();
@@ -3517,6 +3848,62 @@ RangeServer::relinquish_range(ResponseCallback *cb, const TableIdentifier *table
 
 }
 
+
+void
+RangeServer::attach_cell_stores(ResponseCallback *cb,
+    const TableIdentifier *table, const RangeSpec *range_spec,
+    const std::vector<String> &access_groups,
+    const std::vector<String> &files) {
+  TableInfoPtr table_info;
+  RangePtr range;
+
+  HT_INFO_OUT << "attach_cell_stores (" << files.size() << " files)\n"
+              << *table << *range_spec << HT_END;
+
+  if (!m_replay_finished) {
+    if (!wait_for_recovery_finish(cb->get_event()->expiration_time()))
+      return;
+  }
+
+  try {
+
+    if (table->is_system())
+      HT_THROWF(Error::NOT_ALLOWED, "Bulk load into system table %s",
+                table->id);
+
+    if (access_groups.size() != files.size())
+      HT_THROWF(Error::PROTOCOL_ERROR, "Access group count (%d) does not "
+                "match file count (%d)", (int)access_groups.size(),
+                (int)files.size());
+
+    if (!m_live_map->get(table->id, table_info))
+      HT_THROWF(Error::TABLE_NOT_FOUND, "%s", table->id);
+
+    if (table_info->get_schema()->get_generation() != table->generation)
+      HT_THROWF(Error::RANGESERVER_GENERATION_MISMATCH,
+                "RangeServer Schema generation for table '%s' is %u but "
+                "supplied is %u", table->id,
+                (unsigned)table_info->get_schema()->get_generation(),
+                (unsigned)table->generation);
+
+    if (!table_info->get_range(range_spec, range))
+      HT_THROW(Error::RANGESERVER_RANGE_NOT_FOUND,
+               format("%s[%s..%s]", table->id, range_spec->start_row, range_spec->end_row));
+
+    range->attach_cell_stores(range_spec->start_row, range_spec->end_row,
+                              access_groups, files);
+
+    cb->response_ok();
+  }
+  catch (Hypertable::Exception &e) {
+    int error = 0;
+    HT_ERROR_OUT << e << HT_END;
+    if (cb && (error = cb->error(e.code(), e.what())) != Error::OK)
+      HT_ERRORF("Problem sending error response - %s", Error::get_text(error));
+  }
+
+}
+
 void RangeServer::play_fragments(ResponseCallback *cb, int64_t op_id, uint32_t attempt,
     const String &location, int type, const vector<uint32_t> &fragments,
     RangeServerRecoveryLoadPlan &load_plan, uint32_t replay_timeout) {
@@ -4123,6 +4510,11 @@ bool RangeServer::wait_for_recovery_finish(boost::xtime expire_time) {
   return true;
 }
 
+bool RangeServer::update_qualify_queue_full() {
+  ScopedLock lock(m_update_qualify_queue_mutex);
+  return m_update_qualify_queue.size() >= m_update_qualify_queue_limit;
+}
+
 bool RangeServer::wait_for_root_recovery_finish(boost::xtime expire_time) {
   ScopedLock lock(m_mutex);
   while (!m_root_replay_finished) {
@@ -44,6 +44,7 @@
 #include "Hypertable/Lib/NameIdMapper.h"
 #include "Hypertable/Lib/StatsRangeServer.h"
 
+#include "CacheWarmer.h"
 #include "Global.h"
 #include "GroupCommitInterface.h"
 #include "GroupCommitTimerHandler.h"
@@ -111,6 +112,11 @@ namespace Hypertable {
 
     void relinquish_range(ResponseCallback *, const TableIdentifier *,
                           const RangeSpec *);
+
+    void attach_cell_stores(ResponseCallback *, const TableIdentifier *,
+                            const RangeSpec *,
+                            const std::vector<String> &access_groups,
+                            const std::vector<String> &files);
     void heapcheck(ResponseCallback *, const char *);
 
     void metadata_sync(ResponseCallback *, const char *, uint32_t flags, std::vector<const char *> columns);
@@ -155,6 +161,7 @@ namespace Hypertable {
     bool wait_for_root_recovery_finish(boost::xtime expire_time);
     bool wait_for_metadata_recovery_finish(boost::xtime expire_time);
     bool wait_for_system_recovery_finish(boost::xtime expire_time);
+    bool update_qualify_queue_full();
     bool wait_for_recovery_finish(const TableIdentifier *table,
                                   const RangeSpec *range,
 				  boost::xtime expire_time);
@@ -181,6 +188,7 @@ namespace Hypertable {
 
     void initialize(PropertiesPtr &);
     void local_recover();
+    void replay_load_ranges(std::vector<MetaLog::EntityRange *> &entities);
     void replay_log(CommitLogReaderPtr &log_reader);
     void verify_schema(TableInfoPtr &, uint32_t generation);
     void transform_key(ByteString &bskey, DynamicBuffer *dest_bufp,
@@ -189,13 +197,28 @@ namespace Hypertable {
     class UpdateContext {
     public:
       UpdateContext(std::vector<TableUpdate *> &tu, boost::xtime xt) : updates(tu), expire_time(xt),
-          total_updates(0), total_added(0), total_syncs(0), total_bytes_added(0) { }
+          enqueue_ts(0), throttled(false), not_before(0), total_updates(0), total_added(0),
+          total_syncs(0), total_bytes_added(0), range_lists(0) { }
       ~UpdateContext() {
 	foreach(TableUpdate *u, updates)
 	  delete u;
       }
+      bool system_only() {
+        foreach(TableUpdate *u, updates) {
+          if (!u->id.is_system())
+            return false;
+        }
+        return true;
+      }
       std::vector<TableUpdate *> updates;
+      /** Holds the per-range update lists; freed with the context */
+      CharArena arena;
       boost::xtime expire_time;
+      int64_t enqueue_ts;
+      /** Set once the update throttle delay has been computed */
+      bool throttled;
+      /** Not dequeued before this time (ns) while throttled */
+      int64_t not_before;
       int64_t auto_revision;
       SendBackRec send_back;
       DynamicBuffer root_buf;
@@ -204,6 +227,8 @@ namespace Hypertable {
       uint32_t total_added;
       uint32_t total_syncs;
       uint64_t total_bytes_added;
+      /** Number of RangeUpdateLists allocated from #arena */
+      uint32_t range_lists;
     };
 
     Mutex                      m_update_qualify_queue_mutex;
@@ -213,6 +238,10 @@ namespace Hypertable {
     Mutex                      m_update_commit_queue_mutex;
     boost::condition           m_update_commit_queue_cond;
     int32_t                    m_update_commit_queue_count;
+    /** Qualify-stage allocation counters, reported by get_statistics() */
+    uint64_t                   m_update_qualify_batches;
+    uint64_t                   m_update_range_lists;
+    uint64_t                   m_update_arena_bytes;
     Mutex                      m_update_commit_mutex;
     std::list<UpdateContext *> m_update_commit_queue;
     Mutex                      m_update_response_queue_mutex;
@@ -257,6 +286,8 @@ namespace Hypertable {
     uint64_t               m_log_roll_limit;
     uint64_t               m_update_coalesce_limit;
     int                    m_replay_group;
+    Mutex                  m_replay_load_mutex;
+    int32_t                m_replay_load_concurrency;
     TableIdCachePtr        m_dropped_table_id_cache;
 
     StatsRangeServerPtr    m_stats;
@@ -271,7 +302,9 @@ namespace Hypertable {
     GroupCommitInterface  *m_group_commit;
     GroupCommitTimerHandler *m_group_commit_timer_handler;
     uint32_t               m_update_delay;
+    size_t                 m_update_qualify_queue_limit;
     QueryCache            *m_query_cache;
+    CacheWarmer           *m_cache_warmer;
     int64_t                m_last_revision;
     int64_t                m_scanner_buffer_size;
     time_t                 m_last_metrics_update;
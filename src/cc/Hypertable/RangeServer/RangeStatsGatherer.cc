@@ -28,7 +28,8 @@
 using namespace Hypertable;
 
 void RangeStatsGatherer::fetch(RangeStatsVector &range_stats,
-                               size_t *lenp, TableMutator *mutator) {
+                               size_t *lenp, TableMutator *mutator,
+                               bool check_load_split) {
   std::vector<TableInfoPtr> table_vec;
 
   range_stats.clear();
@@ -50,7 +51,8 @@ void RangeStatsGatherer::fetch(RangeStatsVector &range_stats,
   for (size_t i=0,j=0; i<table_vec.size(); i++) {
     table_vec[i]->get_range_vector(m_range_vec);
     for (; j<m_range_vec.size(); j++)
-      range_stats.push_back(m_range_vec[j]->get_maintenance_data(m_arena, now, mutator));
+      range_stats.push_back(m_range_vec[j]->get_maintenance_data(m_arena, now, check_load_split,
+                                                                 mutator));
   }
 
 }
@@ -41,7 +41,14 @@ namespace Hypertable {
 
     virtual ~RangeStatsGatherer() { }
 
-    void fetch(RangeStatsVector &range_stats, size_t *lenp=0, TableMutator *mutator=0);
+    /**
+     * Collects maintenance data for every live range.  Only the
+     * maintenance scheduler passes check_load_split, which decays each
+     * range's load sketch and re-evaluates its load split; other callers
+     * see the last evaluated result.
+     */
+    void fetch(RangeStatsVector &range_stats, size_t *lenp=0, TableMutator *mutator=0,
+               bool check_load_split=false);
 
     void clear();
 
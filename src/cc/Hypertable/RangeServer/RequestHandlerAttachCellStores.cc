@@ -0,0 +1,65 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include "AsyncComm/ResponseCallback.h"
+#include "Common/Serialization.h"
+
+#include "Hypertable/Lib/Types.h"
+
+#include "RangeServer.h"
+#include "RequestHandlerAttachCellStores.h"
+
+using namespace Hypertable;
+using namespace Serialization;
+
+/**
+ *
+ */
+void RequestHandlerAttachCellStores::run() {
+  ResponseCallback cb(m_comm, m_event_ptr);
+  TableIdentifier table;
+  RangeSpec range;
+  std::vector<String> access_groups;
+  std::vector<String> files;
+  const uint8_t *decode_ptr = m_event_ptr->payload;
+  size_t decode_remain = m_event_ptr->payload_len;
+
+  try {
+    table.decode(&decode_ptr, &decode_remain);
+    range.decode(&decode_ptr, &decode_remain);
+    size_t count = decode_i32(&decode_ptr, &decode_remain);
+    for (size_t i=0; i<count; i++) {
+      access_groups.push_back(decode_vstr(&decode_ptr, &decode_remain));
+      files.push_back(decode_vstr(&decode_ptr, &decode_remain));
+    }
+
+    m_range_server->attach_cell_stores(&cb, &table, &range, access_groups,
+                                       files);
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    cb.error(e.code(), e.what());
+  }
+}
@@ -0,0 +1,85 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+
+#include "RowLoadSketch.h"
+
+using namespace Hypertable;
+
+
+void RowLoadSketch::decay() {
+  m_samples = 0;
+  for (RowCountMap::iterator iter = m_rows.begin(); iter != m_rows.end(); ) {
+    iter->second /= 2;
+    if (iter->second == 0)
+      m_rows.erase(iter++);
+    else {
+      m_samples += iter->second;
+      ++iter;
+    }
+  }
+  m_accesses = 0;
+}
+
+
+bool RowLoadSketch::check_split(uint64_t elapsed, uint64_t threshold,
+                                const String &start_row,
+                                const String &end_row, String &split_row) {
+  bool hot = threshold > 0 && elapsed > 0 &&
+    m_accesses / elapsed >= threshold;
+  decay();
+  return hot && median(start_row, end_row, split_row);
+}
+
+
+void RowLoadSketch::trim() {
+  while (m_rows.size() > m_max_rows) {
+    uint64_t accesses = m_accesses;
+    decay();
+    m_accesses = accesses;
+  }
+}
+
+
+bool RowLoadSketch::median(const String &start_row, const String &end_row,
+                           String &split_row) const {
+  RowCountMap::const_iterator begin = m_rows.upper_bound(start_row);
+  RowCountMap::const_iterator last = m_rows.upper_bound(end_row);
+  uint64_t total = 0;
+  uint64_t sum = 0;
+
+  for (RowCountMap::const_iterator iter = begin; iter != last; ++iter)
+    total += iter->second;
+
+  // Need at least two sampled rows, and the split row must be below the
+  // highest one
+  if (begin == last || begin == --last)
+    return false;
+
+  for (RowCountMap::const_iterator iter = begin; iter != last; ++iter) {
+    split_row = iter->first;
+    sum += iter->second;
+    if (2 * sum >= total)
+      break;
+  }
+  return true;
+}
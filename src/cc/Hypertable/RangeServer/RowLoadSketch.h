@@ -0,0 +1,118 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_ROWLOADSKETCH_H
+#define HYPERTABLE_ROWLOADSKETCH_H
+
+#include <map>
+
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /**
+   * Approximate per-row access frequencies for a range.  One in every
+   * sample_interval accesses (cells written or scans started) is counted
+   * against its row.  The number of distinct rows tracked is bounded by
+   * halving all counts whenever the bound is exceeded, and decay() halves
+   * them once per maintenance interval so that the sketch follows the
+   * current workload.  The row at which the sampled load divides in half is
+   * used as a split point for ranges that are hot rather than large.
+   *
+   * This class is not thread safe.  Range accesses it under its schema
+   * mutex, which is already held on the update and scanner creation paths.
+   */
+  class RowLoadSketch {
+  public:
+    /**
+     * @param sample_interval count one of every this many accesses
+     * @param max_rows maximum number of distinct sampled rows to track
+     */
+    RowLoadSketch(uint32_t sample_interval, size_t max_rows)
+      : m_sample_interval(sample_interval ? sample_interval : 1),
+        m_max_rows(max_rows), m_accesses(0), m_samples(0) { }
+
+    /** Records an access to row */
+    void record(const char *row) {
+      if (++m_accesses % m_sample_interval)
+        return;
+      m_rows[row]++;
+      m_samples++;
+      if (m_rows.size() > m_max_rows)
+        trim();
+    }
+
+    /** Returns the number of accesses recorded since the last decay() */
+    uint64_t accesses() const { return m_accesses; }
+
+    /** Halves the sampled counts and resets the access counter */
+    void decay();
+
+    /**
+     * Finds the row that divides the sampled load in half.  The row
+     * returned lies strictly inside (start_row, end_row) and is not the
+     * highest sampled row, so some of the load ends up on each side of
+     * a split at that row.
+     *
+     * @param start_row start row of the range (exclusive)
+     * @param end_row end row of the range (inclusive)
+     * @param split_row set to the load median
+     * @return false if the sampled load can't be divided
+     */
+    bool median(const String &start_row, const String &end_row,
+                String &split_row) const;
+
+    /**
+     * Decides whether the range should be split because of load.  The
+     * access rate since the last call is compared against threshold, the
+     * counts are aged with decay(), and the load median is returned only if
+     * the rate is high enough and median() can divide the load.  A range
+     * whose load sits on a single row is therefore never asked to split.
+     *
+     * @param elapsed seconds since the previous call
+     * @param threshold accesses per second at which to split (0 disables)
+     * @param start_row start row of the range (exclusive)
+     * @param end_row end row of the range (inclusive)
+     * @param split_row set to the load median
+     * @return true if the range should be split at split_row
+     */
+    bool check_split(uint64_t elapsed, uint64_t threshold,
+                     const String &start_row, const String &end_row,
+                     String &split_row);
+
+    /** Discards all samples, for when the range boundaries change */
+    void clear() { m_rows.clear(); m_accesses = m_samples = 0; }
+
+  private:
+    void trim();
+
+    typedef std::map<String, uint32_t> RowCountMap;
+
+    uint32_t    m_sample_interval;
+    size_t      m_max_rows;
+    uint64_t    m_accesses;
+    uint64_t    m_samples;
+    RowCountMap m_rows;
+  };
+
+}
+
+#endif // HYPERTABLE_ROWLOADSKETCH_H
@@ -102,6 +102,7 @@ ScanContext::initialize(int64_t rev, const ScanSpec *ss,
         }
         if (cf->counter)
           family_info[cf->id].counter = true;
+        family_info[cf->id].merge_op = schema->get_merge_operator(cf->id);
       }
     }
     else {
@@ -139,6 +140,8 @@ ScanContext::initialize(int64_t rev, const ScanSpec *ss,
           }
           if ((*cf_it)->counter)
             family_info[(*cf_it)->id].counter = true;
+          family_info[(*cf_it)->id].merge_op =
+            schema->get_merge_operator((*cf_it)->id);
         }
       }
     }
@@ -265,6 +268,28 @@ ScanContext::initialize(int64_t rev, const ScanSpec *ss,
       end_row = Key::END_ROW_MARKER;
     }
 
+    // narrow the row interval to the literal prefix of an anchored row regexp
+    if (spec->row_regexp && *spec->row_regexp != 0 && !has_cell_interval
+        && !spec->scan_and_filter_rows) {
+      String prefix_start, prefix_end;
+      if (ScanSpec::row_regexp_interval(spec->row_regexp, prefix_start,
+                                        prefix_end)) {
+        if (start_row.compare(prefix_start) < 0) {
+          start_row = prefix_start;
+          start_inclusive = true;
+        }
+        if (prefix_end != "" && end_row.compare(prefix_end) >= 0) {
+          end_row = prefix_end;
+          end_inclusive = false;
+        }
+        // regexp can't match any row of the interval, scan nothing
+        if (start_row.compare(end_row) > 0) {
+          end_row = start_row;
+          end_inclusive = false;
+        }
+      }
+    }
+
     if (start_row.compare(end_row) > 0)
       HT_THROW(Error::RANGESERVER_BAD_SCAN_SPEC, "start_row > end_row");
   }
@@ -45,12 +45,13 @@ namespace Hypertable {
   class CellFilterInfo {
   public:
     CellFilterInfo(): cutoff_time(0), max_versions(0), counter(false),
-        filter_by_exact_qualifier(false), filter_by_regexp_qualifier(false) {}
+        merge_op(0), filter_by_exact_qualifier(false), filter_by_regexp_qualifier(false) {}
 
     CellFilterInfo(const CellFilterInfo& other) {
       cutoff_time = other.cutoff_time;
       max_versions = other.max_versions;
       counter = other.counter;
+      merge_op = other.merge_op;
       regexp_qualifiers.clear();
       for (size_t ii=0; ii<other.regexp_qualifiers.size(); ++ii) {
         regexp_qualifiers.push_back( new RE2(other.regexp_qualifiers[ii]->pattern()) );
@@ -102,9 +103,13 @@ namespace Hypertable {
     }
     bool has_qualifier_regexp_filter() const { return regexp_qualifiers.size()>0;}
 
+    /** True if all versions of a cell are folded into a single value */
+    bool merges_versions() const { return counter || merge_op != 0; }
+
     int64_t  cutoff_time;
     uint32_t max_versions;
     bool counter;
+    MergeOperator *merge_op;
   private:
     // disable assignment -- if needed then implement with deep copy of
     // qualifier_regexp
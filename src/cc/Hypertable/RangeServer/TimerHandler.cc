@@ -44,7 +44,7 @@ using namespace Hypertable::Config;
 TimerHandler::TimerHandler(Comm *comm, RangeServer *range_server)
   : m_comm(comm), m_range_server(range_server),
     m_last_low_memory_maintenance(TIMESTAMP_NULL),
-    m_urgent_maintenance_scheduled(false), m_app_queue_paused(false),
+    m_urgent_maintenance_scheduled(false), m_low_memory_mode(false),
     m_low_physical_memory(false), m_maintenance_outstanding(false) {
   int error;
   int32_t maintenance_interval;
@@ -96,10 +96,9 @@ void TimerHandler::complete_maintenance_notify() {
   ScopedLock lock(m_mutex);
   m_maintenance_outstanding = false;
   boost::xtime_get(&m_last_maintenance, TIME_UTC);
-  if (m_app_queue_paused) {
-    if (!low_memory_mode()) {
-      restart_app_queue();
-    }
+  if (m_low_memory_mode || Global::update_throttle->level()) {
+    if (!low_memory_mode() && m_low_memory_mode)
+      leave_low_memory_mode();
   }
 }
 
@@ -120,16 +119,23 @@ void TimerHandler::handle(Hypertable::EventPtr &event_ptr) {
     return;
   }
 
-  if (m_range_server->replay_finished() && low_memory_mode()) {
-    if (!m_app_queue_paused) {
-      HT_INFO("Pausing application queue due to low memory condition");
-      m_app_queue_paused = true;
-      m_app_queue->stop();
-      m_current_interval = 500;
+  // Low memory no longer pauses the application queue, updates are
+  // throttled instead (see low_memory_mode()) and scans keep flowing
+  if (m_range_server->replay_finished()) {
+    if (low_memory_mode()) {
+      if (!m_low_memory_mode) {
+        HT_INFO("Entering low memory mode, holding back updates");
+        m_low_memory_mode = true;
+      }
     }
-  }
-  else if (m_app_queue_paused) {
-    restart_app_queue();
+    else if (m_low_memory_mode)
+      leave_low_memory_mode();
+    // The throttle is only sampled here, so its growth rate is measured
+    // over whole timer intervals
+    Global::update_throttle->adjust(Global::memory_tracker->balance(),
+                                    Global::memory_limit);
+    // Sample memory frequently while the throttle is engaged
+    m_current_interval = Global::update_throttle->level() ? 500 : m_timer_interval;
   }
 
   if (low_memory()) {
@@ -167,13 +173,11 @@ void TimerHandler::handle(Hypertable::EventPtr &event_ptr) {
   }
 }
 
-void TimerHandler::restart_app_queue() {
-  HT_ASSERT(m_app_queue_paused);
-  HT_INFO("Restarting application queue");
-  m_app_queue->start();
-  m_app_queue_paused = false;
+void TimerHandler::leave_low_memory_mode() {
+  HT_ASSERT(m_low_memory_mode);
+  HT_INFO("Leaving low memory mode");
+  m_low_memory_mode = false;
   m_last_low_memory_maintenance = TIMESTAMP_NULL;
-  m_current_interval = m_timer_interval;
 }
 
 bool TimerHandler::low_memory_mode() {
@@ -198,5 +202,6 @@ bool TimerHandler::low_memory_mode() {
     // don't care
     m_low_physical_memory = false;
   }
+
   return memory_used > Global::memory_limit;
 }
@@ -42,7 +42,7 @@ namespace Hypertable {
     virtual void handle(Hypertable::EventPtr &event_ptr);
     virtual void schedule_maintenance();
     virtual void complete_maintenance_notify();
-    virtual bool low_memory() { return m_app_queue_paused || m_low_physical_memory; }
+    virtual bool low_memory() { return m_low_memory_mode || m_low_physical_memory; }
 
   private:
     Comm         *m_comm;
@@ -53,12 +53,12 @@ namespace Hypertable {
     int32_t       m_current_interval;
     int64_t       m_last_low_memory_maintenance;
     bool          m_urgent_maintenance_scheduled;
-    bool          m_app_queue_paused;
+    bool          m_low_memory_mode;
     bool          m_low_physical_memory;
     boost::xtime  m_last_maintenance;
     bool          m_maintenance_outstanding;
 
-    void restart_app_queue();
+    void leave_low_memory_mode();
     bool low_memory_mode();
   };
   typedef boost::intrusive_ptr<TimerHandler> TimerHandlerPtr;
@@ -0,0 +1,145 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+#include "Common/Time.h"
+
+#include <algorithm>
+
+#include "UpdateThrottle.h"
+
+using namespace Hypertable;
+
+namespace {
+  /** Per-table byte counts below this are dropped from the share map */
+  const double MIN_TRACKED_BYTES = 1024.0;
+}
+
+
+UpdateThrottle::UpdateThrottle(int32_t low_watermark, int32_t max_delay,
+                               int32_t horizon)
+  : m_low_watermark(low_watermark), m_max_delay(max_delay),
+    m_horizon(horizon), m_level(0), m_last_used(0), m_last_time(0),
+    m_total_bytes(0.0), m_throttled(0), m_delay_millis(0) {
+  if (m_low_watermark < 0 || m_low_watermark > 100)
+    m_low_watermark = 100;
+  if (m_max_delay < 0)
+    m_max_delay = 0;
+}
+
+
+double UpdateThrottle::pressure(int64_t memory_used, int64_t memory_limit) {
+  int64_t low = (memory_limit / 100) * m_low_watermark;
+
+  if (memory_used <= low)
+    return 0.0;
+  if (memory_used >= memory_limit || low >= memory_limit)
+    return 1.0;
+  return (double)(memory_used - low) / (double)(memory_limit - low);
+}
+
+
+void UpdateThrottle::adjust(int64_t memory_used, int64_t memory_limit) {
+  ScopedLock lock(m_mutex);
+  int64_t now = get_ts64();
+  double target = pressure(memory_used, memory_limit);
+
+  if (m_last_time && now > m_last_time) {
+    double seconds = (double)(now - m_last_time) / 1000000000.0;
+    double rate = (double)(memory_used - m_last_used) / seconds;
+    int64_t projected = memory_used +
+      (int64_t)(rate * ((double)m_horizon / 1000.0));
+    double projected_pressure = pressure(projected, memory_limit);
+
+    // Growing: act on where the balance is headed.  Shrinking: compactions
+    // are winning, so relax towards the projected pressure.
+    if (rate > 0)
+      target = std::max(target, projected_pressure);
+    else
+      target = (target + projected_pressure) / 2.0;
+  }
+  m_last_used = memory_used;
+  m_last_time = now;
+
+  int32_t level;
+  if (memory_used > memory_limit)
+    level = 100;
+  else
+    level = std::min((int32_t)(target * 100.0), (int32_t)99);
+
+  // Rise immediately, fall off gradually to avoid oscillation
+  if (level < m_level)
+    level = std::max(level, m_level / 2);
+
+  // Only log when throttling starts, saturates or stops
+  if ((level == 0) != (m_level == 0) || (level == 100) != (m_level == 100))
+    HT_INFOF("Update throttle level %d -> %d (memory used %lld, limit %lld)",
+             (int)m_level, (int)level, (Lld)memory_used, (Lld)memory_limit);
+  m_level = level;
+
+  // Age the per-table shares
+  m_total_bytes = 0.0;
+  for (TableBytesMap::iterator iter = m_table_bytes.begin();
+       iter != m_table_bytes.end(); ) {
+    iter->second /= 2.0;
+    if (iter->second < MIN_TRACKED_BYTES)
+      m_table_bytes.erase(iter++);
+    else {
+      m_total_bytes += iter->second;
+      ++iter;
+    }
+  }
+}
+
+
+uint32_t UpdateThrottle::delay(const char *table_id, uint64_t bytes) {
+  ScopedLock lock(m_mutex);
+  double &table_bytes = m_table_bytes[table_id];
+
+  table_bytes += (double)bytes;
+  m_total_bytes += (double)bytes;
+
+  if (m_level == 0 || m_max_delay == 0)
+    return 0;
+
+  // Weight by the table's share of recent update bytes relative to an
+  // even split across the tables being written
+  double weight = (table_bytes / m_total_bytes) * m_table_bytes.size();
+  if (weight > 1.0)
+    weight = 1.0;
+
+  uint32_t millis = (uint32_t)(((double)m_level / 100.0) * weight * m_max_delay);
+  if (millis) {
+    m_throttled++;
+    m_delay_millis += millis;
+  }
+  return millis;
+}
+
+
+void UpdateThrottle::get_stats(int32_t *levelp, uint64_t *throttledp,
+                               uint64_t *delay_millisp) {
+  ScopedLock lock(m_mutex);
+  *levelp = m_level;
+  *throttledp = m_throttled;
+  *delay_millisp = m_delay_millis;
+}
@@ -0,0 +1,106 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#ifndef HYPERTABLE_UPDATETHROTTLE_H
+#define HYPERTABLE_UPDATETHROTTLE_H
+
+#include <map>
+
+#include "Common/Mutex.h"
+#include "Common/String.h"
+
+namespace Hypertable {
+
+  /**
+   * Proportional backpressure for the update pipeline.  The throttle level
+   * (0-100) is recomputed from the memory balance every time adjust() is
+   * called.  It starts rising once memory use passes the low watermark and
+   * reaches 100 (saturated) when memory use exceeds the limit.  The net
+   * growth rate of the balance is extrapolated over a short horizon.  That
+   * rate includes what compactions free, so the level rises early when
+   * ingest outpaces compaction and eases off once compactions catch up.
+   *
+   * Update batches are delayed by up to max_delay milliseconds, scaled by
+   * the level and by the share of recent update bytes that belongs to the
+   * table being written.  Tables writing their fair share or more get the
+   * full delay and lighter tables get proportionally less.  While the
+   * throttle is saturated user updates are held back entirely.  Scans and
+   * system table updates are never throttled.
+   */
+  class UpdateThrottle {
+  public:
+    /**
+     * @param low_watermark percentage of the memory limit at which
+     *        throttling begins
+     * @param max_delay maximum delay in milliseconds applied to an update
+     * @param horizon milliseconds over which the growth rate of the memory
+     *        balance is extrapolated
+     */
+    UpdateThrottle(int32_t low_watermark, int32_t max_delay, int32_t horizon);
+
+    /**
+     * Recomputes the throttle level.
+     *
+     * @param memory_used current memory balance
+     * @param memory_limit memory limit of the range server
+     */
+    void adjust(int64_t memory_used, int64_t memory_limit);
+
+    /**
+     * Accounts for an update to a table and returns how long it should be
+     * delayed.
+     *
+     * @param table_id table being updated
+     * @param bytes size of the update
+     * @return delay in milliseconds
+     */
+    uint32_t delay(const char *table_id, uint64_t bytes);
+
+    /** Returns the current throttle level (0-100) */
+    int32_t level() { ScopedLock lock(m_mutex); return m_level; }
+
+    /** Returns true if user updates should be held back entirely */
+    bool saturated() { ScopedLock lock(m_mutex); return m_level >= 100; }
+
+    void get_stats(int32_t *levelp, uint64_t *throttledp,
+                   uint64_t *delay_millisp);
+
+  private:
+    double pressure(int64_t memory_used, int64_t memory_limit);
+
+    typedef std::map<String, double> TableBytesMap;
+
+    Mutex         m_mutex;
+    int32_t       m_low_watermark;
+    int32_t       m_max_delay;
+    int32_t       m_horizon;
+    int32_t       m_level;
+    int64_t       m_last_used;
+    int64_t       m_last_time;
+    TableBytesMap m_table_bytes;
+    double        m_total_bytes;
+    uint64_t      m_throttled;
+    uint64_t      m_delay_millis;
+  };
+
+}
+
+#endif // HYPERTABLE_UPDATETHROTTLE_H
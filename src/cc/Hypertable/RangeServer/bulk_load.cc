@@ -0,0 +1,623 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+extern "C" {
+#include <poll.h>
+}
+
+#include "AsyncComm/Comm.h"
+#include "AsyncComm/ConnectionManager.h"
+
+#include "Common/Init.h"
+#include "Common/ByteString.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Logger.h"
+#include "Common/Stopwatch.h"
+#include "Common/Time.h"
+#include "Common/Timer.h"
+
+#include "DfsBroker/Lib/Client.h"
+
+#include "Hypertable/Lib/Client.h"
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/LoadDataEscape.h"
+#include "Hypertable/Lib/LoadDataSourceFactory.h"
+#include "Hypertable/Lib/RangeServerClient.h"
+#include "Hypertable/Lib/SerializedKey.h"
+
+#include "Config.h"
+#include "CellStoreFactory.h"
+#include "CellStoreV6.h"
+#include "Global.h"
+#include "ScanContext.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+  struct AppPolicy : Config::Policy {
+    static void init_options() {
+      cmdline_desc("Usage: %s [options] <table> <file>...\n\n"
+        "Builds CellStores for <table> from the given input files, which are\n"
+        "in the LOAD DATA INFILE format, and attaches them to the table's\n"
+        "ranges.  The CellStores are partitioned on the range boundaries\n"
+        "currently recorded in METADATA, and re-partitioned if ranges split\n"
+        "or move before they are attached.  Input larger than the memory\n"
+        "limit is sorted in runs, which are merged so that each access group\n"
+        "of a range gets one CellStore.  The data does not pass through\n"
+        "the commit log or the cell caches.\n\nOptions").add_options()
+        ("namespace", str()->default_value("/"),
+         "Namespace containing <table>")
+        ("memory-limit", i64()->default_value(256*M),
+         "Amount of input to sort in memory before writing a run of "
+         "CellStores (runs are merged before they are attached)")
+        ("no-attach", "Build the CellStores but don't attach them")
+        ("no-escape", "Don't unescape \\n, \\t, \\0 and \\\\ in the input")
+        ("row-uniquify-chars", i32()->default_value(0),
+         "Number of random characters to append to each row key")
+        ;
+      cmdline_hidden_desc().add_options()
+        ("table", str(), "")
+        ("file", strs(), "");
+      cmdline_positional_desc().add("table", 1).add("file", -1);
+    }
+    static void init() {
+      if (!has("table") || !has("file")) {
+        HT_ERROR_OUT << "table and at least one input file required" << HT_END;
+        cout << cmdline_desc() << endl;
+        exit(1);
+      }
+    }
+  };
+
+  typedef Meta::list<AppPolicy, DfsClientPolicy, DefaultClientPolicy>
+          Policies;
+
+  /** Cells are written with this revision so that the CellStore trailer
+   * revision stays below anything in the commit log.  The trailer revision
+   * decides which commit log entries are skipped on replay. */
+  const int64_t BULK_LOAD_REVISION = 1;
+
+  /** Rounds of re-partitioning after ranges split or move under us */
+  const int MAX_REPARTITION_ATTEMPTS = 10;
+
+  struct BulkRange {
+    String start_row;
+    String end_row;
+    String location;
+    vector<String> access_groups;
+    vector<String> files;
+  };
+
+  struct BulkAccessGroup {
+    Schema::AccessGroup *ag;
+    PropertiesPtr props;
+    vector<size_t> offsets;
+  };
+
+  struct MergeSource {
+    CellListScannerPtr scanner;
+    Key key;
+    ByteString value;
+  };
+
+  struct LtMergeSource {
+    bool operator()(const MergeSource *ms1, const MergeSource *ms2) const {
+      return ms1->key.serial > ms2->key.serial;
+    }
+  };
+
+  struct SerializedKeyOffsetLt {
+    SerializedKeyOffsetLt(const DynamicBuffer &buf) : base(buf.base) { }
+    bool operator()(size_t o1, size_t o2) const {
+      return SerializedKey(base + o1) < SerializedKey(base + o2);
+    }
+    const uint8_t *base;
+  };
+
+  void load_ranges(TablePtr &metadata, const TableIdentifier &table,
+                   vector<BulkRange> &ranges) {
+    ScanSpec scan_spec;
+    Cell cell;
+    String start = format("%s:", table.id);
+    String end = format("%s:%s", table.id, Key::END_ROW_MARKER);
+    BulkRange *range = 0;
+
+    scan_spec.row_intervals.push_back(RowInterval(start.c_str(), true,
+                                                  end.c_str(), true));
+    scan_spec.columns.push_back("StartRow");
+    scan_spec.columns.push_back("Location");
+    scan_spec.max_versions = 1;
+
+    TableScannerPtr scanner = metadata->create_scanner(scan_spec);
+    while (scanner->next(cell)) {
+      String end_row = strchr(cell.row_key, ':') + 1;
+      if (range == 0 || range->end_row != end_row) {
+        ranges.push_back(BulkRange());
+        range = &ranges.back();
+        range->end_row = end_row;
+      }
+      if (!strcmp(cell.column_family, "StartRow"))
+        range->start_row = String((const char *)cell.value, cell.value_len);
+      else
+        range->location = String((const char *)cell.value, cell.value_len);
+    }
+
+    if (ranges.empty())
+      HT_THROWF(Error::RANGESERVER_RANGE_NOT_FOUND,
+                "No ranges found in METADATA for table %s", table.id);
+  }
+
+  /**
+   * Sorts the buffered cells of each access group and writes one CellStore
+   * per range that received cells.
+   */
+  void write_run(DynamicBuffer &buf, vector<BulkAccessGroup> &ags,
+                 vector<BulkRange> &ranges, TableIdentifier &table,
+                 SchemaPtr &schema, const String &staging_dir, int run) {
+    Key key;
+    ByteString value;
+
+    for (size_t i=0; i<ags.size(); i++) {
+      vector<size_t> &offsets = ags[i].offsets;
+
+      if (offsets.empty())
+        continue;
+
+      sort(offsets.begin(), offsets.end(), SerializedKeyOffsetLt(buf));
+
+      size_t ri = 0;
+      size_t begin = 0;
+      while (begin < offsets.size()) {
+        key.load(SerializedKey(buf.base + offsets[begin]));
+        while (ri+1 < ranges.size() && ranges[ri].end_row.compare(key.row) < 0)
+          ri++;
+
+        size_t end = begin;
+        do {
+          key.load(SerializedKey(buf.base + offsets[end]));
+          if (ri+1 < ranges.size() && ranges[ri].end_row.compare(key.row) < 0)
+            break;
+        } while (++end < offsets.size());
+
+        String fname = format("%s/%s-%u-%d", staging_dir.c_str(),
+                              ags[i].ag->name.c_str(), (unsigned)ri, run);
+        CellStorePtr cellstore = new CellStoreV6(Global::dfs.get(),
+                                                 schema.get());
+        cellstore->create(fname.c_str(), end - begin, ags[i].props, &table);
+        for (size_t j=begin; j<end; j++) {
+          key.load(SerializedKey(buf.base + offsets[j]));
+          value.ptr = buf.base + offsets[j] + key.length;
+          cellstore->add(key, value);
+        }
+        cellstore->finalize(&table);
+
+        ranges[ri].access_groups.push_back(ags[i].ag->name);
+        ranges[ri].files.push_back(fname);
+        begin = end;
+      }
+      offsets.clear();
+    }
+    buf.clear();
+  }
+
+  /**
+   * Merges the files that different runs wrote for the same range and
+   * access group into a single CellStore, so a range is attached at most
+   * one new CellStore per access group however many runs the input took.
+   */
+  void merge_runs(vector<BulkRange> &ranges, vector<BulkAccessGroup> &ags,
+                  TableIdentifier &table, SchemaPtr &schema,
+                  const String &staging_dir, int &run) {
+    map<String, size_t> ag_index;
+
+    for (size_t i=0; i<ags.size(); i++)
+      ag_index[ags[i].ag->name] = i;
+
+    for (size_t ri=0; ri<ranges.size(); ri++) {
+      BulkRange &range = ranges[ri];
+      vector<String> access_groups;
+      vector<String> files;
+
+      for (size_t i=0; i<ags.size(); i++) {
+        vector<String> inputs;
+        for (size_t j=0; j<range.files.size(); j++) {
+          if (range.access_groups[j] == ags[i].ag->name)
+            inputs.push_back(range.files[j]);
+        }
+        if (inputs.size() <= 1) {
+          if (!inputs.empty()) {
+            access_groups.push_back(ags[i].ag->name);
+            files.push_back(inputs[0]);
+          }
+          continue;
+        }
+
+        vector<MergeSource> sources(inputs.size());
+        priority_queue<MergeSource *, vector<MergeSource *>, LtMergeSource> queue;
+        ScanContextPtr scan_ctx = new ScanContext(schema);
+        int64_t total_entries = 0;
+
+        for (size_t j=0; j<inputs.size(); j++) {
+          CellStorePtr input = CellStoreFactory::open(inputs[j], "",
+                                                      Key::END_ROW_MARKER);
+          total_entries += input->get_total_entries();
+          sources[j].scanner = input->create_scanner(scan_ctx);
+          if (sources[j].scanner->get(sources[j].key, sources[j].value))
+            queue.push(&sources[j]);
+        }
+
+        String fname = format("%s/%s-%u-%d", staging_dir.c_str(),
+                              ags[i].ag->name.c_str(), (unsigned)ri, run++);
+        CellStorePtr cellstore = new CellStoreV6(Global::dfs.get(),
+                                                 schema.get());
+        cellstore->create(fname.c_str(), total_entries, ags[i].props, &table);
+        while (!queue.empty()) {
+          MergeSource *source = queue.top();
+          queue.pop();
+          cellstore->add(source->key, source->value);
+          source->scanner->forward();
+          if (source->scanner->get(source->key, source->value))
+            queue.push(source);
+        }
+        cellstore->finalize(&table);
+        sources.clear();
+
+        foreach(const String &input, inputs)
+          Global::dfs->remove(input);
+
+        access_groups.push_back(ags[i].ag->name);
+        files.push_back(fname);
+      }
+
+      range.access_groups.swap(access_groups);
+      range.files.swap(files);
+    }
+  }
+
+  String range_name(const TableIdentifier &table, const BulkRange &range) {
+    return format("%s[%s..%s]", table.id, range.start_row.c_str(),
+                  range.end_row.c_str());
+  }
+
+  /**
+   * Attaches the files of each range.  Ranges that split or moved since
+   * their files were cut are appended to retry, ranges that failed for
+   * any other reason, or stayed busy for longer than timeout milliseconds,
+   * to failed.
+   */
+  void attach(RangeServerClientPtr &client, vector<BulkRange> &ranges,
+              TableIdentifier &table, uint32_t timeout,
+              vector<BulkRange> &retry, vector<BulkRange> &failed) {
+    CommAddress addr;
+    RangeSpec spec;
+
+    foreach(BulkRange &range, ranges) {
+      if (range.files.empty())
+        continue;
+      addr.set_proxy(range.location);
+      spec.start_row = range.start_row.c_str();
+      spec.end_row = range.end_row.c_str();
+      Timer timer(timeout, true);
+      while (true) {
+        try {
+          client->attach_cell_stores(addr, table, spec, range.access_groups,
+                                     range.files);
+          cout << "Attached " << range.files.size() << " CellStores to "
+               << range_name(table, range) << "\n";
+          break;
+        }
+        catch (Exception &e) {
+          if (e.code() == Error::RANGESERVER_RANGE_BUSY && !timer.expired()) {
+            HT_INFOF("Range %s busy, retrying",
+                     range_name(table, range).c_str());
+            poll(0, 0, std::min((uint32_t)1000, timer.remaining()));
+            continue;
+          }
+          if (e.code() == Error::RANGESERVER_RANGE_MISMATCH ||
+              e.code() == Error::RANGESERVER_RANGE_NOT_FOUND) {
+            HT_INFOF("Range %s changed (%s), re-partitioning",
+                     range_name(table, range).c_str(),
+                     Error::get_text(e.code()));
+            retry.push_back(range);
+          }
+          else {
+            HT_ERROR_OUT << "Problem attaching CellStores to "
+                         << range_name(table, range) << " - " << e << HT_END;
+            failed.push_back(range);
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  /**
+   * Assigns the files of ranges in retry to the ranges now recorded in
+   * METADATA.  Files of a range whose boundaries are unchanged (it only
+   * moved) are kept as they are; the others are read back and cut again
+   * on the new boundaries.
+   */
+  void repartition(vector<BulkRange> &retry, vector<BulkRange> &ranges,
+                   vector<BulkAccessGroup> &ags, TableIdentifier &table,
+                   SchemaPtr &schema, const String &staging_dir,
+                   int64_t memory_limit, int &run) {
+    DynamicBuffer buf(0);
+    vector<String> recut_files;
+    map<String, size_t> ag_index;
+    Key key;
+    ByteString value;
+
+    for (size_t i=0; i<ags.size(); i++)
+      ag_index[ags[i].ag->name] = i;
+
+    foreach(BulkRange &old_range, retry) {
+      BulkRange *same = 0;
+      foreach(BulkRange &range, ranges) {
+        if (range.start_row == old_range.start_row &&
+            range.end_row == old_range.end_row)
+          same = &range;
+      }
+      if (same) {
+        same->access_groups.insert(same->access_groups.end(),
+            old_range.access_groups.begin(), old_range.access_groups.end());
+        same->files.insert(same->files.end(), old_range.files.begin(),
+                           old_range.files.end());
+        continue;
+      }
+
+      for (size_t i=0; i<old_range.files.size(); i++) {
+        BulkAccessGroup &bag = ags[ag_index[old_range.access_groups[i]]];
+        CellStorePtr cellstore = CellStoreFactory::open(old_range.files[i],
+            "", Key::END_ROW_MARKER);
+        ScanContextPtr scan_ctx = new ScanContext(schema);
+        CellListScannerPtr scanner = cellstore->create_scanner(scan_ctx);
+        while (scanner->get(key, value)) {
+          bag.offsets.push_back(buf.fill());
+          buf.add(key.serial.ptr, key.length);
+          buf.add(value.ptr, value.length());
+          scanner->forward();
+          if ((int64_t)buf.fill() >= memory_limit)
+            write_run(buf, ags, ranges, table, schema, staging_dir, run++);
+        }
+        recut_files.push_back(old_range.files[i]);
+      }
+    }
+    write_run(buf, ags, ranges, table, schema, staging_dir, run++);
+
+    foreach(const String &fname, recut_files)
+      Global::dfs->remove(fname);
+  }
+
+} // local namespace
+
+
+int main(int argc, char **argv) {
+  try {
+    init_with_policies<Policies>(argc, argv);
+
+    String table_name = get_str("table");
+    vector<String> files = get_strs("file");
+    int64_t memory_limit = get_i64("memory-limit");
+    int32_t row_uniquify_chars = get_i32("row-uniquify-chars");
+    bool escape = !has("no-escape");
+    bool no_attach = has("no-attach");
+    int timeout = get_i32("timeout");
+    Stopwatch stopwatch;
+
+    ClientPtr client = new Hypertable::Client();
+    NamespacePtr ns = client->open_namespace(get_str("namespace"));
+    TablePtr table = ns->open_table(table_name);
+    NamespacePtr root_ns = client->open_namespace("/");
+    TablePtr metadata = root_ns->open_table(TableIdentifier::METADATA_NAME);
+
+    TableIdentifierManaged table_id;
+    SchemaPtr schema;
+    table->get(table_id, schema);
+
+    if (table_id.is_system())
+      HT_THROWF(Error::NOT_ALLOWED, "Bulk load into system table %s",
+                table_name.c_str());
+
+    vector<BulkRange> ranges;
+    load_ranges(metadata, table_id, ranges);
+
+    ConnectionManagerPtr conn_mgr = new ConnectionManager();
+    DfsBroker::Client *dfs = new DfsBroker::Client(conn_mgr, properties);
+
+    if (!dfs->wait_for_connection(timeout)) {
+      cerr << "error: timed out waiting for DFS broker" << endl;
+      exit(1);
+    }
+
+    Global::dfs = dfs;
+    Global::block_cache = new FileBlockCache(200000000LL, 200000000LL);
+    Global::memory_tracker = new MemoryTracker(Global::block_cache);
+
+    String toplevel_dir = get_str("Hypertable.Directory");
+    boost::trim_if(toplevel_dir, boost::is_any_of("/"));
+    // Attached files stay where they are, so they are staged under the
+    // table directory where the 'Files' column can name them
+    String staging_dir = format("/%s/tables/%s/bulk-%lld",
+                                toplevel_dir.c_str(), table_id.id,
+                                (Lld)get_ts64());
+    Global::dfs->mkdirs(staging_dir);
+
+    // Column family code to access group index; counters and merge
+    // operators need the range server to combine cells, so they are refused
+    vector<BulkAccessGroup> ags;
+    map<String, size_t> cf_ag;
+    foreach(Schema::AccessGroup *ag, schema->get_access_groups()) {
+      BulkAccessGroup bag;
+      bag.ag = ag;
+      bag.props = new Properties();
+      bag.props->set("compressor", ag->compressor.size() ?
+                     ag->compressor : schema->get_compressor());
+      bag.props->set("blocksize", ag->blocksize);
+      if (ag->replication != -1)
+        bag.props->set("replication", (int32_t)ag->replication);
+      Schema::parse_bloom_filter(ag->bloom_filter.size() ? ag->bloom_filter :
+          get_str("Hypertable.RangeServer.CellStore.DefaultBloomFilter"),
+          bag.props);
+      foreach(Schema::ColumnFamily *cf, ag->columns) {
+        if (cf->deleted)
+          continue;
+        if (cf->counter || !cf->merge_operator.empty())
+          HT_THROWF(Error::NOT_ALLOWED, "Column family '%s' can't be bulk "
+                    "loaded", cf->name.c_str());
+        cf_ag[cf->name] = ags.size();
+      }
+      ags.push_back(bag);
+    }
+
+    DfsBroker::ClientPtr dfs_client = dfs;
+    DynamicBuffer buf(memory_limit + memory_limit/8);
+    LoadDataEscape row_escaper;
+    LoadDataEscape qualifier_escaper;
+    LoadDataEscape value_escaper;
+    const char *escaped_buf;
+    size_t escaped_len;
+    KeySpec key;
+    uint8_t *value;
+    uint32_t value_len;
+    uint32_t consumed;
+    bool is_delete;
+    int64_t base_ts = get_ts64();
+    int64_t seq = 0;
+    uint64_t total_cells = 0;
+    uint64_t total_bytes = 0;
+    int run = 0;
+
+    foreach(const String &fname, files) {
+      LoadDataSourcePtr lds = LoadDataSourceFactory::create(dfs_client,
+          fname, LOCAL_FILE, String(), 0, vector<String>(), String(),
+          row_uniquify_chars);
+
+      while (lds->next(&key, &value, &value_len, &is_delete, &consumed)) {
+        if (is_delete)
+          HT_THROWF(Error::NOT_ALLOWED, "Delete at line %lld of %s can't be "
+                    "bulk loaded", (Lld)lds->get_current_lineno(),
+                    fname.c_str());
+
+        map<String, size_t>::iterator iter = cf_ag.find(key.column_family);
+        if (iter == cf_ag.end())
+          HT_THROWF(Error::BAD_KEY, "Bad column family '%s' at line %lld of "
+                    "%s", key.column_family, (Lld)lds->get_current_lineno(),
+                    fname.c_str());
+
+        if (escape) {
+          row_escaper.unescape((const char *)key.row, (size_t)key.row_len,
+                               &escaped_buf, &escaped_len);
+          key.row = escaped_buf;
+          qualifier_escaper.unescape(key.column_qualifier,
+              (size_t)key.column_qualifier_len, &escaped_buf, &escaped_len);
+          key.column_qualifier = escaped_buf;
+          value_escaper.unescape((const char *)value, (size_t)value_len,
+                                 &escaped_buf, &escaped_len);
+        }
+        else {
+          escaped_buf = (const char *)value;
+          escaped_len = (size_t)value_len;
+        }
+
+        if (key.timestamp == AUTO_ASSIGN)
+          key.timestamp = base_ts + seq++;
+
+        Schema::ColumnFamily *cf = schema->get_column_family(key.column_family);
+        ags[iter->second].offsets.push_back(buf.fill());
+        create_key_and_append(buf, FLAG_INSERT, (const char *)key.row,
+                              (uint8_t)cf->id, key.column_qualifier,
+                              key.timestamp, BULK_LOAD_REVISION);
+        append_as_byte_string(buf, escaped_buf, escaped_len);
+
+        total_cells++;
+        total_bytes += consumed;
+
+        if ((int64_t)buf.fill() >= memory_limit)
+          write_run(buf, ags, ranges, table_id, schema, staging_dir, run++);
+      }
+    }
+    write_run(buf, ags, ranges, table_id, schema, staging_dir, run++);
+    merge_runs(ranges, ags, table_id, schema, staging_dir, run);
+
+    double build_secs = stopwatch.elapsed();
+
+    vector<BulkRange> failed;
+    if (!no_attach) {
+      RangeServerClientPtr rs_client =
+        new RangeServerClient(Comm::instance(), timeout);
+      vector<BulkRange> retry;
+
+      attach(rs_client, ranges, table_id, timeout, retry, failed);
+      for (int attempt=0; !retry.empty(); attempt++) {
+        if (attempt == MAX_REPARTITION_ATTEMPTS) {
+          failed.insert(failed.end(), retry.begin(), retry.end());
+          break;
+        }
+        poll(0, 0, 1000);
+        ranges.clear();
+        load_ranges(metadata, table_id, ranges);
+        repartition(retry, ranges, ags, table_id, schema, staging_dir,
+                    memory_limit, run);
+        merge_runs(ranges, ags, table_id, schema, staging_dir, run);
+        retry.clear();
+        attach(rs_client, ranges, table_id, timeout, retry, failed);
+      }
+    }
+
+    stopwatch.stop();
+
+    cout << "Elapsed time:  " << stopwatch.elapsed() << " s (build "
+         << build_secs << " s)\n";
+    cout << "Total cells:   " << total_cells << "\n";
+    cout << "Total bytes:   " << total_bytes << "\n";
+    cout << "Throughput:    "
+         << (double)total_bytes / stopwatch.elapsed() << " bytes/s\n";
+    if (no_attach)
+      cout << "CellStores left in " << staging_dir << "\n";
+    foreach(BulkRange &range, failed) {
+      cout << "Not attached:  " << range_name(table_id, range) << "\n";
+      foreach(const String &fname, range.files)
+        cout << "  " << fname << "\n";
+    }
+    cout << flush;
+    if (!failed.empty())
+      return 1;
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+
+  return 0;
+}
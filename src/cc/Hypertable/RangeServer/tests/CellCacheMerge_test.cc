@@ -0,0 +1,265 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Doug Judd (Hypertable, Inc.)
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Config.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Init.h"
+#include "Common/Serialization.h"
+
+#include <iostream>
+#include <vector>
+
+#include "Hypertable/Lib/Key.h"
+#include "Hypertable/Lib/Schema.h"
+
+#include "../CellCache.h"
+#include "../MergeScannerAccessGroup.h"
+#include "../ScanContext.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+  const char *schema_str =
+  "<Schema generation=\"1\">\n"
+  "  <AccessGroup name=\"default\">\n"
+  "    <ColumnFamily id=\"1\">\n"
+  "      <Generation>1</Generation>\n"
+  "      <Name>hi</Name>\n"
+  "      <MergeOperator>max</MergeOperator>\n"
+  "    </ColumnFamily>\n"
+  "    <ColumnFamily id=\"2\">\n"
+  "      <Generation>1</Generation>\n"
+  "      <Name>log</Name>\n"
+  "      <MergeOperator>append</MergeOperator>\n"
+  "    </ColumnFamily>\n"
+  "  </AccessGroup>\n"
+  "</Schema>";
+
+  /** Holds serialized keys and values so they outlive the Key objects */
+  class CellBuilder {
+  public:
+    CellBuilder() : m_keys(64000), m_values(64000) { }
+
+    void build(uint8_t flag, const char *row, uint8_t cf, const char *value,
+               int64_t timestamp, Key &key, ByteString &bsvalue) {
+      SerializedKey serkey;
+      serkey.ptr = m_keys.ptr;
+      create_key_and_append(m_keys, flag, row, cf, "", timestamp, timestamp);
+      key.load(serkey);
+      bsvalue.ptr = m_values.ptr;
+      Serialization::encode_vi32(&m_values.ptr, strlen(value));
+      m_values.add_unchecked(value, strlen(value));
+    }
+
+  private:
+    DynamicBuffer m_keys;
+    DynamicBuffer m_values;
+  };
+
+  struct Cell {
+    Cell(const Key &key, const ByteString &value)
+      : row(key.row), cf(key.column_family_code), flag(key.flag),
+        timestamp(key.timestamp) {
+      const uint8_t *ptr;
+      size_t len = value.decode_length(&ptr);
+      this->value = String((const char *)ptr, len);
+    }
+    String row;
+    uint8_t cf;
+    uint8_t flag;
+    int64_t timestamp;
+    String value;
+  };
+
+  void scan(SchemaPtr &schema, vector<CellCachePtr> &caches,
+            bool return_deletes, vector<Cell> &cells) {
+    ScanContextPtr scan_ctx = new ScanContext(schema);
+    MergeScannerAccessGroup *mscanner =
+      new MergeScannerAccessGroup(scan_ctx, return_deletes);
+    CellListScannerPtr scanner = mscanner;
+    Key key;
+    ByteString value;
+
+    for (size_t i=0; i<caches.size(); i++)
+      mscanner->add_scanner(caches[i]->create_scanner(scan_ctx));
+
+    cells.clear();
+    while (scanner->get(key, value)) {
+      cells.push_back(Cell(key, value));
+      scanner->forward();
+    }
+  }
+
+  int64_t encoded_length(const char *value) {
+    return Serialization::encoded_length_vi32(strlen(value)) + strlen(value);
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+
+  init_with_policy<DefaultPolicy>(argc, argv);
+
+  SchemaPtr schema = Schema::new_instance(schema_str, strlen(schema_str));
+  if (!schema->is_valid()) {
+    HT_ERRORF("Schema Parse Error: %s", schema->get_error_string());
+    exit(1);
+  }
+  MergeOperator *max_op = schema->get_merge_operator(1);
+  MergeOperator *append_op = schema->get_merge_operator(2);
+  HT_ASSERT(max_op && append_op);
+
+  CellBuilder builder;
+  Key key;
+  ByteString value;
+  size_t cell_count;
+  int64_t key_bytes, value_bytes, key_length;
+  vector<Cell> cells;
+
+  /**
+   * add_merge keeps one entry per cell and the byte counts describe
+   * only the entries still in the cache
+   */
+  {
+    CellCachePtr cache = new CellCache();
+
+    // same length, merged in place
+    builder.build(FLAG_INSERT, "r1", 1, "5", 1, key, value);
+    key_length = key.length;
+    cache->add_merge(key, value, max_op);
+    builder.build(FLAG_INSERT, "r1", 1, "9", 2, key, value);
+    cache->add_merge(key, value, max_op);
+    builder.build(FLAG_INSERT, "r1", 1, "3", 3, key, value);
+    cache->add_merge(key, value, max_op);
+
+    cache->get_counts(&cell_count, &key_bytes, &value_bytes);
+    HT_ASSERT(cell_count == 1);
+    HT_ASSERT(key_bytes == key_length);
+    HT_ASSERT(value_bytes == encoded_length("9"));
+
+    // growing values replace the old entry
+    builder.build(FLAG_INSERT, "r2", 2, "a", 4, key, value);
+    cache->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r2", 2, "b", 5, key, value);
+    cache->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r2", 2, "c", 6, key, value);
+    cache->add_merge(key, value, append_op);
+
+    cache->get_counts(&cell_count, &key_bytes, &value_bytes);
+    HT_ASSERT(cell_count == 2);
+    HT_ASSERT(key_bytes == 2 * key_length);
+    HT_ASSERT(value_bytes == encoded_length("9") + encoded_length("abc"));
+    HT_ASSERT(cache->get_collision_count() == 0);
+
+    vector<CellCachePtr> caches(1, cache);
+    scan(schema, caches, false, cells);
+    HT_ASSERT(cells.size() == 2);
+    HT_ASSERT(cells[0].row == "r1" && cells[0].value == "9");
+    HT_ASSERT(cells[0].timestamp == 3);
+    HT_ASSERT(cells[1].row == "r2" && cells[1].value == "abc");
+    HT_ASSERT(cells[1].timestamp == 6);
+
+    // after a delete, cells are added unmerged and the scanner merges them
+    builder.build(FLAG_DELETE_CELL, "r3", 2, "", 7, key, value);
+    cache->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r3", 2, "x", 8, key, value);
+    cache->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r3", 2, "y", 9, key, value);
+    cache->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r2", 2, "d", 10, key, value);
+    cache->add_merge(key, value, append_op);
+
+    cache->get_counts(&cell_count, &key_bytes, &value_bytes);
+    HT_ASSERT(cell_count == 6);
+    HT_ASSERT(cache->get_delete_count() == 1);
+
+    scan(schema, caches, false, cells);
+    HT_ASSERT(cells.size() == 3);
+    HT_ASSERT(cells[1].row == "r2" && cells[1].value == "abcd");
+    HT_ASSERT(cells[2].row == "r3" && cells[2].value == "xy");
+  }
+
+  /**
+   * Merging across an older store and the cache, the way a compaction
+   * does: the compaction output keeps the delete and the merged value,
+   * and scanning that output gives the same result as scanning the inputs
+   */
+  {
+    CellCachePtr older = new CellCache();
+    CellCachePtr newer = new CellCache();
+
+    builder.build(FLAG_INSERT, "r1", 1, "12", 1, key, value);
+    older->add_merge(key, value, max_op);
+    builder.build(FLAG_INSERT, "r1", 1, "40", 5, key, value);
+    newer->add_merge(key, value, max_op);
+    builder.build(FLAG_INSERT, "r1", 1, "7", 6, key, value);
+    newer->add_merge(key, value, max_op);
+
+    builder.build(FLAG_INSERT, "r2", 2, "lost", 1, key, value);
+    older->add_merge(key, value, append_op);
+    builder.build(FLAG_DELETE_CELL, "r2", 2, "", 2, key, value);
+    older->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r2", 2, "kept", 3, key, value);
+    older->add_merge(key, value, append_op);
+    builder.build(FLAG_INSERT, "r2", 2, "+new", 7, key, value);
+    newer->add_merge(key, value, append_op);
+
+    vector<CellCachePtr> caches;
+    caches.push_back(older);
+    caches.push_back(newer);
+
+    scan(schema, caches, false, cells);
+    HT_ASSERT(cells.size() == 2);
+    HT_ASSERT(cells[0].value == "40");
+    HT_ASSERT(cells[1].value == "kept+new");
+
+    vector<Cell> compacted;
+    scan(schema, caches, true, compacted);
+
+    CellCachePtr output = new CellCache();
+    size_t deletes = 0;
+    for (size_t i=0; i<compacted.size(); i++) {
+      builder.build(compacted[i].flag, compacted[i].row.c_str(),
+                    compacted[i].cf, compacted[i].value.c_str(),
+                    compacted[i].timestamp, key, value);
+      output->add(key, value);
+      if (compacted[i].flag != FLAG_INSERT)
+        deletes++;
+    }
+    HT_ASSERT(deletes == 1);
+
+    caches.clear();
+    caches.push_back(output);
+    scan(schema, caches, false, compacted);
+    HT_ASSERT(compacted.size() == cells.size());
+    for (size_t i=0; i<cells.size(); i++) {
+      HT_ASSERT(compacted[i].row == cells[i].row);
+      HT_ASSERT(compacted[i].value == cells[i].value);
+    }
+  }
+
+  return 0;
+}
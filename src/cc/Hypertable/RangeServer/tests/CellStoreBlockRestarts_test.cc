@@ -0,0 +1,190 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/ByteString.h"
+#include "Common/DynamicBuffer.h"
+#include "Common/Error.h"
+#include "Common/Logger.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Hypertable/Lib/Key.h"
+
+#include "Hypertable/RangeServer/CellStoreBlockRestarts.h"
+#include "Hypertable/RangeServer/KeyCompressorPrefix.h"
+#include "Hypertable/RangeServer/KeyDecompressorPrefix.h"
+
+using namespace Hypertable;
+using namespace std;
+
+namespace {
+
+  const int KEY_COUNT = 50;
+  const int RESTART_INTERVAL = 8;
+
+  void make_key(DynamicBuffer &buf, const char *row) {
+    buf.clear();
+    create_key_and_append(buf, FLAG_INSERT, row, 1, "", 1, 1);
+  }
+
+  /**
+   * Builds a data block the way CellStoreV6 does: rows row000..row049,
+   * each with its row as the value, every RESTART_INTERVAL-th key written
+   * without prefix compression, followed by the restart table.
+   */
+  void build_block(DynamicBuffer &block) {
+    KeyCompressorPrefix compressor;
+    vector<uint32_t> offsets;
+    DynamicBuffer keybuf;
+    Key key;
+    char row[16];
+
+    for (int i=0; i<KEY_COUNT; i++) {
+      sprintf(row, "row%03d", i);
+      make_key(keybuf, row);
+      key.load(SerializedKey(keybuf.base));
+      if (i % RESTART_INTERVAL == 0) {
+        compressor.reset();
+        offsets.push_back(block.fill());
+      }
+      compressor.add(key);
+      block.ensure(compressor.length());
+      compressor.write(block.ptr);
+      block.ptr += compressor.length();
+      append_as_byte_string(block, row);
+    }
+    CellStoreBlockRestarts::write(block, offsets);
+  }
+
+  int row_number(KeyDecompressor &decompressor) {
+    Key key;
+    decompressor.load(key);
+    return atoi(key.row + 3);
+  }
+
+  /**
+   * Positions a decompressor on the first key of the block that is not
+   * less than <code>row</code>, the same way the cell store scanners do.
+   *
+   * @param startp set to the row at which the linear scan started
+   * @return row number of the key found, or -1 if the block is exhausted
+   */
+  int seek(const DynamicBuffer &block, const char *row, int *startp) {
+    CellStoreBlockRestarts restarts;
+    KeyDecompressorPrefix decompressor;
+    DynamicBuffer keybuf;
+    SerializedKey target;
+    ByteString value;
+    const uint8_t *end, *ptr;
+
+    make_key(keybuf, row);
+    target.ptr = keybuf.base;
+
+    end = restarts.load(block.base, block.ptr);
+    HT_ASSERT(restarts.count() ==
+              (size_t)(KEY_COUNT + RESTART_INTERVAL - 1) / RESTART_INTERVAL);
+
+    decompressor.reset();
+    value.ptr = decompressor.add(block.base);
+    if (decompressor.less_than(target))
+      value.ptr = restarts.seek(&decompressor, target);
+    *startp = row_number(decompressor);
+
+    while (decompressor.less_than(target)) {
+      ptr = value.ptr + value.length();
+      if (ptr >= end)
+        return -1;
+      value.ptr = decompressor.add(ptr);
+    }
+
+    // the value that follows must belong to the key that was decoded
+    int found = row_number(decompressor);
+    char expected[16];
+    sprintf(expected, "row%03d", found);
+    HT_ASSERT(strlen(value.str()) >= 6 && !memcmp(value.str(), expected, 6));
+    return found;
+  }
+
+}
+
+
+int main(int argc, char **argv) {
+  DynamicBuffer block;
+  char row[16];
+  int start;
+
+  build_block(block);
+
+  // before, at and after every restart point; the scan starts at the last
+  // restart point whose key is strictly less than the target
+  for (int r=RESTART_INTERVAL; r<KEY_COUNT; r+=RESTART_INTERVAL) {
+    sprintf(row, "row%03d", r-1);
+    HT_ASSERT(seek(block, row, &start) == r-1);
+    HT_ASSERT(start == r - RESTART_INTERVAL);
+
+    sprintf(row, "row%03d", r);
+    HT_ASSERT(seek(block, row, &start) == r);
+    HT_ASSERT(start == r - RESTART_INTERVAL);
+
+    sprintf(row, "row%03d", r+1);
+    HT_ASSERT(seek(block, row, &start) == r+1);
+    HT_ASSERT(start == r);
+
+    // between two keys
+    sprintf(row, "row%03da", r);
+    HT_ASSERT(seek(block, row, &start) == r+1);
+    HT_ASSERT(start == r);
+  }
+
+  // every key of the block is found
+  for (int i=0; i<KEY_COUNT; i++) {
+    sprintf(row, "row%03d", i);
+    HT_ASSERT(seek(block, row, &start) == i);
+    HT_ASSERT(start <= i && i - start <= RESTART_INTERVAL);
+  }
+
+  // before the first key no seek is needed
+  HT_ASSERT(seek(block, "row", &start) == 0 && start == 0);
+
+  // past the last key the scan starts at the last restart point
+  HT_ASSERT(seek(block, "row999", &start) == -1);
+  HT_ASSERT(start == ((KEY_COUNT - 1) / RESTART_INTERVAL) * RESTART_INTERVAL);
+
+  // a block without a valid restart table is rejected
+  {
+    DynamicBuffer bad;
+    vector<uint32_t> no_offsets;
+    CellStoreBlockRestarts restarts;
+    CellStoreBlockRestarts::write(bad, no_offsets);
+    try {
+      restarts.load(bad.base, bad.ptr);
+      HT_ASSERT(!"restart table with no entries accepted");
+    }
+    catch (Exception &e) {
+      HT_ASSERT(e.code() == Error::RANGESERVER_CORRUPT_CELLSTORE);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,134 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/RangeServer/CompactionPolicyMergeRun.h"
+#include "Hypertable/RangeServer/CompactionPolicySizeTiered.h"
+#include "Hypertable/RangeServer/CompactionPolicyTimeWindow.h"
+
+using namespace Hypertable;
+
+int main(int argc, char **argv) {
+  std::vector<CompactionPolicy::StoreInfo> stores;
+  size_t index, len;
+
+  {
+    // target size 10..20, runs longer than 3 are merged
+    CompactionPolicyMergeRun policy(10, 20, 3);
+
+    HT_ASSERT(!policy.find_merge_run(stores));
+    HT_ASSERT(!policy.needs_merging(stores));
+
+    stores.push_back(CompactionPolicy::StoreInfo(30));
+    stores.push_back(CompactionPolicy::StoreInfo(4));
+    HT_ASSERT(!policy.find_merge_run(stores));
+    HT_ASSERT(!policy.needs_merging(stores));
+
+    // 4 + 7 reaches the minimum target size
+    stores.push_back(CompactionPolicy::StoreInfo(7));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 1 && len == 2);
+    HT_ASSERT(policy.needs_merging(stores));
+
+    // long run of tiny stores
+    stores.clear();
+    for (size_t i=0; i<4; i++)
+      stores.push_back(CompactionPolicy::StoreInfo(1));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 0 && len == 4);
+  }
+
+  {
+    // ratio 4, at least 3 stores, at most 5
+    CompactionPolicySizeTiered policy(4.0, 3, 5);
+
+    stores.clear();
+    HT_ASSERT(!policy.find_merge_run(stores));
+
+    // no tier has three similar stores
+    stores.push_back(CompactionPolicy::StoreInfo(1000));
+    stores.push_back(CompactionPolicy::StoreInfo(100));
+    stores.push_back(CompactionPolicy::StoreInfo(10));
+    stores.push_back(CompactionPolicy::StoreInfo(12));
+    HT_ASSERT(!policy.find_merge_run(stores));
+
+    // the small tier fills up
+    stores.push_back(CompactionPolicy::StoreInfo(9));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 2 && len == 3);
+
+    // prefer the tier with the smallest stores
+    stores.clear();
+    stores.push_back(CompactionPolicy::StoreInfo(400));
+    stores.push_back(CompactionPolicy::StoreInfo(300));
+    stores.push_back(CompactionPolicy::StoreInfo(500));
+    stores.push_back(CompactionPolicy::StoreInfo(10));
+    stores.push_back(CompactionPolicy::StoreInfo(20));
+    stores.push_back(CompactionPolicy::StoreInfo(30));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 3 && len == 3);
+
+    // too many dissimilar stores, merge the cheapest adjacent pair
+    stores.clear();
+    stores.push_back(CompactionPolicy::StoreInfo(100000));
+    stores.push_back(CompactionPolicy::StoreInfo(10000));
+    stores.push_back(CompactionPolicy::StoreInfo(1000));
+    stores.push_back(CompactionPolicy::StoreInfo(100));
+    stores.push_back(CompactionPolicy::StoreInfo(10));
+    stores.push_back(CompactionPolicy::StoreInfo(1));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 4 && len == 2);
+  }
+
+  {
+    // windows of 10, at least 3 stores in the current window
+    CompactionPolicyTimeWindow policy(10, 3);
+
+    stores.clear();
+    HT_ASSERT(!policy.find_merge_run(stores));
+
+    // one store per window
+    stores.push_back(CompactionPolicy::StoreInfo(100, 0, 5));
+    stores.push_back(CompactionPolicy::StoreInfo(100, 10, 15));
+    stores.push_back(CompactionPolicy::StoreInfo(100, 20, 25));
+    HT_ASSERT(!policy.find_merge_run(stores));
+
+    // two stores in the current window are not enough
+    stores.push_back(CompactionPolicy::StoreInfo(10, 26, 27));
+    HT_ASSERT(!policy.find_merge_run(stores));
+
+    stores.push_back(CompactionPolicy::StoreInfo(10, 27, 28));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 2 && len == 3);
+
+    // once the window closes its stores are merged, never across windows
+    stores.erase(stores.begin()+3, stores.end());
+    stores.push_back(CompactionPolicy::StoreInfo(10, 26, 29));
+    stores.push_back(CompactionPolicy::StoreInfo(10, 30, 31));
+    HT_ASSERT(policy.find_merge_run(stores, &index, &len));
+    HT_ASSERT(index == 2 && len == 2);
+  }
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include <cstdlib>
+#include <cstring>
+
+extern "C" {
+#include <unistd.h>
+}
+
+#include "Common/FileUtils.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/RangeServer/LocalBlockCache.h"
+
+using namespace Hypertable;
+
+namespace {
+  const uint32_t BLOCK_SIZE = 4096;
+
+  void fill_block(uint8_t *buf, int file_id, int64_t offset) {
+    for (uint32_t i=0; i<BLOCK_SIZE; i++)
+      buf[i] = (uint8_t)(file_id * 31 + offset * 7 + i);
+  }
+}
+
+int main(int argc, char **argv) {
+  String dir = format("/tmp/LocalBlockCache_test-%d", (int)getpid());
+  uint8_t block[BLOCK_SIZE], expected[BLOCK_SIZE];
+  uint64_t capacity, used, accesses, hits;
+
+  {
+    // room for 8 blocks
+    LocalBlockCache cache(dir, 8*BLOCK_SIZE, false);
+
+    // admission on second miss
+    fill_block(block, 1, 0);
+    HT_ASSERT(!cache.read(1, 0, block, BLOCK_SIZE));
+    cache.insert(1, 0, block, BLOCK_SIZE);
+    HT_ASSERT(!cache.read(1, 0, block, BLOCK_SIZE));
+    cache.insert(1, 0, block, BLOCK_SIZE);
+    memset(block, 0, BLOCK_SIZE);
+    HT_ASSERT(cache.read(1, 0, block, BLOCK_SIZE));
+    fill_block(expected, 1, 0);
+    HT_ASSERT(memcmp(block, expected, BLOCK_SIZE) == 0);
+
+    // length mismatch is a miss
+    HT_ASSERT(!cache.read(1, 0, block, BLOCK_SIZE/2));
+
+    // purge drops every block of the file
+    fill_block(block, 1, BLOCK_SIZE);
+    cache.insert(1, BLOCK_SIZE, block, BLOCK_SIZE);
+    cache.insert(1, BLOCK_SIZE, block, BLOCK_SIZE);
+    HT_ASSERT(cache.read(1, BLOCK_SIZE, block, BLOCK_SIZE));
+    cache.purge(1);
+    HT_ASSERT(!cache.read(1, 0, block, BLOCK_SIZE));
+    HT_ASSERT(!cache.read(1, BLOCK_SIZE, block, BLOCK_SIZE));
+    cache.get_stats(&capacity, &used, &accesses, &hits);
+    HT_ASSERT(used == 0);
+  }
+
+  {
+    LocalBlockCache cache(dir, 8*BLOCK_SIZE, true);
+
+    // write 12 blocks into a ring of 8, the oldest 4 are overwritten
+    for (int i=0; i<12; i++) {
+      fill_block(block, 2, i);
+      cache.insert(2, i, block, BLOCK_SIZE);
+    }
+    for (int i=0; i<12; i++) {
+      bool found = cache.read(2, i, block, BLOCK_SIZE);
+      HT_ASSERT(found == (i >= 4));
+      if (found) {
+        fill_block(expected, 2, i);
+        HT_ASSERT(memcmp(block, expected, BLOCK_SIZE) == 0);
+      }
+    }
+    cache.get_stats(&capacity, &used, &accesses, &hits);
+    HT_ASSERT(capacity == 8*BLOCK_SIZE);
+    HT_ASSERT(used == 8*BLOCK_SIZE);
+    HT_ASSERT(accesses == 12 && hits == 8);
+  }
+
+  HT_ASSERT(!FileUtils::exists(dir + "/block_cache"));
+  rmdir(dir.c_str());
+
+  return 0;
+}
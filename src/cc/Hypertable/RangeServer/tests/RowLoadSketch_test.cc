@@ -0,0 +1,129 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/RangeServer/RowLoadSketch.h"
+
+using namespace Hypertable;
+
+int main(int argc, char **argv) {
+  String split_row;
+
+  {
+    // one in four accesses is sampled
+    RowLoadSketch sketch(4, 100);
+
+    for (int i=0; i<400; i++)
+      sketch.record("m");
+    HT_ASSERT(sketch.accesses() == 400);
+
+    // a single hot row can't be split
+    HT_ASSERT(!sketch.median("", "z", split_row));
+
+    for (int i=0; i<100; i++)
+      sketch.record("a");
+    for (int i=0; i<100; i++)
+      sketch.record("b");
+    for (int i=0; i<100; i++)
+      sketch.record("x");
+    for (int i=0; i<100; i++)
+      sketch.record("y");
+
+    // "m" holds most of the load, so the split goes right after it
+    HT_ASSERT(sketch.median("", "z", split_row));
+    HT_ASSERT(split_row == "m");
+
+    // rows outside the range are ignored
+    HT_ASSERT(sketch.median("m", "z", split_row));
+    HT_ASSERT(split_row == "x");
+    HT_ASSERT(!sketch.median("x", "y", split_row));
+
+    // decay halves the counts and resets the access counter
+    sketch.decay();
+    HT_ASSERT(sketch.accesses() == 0);
+    HT_ASSERT(sketch.median("", "z", split_row));
+    HT_ASSERT(split_row == "m");
+
+    sketch.clear();
+    HT_ASSERT(!sketch.median("", "z", split_row));
+  }
+
+  {
+    // the number of tracked rows stays bounded
+    RowLoadSketch sketch(1, 10);
+    char row[16];
+
+    for (int i=0; i<1000; i++) {
+      sprintf(row, "%04d", i);
+      sketch.record(row);
+    }
+    for (int i=0; i<3; i++) {
+      sketch.record("a");
+      sketch.record("b");
+    }
+    HT_ASSERT(sketch.median("", "z", split_row));
+    HT_ASSERT(split_row < "b");
+  }
+
+  {
+    // the per-pass decision Range::get_maintenance_data() makes
+    RowLoadSketch sketch(1, 100);
+
+    // a single hot row is over the threshold but can't be split, so no
+    // split (and no size based fallback in split_install_log) is requested
+    for (int i=0; i<1000; i++)
+      sketch.record("hot");
+    HT_ASSERT(!sketch.check_split(10, 50, "", "z", split_row));
+    HT_ASSERT(sketch.accesses() == 0);
+
+    // ... on every pass, even as the counts accumulate
+    for (int pass=0; pass<5; pass++) {
+      for (int i=0; i<1000; i++)
+        sketch.record("hot");
+      HT_ASSERT(!sketch.check_split(10, 50, "", "z", split_row));
+    }
+
+    // once a second row carries load the range splits at the median
+    for (int i=0; i<1000; i++) {
+      sketch.record("hot");
+      sketch.record("warm");
+    }
+    HT_ASSERT(sketch.check_split(10, 50, "", "z", split_row));
+    HT_ASSERT(split_row == "hot");
+
+    // below the threshold, or with load splitting disabled, nothing happens
+    for (int i=0; i<100; i++) {
+      sketch.record("hot");
+      sketch.record("warm");
+    }
+    HT_ASSERT(!sketch.check_split(10, 50, "", "z", split_row));
+    for (int i=0; i<1000; i++) {
+      sketch.record("hot");
+      sketch.record("warm");
+    }
+    HT_ASSERT(!sketch.check_split(10, 0, "", "z", split_row));
+  }
+
+  return 0;
+}
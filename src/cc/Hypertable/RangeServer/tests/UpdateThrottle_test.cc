@@ -0,0 +1,69 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include "Common/Logger.h"
+
+#include "Hypertable/RangeServer/UpdateThrottle.h"
+
+using namespace Hypertable;
+
+int main(int argc, char **argv) {
+  int32_t level;
+  uint64_t throttled, delay_millis;
+
+  {
+    // throttling starts at 80% of the limit
+    UpdateThrottle throttle(80, 1000, 5000);
+
+    throttle.adjust(500, 1000);
+    HT_ASSERT(throttle.level() == 0);
+    HT_ASSERT(throttle.delay("1", 100000) == 0);
+
+    // no growth history yet, halfway between watermark and limit
+    UpdateThrottle throttle2(80, 1000, 5000);
+    throttle2.adjust(900, 1000);
+    HT_ASSERT(throttle2.level() == 50);
+    HT_ASSERT(!throttle2.saturated());
+    HT_ASSERT(throttle2.delay("1", 100000) == 500);
+
+    // a table writing far less than its share is barely delayed
+    HT_ASSERT(throttle2.delay("2", 1000) < 50);
+
+    throttle2.get_stats(&level, &throttled, &delay_millis);
+    HT_ASSERT(level == 50);
+    HT_ASSERT(throttled >= 1 && delay_millis >= 500);
+
+    // over the limit saturates
+    throttle2.adjust(1001, 1000);
+    HT_ASSERT(throttle2.level() == 100);
+    HT_ASSERT(throttle2.saturated());
+
+    // level falls off gradually once memory drops
+    throttle2.adjust(100, 1000);
+    HT_ASSERT(throttle2.level() == 50);
+    throttle2.adjust(100, 1000);
+    HT_ASSERT(throttle2.level() == 25);
+  }
+
+  return 0;
+}
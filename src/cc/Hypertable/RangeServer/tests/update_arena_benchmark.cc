@@ -0,0 +1,172 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 2 of the
+ * License, or any later version.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/Logger.h"
+#include "Common/Stopwatch.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "Hypertable/RangeServer/GroupCommitInterface.h"
+
+using namespace Hypertable;
+using namespace Config;
+
+namespace {
+
+  struct AppPolicy : Config::Policy {
+    static void init_options() {
+      cmdline_desc("Usage: %s [options]\n\n"
+                   "  This program measures the cost of building the per-range\n"
+                   "  update lists of an update batch in the qualify stage,\n"
+                   "  with the lists and their update vectors allocated from\n"
+                   "  the heap (as before UpdateContext had an arena) and from\n"
+                   "  a CharArena (RangeUpdateList as it is now).\n"
+                   "\nOptions").add_options()
+        ("batches", i32()->default_value(100000), "Number of update batches")
+        ("ranges", i32()->default_value(4), "Ranges touched per batch")
+        ("updates", i32()->default_value(4), "Updates per range")
+        ;
+    }
+  };
+
+  size_t allocation_count = 0;
+
+  /** RangeUpdateList as it was before it moved to the UpdateContext arena */
+  class HeapRangeUpdateList {
+  public:
+    HeapRangeUpdateList() : starting_update_count(0), last_request(0),
+                            transfer_buf_reset_offset(0),
+                            latest_transfer_revision(TIMESTAMP_MIN),
+                            range_blocked(false) { }
+    void add_update(UpdateRequest *request, RangeUpdate &update) {
+      if (request != last_request) {
+        starting_update_count = updates.size();
+        last_request = request;
+        transfer_buf_reset_offset = transfer_buf.empty() ? 0 : transfer_buf.fill();
+      }
+      if (update.len)
+        updates.push_back(update);
+    }
+    RangePtr range;
+    std::vector<RangeUpdate> updates;
+    size_t starting_update_count;
+    UpdateRequest *last_request;
+    DynamicBuffer transfer_buf;
+    uint32_t transfer_buf_reset_offset;
+    int64_t latest_transfer_revision;
+    CommitLogPtr transfer_log;
+    bool range_blocked;
+  };
+
+} // local namespace
+
+// Count allocations so that the per-batch heap traffic can be reported
+void *operator new(size_t size) throw (std::bad_alloc) {
+  allocation_count++;
+  void *ptr = malloc(size ? size : 1);
+  if (ptr == 0)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) throw () {
+  free(ptr);
+}
+
+
+int main(int argc, char **argv) {
+
+  try {
+    init_with_policy<AppPolicy>(argc, argv);
+    int32_t batches = get_i32("batches");
+    int32_t range_count = get_i32("ranges");
+    int32_t update_count = get_i32("updates");
+    UpdateRequest request;
+    RangeUpdate update;
+    size_t allocations;
+    uint64_t arena_bytes = 0;
+
+    update.bufp = 0;
+    update.offset = 0;
+    update.len = 1;
+
+    // lists and update vectors on the heap
+    std::vector<HeapRangeUpdateList *> heap_lists;
+    heap_lists.reserve(range_count);
+    allocations = allocation_count;
+    Stopwatch heap_stopwatch;
+    for (int32_t b=0; b<batches; b++) {
+      for (int32_t r=0; r<range_count; r++) {
+        HeapRangeUpdateList *list = new HeapRangeUpdateList();
+        for (int32_t u=0; u<update_count; u++)
+          list->add_update(&request, update);
+        heap_lists.push_back(list);
+      }
+      foreach (HeapRangeUpdateList *list, heap_lists)
+        delete list;
+      heap_lists.clear();
+    }
+    heap_stopwatch.stop();
+    size_t heap_allocations = allocation_count - allocations;
+
+    // lists and update vectors in a per-batch arena
+    std::vector<RangeUpdateList *> arena_lists;
+    arena_lists.reserve(range_count);
+    allocations = allocation_count;
+    Stopwatch arena_stopwatch;
+    for (int32_t b=0; b<batches; b++) {
+      CharArena arena;
+      for (int32_t r=0; r<range_count; r++) {
+        RangeUpdateList *list = RangeUpdateList::create(arena);
+        for (int32_t u=0; u<update_count; u++)
+          list->add_update(&request, update);
+        arena_lists.push_back(list);
+      }
+      foreach (RangeUpdateList *list, arena_lists)
+        list->~RangeUpdateList();
+      arena_lists.clear();
+      arena_bytes += arena.used();
+    }
+    arena_stopwatch.stop();
+    size_t arena_allocations = allocation_count - allocations;
+
+    std::cout << "batches: " << batches << ", ranges: " << range_count
+              << ", updates/range: " << update_count << "\n"
+              << "heap:  " << heap_stopwatch.elapsed() * 1000000.0 / batches
+              << " us/batch, " << (double)heap_allocations / batches
+              << " allocations/batch\n"
+              << "arena: " << arena_stopwatch.elapsed() * 1000000.0 / batches
+              << " us/batch, " << (double)arena_allocations / batches
+              << " allocations/batch, " << arena_bytes / batches
+              << " arena bytes/batch" << std::endl;
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    _exit(1);
+  }
+  return 0;
+}
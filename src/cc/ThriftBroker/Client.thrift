@@ -255,10 +255,13 @@ struct Key {
  *
  * NO_LOG_SYNC: Do not sync the commit log
  * IGNORE_UNKNOWN_CFS: Don't throw exception if mutator writes to unknown column family
+ * COALESCE_UPDATES: Drop writes superseded by a later write to the same cell
+ *   before they are sent
  */
 enum MutatorFlag {
   NO_LOG_SYNC = 1,
-  IGNORE_UNKNOWN_CFS = 2
+  IGNORE_UNKNOWN_CFS = 2,
+  COALESCE_UPDATES = 4
 }
 
 /** Specifies options for a shared periodic mutator 
@@ -511,6 +514,9 @@ struct ColumnFamily {
  *
  *   <dt>columns</dt>
  *   <dd>Specifies list of column families in this AG</dd> 
+ *
+ *   <dt>compaction_policy</dt>
+ *   <dd>Specifies compaction policy for this AG</dd>
  * </dl>
  */
 struct AccessGroup {
@@ -521,6 +527,7 @@ struct AccessGroup {
   5: optional string compressor 
   6: optional string bloom_filter 
   7: optional list<ColumnFamily> columns 
+  8: optional string compaction_policy
 }
 
 /**  
@@ -553,6 +560,29 @@ struct Schema {
   2: optional map<string, ColumnFamily> column_families
 }
 
+/**
+ * Describes how a new table is divided into its initial ranges.  Either
+ * an explicit list of split rows or a split algorithm with a range count
+ * is given.
+ *
+ * <dl>
+ *   <dt>rows</dt>
+ *   <dd>Row keys at which the table is split; n rows create n+1 ranges</dd>
+ *
+ *   <dt>algorithm</dt>
+ *   <dd>"uniform" (equal width over the first two row bytes) or "hash"
+ *   (equal width over eight-digit lowercase hex row prefixes)</dd>
+ *
+ *   <dt>range_count</dt>
+ *   <dd>Number of ranges the algorithm creates</dd>
+ * </dl>
+ */
+struct SplitSpec {
+  1: optional list<string> rows
+  2: optional string algorithm
+  3: optional i32 range_count
+}
+
 
 
 /**
@@ -592,6 +622,17 @@ service ClientService {
    */
   void create_table(1:Namespace ns, 2:string table_name, 3:string schema)
       throws (1:ClientException e),
+
+  /**
+   * Create a table divided into several initial ranges
+   *
+   * @param ns - namespace id 
+   * @param table_name - table name
+   * @param schema - schema of the table (in xml)
+   * @param split_spec - split rows or split algorithm
+   */
+  void create_table_with_splits(1:Namespace ns, 2:string table_name,
+      3:string schema, 4:SplitSpec split_spec) throws (1:ClientException e),
   
   /**
    * Alter a table
@@ -54,10 +54,17 @@ void init_thrift_broker_options() {
     ("pidfile", str(), "File to contain the process id")
     ("log-api", boo()->default_value(false), "Enable or disable API logging")
     ("workers", i32()->default_value(50), "Worker threads")
+    ("nonblocking", boo()->default_value(false), "Serve requests from a "
+        "non-blocking server with a fixed pool of worker threads (see "
+        "--workers) instead of one thread per connection.  Calls that "
+        "block, like next_cells and get_future_result, hold a worker until "
+        "they return, so --workers must cover the clients making such calls "
+        "at the same time.  Can't be combined with --thrift-timeout")
     ;
   alias("port", "ThriftBroker.Port");
   alias("log-api", "ThriftBroker.API.Logging");
   alias("workers", "ThriftBroker.Workers");
+  alias("nonblocking", "ThriftBroker.NonBlocking");
   // hidden aliases
   alias("thrift-timeout", "ThriftBroker.Timeout");
 }
@@ -28,8 +28,10 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <concurrency/PosixThreadFactory.h>
 #include <concurrency/ThreadManager.h>
 #include <protocol/TBinaryProtocol.h>
+#include <server/TNonblockingServer.h>
 #include <server/TThreadedServer.h>
 #include <transport/TBufferTransports.h>
 #include <transport/TServerSocket.h>
@@ -41,6 +43,7 @@
 #include "Hypertable/Lib/Key.h"
 #include "Hypertable/Lib/NamespaceListing.h"
 #include "Hypertable/Lib/Future.h"
+#include "Hypertable/Lib/TableSplitSpec.h"
 
 #include "Config.h"
 #include "SerializedCellsReader.h"
@@ -160,14 +163,81 @@ inline bool operator < (const SharedMutatorMapKey &skey1, const SharedMutatorMap
 
 typedef Meta::list<ThriftBrokerPolicy, DefaultCommPolicy> Policies;
 
+/**
+ * Table of client handles (scanners, mutators, namespaces, futures) split
+ * into independently locked stripes, so that concurrent requests on
+ * different handles do not serialize on one mutex.
+ */
+template <class ValueT>
+class HandleTable {
+public:
+  enum { STRIPES = 64 };
+
+  HandleTable() : m_next_id(1) { }
+
+  bool get(::int64_t id, ValueT &value) {
+    Stripe &stripe = m_stripes[stripe_index(id)];
+    ScopedLock lock(stripe.mutex);
+    typename Map::iterator it = stripe.map.find(id);
+    if (it == stripe.map.end())
+      return false;
+    value = it->second;
+    return true;
+  }
+
+  // does not overwrite an existing entry
+  void insert(::int64_t id, const ValueT &value) {
+    Stripe &stripe = m_stripes[stripe_index(id)];
+    ScopedLock lock(stripe.mutex);
+    stripe.map.insert(make_pair(id, value));
+  }
+
+  // returned id is guaranteed to be unique and non-zero
+  ::int64_t insert_next(const ValueT &value) {
+    ::int64_t id;
+    {
+      ScopedLock lock(m_id_mutex);
+      id = m_next_id++;
+    }
+    insert(id, value);
+    return id;
+  }
+
+  bool remove(::int64_t id) {
+    Stripe &stripe = m_stripes[stripe_index(id)];
+    ScopedLock lock(stripe.mutex);
+    return stripe.map.erase(id) != 0;
+  }
+
+private:
+  typedef hash_map< ::int64_t, ValueT> Map;
+
+  struct Stripe {
+    Mutex mutex;
+    Map map;
+  };
+
+  // ids are often object addresses, so mix the bits before picking a stripe
+  static size_t stripe_index(::int64_t id) {
+    ::uint64_t h = (::uint64_t)id;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return (size_t)(h % STRIPES);
+  }
+
+  Stripe    m_stripes[STRIPES];
+  Mutex     m_id_mutex;
+  ::int64_t m_next_id;
+};
+
 typedef std::map<SharedMutatorMapKey, TableMutatorPtr> SharedMutatorMap;
-typedef hash_map< ::int64_t, TableScannerPtr> ScannerMap;
-typedef hash_map< ::int64_t, TableScannerAsyncPtr> ScannerAsyncMap;
-typedef hash_map< ::int64_t, ::int64_t> ReverseScannerAsyncMap;
-typedef hash_map< ::int64_t, TableMutatorPtr> MutatorMap;
-typedef hash_map< ::int64_t, TableMutatorAsyncPtr> MutatorAsyncMap;
-typedef hash_map< ::int64_t, NamespacePtr> NamespaceMap;
-typedef hash_map< ::int64_t, FuturePtr> FutureMap;
+typedef HandleTable<TableScannerPtr> ScannerMap;
+typedef HandleTable<TableScannerAsyncPtr> ScannerAsyncMap;
+typedef HandleTable<TableMutatorPtr> MutatorMap;
+typedef HandleTable<TableMutatorAsyncPtr> MutatorAsyncMap;
+typedef HandleTable<NamespacePtr> NamespaceMap;
+typedef HandleTable<FuturePtr> FutureMap;
 typedef hash_map< ::int64_t, HqlInterpreterPtr> HqlInterpreterMap;
 typedef std::vector<ThriftGen::Cell> ThriftCells;
 typedef std::vector<CellAsArray> ThriftCellsAsArrays;
@@ -464,8 +534,6 @@ public:
     m_log_api = Config::get_bool("ThriftBroker.API.Logging");
     m_next_threshold = Config::get_i32("ThriftBroker.NextThreshold");
     m_client = new Hypertable::Client();
-    m_next_namespace_id = 1;
-    m_next_future_id = 1;
     m_future_queue_size = Config::get_i32("ThriftBroker.Future.QueueSize");
   }
 
@@ -530,6 +598,28 @@ public:
     LOG_API_FINISH;
   }
 
+  virtual void create_table_with_splits(const ThriftGen::Namespace ns,
+      const String &table, const String &schema,
+      const ThriftGen::SplitSpec &split_spec) {
+    LOG_API_START("namespace=" << ns << " table="<< table <<" schema="<< schema
+                  << " split_rows=" << split_spec.rows.size()
+                  << " algorithm=" << split_spec.algorithm
+                  << " range_count=" << split_spec.range_count);
+
+    try {
+      std::vector<String> split_rows;
+      if (split_spec.__isset.algorithm)
+        TableSplitSpec::generate(split_spec.algorithm, split_spec.range_count,
+                                 split_rows);
+      else
+        split_rows = split_spec.rows;
+      NamespacePtr namespace_ptr = get_namespace(ns);
+      namespace_ptr->create_table(table, schema, split_rows);
+    } RETHROW("namespace=" << ns << " table="<< table <<" schema="<< schema)
+
+    LOG_API_FINISH;
+  }
+
   virtual void alter_table(const ThriftGen::Namespace ns, const String &table, const String &schema) {
     LOG_API_START("namespace=" << ns << " table="<< table <<" schema="<< schema);
 
@@ -1296,6 +1386,7 @@ public:
           t_ag.blocksize = (int32_t)ag->blocksize;
           t_ag.compressor = ag->compressor;
           t_ag.bloom_filter = ag->bloom_filter;
+          t_ag.compaction_policy = ag->compaction_policy;
 
           foreach(Hypertable::Schema::ColumnFamily *cf, ag->columns) {
             ThriftGen::ColumnFamily t_cf;
@@ -1318,6 +1409,7 @@ public:
           t_ag.__isset.blocksize = true;
           t_ag.__isset.compressor = true;
           t_ag.__isset.bloom_filter = true;
+          t_ag.__isset.compaction_policy = true;
           t_ag.__isset.columns = true;
           // push this access group into the map
           result.access_groups[t_ag.name] = t_ag;
@@ -1649,11 +1741,10 @@ public:
   }
 
   FuturePtr get_future(::int64_t id) {
-    ScopedLock lock(m_future_mutex);
-    FutureMap::iterator it = m_future_map.find(id);
+    FuturePtr future_ptr;
 
-    if (it != m_future_map.end())
-      return it->second;
+    if (m_future_map.get(id, future_ptr))
+      return future_ptr;
 
     HT_ERROR_OUT << "Bad future id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_FUTURE_ID,
@@ -1663,11 +1754,10 @@ public:
 
 
   NamespacePtr get_namespace(::int64_t id) {
-    ScopedLock lock(m_namespace_mutex);
-    NamespaceMap::iterator it = m_namespace_map.find(id);
+    NamespacePtr namespace_ptr;
 
-    if (it != m_namespace_map.end())
-      return it->second;
+    if (m_namespace_map.get(id, namespace_ptr))
+      return namespace_ptr;
 
     HT_ERROR_OUT << "Bad namespace id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_NAMESPACE_ID,
@@ -1677,52 +1767,29 @@ public:
 
   // returned id is guaranteed to be unique and non-zero
   ::int64_t get_future_id(FuturePtr *ff) {
-    ScopedLock lock(m_future_mutex);
-    ::int64_t id = m_next_future_id;
-    m_next_future_id++;
-    m_future_map.insert(make_pair(id, *ff)); // no overwrite
-    return id;
+    return m_future_map.insert_next(*ff);
   }
 
 
   // returned id is guaranteed to be unique and non-zero
   ::int64_t get_namespace_id(NamespacePtr *ns) {
-    ScopedLock lock(m_namespace_mutex);
-    // generate unique random 64 bit int id
     // TODO make id random for security reasons
-    //::int64_t id = Random::number64();
-    ::int64_t id = m_next_namespace_id++;
-
-    // TODO make id random for security reasons
-    //while (m_namespace_map.find(id) != m_namespace_map.end() || id == 0) {
-    //  id = Random::number64();
-    //}
-    m_namespace_map.insert(make_pair(id, *ns)); // no overwrite
-    return id;
+    return m_namespace_map.insert_next(*ns);
   }
 
+  // the id is the scanner address, so repeated calls for the same scanner
+  // return the same id
   ::int64_t get_scanner_async_id(TableScannerAsync *scanner) {
-    ScopedLock lock(m_scanner_async_mutex);
     ::int64_t id = (::int64_t)scanner;
-
-    // if scanner is already in map then return id by reverse lookup
-    ReverseScannerAsyncMap::iterator it =
-        m_reverse_scanner_async_map.find((::int64_t)scanner);
-    if (it != m_reverse_scanner_async_map.end())
-      id = it->second;
-    else {
-      m_scanner_async_map.insert(make_pair(id, scanner)); // no overwrite
-      m_reverse_scanner_async_map.insert(make_pair((::int64_t)scanner, id));
-    }
+    m_scanner_async_map.insert(id, scanner); // no overwrite
     return id;
   }
 
   TableScannerAsyncPtr get_scanner_async(::int64_t id) {
-    ScopedLock lock(m_scanner_async_mutex);
-    ScannerAsyncMap::iterator it = m_scanner_async_map.find(id);
+    TableScannerAsyncPtr scanner;
 
-    if (it != m_scanner_async_map.end())
-      return it->second;
+    if (m_scanner_async_map.get(id, scanner))
+      return scanner;
 
     HT_ERROR_OUT << "Bad scanner id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_SCANNER_ID,
@@ -1730,18 +1797,16 @@ public:
   }
 
   ::int64_t get_scanner_id(TableScanner *scanner) {
-    ScopedLock lock(m_scanner_mutex);
     ::int64_t id = (::int64_t)scanner;
-    m_scanner_map.insert(make_pair(id, scanner)); // no overwrite
+    m_scanner_map.insert(id, scanner); // no overwrite
     return id;
   }
 
   TableScannerPtr get_scanner(::int64_t id) {
-    ScopedLock lock(m_scanner_mutex);
-    ScannerMap::iterator it = m_scanner_map.find(id);
+    TableScannerPtr scanner;
 
-    if (it != m_scanner_map.end())
-      return it->second;
+    if (m_scanner_map.get(id, scanner))
+      return scanner;
 
     HT_ERROR_OUT << "Bad scanner id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_SCANNER_ID,
@@ -1749,13 +1814,8 @@ public:
   }
 
   void remove_scanner(::int64_t id) {
-    ScopedLock lock(m_scanner_mutex);
-    ScannerMap::iterator it = m_scanner_map.find(id);
-
-    if (it != m_scanner_map.end()) {
-      m_scanner_map.erase(it);
+    if (m_scanner_map.remove(id))
       return;
-    }
 
     HT_ERROR_OUT << "Bad scanner id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_SCANNER_ID,
@@ -1763,16 +1823,8 @@ public:
   }
 
   void remove_scanner_async(::int64_t id) {
-    ScopedLock lock(m_scanner_async_mutex);
-    ScannerAsyncMap::iterator it = m_scanner_async_map.find(id);
-    ::int64_t scanner_async=0;
-
-    if (it != m_scanner_async_map.end()) {
-      scanner_async = (::int64_t)(it->second.get());
-      m_scanner_async_map.erase(it);
-      m_reverse_scanner_async_map.erase(scanner_async);
+    if (m_scanner_async_map.remove(id))
       return;
-    }
 
     HT_ERROR_OUT << "Bad scanner id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_SCANNER_ID,
@@ -1780,16 +1832,14 @@ public:
   }
 
   ::int64_t get_mutator_id(TableMutator *mutator) {
-    ScopedLock lock(m_mutator_mutex);
     ::int64_t id = (::int64_t)mutator;
-    m_mutator_map.insert(make_pair(id, mutator)); // no overwrite
+    m_mutator_map.insert(id, mutator); // no overwrite
     return id;
   }
 
   ::int64_t get_mutator_async_id(TableMutatorAsync *mutator) {
-    ScopedLock lock(m_mutator_async_mutex);
     ::int64_t id = (::int64_t)mutator;
-    m_mutator_async_map.insert(make_pair(id, mutator)); // no overwrite
+    m_mutator_async_map.insert(id, mutator); // no overwrite
     return id;
   }
 
@@ -1843,11 +1893,10 @@ public:
   }
 
   TableMutatorPtr get_mutator(::int64_t id) {
-    ScopedLock lock(m_mutator_mutex);
-    MutatorMap::iterator it = m_mutator_map.find(id);
+    TableMutatorPtr mutator;
 
-    if (it != m_mutator_map.end())
-      return it->second;
+    if (m_mutator_map.get(id, mutator))
+      return mutator;
 
     HT_ERROR_OUT << "Bad mutator id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_MUTATOR_ID,
@@ -1855,11 +1904,10 @@ public:
   }
 
   TableMutatorAsyncPtr get_mutator_async(::int64_t id) {
-    ScopedLock lock(m_mutator_async_mutex);
-    MutatorAsyncMap::iterator it = m_mutator_async_map.find(id);
+    TableMutatorAsyncPtr mutator;
 
-    if (it != m_mutator_async_map.end())
-      return it->second;
+    if (m_mutator_async_map.get(id, mutator))
+      return mutator;
 
     HT_ERROR_OUT << "Bad mutator id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_MUTATOR_ID,
@@ -1867,13 +1915,8 @@ public:
   }
 
   void remove_future_from_map(::int64_t id) {
-    ScopedLock lock(m_future_mutex);
-    FutureMap::iterator it = m_future_map.find(id);
-
-    if (it != m_future_map.end()) {
-      m_future_map.erase(it);
+    if (m_future_map.remove(id))
       return;
-    }
 
     HT_ERROR_OUT << "Bad future id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_FUTURE_ID,
@@ -1881,13 +1924,8 @@ public:
   }
 
   void remove_namespace_from_map(::int64_t id) {
-    ScopedLock lock(m_namespace_mutex);
-    NamespaceMap::iterator it = m_namespace_map.find(id);
-
-    if (it != m_namespace_map.end()) {
-      m_namespace_map.erase(it);
+    if (m_namespace_map.remove(id))
       return;
-    }
 
     HT_ERROR_OUT << "Bad namespace id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_NAMESPACE_ID,
@@ -1896,13 +1934,8 @@ public:
 
 
   void remove_mutator(::int64_t id) {
-    ScopedLock lock(m_mutator_mutex);
-    MutatorMap::iterator it = m_mutator_map.find(id);
-
-    if (it != m_mutator_map.end()) {
-      m_mutator_map.erase(it);
+    if (m_mutator_map.remove(id))
       return;
-    }
 
     HT_ERROR_OUT << "Bad mutator id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_MUTATOR_ID,
@@ -1910,13 +1943,8 @@ public:
   }
 
   void remove_mutator_async(::int64_t id) {
-    ScopedLock lock(m_mutator_async_mutex);
-    MutatorAsyncMap::iterator it = m_mutator_async_map.find(id);
-
-    if (it != m_mutator_async_map.end()) {
-      m_mutator_async_map.erase(it);
+    if (m_mutator_async_map.remove(id))
       return;
-    }
 
     HT_ERROR_OUT << "Bad mutator id - " << id << HT_END;
     THROW_TE(Error::THRIFTBROKER_BAD_MUTATOR_ID,
@@ -1925,22 +1953,13 @@ public:
 
 private:
   bool             m_log_api;
-  Mutex            m_scanner_mutex;
   ScannerMap       m_scanner_map;
-  Mutex            m_mutator_mutex;
-  Mutex            m_mutator_async_mutex;
   MutatorMap       m_mutator_map;
   MutatorAsyncMap  m_mutator_async_map;
   Mutex            m_shared_mutator_mutex;
-  ::int64_t        m_next_namespace_id;
   NamespaceMap     m_namespace_map;
-  Mutex            m_namespace_mutex;
   ScannerAsyncMap  m_scanner_async_map;
-  ReverseScannerAsyncMap m_reverse_scanner_async_map;
-  Mutex            m_scanner_async_mutex;
-  ::int64_t        m_next_future_id;
   FutureMap        m_future_map;
-  Mutex            m_future_mutex;
   ::int32_t        m_future_queue_size;
   SharedMutatorMap m_shared_mutator_map;
   ::int32_t        m_next_threshold;
@@ -2003,6 +2022,35 @@ int main(int argc, char **argv) {
     boost::shared_ptr<ServerHandler> handler(new ServerHandler());
     boost::shared_ptr<TProcessor> processor(new HqlServiceProcessor(handler));
 
+    if (get_bool("ThriftBroker.NonBlocking")) {
+      // Connections are multiplexed on a single event loop and requests are
+      // executed by a fixed pool of workers, so the number of threads no
+      // longer grows with the number of clients.  Clients must use a framed
+      // transport, which Thrift::Client already does.  A call holds its
+      // worker until it returns, including calls that wait on RangeServers
+      // (next_cells*) or on a future (get_future_result*), so clients
+      // blocked in such calls beyond the pool size stall everyone else.
+      if (has("thrift-timeout")) {
+        HT_ERROR("ThriftBroker.Timeout (--thrift-timeout) can't be used with "
+                 "ThriftBroker.NonBlocking, the non-blocking server has no "
+                 "connection timeouts");
+        return 1;
+      }
+      int workers = get_i32("workers");
+      boost::shared_ptr<ThreadManager> threadManager =
+          ThreadManager::newSimpleThreadManager(workers);
+      boost::shared_ptr<PosixThreadFactory> threadFactory(new PosixThreadFactory());
+      threadManager->threadFactory(threadFactory);
+      threadManager->start();
+
+      TNonblockingServer server(processor, protocolFactory, port, threadManager);
+
+      HT_INFOF("Starting the non-blocking server with %d workers...", workers);
+      server.serve();
+      HT_INFO("Exiting.\n");
+      return 0;
+    }
+
     boost::shared_ptr<TServerTransport> serverTransport;
 
     if (has("thrift-timeout")) {
@@ -351,6 +351,206 @@ uint32_t ClientService_create_table_presult::read(::apache::thrift::protocol::TP
   return xfer;
 }
 
+uint32_t ClientService_create_table_with_splits_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->ns);
+          this->__isset.ns = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->table_name);
+          this->__isset.table_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->schema);
+          this->__isset.schema = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->split_spec.read(iprot);
+          this->__isset.split_spec = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_create_table_with_splits_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("ClientService_create_table_with_splits_args");
+  xfer += oprot->writeFieldBegin("ns", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64(this->ns);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("table_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->table_name);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("schema", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString(this->schema);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("split_spec", ::apache::thrift::protocol::T_STRUCT, 4);
+  xfer += this->split_spec.write(oprot);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_create_table_with_splits_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("ClientService_create_table_with_splits_pargs");
+  xfer += oprot->writeFieldBegin("ns", ::apache::thrift::protocol::T_I64, 1);
+  xfer += oprot->writeI64((*(this->ns)));
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("table_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString((*(this->table_name)));
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("schema", ::apache::thrift::protocol::T_STRING, 3);
+  xfer += oprot->writeString((*(this->schema)));
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldBegin("split_spec", ::apache::thrift::protocol::T_STRUCT, 4);
+  xfer += (*(this->split_spec)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_create_table_with_splits_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ClientService_create_table_with_splits_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("ClientService_create_table_with_splits_result");
+
+  if (this->__isset.e) {
+    xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->e.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+uint32_t ClientService_create_table_with_splits_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
 uint32_t ClientService_alter_table_args::read(::apache::thrift::protocol::TProtocol* iprot) {
 
   uint32_t xfer = 0;
@@ -3599,14 +3799,14 @@ uint32_t ClientService_next_cells_result::read(::apache::thrift::protocol::TProt
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size59;
-            ::apache::thrift::protocol::TType _etype62;
-            iprot->readListBegin(_etype62, _size59);
-            this->success.resize(_size59);
-            uint32_t _i63;
-            for (_i63 = 0; _i63 < _size59; ++_i63)
+            uint32_t _size65;
+            ::apache::thrift::protocol::TType _etype68;
+            iprot->readListBegin(_etype68, _size65);
+            this->success.resize(_size65);
+            uint32_t _i69;
+            for (_i69 = 0; _i69 < _size65; ++_i69)
             {
-              xfer += this->success[_i63].read(iprot);
+              xfer += this->success[_i69].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -3645,10 +3845,10 @@ uint32_t ClientService_next_cells_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Cell> ::const_iterator _iter64;
-      for (_iter64 = this->success.begin(); _iter64 != this->success.end(); ++_iter64)
+      std::vector<Cell> ::const_iterator _iter70;
+      for (_iter70 = this->success.begin(); _iter70 != this->success.end(); ++_iter70)
       {
-        xfer += (*_iter64).write(oprot);
+        xfer += (*_iter70).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -3687,14 +3887,14 @@ uint32_t ClientService_next_cells_presult::read(::apache::thrift::protocol::TPro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size65;
-            ::apache::thrift::protocol::TType _etype68;
-            iprot->readListBegin(_etype68, _size65);
-            (*(this->success)).resize(_size65);
-            uint32_t _i69;
-            for (_i69 = 0; _i69 < _size65; ++_i69)
+            uint32_t _size71;
+            ::apache::thrift::protocol::TType _etype74;
+            iprot->readListBegin(_etype74, _size71);
+            (*(this->success)).resize(_size71);
+            uint32_t _i75;
+            for (_i75 = 0; _i75 < _size71; ++_i75)
             {
-              xfer += (*(this->success))[_i69].read(iprot);
+              xfer += (*(this->success))[_i75].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -3809,23 +4009,23 @@ uint32_t ClientService_next_cells_as_arrays_result::read(::apache::thrift::proto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size70;
-            ::apache::thrift::protocol::TType _etype73;
-            iprot->readListBegin(_etype73, _size70);
-            this->success.resize(_size70);
-            uint32_t _i74;
-            for (_i74 = 0; _i74 < _size70; ++_i74)
+            uint32_t _size76;
+            ::apache::thrift::protocol::TType _etype79;
+            iprot->readListBegin(_etype79, _size76);
+            this->success.resize(_size76);
+            uint32_t _i80;
+            for (_i80 = 0; _i80 < _size76; ++_i80)
             {
               {
-                this->success[_i74].clear();
-                uint32_t _size75;
-                ::apache::thrift::protocol::TType _etype78;
-                iprot->readListBegin(_etype78, _size75);
-                this->success[_i74].resize(_size75);
-                uint32_t _i79;
-                for (_i79 = 0; _i79 < _size75; ++_i79)
+                this->success[_i80].clear();
+                uint32_t _size81;
+                ::apache::thrift::protocol::TType _etype84;
+                iprot->readListBegin(_etype84, _size81);
+                this->success[_i80].resize(_size81);
+                uint32_t _i85;
+                for (_i85 = 0; _i85 < _size81; ++_i85)
                 {
-                  xfer += iprot->readString(this->success[_i74][_i79]);
+                  xfer += iprot->readString(this->success[_i80][_i85]);
                 }
                 iprot->readListEnd();
               }
@@ -3867,15 +4067,15 @@ uint32_t ClientService_next_cells_as_arrays_result::write(::apache::thrift::prot
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->success.size()));
-      std::vector<CellAsArray> ::const_iterator _iter80;
-      for (_iter80 = this->success.begin(); _iter80 != this->success.end(); ++_iter80)
+      std::vector<CellAsArray> ::const_iterator _iter86;
+      for (_iter86 = this->success.begin(); _iter86 != this->success.end(); ++_iter86)
       {
         {
-          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter80).size()));
-          std::vector<std::string> ::const_iterator _iter81;
-          for (_iter81 = (*_iter80).begin(); _iter81 != (*_iter80).end(); ++_iter81)
+          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter86).size()));
+          std::vector<std::string> ::const_iterator _iter87;
+          for (_iter87 = (*_iter86).begin(); _iter87 != (*_iter86).end(); ++_iter87)
           {
-            xfer += oprot->writeString((*_iter81));
+            xfer += oprot->writeString((*_iter87));
           }
           xfer += oprot->writeListEnd();
         }
@@ -3917,23 +4117,23 @@ uint32_t ClientService_next_cells_as_arrays_presult::read(::apache::thrift::prot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size82;
-            ::apache::thrift::protocol::TType _etype85;
-            iprot->readListBegin(_etype85, _size82);
-            (*(this->success)).resize(_size82);
-            uint32_t _i86;
-            for (_i86 = 0; _i86 < _size82; ++_i86)
+            uint32_t _size88;
+            ::apache::thrift::protocol::TType _etype91;
+            iprot->readListBegin(_etype91, _size88);
+            (*(this->success)).resize(_size88);
+            uint32_t _i92;
+            for (_i92 = 0; _i92 < _size88; ++_i92)
             {
               {
-                (*(this->success))[_i86].clear();
-                uint32_t _size87;
-                ::apache::thrift::protocol::TType _etype90;
-                iprot->readListBegin(_etype90, _size87);
-                (*(this->success))[_i86].resize(_size87);
-                uint32_t _i91;
-                for (_i91 = 0; _i91 < _size87; ++_i91)
+                (*(this->success))[_i92].clear();
+                uint32_t _size93;
+                ::apache::thrift::protocol::TType _etype96;
+                iprot->readListBegin(_etype96, _size93);
+                (*(this->success))[_i92].resize(_size93);
+                uint32_t _i97;
+                for (_i97 = 0; _i97 < _size93; ++_i97)
                 {
-                  xfer += iprot->readString((*(this->success))[_i86][_i91]);
+                  xfer += iprot->readString((*(this->success))[_i92][_i97]);
                 }
                 iprot->readListEnd();
               }
@@ -4209,14 +4409,14 @@ uint32_t ClientService_next_row_result::read(::apache::thrift::protocol::TProtoc
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size92;
-            ::apache::thrift::protocol::TType _etype95;
-            iprot->readListBegin(_etype95, _size92);
-            this->success.resize(_size92);
-            uint32_t _i96;
-            for (_i96 = 0; _i96 < _size92; ++_i96)
+            uint32_t _size98;
+            ::apache::thrift::protocol::TType _etype101;
+            iprot->readListBegin(_etype101, _size98);
+            this->success.resize(_size98);
+            uint32_t _i102;
+            for (_i102 = 0; _i102 < _size98; ++_i102)
             {
-              xfer += this->success[_i96].read(iprot);
+              xfer += this->success[_i102].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -4255,10 +4455,10 @@ uint32_t ClientService_next_row_result::write(::apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Cell> ::const_iterator _iter97;
-      for (_iter97 = this->success.begin(); _iter97 != this->success.end(); ++_iter97)
+      std::vector<Cell> ::const_iterator _iter103;
+      for (_iter103 = this->success.begin(); _iter103 != this->success.end(); ++_iter103)
       {
-        xfer += (*_iter97).write(oprot);
+        xfer += (*_iter103).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4297,14 +4497,14 @@ uint32_t ClientService_next_row_presult::read(::apache::thrift::protocol::TProto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size98;
-            ::apache::thrift::protocol::TType _etype101;
-            iprot->readListBegin(_etype101, _size98);
-            (*(this->success)).resize(_size98);
-            uint32_t _i102;
-            for (_i102 = 0; _i102 < _size98; ++_i102)
+            uint32_t _size104;
+            ::apache::thrift::protocol::TType _etype107;
+            iprot->readListBegin(_etype107, _size104);
+            (*(this->success)).resize(_size104);
+            uint32_t _i108;
+            for (_i108 = 0; _i108 < _size104; ++_i108)
             {
-              xfer += (*(this->success))[_i102].read(iprot);
+              xfer += (*(this->success))[_i108].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -4419,23 +4619,23 @@ uint32_t ClientService_next_row_as_arrays_result::read(::apache::thrift::protoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size103;
-            ::apache::thrift::protocol::TType _etype106;
-            iprot->readListBegin(_etype106, _size103);
-            this->success.resize(_size103);
-            uint32_t _i107;
-            for (_i107 = 0; _i107 < _size103; ++_i107)
+            uint32_t _size109;
+            ::apache::thrift::protocol::TType _etype112;
+            iprot->readListBegin(_etype112, _size109);
+            this->success.resize(_size109);
+            uint32_t _i113;
+            for (_i113 = 0; _i113 < _size109; ++_i113)
             {
               {
-                this->success[_i107].clear();
-                uint32_t _size108;
-                ::apache::thrift::protocol::TType _etype111;
-                iprot->readListBegin(_etype111, _size108);
-                this->success[_i107].resize(_size108);
-                uint32_t _i112;
-                for (_i112 = 0; _i112 < _size108; ++_i112)
+                this->success[_i113].clear();
+                uint32_t _size114;
+                ::apache::thrift::protocol::TType _etype117;
+                iprot->readListBegin(_etype117, _size114);
+                this->success[_i113].resize(_size114);
+                uint32_t _i118;
+                for (_i118 = 0; _i118 < _size114; ++_i118)
                 {
-                  xfer += iprot->readString(this->success[_i107][_i112]);
+                  xfer += iprot->readString(this->success[_i113][_i118]);
                 }
                 iprot->readListEnd();
               }
@@ -4477,15 +4677,15 @@ uint32_t ClientService_next_row_as_arrays_result::write(::apache::thrift::protoc
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->success.size()));
-      std::vector<CellAsArray> ::const_iterator _iter113;
-      for (_iter113 = this->success.begin(); _iter113 != this->success.end(); ++_iter113)
+      std::vector<CellAsArray> ::const_iterator _iter119;
+      for (_iter119 = this->success.begin(); _iter119 != this->success.end(); ++_iter119)
       {
         {
-          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter113).size()));
-          std::vector<std::string> ::const_iterator _iter114;
-          for (_iter114 = (*_iter113).begin(); _iter114 != (*_iter113).end(); ++_iter114)
+          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter119).size()));
+          std::vector<std::string> ::const_iterator _iter120;
+          for (_iter120 = (*_iter119).begin(); _iter120 != (*_iter119).end(); ++_iter120)
           {
-            xfer += oprot->writeString((*_iter114));
+            xfer += oprot->writeString((*_iter120));
           }
           xfer += oprot->writeListEnd();
         }
@@ -4527,23 +4727,23 @@ uint32_t ClientService_next_row_as_arrays_presult::read(::apache::thrift::protoc
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size115;
-            ::apache::thrift::protocol::TType _etype118;
-            iprot->readListBegin(_etype118, _size115);
-            (*(this->success)).resize(_size115);
-            uint32_t _i119;
-            for (_i119 = 0; _i119 < _size115; ++_i119)
+            uint32_t _size121;
+            ::apache::thrift::protocol::TType _etype124;
+            iprot->readListBegin(_etype124, _size121);
+            (*(this->success)).resize(_size121);
+            uint32_t _i125;
+            for (_i125 = 0; _i125 < _size121; ++_i125)
             {
               {
-                (*(this->success))[_i119].clear();
-                uint32_t _size120;
-                ::apache::thrift::protocol::TType _etype123;
-                iprot->readListBegin(_etype123, _size120);
-                (*(this->success))[_i119].resize(_size120);
-                uint32_t _i124;
-                for (_i124 = 0; _i124 < _size120; ++_i124)
+                (*(this->success))[_i125].clear();
+                uint32_t _size126;
+                ::apache::thrift::protocol::TType _etype129;
+                iprot->readListBegin(_etype129, _size126);
+                (*(this->success))[_i125].resize(_size126);
+                uint32_t _i130;
+                for (_i130 = 0; _i130 < _size126; ++_i130)
                 {
-                  xfer += iprot->readString((*(this->success))[_i119][_i124]);
+                  xfer += iprot->readString((*(this->success))[_i125][_i130]);
                 }
                 iprot->readListEnd();
               }
@@ -4867,14 +5067,14 @@ uint32_t ClientService_get_row_result::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size125;
-            ::apache::thrift::protocol::TType _etype128;
-            iprot->readListBegin(_etype128, _size125);
-            this->success.resize(_size125);
-            uint32_t _i129;
-            for (_i129 = 0; _i129 < _size125; ++_i129)
+            uint32_t _size131;
+            ::apache::thrift::protocol::TType _etype134;
+            iprot->readListBegin(_etype134, _size131);
+            this->success.resize(_size131);
+            uint32_t _i135;
+            for (_i135 = 0; _i135 < _size131; ++_i135)
             {
-              xfer += this->success[_i129].read(iprot);
+              xfer += this->success[_i135].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -4913,10 +5113,10 @@ uint32_t ClientService_get_row_result::write(::apache::thrift::protocol::TProtoc
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Cell> ::const_iterator _iter130;
-      for (_iter130 = this->success.begin(); _iter130 != this->success.end(); ++_iter130)
+      std::vector<Cell> ::const_iterator _iter136;
+      for (_iter136 = this->success.begin(); _iter136 != this->success.end(); ++_iter136)
       {
-        xfer += (*_iter130).write(oprot);
+        xfer += (*_iter136).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -4955,14 +5155,14 @@ uint32_t ClientService_get_row_presult::read(::apache::thrift::protocol::TProtoc
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size131;
-            ::apache::thrift::protocol::TType _etype134;
-            iprot->readListBegin(_etype134, _size131);
-            (*(this->success)).resize(_size131);
-            uint32_t _i135;
-            for (_i135 = 0; _i135 < _size131; ++_i135)
+            uint32_t _size137;
+            ::apache::thrift::protocol::TType _etype140;
+            iprot->readListBegin(_etype140, _size137);
+            (*(this->success)).resize(_size137);
+            uint32_t _i141;
+            for (_i141 = 0; _i141 < _size137; ++_i141)
             {
-              xfer += (*(this->success))[_i135].read(iprot);
+              xfer += (*(this->success))[_i141].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -5105,23 +5305,23 @@ uint32_t ClientService_get_row_as_arrays_result::read(::apache::thrift::protocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size136;
-            ::apache::thrift::protocol::TType _etype139;
-            iprot->readListBegin(_etype139, _size136);
-            this->success.resize(_size136);
-            uint32_t _i140;
-            for (_i140 = 0; _i140 < _size136; ++_i140)
+            uint32_t _size142;
+            ::apache::thrift::protocol::TType _etype145;
+            iprot->readListBegin(_etype145, _size142);
+            this->success.resize(_size142);
+            uint32_t _i146;
+            for (_i146 = 0; _i146 < _size142; ++_i146)
             {
               {
-                this->success[_i140].clear();
-                uint32_t _size141;
-                ::apache::thrift::protocol::TType _etype144;
-                iprot->readListBegin(_etype144, _size141);
-                this->success[_i140].resize(_size141);
-                uint32_t _i145;
-                for (_i145 = 0; _i145 < _size141; ++_i145)
+                this->success[_i146].clear();
+                uint32_t _size147;
+                ::apache::thrift::protocol::TType _etype150;
+                iprot->readListBegin(_etype150, _size147);
+                this->success[_i146].resize(_size147);
+                uint32_t _i151;
+                for (_i151 = 0; _i151 < _size147; ++_i151)
                 {
-                  xfer += iprot->readString(this->success[_i140][_i145]);
+                  xfer += iprot->readString(this->success[_i146][_i151]);
                 }
                 iprot->readListEnd();
               }
@@ -5163,15 +5363,15 @@ uint32_t ClientService_get_row_as_arrays_result::write(::apache::thrift::protoco
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->success.size()));
-      std::vector<CellAsArray> ::const_iterator _iter146;
-      for (_iter146 = this->success.begin(); _iter146 != this->success.end(); ++_iter146)
+      std::vector<CellAsArray> ::const_iterator _iter152;
+      for (_iter152 = this->success.begin(); _iter152 != this->success.end(); ++_iter152)
       {
         {
-          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter146).size()));
-          std::vector<std::string> ::const_iterator _iter147;
-          for (_iter147 = (*_iter146).begin(); _iter147 != (*_iter146).end(); ++_iter147)
+          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter152).size()));
+          std::vector<std::string> ::const_iterator _iter153;
+          for (_iter153 = (*_iter152).begin(); _iter153 != (*_iter152).end(); ++_iter153)
           {
-            xfer += oprot->writeString((*_iter147));
+            xfer += oprot->writeString((*_iter153));
           }
           xfer += oprot->writeListEnd();
         }
@@ -5213,23 +5413,23 @@ uint32_t ClientService_get_row_as_arrays_presult::read(::apache::thrift::protoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size148;
-            ::apache::thrift::protocol::TType _etype151;
-            iprot->readListBegin(_etype151, _size148);
-            (*(this->success)).resize(_size148);
-            uint32_t _i152;
-            for (_i152 = 0; _i152 < _size148; ++_i152)
+            uint32_t _size154;
+            ::apache::thrift::protocol::TType _etype157;
+            iprot->readListBegin(_etype157, _size154);
+            (*(this->success)).resize(_size154);
+            uint32_t _i158;
+            for (_i158 = 0; _i158 < _size154; ++_i158)
             {
               {
-                (*(this->success))[_i152].clear();
-                uint32_t _size153;
-                ::apache::thrift::protocol::TType _etype156;
-                iprot->readListBegin(_etype156, _size153);
-                (*(this->success))[_i152].resize(_size153);
-                uint32_t _i157;
-                for (_i157 = 0; _i157 < _size153; ++_i157)
+                (*(this->success))[_i158].clear();
+                uint32_t _size159;
+                ::apache::thrift::protocol::TType _etype162;
+                iprot->readListBegin(_etype162, _size159);
+                (*(this->success))[_i158].resize(_size159);
+                uint32_t _i163;
+                for (_i163 = 0; _i163 < _size159; ++_i163)
                 {
-                  xfer += iprot->readString((*(this->success))[_i152][_i157]);
+                  xfer += iprot->readString((*(this->success))[_i158][_i163]);
                 }
                 iprot->readListEnd();
               }
@@ -5801,14 +6001,14 @@ uint32_t ClientService_get_cells_result::read(::apache::thrift::protocol::TProto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size158;
-            ::apache::thrift::protocol::TType _etype161;
-            iprot->readListBegin(_etype161, _size158);
-            this->success.resize(_size158);
-            uint32_t _i162;
-            for (_i162 = 0; _i162 < _size158; ++_i162)
+            uint32_t _size164;
+            ::apache::thrift::protocol::TType _etype167;
+            iprot->readListBegin(_etype167, _size164);
+            this->success.resize(_size164);
+            uint32_t _i168;
+            for (_i168 = 0; _i168 < _size164; ++_i168)
             {
-              xfer += this->success[_i162].read(iprot);
+              xfer += this->success[_i168].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -5847,10 +6047,10 @@ uint32_t ClientService_get_cells_result::write(::apache::thrift::protocol::TProt
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<Cell> ::const_iterator _iter163;
-      for (_iter163 = this->success.begin(); _iter163 != this->success.end(); ++_iter163)
+      std::vector<Cell> ::const_iterator _iter169;
+      for (_iter169 = this->success.begin(); _iter169 != this->success.end(); ++_iter169)
       {
-        xfer += (*_iter163).write(oprot);
+        xfer += (*_iter169).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -5889,14 +6089,14 @@ uint32_t ClientService_get_cells_presult::read(::apache::thrift::protocol::TProt
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size164;
-            ::apache::thrift::protocol::TType _etype167;
-            iprot->readListBegin(_etype167, _size164);
-            (*(this->success)).resize(_size164);
-            uint32_t _i168;
-            for (_i168 = 0; _i168 < _size164; ++_i168)
+            uint32_t _size170;
+            ::apache::thrift::protocol::TType _etype173;
+            iprot->readListBegin(_etype173, _size170);
+            (*(this->success)).resize(_size170);
+            uint32_t _i174;
+            for (_i174 = 0; _i174 < _size170; ++_i174)
             {
-              xfer += (*(this->success))[_i168].read(iprot);
+              xfer += (*(this->success))[_i174].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -6039,23 +6239,23 @@ uint32_t ClientService_get_cells_as_arrays_result::read(::apache::thrift::protoc
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size169;
-            ::apache::thrift::protocol::TType _etype172;
-            iprot->readListBegin(_etype172, _size169);
-            this->success.resize(_size169);
-            uint32_t _i173;
-            for (_i173 = 0; _i173 < _size169; ++_i173)
+            uint32_t _size175;
+            ::apache::thrift::protocol::TType _etype178;
+            iprot->readListBegin(_etype178, _size175);
+            this->success.resize(_size175);
+            uint32_t _i179;
+            for (_i179 = 0; _i179 < _size175; ++_i179)
             {
               {
-                this->success[_i173].clear();
-                uint32_t _size174;
-                ::apache::thrift::protocol::TType _etype177;
-                iprot->readListBegin(_etype177, _size174);
-                this->success[_i173].resize(_size174);
-                uint32_t _i178;
-                for (_i178 = 0; _i178 < _size174; ++_i178)
+                this->success[_i179].clear();
+                uint32_t _size180;
+                ::apache::thrift::protocol::TType _etype183;
+                iprot->readListBegin(_etype183, _size180);
+                this->success[_i179].resize(_size180);
+                uint32_t _i184;
+                for (_i184 = 0; _i184 < _size180; ++_i184)
                 {
-                  xfer += iprot->readString(this->success[_i173][_i178]);
+                  xfer += iprot->readString(this->success[_i179][_i184]);
                 }
                 iprot->readListEnd();
               }
@@ -6097,15 +6297,15 @@ uint32_t ClientService_get_cells_as_arrays_result::write(::apache::thrift::proto
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->success.size()));
-      std::vector<CellAsArray> ::const_iterator _iter179;
-      for (_iter179 = this->success.begin(); _iter179 != this->success.end(); ++_iter179)
+      std::vector<CellAsArray> ::const_iterator _iter185;
+      for (_iter185 = this->success.begin(); _iter185 != this->success.end(); ++_iter185)
       {
         {
-          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter179).size()));
-          std::vector<std::string> ::const_iterator _iter180;
-          for (_iter180 = (*_iter179).begin(); _iter180 != (*_iter179).end(); ++_iter180)
+          xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter185).size()));
+          std::vector<std::string> ::const_iterator _iter186;
+          for (_iter186 = (*_iter185).begin(); _iter186 != (*_iter185).end(); ++_iter186)
           {
-            xfer += oprot->writeString((*_iter180));
+            xfer += oprot->writeString((*_iter186));
           }
           xfer += oprot->writeListEnd();
         }
@@ -6147,23 +6347,23 @@ uint32_t ClientService_get_cells_as_arrays_presult::read(::apache::thrift::proto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size181;
-            ::apache::thrift::protocol::TType _etype184;
-            iprot->readListBegin(_etype184, _size181);
-            (*(this->success)).resize(_size181);
-            uint32_t _i185;
-            for (_i185 = 0; _i185 < _size181; ++_i185)
+            uint32_t _size187;
+            ::apache::thrift::protocol::TType _etype190;
+            iprot->readListBegin(_etype190, _size187);
+            (*(this->success)).resize(_size187);
+            uint32_t _i191;
+            for (_i191 = 0; _i191 < _size187; ++_i191)
             {
               {
-                (*(this->success))[_i185].clear();
-                uint32_t _size186;
-                ::apache::thrift::protocol::TType _etype189;
-                iprot->readListBegin(_etype189, _size186);
-                (*(this->success))[_i185].resize(_size186);
-                uint32_t _i190;
-                for (_i190 = 0; _i190 < _size186; ++_i190)
+                (*(this->success))[_i191].clear();
+                uint32_t _size192;
+                ::apache::thrift::protocol::TType _etype195;
+                iprot->readListBegin(_etype195, _size192);
+                (*(this->success))[_i191].resize(_size192);
+                uint32_t _i196;
+                for (_i196 = 0; _i196 < _size192; ++_i196)
                 {
-                  xfer += iprot->readString((*(this->success))[_i185][_i190]);
+                  xfer += iprot->readString((*(this->success))[_i191][_i196]);
                 }
                 iprot->readListEnd();
               }
@@ -6635,14 +6835,14 @@ uint32_t ClientService_offer_cells_args::read(::apache::thrift::protocol::TProto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size191;
-            ::apache::thrift::protocol::TType _etype194;
-            iprot->readListBegin(_etype194, _size191);
-            this->cells.resize(_size191);
-            uint32_t _i195;
-            for (_i195 = 0; _i195 < _size191; ++_i195)
+            uint32_t _size197;
+            ::apache::thrift::protocol::TType _etype200;
+            iprot->readListBegin(_etype200, _size197);
+            this->cells.resize(_size197);
+            uint32_t _i201;
+            for (_i201 = 0; _i201 < _size197; ++_i201)
             {
-              xfer += this->cells[_i195].read(iprot);
+              xfer += this->cells[_i201].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -6678,10 +6878,10 @@ uint32_t ClientService_offer_cells_args::write(::apache::thrift::protocol::TProt
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->cells.size()));
-    std::vector<Cell> ::const_iterator _iter196;
-    for (_iter196 = this->cells.begin(); _iter196 != this->cells.end(); ++_iter196)
+    std::vector<Cell> ::const_iterator _iter202;
+    for (_iter202 = this->cells.begin(); _iter202 != this->cells.end(); ++_iter202)
     {
-      xfer += (*_iter196).write(oprot);
+      xfer += (*_iter202).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -6706,10 +6906,10 @@ uint32_t ClientService_offer_cells_pargs::write(::apache::thrift::protocol::TPro
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>((*(this->cells)).size()));
-    std::vector<Cell> ::const_iterator _iter197;
-    for (_iter197 = (*(this->cells)).begin(); _iter197 != (*(this->cells)).end(); ++_iter197)
+    std::vector<Cell> ::const_iterator _iter203;
+    for (_iter203 = (*(this->cells)).begin(); _iter203 != (*(this->cells)).end(); ++_iter203)
     {
-      xfer += (*_iter197).write(oprot);
+      xfer += (*_iter203).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -6863,23 +7063,23 @@ uint32_t ClientService_offer_cells_as_arrays_args::read(::apache::thrift::protoc
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size198;
-            ::apache::thrift::protocol::TType _etype201;
-            iprot->readListBegin(_etype201, _size198);
-            this->cells.resize(_size198);
-            uint32_t _i202;
-            for (_i202 = 0; _i202 < _size198; ++_i202)
+            uint32_t _size204;
+            ::apache::thrift::protocol::TType _etype207;
+            iprot->readListBegin(_etype207, _size204);
+            this->cells.resize(_size204);
+            uint32_t _i208;
+            for (_i208 = 0; _i208 < _size204; ++_i208)
             {
               {
-                this->cells[_i202].clear();
-                uint32_t _size203;
-                ::apache::thrift::protocol::TType _etype206;
-                iprot->readListBegin(_etype206, _size203);
-                this->cells[_i202].resize(_size203);
-                uint32_t _i207;
-                for (_i207 = 0; _i207 < _size203; ++_i207)
+                this->cells[_i208].clear();
+                uint32_t _size209;
+                ::apache::thrift::protocol::TType _etype212;
+                iprot->readListBegin(_etype212, _size209);
+                this->cells[_i208].resize(_size209);
+                uint32_t _i213;
+                for (_i213 = 0; _i213 < _size209; ++_i213)
                 {
-                  xfer += iprot->readString(this->cells[_i202][_i207]);
+                  xfer += iprot->readString(this->cells[_i208][_i213]);
                 }
                 iprot->readListEnd();
               }
@@ -6918,15 +7118,15 @@ uint32_t ClientService_offer_cells_as_arrays_args::write(::apache::thrift::proto
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->cells.size()));
-    std::vector<CellAsArray> ::const_iterator _iter208;
-    for (_iter208 = this->cells.begin(); _iter208 != this->cells.end(); ++_iter208)
+    std::vector<CellAsArray> ::const_iterator _iter214;
+    for (_iter214 = this->cells.begin(); _iter214 != this->cells.end(); ++_iter214)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter208).size()));
-        std::vector<std::string> ::const_iterator _iter209;
-        for (_iter209 = (*_iter208).begin(); _iter209 != (*_iter208).end(); ++_iter209)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter214).size()));
+        std::vector<std::string> ::const_iterator _iter215;
+        for (_iter215 = (*_iter214).begin(); _iter215 != (*_iter214).end(); ++_iter215)
         {
-          xfer += oprot->writeString((*_iter209));
+          xfer += oprot->writeString((*_iter215));
         }
         xfer += oprot->writeListEnd();
       }
@@ -6954,15 +7154,15 @@ uint32_t ClientService_offer_cells_as_arrays_pargs::write(::apache::thrift::prot
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>((*(this->cells)).size()));
-    std::vector<CellAsArray> ::const_iterator _iter210;
-    for (_iter210 = (*(this->cells)).begin(); _iter210 != (*(this->cells)).end(); ++_iter210)
+    std::vector<CellAsArray> ::const_iterator _iter216;
+    for (_iter216 = (*(this->cells)).begin(); _iter216 != (*(this->cells)).end(); ++_iter216)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter210).size()));
-        std::vector<std::string> ::const_iterator _iter211;
-        for (_iter211 = (*_iter210).begin(); _iter211 != (*_iter210).end(); ++_iter211)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter216).size()));
+        std::vector<std::string> ::const_iterator _iter217;
+        for (_iter217 = (*_iter216).begin(); _iter217 != (*_iter216).end(); ++_iter217)
         {
-          xfer += oprot->writeString((*_iter211));
+          xfer += oprot->writeString((*_iter217));
         }
         xfer += oprot->writeListEnd();
       }
@@ -7319,14 +7519,14 @@ uint32_t ClientService_offer_cell_as_array_args::read(::apache::thrift::protocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cell.clear();
-            uint32_t _size212;
-            ::apache::thrift::protocol::TType _etype215;
-            iprot->readListBegin(_etype215, _size212);
-            this->cell.resize(_size212);
-            uint32_t _i216;
-            for (_i216 = 0; _i216 < _size212; ++_i216)
+            uint32_t _size218;
+            ::apache::thrift::protocol::TType _etype221;
+            iprot->readListBegin(_etype221, _size218);
+            this->cell.resize(_size218);
+            uint32_t _i222;
+            for (_i222 = 0; _i222 < _size218; ++_i222)
             {
-              xfer += iprot->readString(this->cell[_i216]);
+              xfer += iprot->readString(this->cell[_i222]);
             }
             iprot->readListEnd();
           }
@@ -7362,10 +7562,10 @@ uint32_t ClientService_offer_cell_as_array_args::write(::apache::thrift::protoco
   xfer += oprot->writeFieldBegin("cell", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->cell.size()));
-    std::vector<std::string> ::const_iterator _iter217;
-    for (_iter217 = this->cell.begin(); _iter217 != this->cell.end(); ++_iter217)
+    std::vector<std::string> ::const_iterator _iter223;
+    for (_iter223 = this->cell.begin(); _iter223 != this->cell.end(); ++_iter223)
     {
-      xfer += oprot->writeString((*_iter217));
+      xfer += oprot->writeString((*_iter223));
     }
     xfer += oprot->writeListEnd();
   }
@@ -7390,10 +7590,10 @@ uint32_t ClientService_offer_cell_as_array_pargs::write(::apache::thrift::protoc
   xfer += oprot->writeFieldBegin("cell", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->cell)).size()));
-    std::vector<std::string> ::const_iterator _iter218;
-    for (_iter218 = (*(this->cell)).begin(); _iter218 != (*(this->cell)).end(); ++_iter218)
+    std::vector<std::string> ::const_iterator _iter224;
+    for (_iter224 = (*(this->cell)).begin(); _iter224 != (*(this->cell)).end(); ++_iter224)
     {
-      xfer += oprot->writeString((*_iter218));
+      xfer += oprot->writeString((*_iter224));
     }
     xfer += oprot->writeListEnd();
   }
@@ -8617,14 +8817,14 @@ uint32_t ClientService_set_cell_as_array_args::read(::apache::thrift::protocol::
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cell.clear();
-            uint32_t _size219;
-            ::apache::thrift::protocol::TType _etype222;
-            iprot->readListBegin(_etype222, _size219);
-            this->cell.resize(_size219);
-            uint32_t _i223;
-            for (_i223 = 0; _i223 < _size219; ++_i223)
+            uint32_t _size225;
+            ::apache::thrift::protocol::TType _etype228;
+            iprot->readListBegin(_etype228, _size225);
+            this->cell.resize(_size225);
+            uint32_t _i229;
+            for (_i229 = 0; _i229 < _size225; ++_i229)
             {
-              xfer += iprot->readString(this->cell[_i223]);
+              xfer += iprot->readString(this->cell[_i229]);
             }
             iprot->readListEnd();
           }
@@ -8654,10 +8854,10 @@ uint32_t ClientService_set_cell_as_array_args::write(::apache::thrift::protocol:
   xfer += oprot->writeFieldBegin("cell", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->cell.size()));
-    std::vector<std::string> ::const_iterator _iter224;
-    for (_iter224 = this->cell.begin(); _iter224 != this->cell.end(); ++_iter224)
+    std::vector<std::string> ::const_iterator _iter230;
+    for (_iter230 = this->cell.begin(); _iter230 != this->cell.end(); ++_iter230)
     {
-      xfer += oprot->writeString((*_iter224));
+      xfer += oprot->writeString((*_iter230));
     }
     xfer += oprot->writeListEnd();
   }
@@ -8676,10 +8876,10 @@ uint32_t ClientService_set_cell_as_array_pargs::write(::apache::thrift::protocol
   xfer += oprot->writeFieldBegin("cell", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->cell)).size()));
-    std::vector<std::string> ::const_iterator _iter225;
-    for (_iter225 = (*(this->cell)).begin(); _iter225 != (*(this->cell)).end(); ++_iter225)
+    std::vector<std::string> ::const_iterator _iter231;
+    for (_iter231 = (*(this->cell)).begin(); _iter231 != (*(this->cell)).end(); ++_iter231)
     {
-      xfer += oprot->writeString((*_iter225));
+      xfer += oprot->writeString((*_iter231));
     }
     xfer += oprot->writeListEnd();
   }
@@ -8817,14 +9017,14 @@ uint32_t ClientService_set_cells_args::read(::apache::thrift::protocol::TProtoco
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size226;
-            ::apache::thrift::protocol::TType _etype229;
-            iprot->readListBegin(_etype229, _size226);
-            this->cells.resize(_size226);
-            uint32_t _i230;
-            for (_i230 = 0; _i230 < _size226; ++_i230)
+            uint32_t _size232;
+            ::apache::thrift::protocol::TType _etype235;
+            iprot->readListBegin(_etype235, _size232);
+            this->cells.resize(_size232);
+            uint32_t _i236;
+            for (_i236 = 0; _i236 < _size232; ++_i236)
             {
-              xfer += this->cells[_i230].read(iprot);
+              xfer += this->cells[_i236].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -8854,10 +9054,10 @@ uint32_t ClientService_set_cells_args::write(::apache::thrift::protocol::TProtoc
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->cells.size()));
-    std::vector<Cell> ::const_iterator _iter231;
-    for (_iter231 = this->cells.begin(); _iter231 != this->cells.end(); ++_iter231)
+    std::vector<Cell> ::const_iterator _iter237;
+    for (_iter237 = this->cells.begin(); _iter237 != this->cells.end(); ++_iter237)
     {
-      xfer += (*_iter231).write(oprot);
+      xfer += (*_iter237).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -8876,10 +9076,10 @@ uint32_t ClientService_set_cells_pargs::write(::apache::thrift::protocol::TProto
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>((*(this->cells)).size()));
-    std::vector<Cell> ::const_iterator _iter232;
-    for (_iter232 = (*(this->cells)).begin(); _iter232 != (*(this->cells)).end(); ++_iter232)
+    std::vector<Cell> ::const_iterator _iter238;
+    for (_iter238 = (*(this->cells)).begin(); _iter238 != (*(this->cells)).end(); ++_iter238)
     {
-      xfer += (*_iter232).write(oprot);
+      xfer += (*_iter238).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -9017,23 +9217,23 @@ uint32_t ClientService_set_cells_as_arrays_args::read(::apache::thrift::protocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size233;
-            ::apache::thrift::protocol::TType _etype236;
-            iprot->readListBegin(_etype236, _size233);
-            this->cells.resize(_size233);
-            uint32_t _i237;
-            for (_i237 = 0; _i237 < _size233; ++_i237)
+            uint32_t _size239;
+            ::apache::thrift::protocol::TType _etype242;
+            iprot->readListBegin(_etype242, _size239);
+            this->cells.resize(_size239);
+            uint32_t _i243;
+            for (_i243 = 0; _i243 < _size239; ++_i243)
             {
               {
-                this->cells[_i237].clear();
-                uint32_t _size238;
-                ::apache::thrift::protocol::TType _etype241;
-                iprot->readListBegin(_etype241, _size238);
-                this->cells[_i237].resize(_size238);
-                uint32_t _i242;
-                for (_i242 = 0; _i242 < _size238; ++_i242)
+                this->cells[_i243].clear();
+                uint32_t _size244;
+                ::apache::thrift::protocol::TType _etype247;
+                iprot->readListBegin(_etype247, _size244);
+                this->cells[_i243].resize(_size244);
+                uint32_t _i248;
+                for (_i248 = 0; _i248 < _size244; ++_i248)
                 {
-                  xfer += iprot->readString(this->cells[_i237][_i242]);
+                  xfer += iprot->readString(this->cells[_i243][_i248]);
                 }
                 iprot->readListEnd();
               }
@@ -9066,15 +9266,15 @@ uint32_t ClientService_set_cells_as_arrays_args::write(::apache::thrift::protoco
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->cells.size()));
-    std::vector<CellAsArray> ::const_iterator _iter243;
-    for (_iter243 = this->cells.begin(); _iter243 != this->cells.end(); ++_iter243)
+    std::vector<CellAsArray> ::const_iterator _iter249;
+    for (_iter249 = this->cells.begin(); _iter249 != this->cells.end(); ++_iter249)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter243).size()));
-        std::vector<std::string> ::const_iterator _iter244;
-        for (_iter244 = (*_iter243).begin(); _iter244 != (*_iter243).end(); ++_iter244)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter249).size()));
+        std::vector<std::string> ::const_iterator _iter250;
+        for (_iter250 = (*_iter249).begin(); _iter250 != (*_iter249).end(); ++_iter250)
         {
-          xfer += oprot->writeString((*_iter244));
+          xfer += oprot->writeString((*_iter250));
         }
         xfer += oprot->writeListEnd();
       }
@@ -9096,15 +9296,15 @@ uint32_t ClientService_set_cells_as_arrays_pargs::write(::apache::thrift::protoc
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>((*(this->cells)).size()));
-    std::vector<CellAsArray> ::const_iterator _iter245;
-    for (_iter245 = (*(this->cells)).begin(); _iter245 != (*(this->cells)).end(); ++_iter245)
+    std::vector<CellAsArray> ::const_iterator _iter251;
+    for (_iter251 = (*(this->cells)).begin(); _iter251 != (*(this->cells)).end(); ++_iter251)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter245).size()));
-        std::vector<std::string> ::const_iterator _iter246;
-        for (_iter246 = (*_iter245).begin(); _iter246 != (*_iter245).end(); ++_iter246)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter251).size()));
+        std::vector<std::string> ::const_iterator _iter252;
+        for (_iter252 = (*_iter251).begin(); _iter252 != (*_iter251).end(); ++_iter252)
         {
-          xfer += oprot->writeString((*_iter246));
+          xfer += oprot->writeString((*_iter252));
         }
         xfer += oprot->writeListEnd();
       }
@@ -9761,14 +9961,14 @@ uint32_t ClientService_set_cell_as_array_async_args::read(::apache::thrift::prot
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cell.clear();
-            uint32_t _size247;
-            ::apache::thrift::protocol::TType _etype250;
-            iprot->readListBegin(_etype250, _size247);
-            this->cell.resize(_size247);
-            uint32_t _i251;
-            for (_i251 = 0; _i251 < _size247; ++_i251)
+            uint32_t _size253;
+            ::apache::thrift::protocol::TType _etype256;
+            iprot->readListBegin(_etype256, _size253);
+            this->cell.resize(_size253);
+            uint32_t _i257;
+            for (_i257 = 0; _i257 < _size253; ++_i257)
             {
-              xfer += iprot->readString(this->cell[_i251]);
+              xfer += iprot->readString(this->cell[_i257]);
             }
             iprot->readListEnd();
           }
@@ -9798,10 +9998,10 @@ uint32_t ClientService_set_cell_as_array_async_args::write(::apache::thrift::pro
   xfer += oprot->writeFieldBegin("cell", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->cell.size()));
-    std::vector<std::string> ::const_iterator _iter252;
-    for (_iter252 = this->cell.begin(); _iter252 != this->cell.end(); ++_iter252)
+    std::vector<std::string> ::const_iterator _iter258;
+    for (_iter258 = this->cell.begin(); _iter258 != this->cell.end(); ++_iter258)
     {
-      xfer += oprot->writeString((*_iter252));
+      xfer += oprot->writeString((*_iter258));
     }
     xfer += oprot->writeListEnd();
   }
@@ -9820,10 +10020,10 @@ uint32_t ClientService_set_cell_as_array_async_pargs::write(::apache::thrift::pr
   xfer += oprot->writeFieldBegin("cell", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*(this->cell)).size()));
-    std::vector<std::string> ::const_iterator _iter253;
-    for (_iter253 = (*(this->cell)).begin(); _iter253 != (*(this->cell)).end(); ++_iter253)
+    std::vector<std::string> ::const_iterator _iter259;
+    for (_iter259 = (*(this->cell)).begin(); _iter259 != (*(this->cell)).end(); ++_iter259)
     {
-      xfer += oprot->writeString((*_iter253));
+      xfer += oprot->writeString((*_iter259));
     }
     xfer += oprot->writeListEnd();
   }
@@ -9961,14 +10161,14 @@ uint32_t ClientService_set_cells_async_args::read(::apache::thrift::protocol::TP
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size254;
-            ::apache::thrift::protocol::TType _etype257;
-            iprot->readListBegin(_etype257, _size254);
-            this->cells.resize(_size254);
-            uint32_t _i258;
-            for (_i258 = 0; _i258 < _size254; ++_i258)
+            uint32_t _size260;
+            ::apache::thrift::protocol::TType _etype263;
+            iprot->readListBegin(_etype263, _size260);
+            this->cells.resize(_size260);
+            uint32_t _i264;
+            for (_i264 = 0; _i264 < _size260; ++_i264)
             {
-              xfer += this->cells[_i258].read(iprot);
+              xfer += this->cells[_i264].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -9998,10 +10198,10 @@ uint32_t ClientService_set_cells_async_args::write(::apache::thrift::protocol::T
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->cells.size()));
-    std::vector<Cell> ::const_iterator _iter259;
-    for (_iter259 = this->cells.begin(); _iter259 != this->cells.end(); ++_iter259)
+    std::vector<Cell> ::const_iterator _iter265;
+    for (_iter265 = this->cells.begin(); _iter265 != this->cells.end(); ++_iter265)
     {
-      xfer += (*_iter259).write(oprot);
+      xfer += (*_iter265).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -10020,10 +10220,10 @@ uint32_t ClientService_set_cells_async_pargs::write(::apache::thrift::protocol::
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>((*(this->cells)).size()));
-    std::vector<Cell> ::const_iterator _iter260;
-    for (_iter260 = (*(this->cells)).begin(); _iter260 != (*(this->cells)).end(); ++_iter260)
+    std::vector<Cell> ::const_iterator _iter266;
+    for (_iter266 = (*(this->cells)).begin(); _iter266 != (*(this->cells)).end(); ++_iter266)
     {
-      xfer += (*_iter260).write(oprot);
+      xfer += (*_iter266).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -10161,23 +10361,23 @@ uint32_t ClientService_set_cells_as_arrays_async_args::read(::apache::thrift::pr
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->cells.clear();
-            uint32_t _size261;
-            ::apache::thrift::protocol::TType _etype264;
-            iprot->readListBegin(_etype264, _size261);
-            this->cells.resize(_size261);
-            uint32_t _i265;
-            for (_i265 = 0; _i265 < _size261; ++_i265)
+            uint32_t _size267;
+            ::apache::thrift::protocol::TType _etype270;
+            iprot->readListBegin(_etype270, _size267);
+            this->cells.resize(_size267);
+            uint32_t _i271;
+            for (_i271 = 0; _i271 < _size267; ++_i271)
             {
               {
-                this->cells[_i265].clear();
-                uint32_t _size266;
-                ::apache::thrift::protocol::TType _etype269;
-                iprot->readListBegin(_etype269, _size266);
-                this->cells[_i265].resize(_size266);
-                uint32_t _i270;
-                for (_i270 = 0; _i270 < _size266; ++_i270)
+                this->cells[_i271].clear();
+                uint32_t _size272;
+                ::apache::thrift::protocol::TType _etype275;
+                iprot->readListBegin(_etype275, _size272);
+                this->cells[_i271].resize(_size272);
+                uint32_t _i276;
+                for (_i276 = 0; _i276 < _size272; ++_i276)
                 {
-                  xfer += iprot->readString(this->cells[_i265][_i270]);
+                  xfer += iprot->readString(this->cells[_i271][_i276]);
                 }
                 iprot->readListEnd();
               }
@@ -10210,15 +10410,15 @@ uint32_t ClientService_set_cells_as_arrays_async_args::write(::apache::thrift::p
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>(this->cells.size()));
-    std::vector<CellAsArray> ::const_iterator _iter271;
-    for (_iter271 = this->cells.begin(); _iter271 != this->cells.end(); ++_iter271)
+    std::vector<CellAsArray> ::const_iterator _iter277;
+    for (_iter277 = this->cells.begin(); _iter277 != this->cells.end(); ++_iter277)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter271).size()));
-        std::vector<std::string> ::const_iterator _iter272;
-        for (_iter272 = (*_iter271).begin(); _iter272 != (*_iter271).end(); ++_iter272)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter277).size()));
+        std::vector<std::string> ::const_iterator _iter278;
+        for (_iter278 = (*_iter277).begin(); _iter278 != (*_iter277).end(); ++_iter278)
         {
-          xfer += oprot->writeString((*_iter272));
+          xfer += oprot->writeString((*_iter278));
         }
         xfer += oprot->writeListEnd();
       }
@@ -10240,15 +10440,15 @@ uint32_t ClientService_set_cells_as_arrays_async_pargs::write(::apache::thrift::
   xfer += oprot->writeFieldBegin("cells", ::apache::thrift::protocol::T_LIST, 2);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_LIST, static_cast<uint32_t>((*(this->cells)).size()));
-    std::vector<CellAsArray> ::const_iterator _iter273;
-    for (_iter273 = (*(this->cells)).begin(); _iter273 != (*(this->cells)).end(); ++_iter273)
+    std::vector<CellAsArray> ::const_iterator _iter279;
+    for (_iter279 = (*(this->cells)).begin(); _iter279 != (*(this->cells)).end(); ++_iter279)
     {
       {
-        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter273).size()));
-        std::vector<std::string> ::const_iterator _iter274;
-        for (_iter274 = (*_iter273).begin(); _iter274 != (*_iter273).end(); ++_iter274)
+        xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>((*_iter279).size()));
+        std::vector<std::string> ::const_iterator _iter280;
+        for (_iter280 = (*_iter279).begin(); _iter280 != (*_iter279).end(); ++_iter280)
         {
-          xfer += oprot->writeString((*_iter274));
+          xfer += oprot->writeString((*_iter280));
         }
         xfer += oprot->writeListEnd();
       }
@@ -11925,14 +12125,14 @@ uint32_t ClientService_get_tables_result::read(::apache::thrift::protocol::TProt
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size275;
-            ::apache::thrift::protocol::TType _etype278;
-            iprot->readListBegin(_etype278, _size275);
-            this->success.resize(_size275);
-            uint32_t _i279;
-            for (_i279 = 0; _i279 < _size275; ++_i279)
+            uint32_t _size281;
+            ::apache::thrift::protocol::TType _etype284;
+            iprot->readListBegin(_etype284, _size281);
+            this->success.resize(_size281);
+            uint32_t _i285;
+            for (_i285 = 0; _i285 < _size281; ++_i285)
             {
-              xfer += iprot->readString(this->success[_i279]);
+              xfer += iprot->readString(this->success[_i285]);
             }
             iprot->readListEnd();
           }
@@ -11971,10 +12171,10 @@ uint32_t ClientService_get_tables_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->success.size()));
-      std::vector<std::string> ::const_iterator _iter280;
-      for (_iter280 = this->success.begin(); _iter280 != this->success.end(); ++_iter280)
+      std::vector<std::string> ::const_iterator _iter286;
+      for (_iter286 = this->success.begin(); _iter286 != this->success.end(); ++_iter286)
       {
-        xfer += oprot->writeString((*_iter280));
+        xfer += oprot->writeString((*_iter286));
       }
       xfer += oprot->writeListEnd();
     }
@@ -12013,14 +12213,14 @@ uint32_t ClientService_get_tables_presult::read(::apache::thrift::protocol::TPro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size281;
-            ::apache::thrift::protocol::TType _etype284;
-            iprot->readListBegin(_etype284, _size281);
-            (*(this->success)).resize(_size281);
-            uint32_t _i285;
-            for (_i285 = 0; _i285 < _size281; ++_i285)
+            uint32_t _size287;
+            ::apache::thrift::protocol::TType _etype290;
+            iprot->readListBegin(_etype290, _size287);
+            (*(this->success)).resize(_size287);
+            uint32_t _i291;
+            for (_i291 = 0; _i291 < _size287; ++_i291)
             {
-              xfer += iprot->readString((*(this->success))[_i285]);
+              xfer += iprot->readString((*(this->success))[_i291]);
             }
             iprot->readListEnd();
           }
@@ -12135,14 +12335,14 @@ uint32_t ClientService_get_listing_result::read(::apache::thrift::protocol::TPro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size286;
-            ::apache::thrift::protocol::TType _etype289;
-            iprot->readListBegin(_etype289, _size286);
-            this->success.resize(_size286);
-            uint32_t _i290;
-            for (_i290 = 0; _i290 < _size286; ++_i290)
+            uint32_t _size292;
+            ::apache::thrift::protocol::TType _etype295;
+            iprot->readListBegin(_etype295, _size292);
+            this->success.resize(_size292);
+            uint32_t _i296;
+            for (_i296 = 0; _i296 < _size292; ++_i296)
             {
-              xfer += this->success[_i290].read(iprot);
+              xfer += this->success[_i296].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -12181,10 +12381,10 @@ uint32_t ClientService_get_listing_result::write(::apache::thrift::protocol::TPr
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<NamespaceListing> ::const_iterator _iter291;
-      for (_iter291 = this->success.begin(); _iter291 != this->success.end(); ++_iter291)
+      std::vector<NamespaceListing> ::const_iterator _iter297;
+      for (_iter297 = this->success.begin(); _iter297 != this->success.end(); ++_iter297)
       {
-        xfer += (*_iter291).write(oprot);
+        xfer += (*_iter297).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -12223,14 +12423,14 @@ uint32_t ClientService_get_listing_presult::read(::apache::thrift::protocol::TPr
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size292;
-            ::apache::thrift::protocol::TType _etype295;
-            iprot->readListBegin(_etype295, _size292);
-            (*(this->success)).resize(_size292);
-            uint32_t _i296;
-            for (_i296 = 0; _i296 < _size292; ++_i296)
+            uint32_t _size298;
+            ::apache::thrift::protocol::TType _etype301;
+            iprot->readListBegin(_etype301, _size298);
+            (*(this->success)).resize(_size298);
+            uint32_t _i302;
+            for (_i302 = 0; _i302 < _size298; ++_i302)
             {
-              xfer += (*(this->success))[_i296].read(iprot);
+              xfer += (*(this->success))[_i302].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -12359,14 +12559,14 @@ uint32_t ClientService_get_table_splits_result::read(::apache::thrift::protocol:
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size297;
-            ::apache::thrift::protocol::TType _etype300;
-            iprot->readListBegin(_etype300, _size297);
-            this->success.resize(_size297);
-            uint32_t _i301;
-            for (_i301 = 0; _i301 < _size297; ++_i301)
+            uint32_t _size303;
+            ::apache::thrift::protocol::TType _etype306;
+            iprot->readListBegin(_etype306, _size303);
+            this->success.resize(_size303);
+            uint32_t _i307;
+            for (_i307 = 0; _i307 < _size303; ++_i307)
             {
-              xfer += this->success[_i301].read(iprot);
+              xfer += this->success[_i307].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -12405,10 +12605,10 @@ uint32_t ClientService_get_table_splits_result::write(::apache::thrift::protocol
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<TableSplit> ::const_iterator _iter302;
-      for (_iter302 = this->success.begin(); _iter302 != this->success.end(); ++_iter302)
+      std::vector<TableSplit> ::const_iterator _iter308;
+      for (_iter308 = this->success.begin(); _iter308 != this->success.end(); ++_iter308)
       {
-        xfer += (*_iter302).write(oprot);
+        xfer += (*_iter308).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -12447,14 +12647,14 @@ uint32_t ClientService_get_table_splits_presult::read(::apache::thrift::protocol
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size303;
-            ::apache::thrift::protocol::TType _etype306;
-            iprot->readListBegin(_etype306, _size303);
-            (*(this->success)).resize(_size303);
-            uint32_t _i307;
-            for (_i307 = 0; _i307 < _size303; ++_i307)
+            uint32_t _size309;
+            ::apache::thrift::protocol::TType _etype312;
+            iprot->readListBegin(_etype312, _size309);
+            (*(this->success)).resize(_size309);
+            uint32_t _i313;
+            for (_i313 = 0; _i313 < _size309; ++_i313)
             {
-              xfer += (*(this->success))[_i307].read(iprot);
+              xfer += (*(this->success))[_i313].read(iprot);
             }
             iprot->readListEnd();
           }
@@ -13141,6 +13341,65 @@ void ClientServiceClient::recv_create_table()
   return;
 }
 
+void ClientServiceClient::create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec)
+{
+  send_create_table_with_splits(ns, table_name, schema, split_spec);
+  recv_create_table_with_splits();
+}
+
+void ClientServiceClient::send_create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("create_table_with_splits", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  ClientService_create_table_with_splits_pargs args;
+  args.ns = &ns;
+  args.table_name = &table_name;
+  args.schema = &schema;
+  args.split_spec = &split_spec;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void ClientServiceClient::recv_create_table_with_splits()
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("create_table_with_splits") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  ClientService_create_table_with_splits_presult result;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.e) {
+    throw result.e;
+  }
+  return;
+}
+
 void ClientServiceClient::alter_table(const Namespace ns, const std::string& table_name, const std::string& schema)
 {
   send_alter_table(ns, table_name, schema);
@@ -17175,6 +17434,62 @@ void ClientServiceProcessor::process_create_table(int32_t seqid, ::apache::thrif
   }
 }
 
+void ClientServiceProcessor::process_create_table_with_splits(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (eventHandler_.get() != NULL) {
+    ctx = eventHandler_->getContext("ClientService.create_table_with_splits", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(eventHandler_.get(), ctx, "ClientService.create_table_with_splits");
+
+  if (eventHandler_.get() != NULL) {
+    eventHandler_->preRead(ctx, "ClientService.create_table_with_splits");
+  }
+
+  ClientService_create_table_with_splits_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (eventHandler_.get() != NULL) {
+    eventHandler_->postRead(ctx, "ClientService.create_table_with_splits", bytes);
+  }
+
+  ClientService_create_table_with_splits_result result;
+  try {
+    iface_->create_table_with_splits(args.ns, args.table_name, args.schema, args.split_spec);
+  } catch (ClientException &e) {
+    result.e = e;
+    result.__isset.e = true;
+  } catch (const std::exception& e) {
+    if (eventHandler_.get() != NULL) {
+      eventHandler_->handlerError(ctx, "ClientService.create_table_with_splits");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("create_table_with_splits", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (eventHandler_.get() != NULL) {
+    eventHandler_->preWrite(ctx, "ClientService.create_table_with_splits");
+  }
+
+  oprot->writeMessageBegin("create_table_with_splits", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (eventHandler_.get() != NULL) {
+    eventHandler_->postWrite(ctx, "ClientService.create_table_with_splits", bytes);
+  }
+}
+
 void ClientServiceProcessor::process_alter_table(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
@@ -16,6 +16,7 @@ class ClientServiceIf {
   virtual ~ClientServiceIf() {}
   virtual void create_namespace(const std::string& ns) = 0;
   virtual void create_table(const Namespace ns, const std::string& table_name, const std::string& schema) = 0;
+  virtual void create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec) = 0;
   virtual void alter_table(const Namespace ns, const std::string& table_name, const std::string& schema) = 0;
   virtual Namespace open_namespace(const std::string& ns) = 0;
   virtual void close_namespace(const Namespace ns) = 0;
@@ -92,6 +93,9 @@ class ClientServiceNull : virtual public ClientServiceIf {
   void create_table(const Namespace /* ns */, const std::string& /* table_name */, const std::string& /* schema */) {
     return;
   }
+  void create_table_with_splits(const Namespace /* ns */, const std::string& /* table_name */, const std::string& /* schema */, const SplitSpec& /* split_spec */) {
+    return;
+  }
   void alter_table(const Namespace /* ns */, const std::string& /* table_name */, const std::string& /* schema */) {
     return;
   }
@@ -535,6 +539,141 @@ class ClientService_create_table_presult {
 
 };
 
+typedef struct _ClientService_create_table_with_splits_args__isset {
+  _ClientService_create_table_with_splits_args__isset() : ns(false), table_name(false), schema(false), split_spec(false) {}
+  bool ns;
+  bool table_name;
+  bool schema;
+  bool split_spec;
+} _ClientService_create_table_with_splits_args__isset;
+
+class ClientService_create_table_with_splits_args {
+ public:
+
+  ClientService_create_table_with_splits_args() : ns(0), table_name(""), schema("") {
+  }
+
+  virtual ~ClientService_create_table_with_splits_args() throw() {}
+
+  Namespace ns;
+  std::string table_name;
+  std::string schema;
+  SplitSpec split_spec;
+
+  _ClientService_create_table_with_splits_args__isset __isset;
+
+  void __set_ns(const Namespace val) {
+    ns = val;
+  }
+
+  void __set_table_name(const std::string& val) {
+    table_name = val;
+  }
+
+  void __set_schema(const std::string& val) {
+    schema = val;
+  }
+
+  void __set_split_spec(const SplitSpec& val) {
+    split_spec = val;
+  }
+
+  bool operator == (const ClientService_create_table_with_splits_args & rhs) const
+  {
+    if (!(ns == rhs.ns))
+      return false;
+    if (!(table_name == rhs.table_name))
+      return false;
+    if (!(schema == rhs.schema))
+      return false;
+    if (!(split_spec == rhs.split_spec))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_create_table_with_splits_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_create_table_with_splits_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class ClientService_create_table_with_splits_pargs {
+ public:
+
+
+  virtual ~ClientService_create_table_with_splits_pargs() throw() {}
+
+  const Namespace* ns;
+  const std::string* table_name;
+  const std::string* schema;
+  const SplitSpec* split_spec;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ClientService_create_table_with_splits_result__isset {
+  _ClientService_create_table_with_splits_result__isset() : e(false) {}
+  bool e;
+} _ClientService_create_table_with_splits_result__isset;
+
+class ClientService_create_table_with_splits_result {
+ public:
+
+  ClientService_create_table_with_splits_result() {
+  }
+
+  virtual ~ClientService_create_table_with_splits_result() throw() {}
+
+  ClientException e;
+
+  _ClientService_create_table_with_splits_result__isset __isset;
+
+  void __set_e(const ClientException& val) {
+    e = val;
+  }
+
+  bool operator == (const ClientService_create_table_with_splits_result & rhs) const
+  {
+    if (!(e == rhs.e))
+      return false;
+    return true;
+  }
+  bool operator != (const ClientService_create_table_with_splits_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ClientService_create_table_with_splits_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _ClientService_create_table_with_splits_presult__isset {
+  _ClientService_create_table_with_splits_presult__isset() : e(false) {}
+  bool e;
+} _ClientService_create_table_with_splits_presult__isset;
+
+class ClientService_create_table_with_splits_presult {
+ public:
+
+
+  virtual ~ClientService_create_table_with_splits_presult() throw() {}
+
+  ClientException e;
+
+  _ClientService_create_table_with_splits_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _ClientService_alter_table_args__isset {
   _ClientService_alter_table_args__isset() : ns(false), table_name(false), schema(false) {}
   bool ns;
@@ -8506,6 +8645,9 @@ class ClientServiceClient : virtual public ClientServiceIf {
   void create_table(const Namespace ns, const std::string& table_name, const std::string& schema);
   void send_create_table(const Namespace ns, const std::string& table_name, const std::string& schema);
   void recv_create_table();
+  void create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec);
+  void send_create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec);
+  void recv_create_table_with_splits();
   void alter_table(const Namespace ns, const std::string& table_name, const std::string& schema);
   void send_alter_table(const Namespace ns, const std::string& table_name, const std::string& schema);
   void recv_alter_table();
@@ -8716,6 +8858,7 @@ class ClientServiceProcessor : virtual public ::apache::thrift::TProcessor {
   std::map<std::string, void (ClientServiceProcessor::*)(int32_t, ::apache::thrift::protocol::TProtocol*, ::apache::thrift::protocol::TProtocol*, void*)> processMap_;
   void process_create_namespace(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_create_table(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_create_table_with_splits(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_alter_table(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_open_namespace(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_close_namespace(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -8786,6 +8929,7 @@ class ClientServiceProcessor : virtual public ::apache::thrift::TProcessor {
     iface_(iface) {
     processMap_["create_namespace"] = &ClientServiceProcessor::process_create_namespace;
     processMap_["create_table"] = &ClientServiceProcessor::process_create_table;
+    processMap_["create_table_with_splits"] = &ClientServiceProcessor::process_create_table_with_splits;
     processMap_["alter_table"] = &ClientServiceProcessor::process_alter_table;
     processMap_["open_namespace"] = &ClientServiceProcessor::process_open_namespace;
     processMap_["close_namespace"] = &ClientServiceProcessor::process_close_namespace;
@@ -8883,6 +9027,13 @@ class ClientServiceMultiface : virtual public ClientServiceIf {
     }
   }
 
+  void create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec) {
+    size_t sz = ifaces_.size();
+    for (size_t i = 0; i < sz; ++i) {
+      ifaces_[i]->create_table_with_splits(ns, table_name, schema, split_spec);
+    }
+  }
+
   void alter_table(const Namespace ns, const std::string& table_name, const std::string& schema) {
     size_t sz = ifaces_.size();
     for (size_t i = 0; i < sz; ++i) {
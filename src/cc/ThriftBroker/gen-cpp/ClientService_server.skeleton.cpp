@@ -32,6 +32,11 @@ class ClientServiceHandler : virtual public ClientServiceIf {
     printf("create_table\n");
   }
 
+  void create_table_with_splits(const Namespace ns, const std::string& table_name, const std::string& schema, const SplitSpec& split_spec) {
+    // Your implementation goes here
+    printf("create_table_with_splits\n");
+  }
+
   void alter_table(const Namespace ns, const std::string& table_name, const std::string& schema) {
     // Your implementation goes here
     printf("alter_table\n");
@@ -25,13 +25,15 @@ const std::map<int, const char*> _KeyFlag_VALUES_TO_NAMES(::apache::thrift::TEnu
 
 int _kMutatorFlagValues[] = {
   MutatorFlag::NO_LOG_SYNC,
-  MutatorFlag::IGNORE_UNKNOWN_CFS
+  MutatorFlag::IGNORE_UNKNOWN_CFS,
+  MutatorFlag::COALESCE_UPDATES
 };
 const char* _kMutatorFlagNames[] = {
   "NO_LOG_SYNC",
-  "IGNORE_UNKNOWN_CFS"
+  "IGNORE_UNKNOWN_CFS",
+  "COALESCE_UPDATES"
 };
-const std::map<int, const char*> _MutatorFlag_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(2, _kMutatorFlagValues, _kMutatorFlagNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
+const std::map<int, const char*> _MutatorFlag_VALUES_TO_NAMES(::apache::thrift::TEnumIterator(3, _kMutatorFlagValues, _kMutatorFlagNames), ::apache::thrift::TEnumIterator(-1, NULL, NULL));
 
 const char* RowInterval::ascii_fingerprint = "E1A4BCD94F003EFF8636F1C98591705A";
 const uint8_t RowInterval::binary_fingerprint[16] = {0xE1,0xA4,0xBC,0xD9,0x4F,0x00,0x3E,0xFF,0x86,0x36,0xF1,0xC9,0x85,0x91,0x70,0x5A};
@@ -1549,8 +1551,8 @@ uint32_t ColumnFamily::write(::apache::thrift::protocol::TProtocol* oprot) const
   return xfer;
 }
 
-const char* AccessGroup::ascii_fingerprint = "17108017AF8680A78499DB15024EC92B";
-const uint8_t AccessGroup::binary_fingerprint[16] = {0x17,0x10,0x80,0x17,0xAF,0x86,0x80,0xA7,0x84,0x99,0xDB,0x15,0x02,0x4E,0xC9,0x2B};
+const char* AccessGroup::ascii_fingerprint = "5FD10AFC43C98B2D4154180AFE96C9CC";
+const uint8_t AccessGroup::binary_fingerprint[16] = {0x5F,0xD1,0x0A,0xFC,0x43,0xC9,0x8B,0x2D,0x41,0x54,0x18,0x0A,0xFE,0x96,0xC9,0xCC};
 
 uint32_t AccessGroup::read(::apache::thrift::protocol::TProtocol* iprot) {
 
@@ -1640,6 +1642,14 @@ uint32_t AccessGroup::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 8:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->compaction_policy);
+          this->__isset.compaction_policy = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1698,13 +1708,18 @@ uint32_t AccessGroup::write(::apache::thrift::protocol::TProtocol* oprot) const
     }
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.compaction_policy) {
+    xfer += oprot->writeFieldBegin("compaction_policy", ::apache::thrift::protocol::T_STRING, 8);
+    xfer += oprot->writeString(this->compaction_policy);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
 }
 
-const char* Schema::ascii_fingerprint = "69B5DA4C91BFF355857D905B1B5A3A03";
-const uint8_t Schema::binary_fingerprint[16] = {0x69,0xB5,0xDA,0x4C,0x91,0xBF,0xF3,0x55,0x85,0x7D,0x90,0x5B,0x1B,0x5A,0x3A,0x03};
+const char* Schema::ascii_fingerprint = "728E3AC4BFF6678286F9989CF24E33D1";
+const uint8_t Schema::binary_fingerprint[16] = {0x72,0x8E,0x3A,0xC4,0xBF,0xF6,0x67,0x82,0x86,0xF9,0x98,0x9C,0xF2,0x4E,0x33,0xD1};
 
 uint32_t Schema::read(::apache::thrift::protocol::TProtocol* iprot) {
 
@@ -1820,6 +1835,108 @@ uint32_t Schema::write(::apache::thrift::protocol::TProtocol* oprot) const {
   return xfer;
 }
 
+const char* SplitSpec::ascii_fingerprint = "BC54E0D15AB12EF355A33407F165F568";
+const uint8_t SplitSpec::binary_fingerprint[16] = {0xBC,0x54,0xE0,0xD1,0x5A,0xB1,0x2E,0xF3,0x55,0xA3,0x34,0x07,0xF1,0x65,0xF5,0x68};
+
+uint32_t SplitSpec::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->rows.clear();
+            uint32_t _size59;
+            ::apache::thrift::protocol::TType _etype62;
+            iprot->readListBegin(_etype62, _size59);
+            this->rows.resize(_size59);
+            uint32_t _i63;
+            for (_i63 = 0; _i63 < _size59; ++_i63)
+            {
+              xfer += iprot->readString(this->rows[_i63]);
+            }
+            iprot->readListEnd();
+          }
+          this->__isset.rows = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->algorithm);
+          this->__isset.algorithm = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->range_count);
+          this->__isset.range_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t SplitSpec::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  xfer += oprot->writeStructBegin("SplitSpec");
+  if (this->__isset.rows) {
+    xfer += oprot->writeFieldBegin("rows", ::apache::thrift::protocol::T_LIST, 1);
+    {
+      xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->rows.size()));
+      std::vector<std::string> ::const_iterator _iter64;
+      for (_iter64 = this->rows.begin(); _iter64 != this->rows.end(); ++_iter64)
+      {
+        xfer += oprot->writeString((*_iter64));
+      }
+      xfer += oprot->writeListEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.algorithm) {
+    xfer += oprot->writeFieldBegin("algorithm", ::apache::thrift::protocol::T_STRING, 2);
+    xfer += oprot->writeString(this->algorithm);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.range_count) {
+    xfer += oprot->writeFieldBegin("range_count", ::apache::thrift::protocol::T_I32, 3);
+    xfer += oprot->writeI32(this->range_count);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
 const char* ClientException::ascii_fingerprint = "3F5FC93B338687BC7235B1AB103F47B3";
 const uint8_t ClientException::binary_fingerprint[16] = {0x3F,0x5F,0xC9,0x3B,0x33,0x86,0x87,0xBC,0x72,0x35,0xB1,0xAB,0x10,0x3F,0x47,0xB3};
 
@@ -30,7 +30,8 @@ extern const std::map<int, const char*> _KeyFlag_VALUES_TO_NAMES;
 struct MutatorFlag {
   enum type {
     NO_LOG_SYNC = 1,
-    IGNORE_UNKNOWN_CFS = 2
+    IGNORE_UNKNOWN_CFS = 2,
+    COALESCE_UPDATES = 4
   };
 };
 
@@ -1097,7 +1098,7 @@ class ColumnFamily {
 };
 
 typedef struct _AccessGroup__isset {
-  _AccessGroup__isset() : name(false), in_memory(false), replication(false), blocksize(false), compressor(false), bloom_filter(false), columns(false) {}
+  _AccessGroup__isset() : name(false), in_memory(false), replication(false), blocksize(false), compressor(false), bloom_filter(false), columns(false), compaction_policy(false) {}
   bool name;
   bool in_memory;
   bool replication;
@@ -1105,15 +1106,16 @@ typedef struct _AccessGroup__isset {
   bool compressor;
   bool bloom_filter;
   bool columns;
+  bool compaction_policy;
 } _AccessGroup__isset;
 
 class AccessGroup {
  public:
 
-  static const char* ascii_fingerprint; // = "17108017AF8680A78499DB15024EC92B";
-  static const uint8_t binary_fingerprint[16]; // = {0x17,0x10,0x80,0x17,0xAF,0x86,0x80,0xA7,0x84,0x99,0xDB,0x15,0x02,0x4E,0xC9,0x2B};
+  static const char* ascii_fingerprint; // = "5FD10AFC43C98B2D4154180AFE96C9CC";
+  static const uint8_t binary_fingerprint[16]; // = {0x5F,0xD1,0x0A,0xFC,0x43,0xC9,0x8B,0x2D,0x41,0x54,0x18,0x0A,0xFE,0x96,0xC9,0xCC};
 
-  AccessGroup() : name(""), in_memory(0), replication(0), blocksize(0), compressor(""), bloom_filter("") {
+  AccessGroup() : name(""), in_memory(0), replication(0), blocksize(0), compressor(""), bloom_filter(""), compaction_policy("") {
   }
 
   virtual ~AccessGroup() throw() {}
@@ -1125,6 +1127,7 @@ class AccessGroup {
   std::string compressor;
   std::string bloom_filter;
   std::vector<ColumnFamily>  columns;
+  std::string compaction_policy;
 
   _AccessGroup__isset __isset;
 
@@ -1163,6 +1166,11 @@ class AccessGroup {
     __isset.columns = true;
   }
 
+  void __set_compaction_policy(const std::string& val) {
+    compaction_policy = val;
+    __isset.compaction_policy = true;
+  }
+
   bool operator == (const AccessGroup & rhs) const
   {
     if (__isset.name != rhs.__isset.name)
@@ -1193,6 +1201,10 @@ class AccessGroup {
       return false;
     else if (__isset.columns && !(columns == rhs.columns))
       return false;
+    if (__isset.compaction_policy != rhs.__isset.compaction_policy)
+      return false;
+    else if (__isset.compaction_policy && !(compaction_policy == rhs.compaction_policy))
+      return false;
     return true;
   }
   bool operator != (const AccessGroup &rhs) const {
@@ -1215,8 +1227,8 @@ typedef struct _Schema__isset {
 class Schema {
  public:
 
-  static const char* ascii_fingerprint; // = "69B5DA4C91BFF355857D905B1B5A3A03";
-  static const uint8_t binary_fingerprint[16]; // = {0x69,0xB5,0xDA,0x4C,0x91,0xBF,0xF3,0x55,0x85,0x7D,0x90,0x5B,0x1B,0x5A,0x3A,0x03};
+  static const char* ascii_fingerprint; // = "728E3AC4BFF6678286F9989CF24E33D1";
+  static const uint8_t binary_fingerprint[16]; // = {0x72,0x8E,0x3A,0xC4,0xBF,0xF6,0x67,0x82,0x86,0xF9,0x98,0x9C,0xF2,0x4E,0x33,0xD1};
 
   Schema() {
   }
@@ -1261,6 +1273,72 @@ class Schema {
 
 };
 
+typedef struct _SplitSpec__isset {
+  _SplitSpec__isset() : rows(false), algorithm(false), range_count(false) {}
+  bool rows;
+  bool algorithm;
+  bool range_count;
+} _SplitSpec__isset;
+
+class SplitSpec {
+ public:
+
+  static const char* ascii_fingerprint; // = "BC54E0D15AB12EF355A33407F165F568";
+  static const uint8_t binary_fingerprint[16]; // = {0xBC,0x54,0xE0,0xD1,0x5A,0xB1,0x2E,0xF3,0x55,0xA3,0x34,0x07,0xF1,0x65,0xF5,0x68};
+
+  SplitSpec() : algorithm(""), range_count(0) {
+  }
+
+  virtual ~SplitSpec() throw() {}
+
+  std::vector<std::string>  rows;
+  std::string algorithm;
+  int32_t range_count;
+
+  _SplitSpec__isset __isset;
+
+  void __set_rows(const std::vector<std::string> & val) {
+    rows = val;
+    __isset.rows = true;
+  }
+
+  void __set_algorithm(const std::string& val) {
+    algorithm = val;
+    __isset.algorithm = true;
+  }
+
+  void __set_range_count(const int32_t val) {
+    range_count = val;
+    __isset.range_count = true;
+  }
+
+  bool operator == (const SplitSpec & rhs) const
+  {
+    if (__isset.rows != rhs.__isset.rows)
+      return false;
+    else if (__isset.rows && !(rows == rhs.rows))
+      return false;
+    if (__isset.algorithm != rhs.__isset.algorithm)
+      return false;
+    else if (__isset.algorithm && !(algorithm == rhs.algorithm))
+      return false;
+    if (__isset.range_count != rhs.__isset.range_count)
+      return false;
+    else if (__isset.range_count && !(range_count == rhs.range_count))
+      return false;
+    return true;
+  }
+  bool operator != (const SplitSpec &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const SplitSpec & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
 typedef struct _ClientException__isset {
   _ClientException__isset() : code(false), message(false) {}
   bool code;
@@ -0,0 +1,238 @@
+/** -*- c++ -*-
+ * Copyright (C) 2011 Hypertable, Inc.
+ *
+ * This file is part of Hypertable.
+ *
+ * Hypertable is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; version 3 of the
+ * License.
+ *
+ * Hypertable is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+#include "Common/Compat.h"
+#include "Common/Init.h"
+#include "Common/LatencyHistogram.h"
+#include "Common/Logger.h"
+#include "Common/Mutex.h"
+#include "Common/Stopwatch.h"
+
+#include <iostream>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include "ThriftBroker/Client.h"
+#include "ThriftBroker/Config.h"
+#include "ThriftBroker/SerializedCellsReader.h"
+#include "ThriftBroker/SerializedCellsWriter.h"
+
+using namespace Hypertable;
+using namespace Config;
+using namespace std;
+
+namespace {
+
+  struct AppPolicy : Config::Policy {
+    static void init_options() {
+      cmdline_desc("Usage: %s [options]\n\n"
+                   "  This program drives a running ThriftBroker with many\n"
+                   "  concurrent clients, each of which writes its own rows\n"
+                   "  with set_cells_serialized and then reads them back\n"
+                   "  with next_cells_serialized.  Aggregate throughput and\n"
+                   "  per-call latency are reported for both phases.\n"
+                   "\nOptions").add_options()
+        ("clients", i32()->default_value(100), "Number of concurrent clients")
+        ("cells", i32()->default_value(10000), "Cells written per client")
+        ("batch-size", i32()->default_value(500),
+         "Cells per set_cells_serialized call")
+        ("value-size", i32()->default_value(100), "Value size in bytes")
+        ("table", str()->default_value("ThriftBrokerBenchmark"),
+         "Table to create and load")
+        ;
+    }
+  };
+
+  typedef Meta::list<ThriftClientPolicy, DefaultCommPolicy, AppPolicy> Policies;
+
+  struct Phase {
+    Phase() : cells(0), errors(0) { }
+    Mutex mutex;
+    LatencyHistogram latency;
+    uint64_t cells;
+    uint64_t errors;
+
+    void merge(const LatencyHistogram &hist, uint64_t ncells, bool error) {
+      ScopedLock lock(mutex);
+      latency.merge(hist);
+      cells += ncells;
+      if (error)
+        errors++;
+    }
+
+    void report(const char *name, double elapsed) {
+      cout << name << ": " << cells << " cells in " << elapsed << "s ("
+           << (uint64_t)(elapsed > 0 ? (double)cells / elapsed : 0)
+           << " cells/s), " << errors << " client errors\n  "
+           << latency.summary() << endl;
+    }
+  };
+
+  Phase g_write, g_read;
+
+  class BenchmarkClient {
+  public:
+    BenchmarkClient(int id, int phase) : m_id(id), m_phase(phase) { }
+
+    void operator()() {
+      LatencyHistogram hist;
+      uint64_t cells = 0;
+      bool error = false;
+
+      try {
+        Thrift::Client client(get_str("thrift-host"), get_i16("thrift-port"));
+        ThriftGen::Namespace ns = client.open_namespace("/");
+        if (m_phase == 0)
+          cells = write(client, ns, hist);
+        else
+          cells = read(client, ns, hist);
+        client.close_namespace(ns);
+      }
+      catch (ThriftGen::ClientException &e) {
+        HT_ERRORF("client %d: %s", m_id, e.message.c_str());
+        error = true;
+      }
+      catch (std::exception &e) {
+        HT_ERRORF("client %d: %s", m_id, e.what());
+        error = true;
+      }
+      (m_phase == 0 ? g_write : g_read).merge(hist, cells, error);
+    }
+
+  private:
+
+    uint64_t write(Thrift::Client &client, ThriftGen::Namespace ns,
+                   LatencyHistogram &hist) {
+      int32_t count = get_i32("cells");
+      int32_t batch_size = get_i32("batch-size");
+      String value(get_i32("value-size"), 'v');
+      char row[64];
+      uint64_t cells = 0;
+
+      ThriftGen::Mutator mutator = client.open_mutator(ns, get_str("table"), 0, 0);
+
+      for (int32_t i=0; i<count; ) {
+        SerializedCellsWriter writer(0, true);
+        for (int32_t j=0; j<batch_size && i<count; j++, i++) {
+          sprintf(row, "%05d-%010d", m_id, i);
+          writer.add(row, "data", "", AUTO_ASSIGN, value.data(), value.length());
+          cells++;
+        }
+        writer.finalize(SerializedCellsFlag::EOS);
+        ThriftGen::CellsSerialized buf((const char *)writer.get_buffer(),
+                                       writer.get_buffer_length());
+        Stopwatch stopwatch;
+        client.set_cells_serialized(mutator, buf, false);
+        stopwatch.stop();
+        hist.add((uint64_t)(stopwatch.elapsed() * 1000000.0));
+      }
+      client.close_mutator(mutator);
+      return cells;
+    }
+
+    uint64_t read(Thrift::Client &client, ThriftGen::Namespace ns,
+                  LatencyHistogram &hist) {
+      ThriftGen::ScanSpec ss;
+      ThriftGen::RowInterval ri;
+      ThriftGen::CellsSerialized buf;
+      uint64_t cells = 0;
+
+      ri.__set_start_row(format("%05d-", m_id));
+      ri.__set_start_inclusive(true);
+      ri.__set_end_row(format("%05d.", m_id));
+      ri.__set_end_inclusive(false);
+      ss.row_intervals.push_back(ri);
+      ss.__isset.row_intervals = true;
+
+      ThriftGen::Scanner scanner = client.open_scanner(ns, get_str("table"), ss);
+      while (true) {
+        Stopwatch stopwatch;
+        client.next_cells_serialized(buf, scanner);
+        stopwatch.stop();
+        hist.add((uint64_t)(stopwatch.elapsed() * 1000000.0));
+
+        SerializedCellsReader reader((void *)buf.c_str(), (uint32_t)buf.length());
+        while (reader.next())
+          cells++;
+        if (reader.eos())
+          break;
+      }
+      client.close_scanner(scanner);
+      return cells;
+    }
+
+    int m_id;
+    int m_phase;
+  };
+
+  double run_phase(int phase, int nclients) {
+    boost::thread_group threads;
+    Stopwatch stopwatch;
+    for (int i=0; i<nclients; i++)
+      threads.create_thread(BenchmarkClient(i, phase));
+    threads.join_all();
+    stopwatch.stop();
+    return stopwatch.elapsed();
+  }
+
+} // local namespace
+
+
+int main(int argc, char **argv) {
+  try {
+    init_with_policies<Policies>(argc, argv);
+
+    int nclients = get_i32("clients");
+    String table = get_str("table");
+
+    {
+      Thrift::Client client(get_str("thrift-host"), get_i16("thrift-port"));
+      ThriftGen::Namespace ns = client.open_namespace("/");
+      client.drop_table(ns, table, true);
+      client.create_table(ns, table, "<Schema><AccessGroup name=\"default\">"
+                          "<ColumnFamily><Name>data</Name></ColumnFamily>"
+                          "</AccessGroup></Schema>");
+      client.close_namespace(ns);
+    }
+
+    double elapsed = run_phase(0, nclients);
+    g_write.report("set_cells_serialized", elapsed);
+
+    elapsed = run_phase(1, nclients);
+    g_read.report("next_cells_serialized", elapsed);
+
+    if (g_read.cells != g_write.cells) {
+      HT_ERRORF("Read back %llu cells, expected %llu", (Llu)g_read.cells,
+                (Llu)g_write.cells);
+      return 1;
+    }
+  }
+  catch (ThriftGen::ClientException &e) {
+    HT_ERROR_OUT << e.message << HT_END;
+    return 1;
+  }
+  catch (Exception &e) {
+    HT_ERROR_OUT << e << HT_END;
+    return 1;
+  }
+  return 0;
+}
@@ -39,6 +39,7 @@ extern "C" {
 #include "Hypertable/Lib/Config.h"
 #include "Hypertable/Lib/Client.h"
 #include "Hypertable/Lib/BalancePlan.h"
+#include "Hypertable/Master/LoadBalancerBasicDistributeCost.h"
 #include "Hypertable/Master/LoadBalancerBasicDistributeLoad.h"
 
 using namespace Hypertable;
@@ -54,7 +55,9 @@ namespace {
     "Description:\n"
     "  This program is used to generate a load balancing plan.\n"
     "  The <rs_metrics_file> argument indicates the location of the file containing the dump\n"
-    "  of the 'sys/RS_METRICS' table.\n\n"
+    "  of the 'sys/RS_METRICS' table.  With --simulate, the plan is applied to\n"
+    "  the captured metrics and the resulting per-server resource usage and\n"
+    "  scores (as computed by the cost-aware balancer model) are reported.\n\n"
     "Options";
 
   struct AppPolicy : Config::Policy {
@@ -70,7 +73,9 @@ namespace {
         ("rs-metrics-loaded",  boo()->zero_tokens()->default_value(false),
          "If true then assume RS_METRICS is already loaded in namespace/table")
         ("load-balancer", str()->default_value("basic-distribute-load"),
-         "Type of load balancer to be used.")
+         "Type of load balancer to be used (basic-distribute-load, cost-aware).")
+        ("simulate", boo()->zero_tokens()->default_value(false),
+         "Evaluate the plan against the captured metrics")
         ("verbose,v", boo()->zero_tokens()->default_value(false),
          "Show more verbose output")
         ("balance-plan-file,b",  str()->default_value(""),
@@ -144,6 +149,11 @@ int main(int argc, char **argv) {
         << ", " << plan->moves[ii]->dest_location << ")";
     }
     *oo << " }" << endl;
+
+    if (get_bool("simulate")) {
+      LoadBalancerBasicDistributeCost model(properties, rs_metrics);
+      model.simulate(plan, *oo);
+    }
   }
   catch (Exception &e) {
     HT_ERROR_OUT << e << HT_END;
@@ -157,10 +167,16 @@ int main(int argc, char **argv) {
 void generate_balance_plan(PropertiesPtr &props, const String &load_balancer,
     TablePtr &rs_metrics, BalancePlanPtr &plan) {
 
+  if (load_balancer == "cost-aware") {
+    LoadBalancerBasicDistributeCost balancer(properties, rs_metrics);
+    balancer.compute_plan(plan);
+    return;
+  }
+
   if (load_balancer != "basic-distribute-load")
     HT_THROW(Error::NOT_IMPLEMENTED,
-             (String)"Only 'basic-distribute-load' balancer is supported. '" + load_balancer
-             + "' balancer not supported.");
+             (String)"Only 'basic-distribute-load' and 'cost-aware' balancers are "
+             "supported. '" + load_balancer + "' balancer not supported.");
 
   double loadavg_threshold = get_f64("Hypertable.LoadBalancer.LoadavgThreshold");
   LoadBalancerBasicDistributeLoad balancer(loadavg_threshold, rs_metrics);
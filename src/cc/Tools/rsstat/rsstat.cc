@@ -55,14 +55,45 @@ int main(int argc, char **argv) {
 
     RangeServerClient *client = new RangeServerClient(comm, timeout);
     StatsRangeServer stats;
-    String stats_str;
 
     client->get_statistics(addr, stats);
-    /** FIXME!!
-    stats->dump_str(stats_str);
 
-    std::cout << stats_str << std::endl;
-    */
+    std::cout << "location=" << stats.location << " version=" << stats.version
+              << " ranges=" << stats.range_count << " scanners="
+              << stats.scanner_count << " files=" << stats.file_count << "\n";
+    std::cout << "scans=" << stats.scan_count << " cells_scanned="
+              << stats.scanned_cells << " bytes_scanned=" << stats.scanned_bytes
+              << "\n";
+    std::cout << "updates=" << stats.update_count << " cells_updated="
+              << stats.updated_cells << " bytes_updated=" << stats.updated_bytes
+              << " syncs=" << stats.sync_count << "\n";
+    std::cout << "block_cache accesses=" << stats.block_cache_accesses
+              << " hits=" << stats.block_cache_hits << "\n";
+    if (stats.local_block_cache_capacity)
+      std::cout << "local_block_cache capacity="
+                << stats.local_block_cache_capacity << " used="
+                << stats.local_block_cache_used << " accesses="
+                << stats.local_block_cache_accesses << " hits="
+                << stats.local_block_cache_hits << "\n";
+    std::cout << "update_throttle level=" << stats.update_throttle_level
+              << " throttled=" << stats.updates_throttled << " delay_millis="
+              << stats.update_throttle_millis << "\n";
+    std::cout << "update_qualify batches=" << stats.update_qualify_batches
+              << " range_lists=" << stats.update_range_lists
+              << " arena_bytes=" << stats.update_arena_bytes << "\n";
+    std::cout << "Latency (since server start):\n";
+    for (int i=0; i<StatsRangeServer::LATENCY_PHASE_COUNT; i++)
+      std::cout << "  " << StatsRangeServer::latency_phase_name(i) << " "
+                << stats.latency[i].summary() << "\n";
+    std::cout << "Codec mix:\n";
+    for (int i=0; i<BlockCompressionCodec::COMPRESSION_TYPE_LIMIT; i++) {
+      if (stats.codec_blocks[i])
+        std::cout << "  " << BlockCompressionCodec::get_compressor_name(i)
+                  << " blocks=" << stats.codec_blocks[i] << " bytes="
+                  << stats.codec_bytes[i] << " zbytes="
+                  << stats.codec_zbytes[i] << "\n";
+    }
+    std::cout << std::flush;
   }
   catch (Exception &e) {
     HT_ERROR_OUT << e << HT_END;
@@ -43,6 +43,9 @@ import org.slf4j.LoggerFactory;
  * 
  *   <dt>columns</dt>
  *   <dd>Specifies list of column families in this AG</dd>
+ * 
+ *   <dt>compaction_policy</dt>
+ *   <dd>Specifies compaction policy for this AG</dd>
  * </dl>
  */
 public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessGroup._Fields>, java.io.Serializable, Cloneable {
@@ -55,6 +58,7 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
   private static final org.apache.thrift.protocol.TField COMPRESSOR_FIELD_DESC = new org.apache.thrift.protocol.TField("compressor", org.apache.thrift.protocol.TType.STRING, (short)5);
   private static final org.apache.thrift.protocol.TField BLOOM_FILTER_FIELD_DESC = new org.apache.thrift.protocol.TField("bloom_filter", org.apache.thrift.protocol.TType.STRING, (short)6);
   private static final org.apache.thrift.protocol.TField COLUMNS_FIELD_DESC = new org.apache.thrift.protocol.TField("columns", org.apache.thrift.protocol.TType.LIST, (short)7);
+  private static final org.apache.thrift.protocol.TField COMPACTION_POLICY_FIELD_DESC = new org.apache.thrift.protocol.TField("compaction_policy", org.apache.thrift.protocol.TType.STRING, (short)8);
 
   public String name; // required
   public boolean in_memory; // required
@@ -63,6 +67,7 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
   public String compressor; // required
   public String bloom_filter; // required
   public List<ColumnFamily> columns; // required
+  public String compaction_policy; // required
 
   /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
   public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -72,7 +77,8 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
     BLOCKSIZE((short)4, "blocksize"),
     COMPRESSOR((short)5, "compressor"),
     BLOOM_FILTER((short)6, "bloom_filter"),
-    COLUMNS((short)7, "columns");
+    COLUMNS((short)7, "columns"),
+    COMPACTION_POLICY((short)8, "compaction_policy");
 
     private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
 
@@ -101,6 +107,8 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
           return BLOOM_FILTER;
         case 7: // COLUMNS
           return COLUMNS;
+        case 8: // COMPACTION_POLICY
+          return COMPACTION_POLICY;
         default:
           return null;
       }
@@ -164,6 +172,8 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
     tmpMap.put(_Fields.COLUMNS, new org.apache.thrift.meta_data.FieldMetaData("columns", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
         new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
             new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ColumnFamily.class))));
+    tmpMap.put(_Fields.COMPACTION_POLICY, new org.apache.thrift.meta_data.FieldMetaData("compaction_policy", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
     metaDataMap = Collections.unmodifiableMap(tmpMap);
     org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(AccessGroup.class, metaDataMap);
   }
@@ -196,6 +206,9 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
       }
       this.columns = __this__columns;
     }
+    if (other.isSetCompaction_policy()) {
+      this.compaction_policy = other.compaction_policy;
+    }
   }
 
   public AccessGroup deepCopy() {
@@ -214,6 +227,7 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
     this.compressor = null;
     this.bloom_filter = null;
     this.columns = null;
+    this.compaction_policy = null;
   }
 
   public String getName() {
@@ -396,6 +410,30 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
     }
   }
 
+  public String getCompaction_policy() {
+    return this.compaction_policy;
+  }
+
+  public AccessGroup setCompaction_policy(String compaction_policy) {
+    this.compaction_policy = compaction_policy;
+    return this;
+  }
+
+  public void unsetCompaction_policy() {
+    this.compaction_policy = null;
+  }
+
+  /** Returns true if field compaction_policy is set (has been assigned a value) and false otherwise */
+  public boolean isSetCompaction_policy() {
+    return this.compaction_policy != null;
+  }
+
+  public void setCompaction_policyIsSet(boolean value) {
+    if (!value) {
+      this.compaction_policy = null;
+    }
+  }
+
   public void setFieldValue(_Fields field, Object value) {
     switch (field) {
     case NAME:
@@ -454,6 +492,14 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
       }
       break;
 
+    case COMPACTION_POLICY:
+      if (value == null) {
+        unsetCompaction_policy();
+      } else {
+        setCompaction_policy((String)value);
+      }
+      break;
+
     }
   }
 
@@ -480,6 +526,9 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
     case COLUMNS:
       return getColumns();
 
+    case COMPACTION_POLICY:
+      return getCompaction_policy();
+
     }
     throw new IllegalStateException();
   }
@@ -505,6 +554,8 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
       return isSetBloom_filter();
     case COLUMNS:
       return isSetColumns();
+    case COMPACTION_POLICY:
+      return isSetCompaction_policy();
     }
     throw new IllegalStateException();
   }
@@ -585,6 +636,15 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
         return false;
     }
 
+    boolean this_present_compaction_policy = true && this.isSetCompaction_policy();
+    boolean that_present_compaction_policy = true && that.isSetCompaction_policy();
+    if (this_present_compaction_policy || that_present_compaction_policy) {
+      if (!(this_present_compaction_policy && that_present_compaction_policy))
+        return false;
+      if (!this.compaction_policy.equals(that.compaction_policy))
+        return false;
+    }
+
     return true;
   }
 
@@ -671,6 +731,16 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
         return lastComparison;
       }
     }
+    lastComparison = Boolean.valueOf(isSetCompaction_policy()).compareTo(typedOther.isSetCompaction_policy());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetCompaction_policy()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.compaction_policy, typedOther.compaction_policy);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
     return 0;
   }
 
@@ -751,6 +821,13 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
             org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
           }
           break;
+        case 8: // COMPACTION_POLICY
+          if (field.type == org.apache.thrift.protocol.TType.STRING) {
+            this.compaction_policy = iprot.readString();
+          } else { 
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
         default:
           org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
       }
@@ -816,6 +893,13 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
         oprot.writeFieldEnd();
       }
     }
+    if (this.compaction_policy != null) {
+      if (isSetCompaction_policy()) {
+        oprot.writeFieldBegin(COMPACTION_POLICY_FIELD_DESC);
+        oprot.writeString(this.compaction_policy);
+        oprot.writeFieldEnd();
+      }
+    }
     oprot.writeFieldStop();
     oprot.writeStructEnd();
   }
@@ -882,6 +966,16 @@ public class AccessGroup implements org.apache.thrift.TBase<AccessGroup, AccessG
       }
       first = false;
     }
+    if (isSetCompaction_policy()) {
+      if (!first) sb.append(", ");
+      sb.append("compaction_policy:");
+      if (this.compaction_policy == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.compaction_policy);
+      }
+      first = false;
+    }
     sb.append(")");
     return sb.toString();
   }
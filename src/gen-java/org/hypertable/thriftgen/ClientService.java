@@ -50,6 +50,21 @@ public class ClientService {
      */
     public void create_table(long ns, String table_name, String schema) throws ClientException, org.apache.thrift.TException;
 
+    /**
+     * Create a table divided into several initial ranges
+     * 
+     * @param ns - namespace id
+     * @param table_name - table name
+     * @param schema - schema of the table (in xml)
+     * @param split_spec - split rows or split algorithm
+     * 
+     * @param ns
+     * @param table_name
+     * @param schema
+     * @param split_spec
+     */
+    public void create_table_with_splits(long ns, String table_name, String schema, SplitSpec split_spec) throws ClientException, org.apache.thrift.TException;
+
     /**
      * Alter a table
      * 
@@ -773,6 +788,8 @@ public class ClientService {
 
     public void create_table(long ns, String table_name, String schema, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.create_table_call> resultHandler) throws org.apache.thrift.TException;
 
+    public void create_table_with_splits(long ns, String table_name, String schema, SplitSpec split_spec, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.create_table_with_splits_call> resultHandler) throws org.apache.thrift.TException;
+
     public void alter_table(long ns, String table_name, String schema, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.alter_table_call> resultHandler) throws org.apache.thrift.TException;
 
     public void open_namespace(String ns, org.apache.thrift.async.AsyncMethodCallback<AsyncClient.open_namespace_call> resultHandler) throws org.apache.thrift.TException;
@@ -973,6 +990,32 @@ public class ClientService {
       return;
     }
 
+    public void create_table_with_splits(long ns, String table_name, String schema, SplitSpec split_spec) throws ClientException, org.apache.thrift.TException
+    {
+      send_create_table_with_splits(ns, table_name, schema, split_spec);
+      recv_create_table_with_splits();
+    }
+
+    public void send_create_table_with_splits(long ns, String table_name, String schema, SplitSpec split_spec) throws org.apache.thrift.TException
+    {
+      create_table_with_splits_args args = new create_table_with_splits_args();
+      args.setNs(ns);
+      args.setTable_name(table_name);
+      args.setSchema(schema);
+      args.setSplit_spec(split_spec);
+      sendBase("create_table_with_splits", args);
+    }
+
+    public void recv_create_table_with_splits() throws ClientException, org.apache.thrift.TException
+    {
+      create_table_with_splits_result result = new create_table_with_splits_result();
+      receiveBase(result, "create_table_with_splits");
+      if (result.e != null) {
+        throw result.e;
+      }
+      return;
+    }
+
     public void alter_table(long ns, String table_name, String schema) throws ClientException, org.apache.thrift.TException
     {
       send_alter_table(ns, table_name, schema);
@@ -2723,6 +2766,47 @@ public class ClientService {
       }
     }
 
+    public void create_table_with_splits(long ns, String table_name, String schema, SplitSpec split_spec, org.apache.thrift.async.AsyncMethodCallback<create_table_with_splits_call> resultHandler) throws org.apache.thrift.TException {
+      checkReady();
+      create_table_with_splits_call method_call = new create_table_with_splits_call(ns, table_name, schema, split_spec, resultHandler, this, ___protocolFactory, ___transport);
+      this.___currentMethod = method_call;
+      ___manager.call(method_call);
+    }
+
+    public static class create_table_with_splits_call extends org.apache.thrift.async.TAsyncMethodCall {
+      private long ns;
+      private String table_name;
+      private String schema;
+      private SplitSpec split_spec;
+      public create_table_with_splits_call(long ns, String table_name, String schema, SplitSpec split_spec, org.apache.thrift.async.AsyncMethodCallback<create_table_with_splits_call> resultHandler, org.apache.thrift.async.TAsyncClient client, org.apache.thrift.protocol.TProtocolFactory protocolFactory, org.apache.thrift.transport.TNonblockingTransport transport) throws org.apache.thrift.TException {
+        super(client, protocolFactory, transport, resultHandler, false);
+        this.ns = ns;
+        this.table_name = table_name;
+        this.schema = schema;
+        this.split_spec = split_spec;
+      }
+
+      public void write_args(org.apache.thrift.protocol.TProtocol prot) throws org.apache.thrift.TException {
+        prot.writeMessageBegin(new org.apache.thrift.protocol.TMessage("create_table_with_splits", org.apache.thrift.protocol.TMessageType.CALL, 0));
+        create_table_with_splits_args args = new create_table_with_splits_args();
+        args.setNs(ns);
+        args.setTable_name(table_name);
+        args.setSchema(schema);
+        args.setSplit_spec(split_spec);
+        args.write(prot);
+        prot.writeMessageEnd();
+      }
+
+      public void getResult() throws ClientException, org.apache.thrift.TException {
+        if (getState() != org.apache.thrift.async.TAsyncMethodCall.State.RESPONSE_READ) {
+          throw new IllegalStateException("Method call not finished!");
+        }
+        org.apache.thrift.transport.TMemoryInputTransport memoryTransport = new org.apache.thrift.transport.TMemoryInputTransport(getFrameBuffer().array());
+        org.apache.thrift.protocol.TProtocol prot = client.getProtocolFactory().getProtocol(memoryTransport);
+        (new Client(prot)).recv_create_table_with_splits();
+      }
+    }
+
     public void alter_table(long ns, String table_name, String schema, org.apache.thrift.async.AsyncMethodCallback<alter_table_call> resultHandler) throws org.apache.thrift.TException {
       checkReady();
       alter_table_call method_call = new alter_table_call(ns, table_name, schema, resultHandler, this, ___protocolFactory, ___transport);
@@ -5013,6 +5097,7 @@ public class ClientService {
     private static <I extends Iface> Map<String,  org.apache.thrift.ProcessFunction<I, ? extends  org.apache.thrift.TBase>> getProcessMap(Map<String,  org.apache.thrift.ProcessFunction<I, ? extends  org.apache.thrift.TBase>> processMap) {
       processMap.put("create_namespace", new create_namespace());
       processMap.put("create_table", new create_table());
+      processMap.put("create_table_with_splits", new create_table_with_splits());
       processMap.put("alter_table", new alter_table());
       processMap.put("open_namespace", new open_namespace());
       processMap.put("close_namespace", new close_namespace());
@@ -5121,6 +5206,26 @@ public class ClientService {
       }
     }
 
+    private static class create_table_with_splits<I extends Iface> extends org.apache.thrift.ProcessFunction<I, create_table_with_splits_args> {
+      public create_table_with_splits() {
+        super("create_table_with_splits");
+      }
+
+      protected create_table_with_splits_args getEmptyArgsInstance() {
+        return new create_table_with_splits_args();
+      }
+
+      protected create_table_with_splits_result getResult(I iface, create_table_with_splits_args args) throws org.apache.thrift.TException {
+        create_table_with_splits_result result = new create_table_with_splits_result();
+        try {
+          iface.create_table_with_splits(args.ns, args.table_name, args.schema, args.split_spec);
+        } catch (ClientException e) {
+          result.e = e;
+        }
+        return result;
+      }
+    }
+
     private static class alter_table<I extends Iface> extends org.apache.thrift.ProcessFunction<I, alter_table_args> {
       public alter_table() {
         super("alter_table");
@@ -7795,22 +7900,25 @@ public class ClientService {
 
   }
 
-  public static class alter_table_args implements org.apache.thrift.TBase<alter_table_args, alter_table_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("alter_table_args");
+  public static class create_table_with_splits_args implements org.apache.thrift.TBase<create_table_with_splits_args, create_table_with_splits_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("create_table_with_splits_args");
 
     private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.I64, (short)1);
     private static final org.apache.thrift.protocol.TField TABLE_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("table_name", org.apache.thrift.protocol.TType.STRING, (short)2);
     private static final org.apache.thrift.protocol.TField SCHEMA_FIELD_DESC = new org.apache.thrift.protocol.TField("schema", org.apache.thrift.protocol.TType.STRING, (short)3);
+    private static final org.apache.thrift.protocol.TField SPLIT_SPEC_FIELD_DESC = new org.apache.thrift.protocol.TField("split_spec", org.apache.thrift.protocol.TType.STRUCT, (short)4);
 
     public long ns; // required
     public String table_name; // required
     public String schema; // required
+    public SplitSpec split_spec; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
       NS((short)1, "ns"),
       TABLE_NAME((short)2, "table_name"),
-      SCHEMA((short)3, "schema");
+      SCHEMA((short)3, "schema"),
+      SPLIT_SPEC((short)4, "split_spec");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
 
@@ -7831,6 +7939,8 @@ public class ClientService {
             return TABLE_NAME;
           case 3: // SCHEMA
             return SCHEMA;
+          case 4: // SPLIT_SPEC
+            return SPLIT_SPEC;
           default:
             return null;
         }
@@ -7883,29 +7993,33 @@ public class ClientService {
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       tmpMap.put(_Fields.SCHEMA, new org.apache.thrift.meta_data.FieldMetaData("schema", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.SPLIT_SPEC, new org.apache.thrift.meta_data.FieldMetaData("split_spec", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, SplitSpec.class)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(alter_table_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(create_table_with_splits_args.class, metaDataMap);
     }
 
-    public alter_table_args() {
+    public create_table_with_splits_args() {
     }
 
-    public alter_table_args(
+    public create_table_with_splits_args(
       long ns,
       String table_name,
-      String schema)
+      String schema,
+      SplitSpec split_spec)
     {
       this();
       this.ns = ns;
       setNsIsSet(true);
       this.table_name = table_name;
       this.schema = schema;
+      this.split_spec = split_spec;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public alter_table_args(alter_table_args other) {
+    public create_table_with_splits_args(create_table_with_splits_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ns = other.ns;
@@ -7915,10 +8029,13 @@ public class ClientService {
       if (other.isSetSchema()) {
         this.schema = other.schema;
       }
+      if (other.isSetSplit_spec()) {
+        this.split_spec = new SplitSpec(other.split_spec);
+      }
     }
 
-    public alter_table_args deepCopy() {
-      return new alter_table_args(this);
+    public create_table_with_splits_args deepCopy() {
+      return new create_table_with_splits_args(this);
     }
 
     @Override
@@ -7927,13 +8044,14 @@ public class ClientService {
       this.ns = 0;
       this.table_name = null;
       this.schema = null;
+      this.split_spec = null;
     }
 
     public long getNs() {
       return this.ns;
     }
 
-    public alter_table_args setNs(long ns) {
+    public create_table_with_splits_args setNs(long ns) {
       this.ns = ns;
       setNsIsSet(true);
       return this;
@@ -7956,7 +8074,7 @@ public class ClientService {
       return this.table_name;
     }
 
-    public alter_table_args setTable_name(String table_name) {
+    public create_table_with_splits_args setTable_name(String table_name) {
       this.table_name = table_name;
       return this;
     }
@@ -7980,7 +8098,7 @@ public class ClientService {
       return this.schema;
     }
 
-    public alter_table_args setSchema(String schema) {
+    public create_table_with_splits_args setSchema(String schema) {
       this.schema = schema;
       return this;
     }
@@ -8000,6 +8118,30 @@ public class ClientService {
       }
     }
 
+    public SplitSpec getSplit_spec() {
+      return this.split_spec;
+    }
+
+    public create_table_with_splits_args setSplit_spec(SplitSpec split_spec) {
+      this.split_spec = split_spec;
+      return this;
+    }
+
+    public void unsetSplit_spec() {
+      this.split_spec = null;
+    }
+
+    /** Returns true if field split_spec is set (has been assigned a value) and false otherwise */
+    public boolean isSetSplit_spec() {
+      return this.split_spec != null;
+    }
+
+    public void setSplit_specIsSet(boolean value) {
+      if (!value) {
+        this.split_spec = null;
+      }
+    }
+
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
       case NS:
@@ -8026,6 +8168,14 @@ public class ClientService {
         }
         break;
 
+      case SPLIT_SPEC:
+        if (value == null) {
+          unsetSplit_spec();
+        } else {
+          setSplit_spec((SplitSpec)value);
+        }
+        break;
+
       }
     }
 
@@ -8040,6 +8190,9 @@ public class ClientService {
       case SCHEMA:
         return getSchema();
 
+      case SPLIT_SPEC:
+        return getSplit_spec();
+
       }
       throw new IllegalStateException();
     }
@@ -8057,6 +8210,8 @@ public class ClientService {
         return isSetTable_name();
       case SCHEMA:
         return isSetSchema();
+      case SPLIT_SPEC:
+        return isSetSplit_spec();
       }
       throw new IllegalStateException();
     }
@@ -8065,12 +8220,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof alter_table_args)
-        return this.equals((alter_table_args)that);
+      if (that instanceof create_table_with_splits_args)
+        return this.equals((create_table_with_splits_args)that);
       return false;
     }
 
-    public boolean equals(alter_table_args that) {
+    public boolean equals(create_table_with_splits_args that) {
       if (that == null)
         return false;
 
@@ -8101,6 +8256,15 @@ public class ClientService {
           return false;
       }
 
+      boolean this_present_split_spec = true && this.isSetSplit_spec();
+      boolean that_present_split_spec = true && that.isSetSplit_spec();
+      if (this_present_split_spec || that_present_split_spec) {
+        if (!(this_present_split_spec && that_present_split_spec))
+          return false;
+        if (!this.split_spec.equals(that.split_spec))
+          return false;
+      }
+
       return true;
     }
 
@@ -8109,13 +8273,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(alter_table_args other) {
+    public int compareTo(create_table_with_splits_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      alter_table_args typedOther = (alter_table_args)other;
+      create_table_with_splits_args typedOther = (create_table_with_splits_args)other;
 
       lastComparison = Boolean.valueOf(isSetNs()).compareTo(typedOther.isSetNs());
       if (lastComparison != 0) {
@@ -8147,6 +8311,16 @@ public class ClientService {
           return lastComparison;
         }
       }
+      lastComparison = Boolean.valueOf(isSetSplit_spec()).compareTo(typedOther.isSetSplit_spec());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSplit_spec()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.split_spec, typedOther.split_spec);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -8186,6 +8360,14 @@ public class ClientService {
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
             }
             break;
+          case 4: // SPLIT_SPEC
+            if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
+              this.split_spec = new SplitSpec();
+              this.split_spec.read(iprot);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
           default:
             org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
         }
@@ -8214,13 +8396,18 @@ public class ClientService {
         oprot.writeString(this.schema);
         oprot.writeFieldEnd();
       }
+      if (this.split_spec != null) {
+        oprot.writeFieldBegin(SPLIT_SPEC_FIELD_DESC);
+        this.split_spec.write(oprot);
+        oprot.writeFieldEnd();
+      }
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("alter_table_args(");
+      StringBuilder sb = new StringBuilder("create_table_with_splits_args(");
       boolean first = true;
 
       sb.append("ns:");
@@ -8242,6 +8429,14 @@ public class ClientService {
         sb.append(this.schema);
       }
       first = false;
+      if (!first) sb.append(", ");
+      sb.append("split_spec:");
+      if (this.split_spec == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.split_spec);
+      }
+      first = false;
       sb.append(")");
       return sb.toString();
     }
@@ -8268,8 +8463,8 @@ public class ClientService {
 
   }
 
-  public static class alter_table_result implements org.apache.thrift.TBase<alter_table_result, alter_table_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("alter_table_result");
+  public static class create_table_with_splits_result implements org.apache.thrift.TBase<create_table_with_splits_result, create_table_with_splits_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("create_table_with_splits_result");
 
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
@@ -8341,13 +8536,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(alter_table_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(create_table_with_splits_result.class, metaDataMap);
     }
 
-    public alter_table_result() {
+    public create_table_with_splits_result() {
     }
 
-    public alter_table_result(
+    public create_table_with_splits_result(
       ClientException e)
     {
       this();
@@ -8357,14 +8552,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public alter_table_result(alter_table_result other) {
+    public create_table_with_splits_result(create_table_with_splits_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public alter_table_result deepCopy() {
-      return new alter_table_result(this);
+    public create_table_with_splits_result deepCopy() {
+      return new create_table_with_splits_result(this);
     }
 
     @Override
@@ -8376,7 +8571,7 @@ public class ClientService {
       return this.e;
     }
 
-    public alter_table_result setE(ClientException e) {
+    public create_table_with_splits_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -8435,12 +8630,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof alter_table_result)
-        return this.equals((alter_table_result)that);
+      if (that instanceof create_table_with_splits_result)
+        return this.equals((create_table_with_splits_result)that);
       return false;
     }
 
-    public boolean equals(alter_table_result that) {
+    public boolean equals(create_table_with_splits_result that) {
       if (that == null)
         return false;
 
@@ -8461,13 +8656,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(alter_table_result other) {
+    public int compareTo(create_table_with_splits_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      alter_table_result typedOther = (alter_table_result)other;
+      create_table_with_splits_result typedOther = (create_table_with_splits_result)other;
 
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
@@ -8529,7 +8724,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("alter_table_result(");
+      StringBuilder sb = new StringBuilder("create_table_with_splits_result(");
       boolean first = true;
 
       sb.append("e:");
@@ -8565,16 +8760,22 @@ public class ClientService {
 
   }
 
-  public static class open_namespace_args implements org.apache.thrift.TBase<open_namespace_args, open_namespace_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_namespace_args");
+  public static class alter_table_args implements org.apache.thrift.TBase<alter_table_args, alter_table_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("alter_table_args");
 
-    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.STRING, (short)1);
+    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.I64, (short)1);
+    private static final org.apache.thrift.protocol.TField TABLE_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("table_name", org.apache.thrift.protocol.TType.STRING, (short)2);
+    private static final org.apache.thrift.protocol.TField SCHEMA_FIELD_DESC = new org.apache.thrift.protocol.TField("schema", org.apache.thrift.protocol.TType.STRING, (short)3);
 
-    public String ns; // required
+    public long ns; // required
+    public String table_name; // required
+    public String schema; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      NS((short)1, "ns");
+      NS((short)1, "ns"),
+      TABLE_NAME((short)2, "table_name"),
+      SCHEMA((short)3, "schema");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
 
@@ -8591,6 +8792,10 @@ public class ClientService {
         switch(fieldId) {
           case 1: // NS
             return NS;
+          case 2: // TABLE_NAME
+            return TABLE_NAME;
+          case 3: // SCHEMA
+            return SCHEMA;
           default:
             return null;
         }
@@ -8631,65 +8836,132 @@ public class ClientService {
     }
 
     // isset id assignments
+    private static final int __NS_ISSET_ID = 0;
+    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.NS, new org.apache.thrift.meta_data.FieldMetaData("ns", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Namespace")));
+      tmpMap.put(_Fields.TABLE_NAME, new org.apache.thrift.meta_data.FieldMetaData("table_name", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+      tmpMap.put(_Fields.SCHEMA, new org.apache.thrift.meta_data.FieldMetaData("schema", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_namespace_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(alter_table_args.class, metaDataMap);
     }
 
-    public open_namespace_args() {
+    public alter_table_args() {
     }
 
-    public open_namespace_args(
-      String ns)
+    public alter_table_args(
+      long ns,
+      String table_name,
+      String schema)
     {
       this();
       this.ns = ns;
+      setNsIsSet(true);
+      this.table_name = table_name;
+      this.schema = schema;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public open_namespace_args(open_namespace_args other) {
-      if (other.isSetNs()) {
-        this.ns = other.ns;
+    public alter_table_args(alter_table_args other) {
+      __isset_bit_vector.clear();
+      __isset_bit_vector.or(other.__isset_bit_vector);
+      this.ns = other.ns;
+      if (other.isSetTable_name()) {
+        this.table_name = other.table_name;
+      }
+      if (other.isSetSchema()) {
+        this.schema = other.schema;
       }
     }
 
-    public open_namespace_args deepCopy() {
-      return new open_namespace_args(this);
+    public alter_table_args deepCopy() {
+      return new alter_table_args(this);
     }
 
     @Override
     public void clear() {
-      this.ns = null;
+      setNsIsSet(false);
+      this.ns = 0;
+      this.table_name = null;
+      this.schema = null;
     }
 
-    public String getNs() {
+    public long getNs() {
       return this.ns;
     }
 
-    public open_namespace_args setNs(String ns) {
+    public alter_table_args setNs(long ns) {
       this.ns = ns;
+      setNsIsSet(true);
       return this;
     }
 
     public void unsetNs() {
-      this.ns = null;
+      __isset_bit_vector.clear(__NS_ISSET_ID);
     }
 
     /** Returns true if field ns is set (has been assigned a value) and false otherwise */
     public boolean isSetNs() {
-      return this.ns != null;
+      return __isset_bit_vector.get(__NS_ISSET_ID);
     }
 
     public void setNsIsSet(boolean value) {
+      __isset_bit_vector.set(__NS_ISSET_ID, value);
+    }
+
+    public String getTable_name() {
+      return this.table_name;
+    }
+
+    public alter_table_args setTable_name(String table_name) {
+      this.table_name = table_name;
+      return this;
+    }
+
+    public void unsetTable_name() {
+      this.table_name = null;
+    }
+
+    /** Returns true if field table_name is set (has been assigned a value) and false otherwise */
+    public boolean isSetTable_name() {
+      return this.table_name != null;
+    }
+
+    public void setTable_nameIsSet(boolean value) {
       if (!value) {
-        this.ns = null;
+        this.table_name = null;
+      }
+    }
+
+    public String getSchema() {
+      return this.schema;
+    }
+
+    public alter_table_args setSchema(String schema) {
+      this.schema = schema;
+      return this;
+    }
+
+    public void unsetSchema() {
+      this.schema = null;
+    }
+
+    /** Returns true if field schema is set (has been assigned a value) and false otherwise */
+    public boolean isSetSchema() {
+      return this.schema != null;
+    }
+
+    public void setSchemaIsSet(boolean value) {
+      if (!value) {
+        this.schema = null;
       }
     }
 
@@ -8699,7 +8971,23 @@ public class ClientService {
         if (value == null) {
           unsetNs();
         } else {
-          setNs((String)value);
+          setNs((Long)value);
+        }
+        break;
+
+      case TABLE_NAME:
+        if (value == null) {
+          unsetTable_name();
+        } else {
+          setTable_name((String)value);
+        }
+        break;
+
+      case SCHEMA:
+        if (value == null) {
+          unsetSchema();
+        } else {
+          setSchema((String)value);
         }
         break;
 
@@ -8709,7 +8997,13 @@ public class ClientService {
     public Object getFieldValue(_Fields field) {
       switch (field) {
       case NS:
-        return getNs();
+        return Long.valueOf(getNs());
+
+      case TABLE_NAME:
+        return getTable_name();
+
+      case SCHEMA:
+        return getSchema();
 
       }
       throw new IllegalStateException();
@@ -8724,6 +9018,10 @@ public class ClientService {
       switch (field) {
       case NS:
         return isSetNs();
+      case TABLE_NAME:
+        return isSetTable_name();
+      case SCHEMA:
+        return isSetSchema();
       }
       throw new IllegalStateException();
     }
@@ -8732,21 +9030,39 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_namespace_args)
-        return this.equals((open_namespace_args)that);
+      if (that instanceof alter_table_args)
+        return this.equals((alter_table_args)that);
       return false;
     }
 
-    public boolean equals(open_namespace_args that) {
+    public boolean equals(alter_table_args that) {
       if (that == null)
         return false;
 
-      boolean this_present_ns = true && this.isSetNs();
-      boolean that_present_ns = true && that.isSetNs();
+      boolean this_present_ns = true;
+      boolean that_present_ns = true;
       if (this_present_ns || that_present_ns) {
         if (!(this_present_ns && that_present_ns))
           return false;
-        if (!this.ns.equals(that.ns))
+        if (this.ns != that.ns)
+          return false;
+      }
+
+      boolean this_present_table_name = true && this.isSetTable_name();
+      boolean that_present_table_name = true && that.isSetTable_name();
+      if (this_present_table_name || that_present_table_name) {
+        if (!(this_present_table_name && that_present_table_name))
+          return false;
+        if (!this.table_name.equals(that.table_name))
+          return false;
+      }
+
+      boolean this_present_schema = true && this.isSetSchema();
+      boolean that_present_schema = true && that.isSetSchema();
+      if (this_present_schema || that_present_schema) {
+        if (!(this_present_schema && that_present_schema))
+          return false;
+        if (!this.schema.equals(that.schema))
           return false;
       }
 
@@ -8758,13 +9074,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(open_namespace_args other) {
+    public int compareTo(alter_table_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      open_namespace_args typedOther = (open_namespace_args)other;
+      alter_table_args typedOther = (alter_table_args)other;
 
       lastComparison = Boolean.valueOf(isSetNs()).compareTo(typedOther.isSetNs());
       if (lastComparison != 0) {
@@ -8776,6 +9092,26 @@ public class ClientService {
           return lastComparison;
         }
       }
+      lastComparison = Boolean.valueOf(isSetTable_name()).compareTo(typedOther.isSetTable_name());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetTable_name()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.table_name, typedOther.table_name);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      lastComparison = Boolean.valueOf(isSetSchema()).compareTo(typedOther.isSetSchema());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSchema()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.schema, typedOther.schema);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       return 0;
     }
 
@@ -8794,8 +9130,23 @@ public class ClientService {
         }
         switch (field.id) {
           case 1: // NS
+            if (field.type == org.apache.thrift.protocol.TType.I64) {
+              this.ns = iprot.readI64();
+              setNsIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case 2: // TABLE_NAME
             if (field.type == org.apache.thrift.protocol.TType.STRING) {
-              this.ns = iprot.readString();
+              this.table_name = iprot.readString();
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          case 3: // SCHEMA
+            if (field.type == org.apache.thrift.protocol.TType.STRING) {
+              this.schema = iprot.readString();
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
             }
@@ -8815,9 +9166,17 @@ public class ClientService {
       validate();
 
       oprot.writeStructBegin(STRUCT_DESC);
-      if (this.ns != null) {
-        oprot.writeFieldBegin(NS_FIELD_DESC);
-        oprot.writeString(this.ns);
+      oprot.writeFieldBegin(NS_FIELD_DESC);
+      oprot.writeI64(this.ns);
+      oprot.writeFieldEnd();
+      if (this.table_name != null) {
+        oprot.writeFieldBegin(TABLE_NAME_FIELD_DESC);
+        oprot.writeString(this.table_name);
+        oprot.writeFieldEnd();
+      }
+      if (this.schema != null) {
+        oprot.writeFieldBegin(SCHEMA_FIELD_DESC);
+        oprot.writeString(this.schema);
         oprot.writeFieldEnd();
       }
       oprot.writeFieldStop();
@@ -8826,14 +9185,26 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_namespace_args(");
+      StringBuilder sb = new StringBuilder("alter_table_args(");
       boolean first = true;
 
       sb.append("ns:");
-      if (this.ns == null) {
+      sb.append(this.ns);
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("table_name:");
+      if (this.table_name == null) {
         sb.append("null");
       } else {
-        sb.append(this.ns);
+        sb.append(this.table_name);
+      }
+      first = false;
+      if (!first) sb.append(", ");
+      sb.append("schema:");
+      if (this.schema == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.schema);
       }
       first = false;
       sb.append(")");
@@ -8862,18 +9233,15 @@ public class ClientService {
 
   }
 
-  public static class open_namespace_result implements org.apache.thrift.TBase<open_namespace_result, open_namespace_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_namespace_result");
+  public static class alter_table_result implements org.apache.thrift.TBase<alter_table_result, alter_table_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("alter_table_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.I64, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
-    public long success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -8889,8 +9257,6 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -8933,84 +9299,49 @@ public class ClientService {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
-    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Namespace")));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_namespace_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(alter_table_result.class, metaDataMap);
     }
 
-    public open_namespace_result() {
+    public alter_table_result() {
     }
 
-    public open_namespace_result(
-      long success,
+    public alter_table_result(
       ClientException e)
     {
       this();
-      this.success = success;
-      setSuccessIsSet(true);
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public open_namespace_result(open_namespace_result other) {
-      __isset_bit_vector.clear();
-      __isset_bit_vector.or(other.__isset_bit_vector);
-      this.success = other.success;
+    public alter_table_result(alter_table_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public open_namespace_result deepCopy() {
-      return new open_namespace_result(this);
+    public alter_table_result deepCopy() {
+      return new alter_table_result(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = 0;
       this.e = null;
     }
 
-    public long getSuccess() {
-      return this.success;
-    }
-
-    public open_namespace_result setSuccess(long success) {
-      this.success = success;
-      setSuccessIsSet(true);
-      return this;
-    }
-
-    public void unsetSuccess() {
-      __isset_bit_vector.clear(__SUCCESS_ISSET_ID);
-    }
-
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return __isset_bit_vector.get(__SUCCESS_ISSET_ID);
-    }
-
-    public void setSuccessIsSet(boolean value) {
-      __isset_bit_vector.set(__SUCCESS_ISSET_ID, value);
-    }
-
     public ClientException getE() {
       return this.e;
     }
 
-    public open_namespace_result setE(ClientException e) {
+    public alter_table_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -9032,14 +9363,6 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((Long)value);
-        }
-        break;
-
       case E:
         if (value == null) {
           unsetE();
@@ -9053,9 +9376,6 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return Long.valueOf(getSuccess());
-
       case E:
         return getE();
 
@@ -9070,8 +9390,6 @@ public class ClientService {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -9082,24 +9400,15 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_namespace_result)
-        return this.equals((open_namespace_result)that);
+      if (that instanceof alter_table_result)
+        return this.equals((alter_table_result)that);
       return false;
     }
 
-    public boolean equals(open_namespace_result that) {
+    public boolean equals(alter_table_result that) {
       if (that == null)
         return false;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (this.success != that.success)
-          return false;
-      }
-
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -9117,24 +9426,14 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(open_namespace_result other) {
+    public int compareTo(alter_table_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      open_namespace_result typedOther = (open_namespace_result)other;
+      alter_table_result typedOther = (alter_table_result)other;
 
-      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -9162,14 +9461,6 @@ public class ClientService {
           break;
         }
         switch (field.id) {
-          case 0: // SUCCESS
-            if (field.type == org.apache.thrift.protocol.TType.I64) {
-              this.success = iprot.readI64();
-              setSuccessIsSet(true);
-            } else { 
-              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
-            }
-            break;
           case 1: // E
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
               this.e = new ClientException();
@@ -9192,11 +9483,7 @@ public class ClientService {
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetSuccess()) {
-        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        oprot.writeI64(this.success);
-        oprot.writeFieldEnd();
-      } else if (this.isSetE()) {
+      if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -9207,13 +9494,9 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_namespace_result(");
+      StringBuilder sb = new StringBuilder("alter_table_result(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
-      first = false;
-      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -9247,12 +9530,12 @@ public class ClientService {
 
   }
 
-  public static class close_namespace_args implements org.apache.thrift.TBase<close_namespace_args, close_namespace_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_namespace_args");
+  public static class open_namespace_args implements org.apache.thrift.TBase<open_namespace_args, open_namespace_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_namespace_args");
 
-    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.I64, (short)1);
+    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.STRING, (short)1);
 
-    public long ns; // required
+    public String ns; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
@@ -9313,69 +9596,66 @@ public class ClientService {
     }
 
     // isset id assignments
-    private static final int __NS_ISSET_ID = 0;
-    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.NS, new org.apache.thrift.meta_data.FieldMetaData("ns", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Namespace")));
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_namespace_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_namespace_args.class, metaDataMap);
     }
 
-    public close_namespace_args() {
+    public open_namespace_args() {
     }
 
-    public close_namespace_args(
-      long ns)
+    public open_namespace_args(
+      String ns)
     {
       this();
       this.ns = ns;
-      setNsIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_namespace_args(close_namespace_args other) {
-      __isset_bit_vector.clear();
-      __isset_bit_vector.or(other.__isset_bit_vector);
-      this.ns = other.ns;
+    public open_namespace_args(open_namespace_args other) {
+      if (other.isSetNs()) {
+        this.ns = other.ns;
+      }
     }
 
-    public close_namespace_args deepCopy() {
-      return new close_namespace_args(this);
+    public open_namespace_args deepCopy() {
+      return new open_namespace_args(this);
     }
 
     @Override
     public void clear() {
-      setNsIsSet(false);
-      this.ns = 0;
+      this.ns = null;
     }
 
-    public long getNs() {
+    public String getNs() {
       return this.ns;
     }
 
-    public close_namespace_args setNs(long ns) {
+    public open_namespace_args setNs(String ns) {
       this.ns = ns;
-      setNsIsSet(true);
       return this;
     }
 
     public void unsetNs() {
-      __isset_bit_vector.clear(__NS_ISSET_ID);
+      this.ns = null;
     }
 
     /** Returns true if field ns is set (has been assigned a value) and false otherwise */
     public boolean isSetNs() {
-      return __isset_bit_vector.get(__NS_ISSET_ID);
+      return this.ns != null;
     }
 
     public void setNsIsSet(boolean value) {
-      __isset_bit_vector.set(__NS_ISSET_ID, value);
+      if (!value) {
+        this.ns = null;
+      }
     }
 
     public void setFieldValue(_Fields field, Object value) {
@@ -9384,7 +9664,7 @@ public class ClientService {
         if (value == null) {
           unsetNs();
         } else {
-          setNs((Long)value);
+          setNs((String)value);
         }
         break;
 
@@ -9394,7 +9674,7 @@ public class ClientService {
     public Object getFieldValue(_Fields field) {
       switch (field) {
       case NS:
-        return Long.valueOf(getNs());
+        return getNs();
 
       }
       throw new IllegalStateException();
@@ -9417,21 +9697,21 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_namespace_args)
-        return this.equals((close_namespace_args)that);
+      if (that instanceof open_namespace_args)
+        return this.equals((open_namespace_args)that);
       return false;
     }
 
-    public boolean equals(close_namespace_args that) {
+    public boolean equals(open_namespace_args that) {
       if (that == null)
         return false;
 
-      boolean this_present_ns = true;
-      boolean that_present_ns = true;
+      boolean this_present_ns = true && this.isSetNs();
+      boolean that_present_ns = true && that.isSetNs();
       if (this_present_ns || that_present_ns) {
         if (!(this_present_ns && that_present_ns))
           return false;
-        if (this.ns != that.ns)
+        if (!this.ns.equals(that.ns))
           return false;
       }
 
@@ -9443,13 +9723,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_namespace_args other) {
+    public int compareTo(open_namespace_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_namespace_args typedOther = (close_namespace_args)other;
+      open_namespace_args typedOther = (open_namespace_args)other;
 
       lastComparison = Boolean.valueOf(isSetNs()).compareTo(typedOther.isSetNs());
       if (lastComparison != 0) {
@@ -9479,9 +9759,8 @@ public class ClientService {
         }
         switch (field.id) {
           case 1: // NS
-            if (field.type == org.apache.thrift.protocol.TType.I64) {
-              this.ns = iprot.readI64();
-              setNsIsSet(true);
+            if (field.type == org.apache.thrift.protocol.TType.STRING) {
+              this.ns = iprot.readString();
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
             }
@@ -9501,20 +9780,26 @@ public class ClientService {
       validate();
 
       oprot.writeStructBegin(STRUCT_DESC);
-      oprot.writeFieldBegin(NS_FIELD_DESC);
-      oprot.writeI64(this.ns);
-      oprot.writeFieldEnd();
+      if (this.ns != null) {
+        oprot.writeFieldBegin(NS_FIELD_DESC);
+        oprot.writeString(this.ns);
+        oprot.writeFieldEnd();
+      }
       oprot.writeFieldStop();
       oprot.writeStructEnd();
     }
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_namespace_args(");
+      StringBuilder sb = new StringBuilder("open_namespace_args(");
       boolean first = true;
 
       sb.append("ns:");
-      sb.append(this.ns);
+      if (this.ns == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.ns);
+      }
       first = false;
       sb.append(")");
       return sb.toString();
@@ -9542,15 +9827,18 @@ public class ClientService {
 
   }
 
-  public static class close_namespace_result implements org.apache.thrift.TBase<close_namespace_result, close_namespace_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_namespace_result");
+  public static class open_namespace_result implements org.apache.thrift.TBase<open_namespace_result, open_namespace_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_namespace_result");
 
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.I64, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
+    public long success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -9566,6 +9854,8 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
+          case 0: // SUCCESS
+            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -9608,49 +9898,84 @@ public class ClientService {
     }
 
     // isset id assignments
+    private static final int __SUCCESS_ISSET_ID = 0;
+    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Namespace")));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_namespace_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_namespace_result.class, metaDataMap);
     }
 
-    public close_namespace_result() {
+    public open_namespace_result() {
     }
 
-    public close_namespace_result(
+    public open_namespace_result(
+      long success,
       ClientException e)
     {
       this();
+      this.success = success;
+      setSuccessIsSet(true);
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_namespace_result(close_namespace_result other) {
+    public open_namespace_result(open_namespace_result other) {
+      __isset_bit_vector.clear();
+      __isset_bit_vector.or(other.__isset_bit_vector);
+      this.success = other.success;
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public close_namespace_result deepCopy() {
-      return new close_namespace_result(this);
+    public open_namespace_result deepCopy() {
+      return new open_namespace_result(this);
     }
 
     @Override
     public void clear() {
+      setSuccessIsSet(false);
+      this.success = 0;
       this.e = null;
     }
 
+    public long getSuccess() {
+      return this.success;
+    }
+
+    public open_namespace_result setSuccess(long success) {
+      this.success = success;
+      setSuccessIsSet(true);
+      return this;
+    }
+
+    public void unsetSuccess() {
+      __isset_bit_vector.clear(__SUCCESS_ISSET_ID);
+    }
+
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return __isset_bit_vector.get(__SUCCESS_ISSET_ID);
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      __isset_bit_vector.set(__SUCCESS_ISSET_ID, value);
+    }
+
     public ClientException getE() {
       return this.e;
     }
 
-    public close_namespace_result setE(ClientException e) {
+    public open_namespace_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -9672,6 +9997,14 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((Long)value);
+        }
+        break;
+
       case E:
         if (value == null) {
           unsetE();
@@ -9685,6 +10018,9 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
+      case SUCCESS:
+        return Long.valueOf(getSuccess());
+
       case E:
         return getE();
 
@@ -9699,6 +10035,8 @@ public class ClientService {
       }
 
       switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -9709,15 +10047,24 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_namespace_result)
-        return this.equals((close_namespace_result)that);
+      if (that instanceof open_namespace_result)
+        return this.equals((open_namespace_result)that);
       return false;
     }
 
-    public boolean equals(close_namespace_result that) {
+    public boolean equals(open_namespace_result that) {
       if (that == null)
         return false;
 
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (this.success != that.success)
+          return false;
+      }
+
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -9735,14 +10082,24 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_namespace_result other) {
+    public int compareTo(open_namespace_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_namespace_result typedOther = (close_namespace_result)other;
+      open_namespace_result typedOther = (open_namespace_result)other;
 
+      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -9770,6 +10127,14 @@ public class ClientService {
           break;
         }
         switch (field.id) {
+          case 0: // SUCCESS
+            if (field.type == org.apache.thrift.protocol.TType.I64) {
+              this.success = iprot.readI64();
+              setSuccessIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
           case 1: // E
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
               this.e = new ClientException();
@@ -9792,7 +10157,11 @@ public class ClientService {
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetE()) {
+      if (this.isSetSuccess()) {
+        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+        oprot.writeI64(this.success);
+        oprot.writeFieldEnd();
+      } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -9803,9 +10172,13 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_namespace_result(");
+      StringBuilder sb = new StringBuilder("open_namespace_result(");
       boolean first = true;
 
+      sb.append("success:");
+      sb.append(this.success);
+      first = false;
+      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -9839,16 +10212,16 @@ public class ClientService {
 
   }
 
-  public static class open_future_args implements org.apache.thrift.TBase<open_future_args, open_future_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_future_args");
+  public static class close_namespace_args implements org.apache.thrift.TBase<close_namespace_args, close_namespace_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_namespace_args");
 
-    private static final org.apache.thrift.protocol.TField QUEUE_SIZE_FIELD_DESC = new org.apache.thrift.protocol.TField("queue_size", org.apache.thrift.protocol.TType.I32, (short)1);
+    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.I64, (short)1);
 
-    public int queue_size; // required
+    public long ns; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      QUEUE_SIZE((short)1, "queue_size");
+      NS((short)1, "ns");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
 
@@ -9863,8 +10236,8 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // QUEUE_SIZE
-            return QUEUE_SIZE;
+          case 1: // NS
+            return NS;
           default:
             return null;
         }
@@ -9905,80 +10278,78 @@ public class ClientService {
     }
 
     // isset id assignments
-    private static final int __QUEUE_SIZE_ISSET_ID = 0;
+    private static final int __NS_ISSET_ID = 0;
     private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.QUEUE_SIZE, new org.apache.thrift.meta_data.FieldMetaData("queue_size", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+      tmpMap.put(_Fields.NS, new org.apache.thrift.meta_data.FieldMetaData("ns", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Namespace")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_future_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_namespace_args.class, metaDataMap);
     }
 
-    public open_future_args() {
-      this.queue_size = 0;
-
+    public close_namespace_args() {
     }
 
-    public open_future_args(
-      int queue_size)
+    public close_namespace_args(
+      long ns)
     {
       this();
-      this.queue_size = queue_size;
-      setQueue_sizeIsSet(true);
+      this.ns = ns;
+      setNsIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public open_future_args(open_future_args other) {
+    public close_namespace_args(close_namespace_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
-      this.queue_size = other.queue_size;
+      this.ns = other.ns;
     }
 
-    public open_future_args deepCopy() {
-      return new open_future_args(this);
+    public close_namespace_args deepCopy() {
+      return new close_namespace_args(this);
     }
 
     @Override
     public void clear() {
-      this.queue_size = 0;
-
+      setNsIsSet(false);
+      this.ns = 0;
     }
 
-    public int getQueue_size() {
-      return this.queue_size;
+    public long getNs() {
+      return this.ns;
     }
 
-    public open_future_args setQueue_size(int queue_size) {
-      this.queue_size = queue_size;
-      setQueue_sizeIsSet(true);
+    public close_namespace_args setNs(long ns) {
+      this.ns = ns;
+      setNsIsSet(true);
       return this;
     }
 
-    public void unsetQueue_size() {
-      __isset_bit_vector.clear(__QUEUE_SIZE_ISSET_ID);
+    public void unsetNs() {
+      __isset_bit_vector.clear(__NS_ISSET_ID);
     }
 
-    /** Returns true if field queue_size is set (has been assigned a value) and false otherwise */
-    public boolean isSetQueue_size() {
-      return __isset_bit_vector.get(__QUEUE_SIZE_ISSET_ID);
+    /** Returns true if field ns is set (has been assigned a value) and false otherwise */
+    public boolean isSetNs() {
+      return __isset_bit_vector.get(__NS_ISSET_ID);
     }
 
-    public void setQueue_sizeIsSet(boolean value) {
-      __isset_bit_vector.set(__QUEUE_SIZE_ISSET_ID, value);
+    public void setNsIsSet(boolean value) {
+      __isset_bit_vector.set(__NS_ISSET_ID, value);
     }
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
-      case QUEUE_SIZE:
+      case NS:
         if (value == null) {
-          unsetQueue_size();
+          unsetNs();
         } else {
-          setQueue_size((Integer)value);
+          setNs((Long)value);
         }
         break;
 
@@ -9987,8 +10358,8 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
-      case QUEUE_SIZE:
-        return Integer.valueOf(getQueue_size());
+      case NS:
+        return Long.valueOf(getNs());
 
       }
       throw new IllegalStateException();
@@ -10001,8 +10372,8 @@ public class ClientService {
       }
 
       switch (field) {
-      case QUEUE_SIZE:
-        return isSetQueue_size();
+      case NS:
+        return isSetNs();
       }
       throw new IllegalStateException();
     }
@@ -10011,21 +10382,21 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_future_args)
-        return this.equals((open_future_args)that);
+      if (that instanceof close_namespace_args)
+        return this.equals((close_namespace_args)that);
       return false;
     }
 
-    public boolean equals(open_future_args that) {
+    public boolean equals(close_namespace_args that) {
       if (that == null)
         return false;
 
-      boolean this_present_queue_size = true;
-      boolean that_present_queue_size = true;
-      if (this_present_queue_size || that_present_queue_size) {
-        if (!(this_present_queue_size && that_present_queue_size))
+      boolean this_present_ns = true;
+      boolean that_present_ns = true;
+      if (this_present_ns || that_present_ns) {
+        if (!(this_present_ns && that_present_ns))
           return false;
-        if (this.queue_size != that.queue_size)
+        if (this.ns != that.ns)
           return false;
       }
 
@@ -10037,20 +10408,20 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(open_future_args other) {
+    public int compareTo(close_namespace_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      open_future_args typedOther = (open_future_args)other;
+      close_namespace_args typedOther = (close_namespace_args)other;
 
-      lastComparison = Boolean.valueOf(isSetQueue_size()).compareTo(typedOther.isSetQueue_size());
+      lastComparison = Boolean.valueOf(isSetNs()).compareTo(typedOther.isSetNs());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetQueue_size()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.queue_size, typedOther.queue_size);
+      if (isSetNs()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.ns, typedOther.ns);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -10072,10 +10443,10 @@ public class ClientService {
           break;
         }
         switch (field.id) {
-          case 1: // QUEUE_SIZE
-            if (field.type == org.apache.thrift.protocol.TType.I32) {
-              this.queue_size = iprot.readI32();
-              setQueue_sizeIsSet(true);
+          case 1: // NS
+            if (field.type == org.apache.thrift.protocol.TType.I64) {
+              this.ns = iprot.readI64();
+              setNsIsSet(true);
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
             }
@@ -10095,8 +10466,8 @@ public class ClientService {
       validate();
 
       oprot.writeStructBegin(STRUCT_DESC);
-      oprot.writeFieldBegin(QUEUE_SIZE_FIELD_DESC);
-      oprot.writeI32(this.queue_size);
+      oprot.writeFieldBegin(NS_FIELD_DESC);
+      oprot.writeI64(this.ns);
       oprot.writeFieldEnd();
       oprot.writeFieldStop();
       oprot.writeStructEnd();
@@ -10104,11 +10475,11 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_future_args(");
+      StringBuilder sb = new StringBuilder("close_namespace_args(");
       boolean first = true;
 
-      sb.append("queue_size:");
-      sb.append(this.queue_size);
+      sb.append("ns:");
+      sb.append(this.ns);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -10128,8 +10499,6 @@ public class ClientService {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bit_vector = new BitSet(1);
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
@@ -10138,18 +10507,15 @@ public class ClientService {
 
   }
 
-  public static class open_future_result implements org.apache.thrift.TBase<open_future_result, open_future_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_future_result");
+  public static class close_namespace_result implements org.apache.thrift.TBase<close_namespace_result, close_namespace_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_namespace_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.I64, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
-    public long success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -10165,8 +10531,6 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -10209,84 +10573,49 @@ public class ClientService {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
-    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_future_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_namespace_result.class, metaDataMap);
     }
 
-    public open_future_result() {
+    public close_namespace_result() {
     }
 
-    public open_future_result(
-      long success,
+    public close_namespace_result(
       ClientException e)
     {
       this();
-      this.success = success;
-      setSuccessIsSet(true);
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public open_future_result(open_future_result other) {
-      __isset_bit_vector.clear();
-      __isset_bit_vector.or(other.__isset_bit_vector);
-      this.success = other.success;
+    public close_namespace_result(close_namespace_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public open_future_result deepCopy() {
-      return new open_future_result(this);
+    public close_namespace_result deepCopy() {
+      return new close_namespace_result(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = 0;
       this.e = null;
     }
 
-    public long getSuccess() {
-      return this.success;
-    }
-
-    public open_future_result setSuccess(long success) {
-      this.success = success;
-      setSuccessIsSet(true);
-      return this;
-    }
-
-    public void unsetSuccess() {
-      __isset_bit_vector.clear(__SUCCESS_ISSET_ID);
-    }
-
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return __isset_bit_vector.get(__SUCCESS_ISSET_ID);
-    }
-
-    public void setSuccessIsSet(boolean value) {
-      __isset_bit_vector.set(__SUCCESS_ISSET_ID, value);
-    }
-
     public ClientException getE() {
       return this.e;
     }
 
-    public open_future_result setE(ClientException e) {
+    public close_namespace_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -10308,14 +10637,6 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((Long)value);
-        }
-        break;
-
       case E:
         if (value == null) {
           unsetE();
@@ -10329,9 +10650,6 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return Long.valueOf(getSuccess());
-
       case E:
         return getE();
 
@@ -10346,8 +10664,6 @@ public class ClientService {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -10358,24 +10674,15 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof open_future_result)
-        return this.equals((open_future_result)that);
+      if (that instanceof close_namespace_result)
+        return this.equals((close_namespace_result)that);
       return false;
     }
 
-    public boolean equals(open_future_result that) {
+    public boolean equals(close_namespace_result that) {
       if (that == null)
         return false;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (this.success != that.success)
-          return false;
-      }
-
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -10393,24 +10700,14 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(open_future_result other) {
+    public int compareTo(close_namespace_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      open_future_result typedOther = (open_future_result)other;
+      close_namespace_result typedOther = (close_namespace_result)other;
 
-      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -10438,14 +10735,6 @@ public class ClientService {
           break;
         }
         switch (field.id) {
-          case 0: // SUCCESS
-            if (field.type == org.apache.thrift.protocol.TType.I64) {
-              this.success = iprot.readI64();
-              setSuccessIsSet(true);
-            } else { 
-              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
-            }
-            break;
           case 1: // E
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
               this.e = new ClientException();
@@ -10468,11 +10757,7 @@ public class ClientService {
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetSuccess()) {
-        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        oprot.writeI64(this.success);
-        oprot.writeFieldEnd();
-      } else if (this.isSetE()) {
+      if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -10483,13 +10768,9 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("open_future_result(");
+      StringBuilder sb = new StringBuilder("close_namespace_result(");
       boolean first = true;
 
-      sb.append("success:");
-      sb.append(this.success);
-      first = false;
-      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -10523,16 +10804,16 @@ public class ClientService {
 
   }
 
-  public static class cancel_future_args implements org.apache.thrift.TBase<cancel_future_args, cancel_future_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_future_args");
+  public static class open_future_args implements org.apache.thrift.TBase<open_future_args, open_future_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_future_args");
 
-    private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
+    private static final org.apache.thrift.protocol.TField QUEUE_SIZE_FIELD_DESC = new org.apache.thrift.protocol.TField("queue_size", org.apache.thrift.protocol.TType.I32, (short)1);
 
-    public long ff; // required
+    public int queue_size; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      FF((short)1, "ff");
+      QUEUE_SIZE((short)1, "queue_size");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
 
@@ -10547,8 +10828,8 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // FF
-            return FF;
+          case 1: // QUEUE_SIZE
+            return QUEUE_SIZE;
           default:
             return null;
         }
@@ -10589,78 +10870,80 @@ public class ClientService {
     }
 
     // isset id assignments
-    private static final int __FF_ISSET_ID = 0;
+    private static final int __QUEUE_SIZE_ISSET_ID = 0;
     private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
+      tmpMap.put(_Fields.QUEUE_SIZE, new org.apache.thrift.meta_data.FieldMetaData("queue_size", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_future_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_future_args.class, metaDataMap);
     }
 
-    public cancel_future_args() {
+    public open_future_args() {
+      this.queue_size = 0;
+
     }
 
-    public cancel_future_args(
-      long ff)
+    public open_future_args(
+      int queue_size)
     {
       this();
-      this.ff = ff;
-      setFfIsSet(true);
+      this.queue_size = queue_size;
+      setQueue_sizeIsSet(true);
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public cancel_future_args(cancel_future_args other) {
+    public open_future_args(open_future_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
-      this.ff = other.ff;
+      this.queue_size = other.queue_size;
     }
 
-    public cancel_future_args deepCopy() {
-      return new cancel_future_args(this);
+    public open_future_args deepCopy() {
+      return new open_future_args(this);
     }
 
     @Override
     public void clear() {
-      setFfIsSet(false);
-      this.ff = 0;
+      this.queue_size = 0;
+
     }
 
-    public long getFf() {
-      return this.ff;
+    public int getQueue_size() {
+      return this.queue_size;
     }
 
-    public cancel_future_args setFf(long ff) {
-      this.ff = ff;
-      setFfIsSet(true);
+    public open_future_args setQueue_size(int queue_size) {
+      this.queue_size = queue_size;
+      setQueue_sizeIsSet(true);
       return this;
     }
 
-    public void unsetFf() {
-      __isset_bit_vector.clear(__FF_ISSET_ID);
+    public void unsetQueue_size() {
+      __isset_bit_vector.clear(__QUEUE_SIZE_ISSET_ID);
     }
 
-    /** Returns true if field ff is set (has been assigned a value) and false otherwise */
-    public boolean isSetFf() {
-      return __isset_bit_vector.get(__FF_ISSET_ID);
+    /** Returns true if field queue_size is set (has been assigned a value) and false otherwise */
+    public boolean isSetQueue_size() {
+      return __isset_bit_vector.get(__QUEUE_SIZE_ISSET_ID);
     }
 
-    public void setFfIsSet(boolean value) {
-      __isset_bit_vector.set(__FF_ISSET_ID, value);
+    public void setQueue_sizeIsSet(boolean value) {
+      __isset_bit_vector.set(__QUEUE_SIZE_ISSET_ID, value);
     }
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
-      case FF:
+      case QUEUE_SIZE:
         if (value == null) {
-          unsetFf();
+          unsetQueue_size();
         } else {
-          setFf((Long)value);
+          setQueue_size((Integer)value);
         }
         break;
 
@@ -10669,8 +10952,8 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
-      case FF:
-        return Long.valueOf(getFf());
+      case QUEUE_SIZE:
+        return Integer.valueOf(getQueue_size());
 
       }
       throw new IllegalStateException();
@@ -10683,8 +10966,8 @@ public class ClientService {
       }
 
       switch (field) {
-      case FF:
-        return isSetFf();
+      case QUEUE_SIZE:
+        return isSetQueue_size();
       }
       throw new IllegalStateException();
     }
@@ -10693,21 +10976,21 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof cancel_future_args)
-        return this.equals((cancel_future_args)that);
+      if (that instanceof open_future_args)
+        return this.equals((open_future_args)that);
       return false;
     }
 
-    public boolean equals(cancel_future_args that) {
+    public boolean equals(open_future_args that) {
       if (that == null)
         return false;
 
-      boolean this_present_ff = true;
-      boolean that_present_ff = true;
-      if (this_present_ff || that_present_ff) {
-        if (!(this_present_ff && that_present_ff))
+      boolean this_present_queue_size = true;
+      boolean that_present_queue_size = true;
+      if (this_present_queue_size || that_present_queue_size) {
+        if (!(this_present_queue_size && that_present_queue_size))
           return false;
-        if (this.ff != that.ff)
+        if (this.queue_size != that.queue_size)
           return false;
       }
 
@@ -10719,20 +11002,20 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(cancel_future_args other) {
+    public int compareTo(open_future_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      cancel_future_args typedOther = (cancel_future_args)other;
+      open_future_args typedOther = (open_future_args)other;
 
-      lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
+      lastComparison = Boolean.valueOf(isSetQueue_size()).compareTo(typedOther.isSetQueue_size());
       if (lastComparison != 0) {
         return lastComparison;
       }
-      if (isSetFf()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.ff, typedOther.ff);
+      if (isSetQueue_size()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.queue_size, typedOther.queue_size);
         if (lastComparison != 0) {
           return lastComparison;
         }
@@ -10754,10 +11037,10 @@ public class ClientService {
           break;
         }
         switch (field.id) {
-          case 1: // FF
-            if (field.type == org.apache.thrift.protocol.TType.I64) {
-              this.ff = iprot.readI64();
-              setFfIsSet(true);
+          case 1: // QUEUE_SIZE
+            if (field.type == org.apache.thrift.protocol.TType.I32) {
+              this.queue_size = iprot.readI32();
+              setQueue_sizeIsSet(true);
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
             }
@@ -10777,8 +11060,8 @@ public class ClientService {
       validate();
 
       oprot.writeStructBegin(STRUCT_DESC);
-      oprot.writeFieldBegin(FF_FIELD_DESC);
-      oprot.writeI64(this.ff);
+      oprot.writeFieldBegin(QUEUE_SIZE_FIELD_DESC);
+      oprot.writeI32(this.queue_size);
       oprot.writeFieldEnd();
       oprot.writeFieldStop();
       oprot.writeStructEnd();
@@ -10786,11 +11069,11 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("cancel_future_args(");
+      StringBuilder sb = new StringBuilder("open_future_args(");
       boolean first = true;
 
-      sb.append("ff:");
-      sb.append(this.ff);
+      sb.append("queue_size:");
+      sb.append(this.queue_size);
       first = false;
       sb.append(")");
       return sb.toString();
@@ -10820,15 +11103,18 @@ public class ClientService {
 
   }
 
-  public static class cancel_future_result implements org.apache.thrift.TBase<cancel_future_result, cancel_future_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_future_result");
+  public static class open_future_result implements org.apache.thrift.TBase<open_future_result, open_future_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_future_result");
 
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.I64, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
+    public long success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -10844,6 +11130,8 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
+          case 0: // SUCCESS
+            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -10886,49 +11174,84 @@ public class ClientService {
     }
 
     // isset id assignments
+    private static final int __SUCCESS_ISSET_ID = 0;
+    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_future_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(open_future_result.class, metaDataMap);
     }
 
-    public cancel_future_result() {
+    public open_future_result() {
     }
 
-    public cancel_future_result(
+    public open_future_result(
+      long success,
       ClientException e)
     {
       this();
+      this.success = success;
+      setSuccessIsSet(true);
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public cancel_future_result(cancel_future_result other) {
+    public open_future_result(open_future_result other) {
+      __isset_bit_vector.clear();
+      __isset_bit_vector.or(other.__isset_bit_vector);
+      this.success = other.success;
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public cancel_future_result deepCopy() {
-      return new cancel_future_result(this);
+    public open_future_result deepCopy() {
+      return new open_future_result(this);
     }
 
     @Override
     public void clear() {
+      setSuccessIsSet(false);
+      this.success = 0;
       this.e = null;
     }
 
+    public long getSuccess() {
+      return this.success;
+    }
+
+    public open_future_result setSuccess(long success) {
+      this.success = success;
+      setSuccessIsSet(true);
+      return this;
+    }
+
+    public void unsetSuccess() {
+      __isset_bit_vector.clear(__SUCCESS_ISSET_ID);
+    }
+
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return __isset_bit_vector.get(__SUCCESS_ISSET_ID);
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      __isset_bit_vector.set(__SUCCESS_ISSET_ID, value);
+    }
+
     public ClientException getE() {
       return this.e;
     }
 
-    public cancel_future_result setE(ClientException e) {
+    public open_future_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -10950,6 +11273,14 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((Long)value);
+        }
+        break;
+
       case E:
         if (value == null) {
           unsetE();
@@ -10963,6 +11294,9 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
+      case SUCCESS:
+        return Long.valueOf(getSuccess());
+
       case E:
         return getE();
 
@@ -10977,6 +11311,8 @@ public class ClientService {
       }
 
       switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -10987,15 +11323,24 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof cancel_future_result)
-        return this.equals((cancel_future_result)that);
+      if (that instanceof open_future_result)
+        return this.equals((open_future_result)that);
       return false;
     }
 
-    public boolean equals(cancel_future_result that) {
+    public boolean equals(open_future_result that) {
       if (that == null)
         return false;
 
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (this.success != that.success)
+          return false;
+      }
+
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -11013,14 +11358,24 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(cancel_future_result other) {
+    public int compareTo(open_future_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      cancel_future_result typedOther = (cancel_future_result)other;
+      open_future_result typedOther = (open_future_result)other;
 
+      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -11048,6 +11403,14 @@ public class ClientService {
           break;
         }
         switch (field.id) {
+          case 0: // SUCCESS
+            if (field.type == org.apache.thrift.protocol.TType.I64) {
+              this.success = iprot.readI64();
+              setSuccessIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
           case 1: // E
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
               this.e = new ClientException();
@@ -11070,7 +11433,11 @@ public class ClientService {
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetE()) {
+      if (this.isSetSuccess()) {
+        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+        oprot.writeI64(this.success);
+        oprot.writeFieldEnd();
+      } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -11081,9 +11448,13 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("cancel_future_result(");
+      StringBuilder sb = new StringBuilder("open_future_result(");
       boolean first = true;
 
+      sb.append("success:");
+      sb.append(this.success);
+      first = false;
+      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -11117,8 +11488,8 @@ public class ClientService {
 
   }
 
-  public static class get_future_result_args implements org.apache.thrift.TBase<get_future_result_args, get_future_result_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_args");
+  public static class cancel_future_args implements org.apache.thrift.TBase<cancel_future_args, cancel_future_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_future_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -11192,13 +11563,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_future_args.class, metaDataMap);
     }
 
-    public get_future_result_args() {
+    public cancel_future_args() {
     }
 
-    public get_future_result_args(
+    public cancel_future_args(
       long ff)
     {
       this();
@@ -11209,14 +11580,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_future_result_args(get_future_result_args other) {
+    public cancel_future_args(cancel_future_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public get_future_result_args deepCopy() {
-      return new get_future_result_args(this);
+    public cancel_future_args deepCopy() {
+      return new cancel_future_args(this);
     }
 
     @Override
@@ -11229,7 +11600,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public get_future_result_args setFf(long ff) {
+    public cancel_future_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -11287,12 +11658,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_future_result_args)
-        return this.equals((get_future_result_args)that);
+      if (that instanceof cancel_future_args)
+        return this.equals((cancel_future_args)that);
       return false;
     }
 
-    public boolean equals(get_future_result_args that) {
+    public boolean equals(cancel_future_args that) {
       if (that == null)
         return false;
 
@@ -11313,13 +11684,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(get_future_result_args other) {
+    public int compareTo(cancel_future_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      get_future_result_args typedOther = (get_future_result_args)other;
+      cancel_future_args typedOther = (cancel_future_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -11380,7 +11751,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_future_result_args(");
+      StringBuilder sb = new StringBuilder("cancel_future_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -11404,6 +11775,8 @@ public class ClientService {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
       try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bit_vector = new BitSet(1);
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
@@ -11412,18 +11785,15 @@ public class ClientService {
 
   }
 
-  public static class get_future_result_result implements org.apache.thrift.TBase<get_future_result_result, get_future_result_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_result");
+  public static class cancel_future_result implements org.apache.thrift.TBase<cancel_future_result, cancel_future_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("cancel_future_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
-    public Result success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -11439,8 +11809,6 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 0: // SUCCESS
-            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -11487,77 +11855,45 @@ public class ClientService {
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
-      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, Result.class)));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(cancel_future_result.class, metaDataMap);
     }
 
-    public get_future_result_result() {
+    public cancel_future_result() {
     }
 
-    public get_future_result_result(
-      Result success,
+    public cancel_future_result(
       ClientException e)
     {
       this();
-      this.success = success;
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_future_result_result(get_future_result_result other) {
-      if (other.isSetSuccess()) {
-        this.success = new Result(other.success);
-      }
+    public cancel_future_result(cancel_future_result other) {
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public get_future_result_result deepCopy() {
-      return new get_future_result_result(this);
+    public cancel_future_result deepCopy() {
+      return new cancel_future_result(this);
     }
 
     @Override
     public void clear() {
-      this.success = null;
       this.e = null;
     }
 
-    public Result getSuccess() {
-      return this.success;
-    }
-
-    public get_future_result_result setSuccess(Result success) {
-      this.success = success;
-      return this;
-    }
-
-    public void unsetSuccess() {
-      this.success = null;
-    }
-
-    /** Returns true if field success is set (has been assigned a value) and false otherwise */
-    public boolean isSetSuccess() {
-      return this.success != null;
-    }
-
-    public void setSuccessIsSet(boolean value) {
-      if (!value) {
-        this.success = null;
-      }
-    }
-
     public ClientException getE() {
       return this.e;
     }
 
-    public get_future_result_result setE(ClientException e) {
+    public cancel_future_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -11579,14 +11915,6 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
-      case SUCCESS:
-        if (value == null) {
-          unsetSuccess();
-        } else {
-          setSuccess((Result)value);
-        }
-        break;
-
       case E:
         if (value == null) {
           unsetE();
@@ -11600,9 +11928,6 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
-      case SUCCESS:
-        return getSuccess();
-
       case E:
         return getE();
 
@@ -11617,8 +11942,6 @@ public class ClientService {
       }
 
       switch (field) {
-      case SUCCESS:
-        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -11629,24 +11952,15 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_future_result_result)
-        return this.equals((get_future_result_result)that);
+      if (that instanceof cancel_future_result)
+        return this.equals((cancel_future_result)that);
       return false;
     }
 
-    public boolean equals(get_future_result_result that) {
+    public boolean equals(cancel_future_result that) {
       if (that == null)
         return false;
 
-      boolean this_present_success = true && this.isSetSuccess();
-      boolean that_present_success = true && that.isSetSuccess();
-      if (this_present_success || that_present_success) {
-        if (!(this_present_success && that_present_success))
-          return false;
-        if (!this.success.equals(that.success))
-          return false;
-      }
-
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -11664,24 +11978,14 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(get_future_result_result other) {
+    public int compareTo(cancel_future_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      get_future_result_result typedOther = (get_future_result_result)other;
+      cancel_future_result typedOther = (cancel_future_result)other;
 
-      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
-      if (lastComparison != 0) {
-        return lastComparison;
-      }
-      if (isSetSuccess()) {
-        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
-        if (lastComparison != 0) {
-          return lastComparison;
-        }
-      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -11709,14 +12013,6 @@ public class ClientService {
           break;
         }
         switch (field.id) {
-          case 0: // SUCCESS
-            if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
-              this.success = new Result();
-              this.success.read(iprot);
-            } else { 
-              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
-            }
-            break;
           case 1: // E
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
               this.e = new ClientException();
@@ -11739,11 +12035,7 @@ public class ClientService {
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetSuccess()) {
-        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        this.success.write(oprot);
-        oprot.writeFieldEnd();
-      } else if (this.isSetE()) {
+      if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -11754,17 +12046,9 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_future_result_result(");
+      StringBuilder sb = new StringBuilder("cancel_future_result(");
       boolean first = true;
 
-      sb.append("success:");
-      if (this.success == null) {
-        sb.append("null");
-      } else {
-        sb.append(this.success);
-      }
-      first = false;
-      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -11798,8 +12082,8 @@ public class ClientService {
 
   }
 
-  public static class get_future_result_as_arrays_args implements org.apache.thrift.TBase<get_future_result_as_arrays_args, get_future_result_as_arrays_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_as_arrays_args");
+  public static class get_future_result_args implements org.apache.thrift.TBase<get_future_result_args, get_future_result_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -11873,13 +12157,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_as_arrays_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_args.class, metaDataMap);
     }
 
-    public get_future_result_as_arrays_args() {
+    public get_future_result_args() {
     }
 
-    public get_future_result_as_arrays_args(
+    public get_future_result_args(
       long ff)
     {
       this();
@@ -11890,14 +12174,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_future_result_as_arrays_args(get_future_result_as_arrays_args other) {
+    public get_future_result_args(get_future_result_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public get_future_result_as_arrays_args deepCopy() {
-      return new get_future_result_as_arrays_args(this);
+    public get_future_result_args deepCopy() {
+      return new get_future_result_args(this);
     }
 
     @Override
@@ -11910,7 +12194,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public get_future_result_as_arrays_args setFf(long ff) {
+    public get_future_result_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -11968,12 +12252,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_future_result_as_arrays_args)
-        return this.equals((get_future_result_as_arrays_args)that);
+      if (that instanceof get_future_result_args)
+        return this.equals((get_future_result_args)that);
       return false;
     }
 
-    public boolean equals(get_future_result_as_arrays_args that) {
+    public boolean equals(get_future_result_args that) {
       if (that == null)
         return false;
 
@@ -11994,13 +12278,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(get_future_result_as_arrays_args other) {
+    public int compareTo(get_future_result_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      get_future_result_as_arrays_args typedOther = (get_future_result_as_arrays_args)other;
+      get_future_result_args typedOther = (get_future_result_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -12061,7 +12345,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_future_result_as_arrays_args(");
+      StringBuilder sb = new StringBuilder("get_future_result_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -12085,8 +12369,6 @@ public class ClientService {
 
     private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
       try {
-        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
-        __isset_bit_vector = new BitSet(1);
         read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
       } catch (org.apache.thrift.TException te) {
         throw new java.io.IOException(te);
@@ -12095,13 +12377,13 @@ public class ClientService {
 
   }
 
-  public static class get_future_result_as_arrays_result implements org.apache.thrift.TBase<get_future_result_as_arrays_result, get_future_result_as_arrays_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_as_arrays_result");
+  public static class get_future_result_result implements org.apache.thrift.TBase<get_future_result_result, get_future_result_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
-    public ResultAsArrays success; // required
+    public Result success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -12171,18 +12453,18 @@ public class ClientService {
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ResultAsArrays.class)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, Result.class)));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_as_arrays_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_result.class, metaDataMap);
     }
 
-    public get_future_result_as_arrays_result() {
+    public get_future_result_result() {
     }
 
-    public get_future_result_as_arrays_result(
-      ResultAsArrays success,
+    public get_future_result_result(
+      Result success,
       ClientException e)
     {
       this();
@@ -12193,17 +12475,17 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_future_result_as_arrays_result(get_future_result_as_arrays_result other) {
+    public get_future_result_result(get_future_result_result other) {
       if (other.isSetSuccess()) {
-        this.success = new ResultAsArrays(other.success);
+        this.success = new Result(other.success);
       }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public get_future_result_as_arrays_result deepCopy() {
-      return new get_future_result_as_arrays_result(this);
+    public get_future_result_result deepCopy() {
+      return new get_future_result_result(this);
     }
 
     @Override
@@ -12212,11 +12494,11 @@ public class ClientService {
       this.e = null;
     }
 
-    public ResultAsArrays getSuccess() {
+    public Result getSuccess() {
       return this.success;
     }
 
-    public get_future_result_as_arrays_result setSuccess(ResultAsArrays success) {
+    public get_future_result_result setSuccess(Result success) {
       this.success = success;
       return this;
     }
@@ -12240,7 +12522,7 @@ public class ClientService {
       return this.e;
     }
 
-    public get_future_result_as_arrays_result setE(ClientException e) {
+    public get_future_result_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -12266,7 +12548,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((ResultAsArrays)value);
+          setSuccess((Result)value);
         }
         break;
 
@@ -12312,12 +12594,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_future_result_as_arrays_result)
-        return this.equals((get_future_result_as_arrays_result)that);
+      if (that instanceof get_future_result_result)
+        return this.equals((get_future_result_result)that);
       return false;
     }
 
-    public boolean equals(get_future_result_as_arrays_result that) {
+    public boolean equals(get_future_result_result that) {
       if (that == null)
         return false;
 
@@ -12347,13 +12629,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(get_future_result_as_arrays_result other) {
+    public int compareTo(get_future_result_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      get_future_result_as_arrays_result typedOther = (get_future_result_as_arrays_result)other;
+      get_future_result_result typedOther = (get_future_result_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -12394,7 +12676,7 @@ public class ClientService {
         switch (field.id) {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
-              this.success = new ResultAsArrays();
+              this.success = new Result();
               this.success.read(iprot);
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
@@ -12437,7 +12719,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_future_result_as_arrays_result(");
+      StringBuilder sb = new StringBuilder("get_future_result_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -12481,8 +12763,8 @@ public class ClientService {
 
   }
 
-  public static class get_future_result_serialized_args implements org.apache.thrift.TBase<get_future_result_serialized_args, get_future_result_serialized_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_serialized_args");
+  public static class get_future_result_as_arrays_args implements org.apache.thrift.TBase<get_future_result_as_arrays_args, get_future_result_as_arrays_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_as_arrays_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -12556,13 +12838,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_serialized_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_as_arrays_args.class, metaDataMap);
     }
 
-    public get_future_result_serialized_args() {
+    public get_future_result_as_arrays_args() {
     }
 
-    public get_future_result_serialized_args(
+    public get_future_result_as_arrays_args(
       long ff)
     {
       this();
@@ -12573,14 +12855,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_future_result_serialized_args(get_future_result_serialized_args other) {
+    public get_future_result_as_arrays_args(get_future_result_as_arrays_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public get_future_result_serialized_args deepCopy() {
-      return new get_future_result_serialized_args(this);
+    public get_future_result_as_arrays_args deepCopy() {
+      return new get_future_result_as_arrays_args(this);
     }
 
     @Override
@@ -12593,7 +12875,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public get_future_result_serialized_args setFf(long ff) {
+    public get_future_result_as_arrays_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -12651,12 +12933,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_future_result_serialized_args)
-        return this.equals((get_future_result_serialized_args)that);
+      if (that instanceof get_future_result_as_arrays_args)
+        return this.equals((get_future_result_as_arrays_args)that);
       return false;
     }
 
-    public boolean equals(get_future_result_serialized_args that) {
+    public boolean equals(get_future_result_as_arrays_args that) {
       if (that == null)
         return false;
 
@@ -12677,13 +12959,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(get_future_result_serialized_args other) {
+    public int compareTo(get_future_result_as_arrays_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      get_future_result_serialized_args typedOther = (get_future_result_serialized_args)other;
+      get_future_result_as_arrays_args typedOther = (get_future_result_as_arrays_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -12744,7 +13026,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_future_result_serialized_args(");
+      StringBuilder sb = new StringBuilder("get_future_result_as_arrays_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -12778,13 +13060,13 @@ public class ClientService {
 
   }
 
-  public static class get_future_result_serialized_result implements org.apache.thrift.TBase<get_future_result_serialized_result, get_future_result_serialized_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_serialized_result");
+  public static class get_future_result_as_arrays_result implements org.apache.thrift.TBase<get_future_result_as_arrays_result, get_future_result_as_arrays_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_as_arrays_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
-    public ResultSerialized success; // required
+    public ResultAsArrays success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -12854,18 +13136,18 @@ public class ClientService {
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ResultSerialized.class)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ResultAsArrays.class)));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_serialized_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_as_arrays_result.class, metaDataMap);
     }
 
-    public get_future_result_serialized_result() {
+    public get_future_result_as_arrays_result() {
     }
 
-    public get_future_result_serialized_result(
-      ResultSerialized success,
+    public get_future_result_as_arrays_result(
+      ResultAsArrays success,
       ClientException e)
     {
       this();
@@ -12876,17 +13158,17 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public get_future_result_serialized_result(get_future_result_serialized_result other) {
+    public get_future_result_as_arrays_result(get_future_result_as_arrays_result other) {
       if (other.isSetSuccess()) {
-        this.success = new ResultSerialized(other.success);
+        this.success = new ResultAsArrays(other.success);
       }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public get_future_result_serialized_result deepCopy() {
-      return new get_future_result_serialized_result(this);
+    public get_future_result_as_arrays_result deepCopy() {
+      return new get_future_result_as_arrays_result(this);
     }
 
     @Override
@@ -12895,11 +13177,11 @@ public class ClientService {
       this.e = null;
     }
 
-    public ResultSerialized getSuccess() {
+    public ResultAsArrays getSuccess() {
       return this.success;
     }
 
-    public get_future_result_serialized_result setSuccess(ResultSerialized success) {
+    public get_future_result_as_arrays_result setSuccess(ResultAsArrays success) {
       this.success = success;
       return this;
     }
@@ -12923,7 +13205,7 @@ public class ClientService {
       return this.e;
     }
 
-    public get_future_result_serialized_result setE(ClientException e) {
+    public get_future_result_as_arrays_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -12949,7 +13231,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((ResultSerialized)value);
+          setSuccess((ResultAsArrays)value);
         }
         break;
 
@@ -12995,12 +13277,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof get_future_result_serialized_result)
-        return this.equals((get_future_result_serialized_result)that);
+      if (that instanceof get_future_result_as_arrays_result)
+        return this.equals((get_future_result_as_arrays_result)that);
       return false;
     }
 
-    public boolean equals(get_future_result_serialized_result that) {
+    public boolean equals(get_future_result_as_arrays_result that) {
       if (that == null)
         return false;
 
@@ -13030,13 +13312,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(get_future_result_serialized_result other) {
+    public int compareTo(get_future_result_as_arrays_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      get_future_result_serialized_result typedOther = (get_future_result_serialized_result)other;
+      get_future_result_as_arrays_result typedOther = (get_future_result_as_arrays_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -13077,7 +13359,7 @@ public class ClientService {
         switch (field.id) {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
-              this.success = new ResultSerialized();
+              this.success = new ResultAsArrays();
               this.success.read(iprot);
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
@@ -13120,7 +13402,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("get_future_result_serialized_result(");
+      StringBuilder sb = new StringBuilder("get_future_result_as_arrays_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -13164,8 +13446,8 @@ public class ClientService {
 
   }
 
-  public static class future_is_empty_args implements org.apache.thrift.TBase<future_is_empty_args, future_is_empty_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_empty_args");
+  public static class get_future_result_serialized_args implements org.apache.thrift.TBase<get_future_result_serialized_args, get_future_result_serialized_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_serialized_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -13239,13 +13521,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_empty_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_serialized_args.class, metaDataMap);
     }
 
-    public future_is_empty_args() {
+    public get_future_result_serialized_args() {
     }
 
-    public future_is_empty_args(
+    public get_future_result_serialized_args(
       long ff)
     {
       this();
@@ -13256,14 +13538,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_is_empty_args(future_is_empty_args other) {
+    public get_future_result_serialized_args(get_future_result_serialized_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public future_is_empty_args deepCopy() {
-      return new future_is_empty_args(this);
+    public get_future_result_serialized_args deepCopy() {
+      return new get_future_result_serialized_args(this);
     }
 
     @Override
@@ -13276,7 +13558,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public future_is_empty_args setFf(long ff) {
+    public get_future_result_serialized_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -13334,12 +13616,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_is_empty_args)
-        return this.equals((future_is_empty_args)that);
+      if (that instanceof get_future_result_serialized_args)
+        return this.equals((get_future_result_serialized_args)that);
       return false;
     }
 
-    public boolean equals(future_is_empty_args that) {
+    public boolean equals(get_future_result_serialized_args that) {
       if (that == null)
         return false;
 
@@ -13360,13 +13642,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_is_empty_args other) {
+    public int compareTo(get_future_result_serialized_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_is_empty_args typedOther = (future_is_empty_args)other;
+      get_future_result_serialized_args typedOther = (get_future_result_serialized_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -13427,7 +13709,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_is_empty_args(");
+      StringBuilder sb = new StringBuilder("get_future_result_serialized_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -13461,13 +13743,13 @@ public class ClientService {
 
   }
 
-  public static class future_is_empty_result implements org.apache.thrift.TBase<future_is_empty_result, future_is_empty_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_empty_result");
+  public static class get_future_result_serialized_result implements org.apache.thrift.TBase<get_future_result_serialized_result, get_future_result_serialized_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("get_future_result_serialized_result");
 
-    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.STRUCT, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
-    public boolean success; // required
+    public ResultSerialized success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
@@ -13532,84 +13814,81 @@ public class ClientService {
     }
 
     // isset id assignments
-    private static final int __SUCCESS_ISSET_ID = 0;
-    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
       tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
-          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
+          new org.apache.thrift.meta_data.StructMetaData(org.apache.thrift.protocol.TType.STRUCT, ResultSerialized.class)));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_empty_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(get_future_result_serialized_result.class, metaDataMap);
     }
 
-    public future_is_empty_result() {
+    public get_future_result_serialized_result() {
     }
 
-    public future_is_empty_result(
-      boolean success,
+    public get_future_result_serialized_result(
+      ResultSerialized success,
       ClientException e)
     {
       this();
       this.success = success;
-      setSuccessIsSet(true);
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_is_empty_result(future_is_empty_result other) {
-      __isset_bit_vector.clear();
-      __isset_bit_vector.or(other.__isset_bit_vector);
-      this.success = other.success;
+    public get_future_result_serialized_result(get_future_result_serialized_result other) {
+      if (other.isSetSuccess()) {
+        this.success = new ResultSerialized(other.success);
+      }
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public future_is_empty_result deepCopy() {
-      return new future_is_empty_result(this);
+    public get_future_result_serialized_result deepCopy() {
+      return new get_future_result_serialized_result(this);
     }
 
     @Override
     public void clear() {
-      setSuccessIsSet(false);
-      this.success = false;
+      this.success = null;
       this.e = null;
     }
 
-    public boolean isSuccess() {
+    public ResultSerialized getSuccess() {
       return this.success;
     }
 
-    public future_is_empty_result setSuccess(boolean success) {
+    public get_future_result_serialized_result setSuccess(ResultSerialized success) {
       this.success = success;
-      setSuccessIsSet(true);
       return this;
     }
 
     public void unsetSuccess() {
-      __isset_bit_vector.clear(__SUCCESS_ISSET_ID);
+      this.success = null;
     }
 
     /** Returns true if field success is set (has been assigned a value) and false otherwise */
     public boolean isSetSuccess() {
-      return __isset_bit_vector.get(__SUCCESS_ISSET_ID);
+      return this.success != null;
     }
 
     public void setSuccessIsSet(boolean value) {
-      __isset_bit_vector.set(__SUCCESS_ISSET_ID, value);
+      if (!value) {
+        this.success = null;
+      }
     }
 
     public ClientException getE() {
       return this.e;
     }
 
-    public future_is_empty_result setE(ClientException e) {
+    public get_future_result_serialized_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -13635,7 +13914,7 @@ public class ClientService {
         if (value == null) {
           unsetSuccess();
         } else {
-          setSuccess((Boolean)value);
+          setSuccess((ResultSerialized)value);
         }
         break;
 
@@ -13653,7 +13932,7 @@ public class ClientService {
     public Object getFieldValue(_Fields field) {
       switch (field) {
       case SUCCESS:
-        return Boolean.valueOf(isSuccess());
+        return getSuccess();
 
       case E:
         return getE();
@@ -13681,21 +13960,21 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_is_empty_result)
-        return this.equals((future_is_empty_result)that);
+      if (that instanceof get_future_result_serialized_result)
+        return this.equals((get_future_result_serialized_result)that);
       return false;
     }
 
-    public boolean equals(future_is_empty_result that) {
+    public boolean equals(get_future_result_serialized_result that) {
       if (that == null)
         return false;
 
-      boolean this_present_success = true;
-      boolean that_present_success = true;
+      boolean this_present_success = true && this.isSetSuccess();
+      boolean that_present_success = true && that.isSetSuccess();
       if (this_present_success || that_present_success) {
         if (!(this_present_success && that_present_success))
           return false;
-        if (this.success != that.success)
+        if (!this.success.equals(that.success))
           return false;
       }
 
@@ -13716,13 +13995,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_is_empty_result other) {
+    public int compareTo(get_future_result_serialized_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_is_empty_result typedOther = (future_is_empty_result)other;
+      get_future_result_serialized_result typedOther = (get_future_result_serialized_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -13762,9 +14041,9 @@ public class ClientService {
         }
         switch (field.id) {
           case 0: // SUCCESS
-            if (field.type == org.apache.thrift.protocol.TType.BOOL) {
-              this.success = iprot.readBool();
-              setSuccessIsSet(true);
+            if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
+              this.success = new ResultSerialized();
+              this.success.read(iprot);
             } else { 
               org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
             }
@@ -13793,7 +14072,7 @@ public class ClientService {
 
       if (this.isSetSuccess()) {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
-        oprot.writeBool(this.success);
+        this.success.write(oprot);
         oprot.writeFieldEnd();
       } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
@@ -13806,11 +14085,15 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_is_empty_result(");
+      StringBuilder sb = new StringBuilder("get_future_result_serialized_result(");
       boolean first = true;
 
       sb.append("success:");
-      sb.append(this.success);
+      if (this.success == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.success);
+      }
       first = false;
       if (!first) sb.append(", ");
       sb.append("e:");
@@ -13846,8 +14129,8 @@ public class ClientService {
 
   }
 
-  public static class future_is_full_args implements org.apache.thrift.TBase<future_is_full_args, future_is_full_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_full_args");
+  public static class future_is_empty_args implements org.apache.thrift.TBase<future_is_empty_args, future_is_empty_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_empty_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -13921,13 +14204,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_full_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_empty_args.class, metaDataMap);
     }
 
-    public future_is_full_args() {
+    public future_is_empty_args() {
     }
 
-    public future_is_full_args(
+    public future_is_empty_args(
       long ff)
     {
       this();
@@ -13938,14 +14221,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_is_full_args(future_is_full_args other) {
+    public future_is_empty_args(future_is_empty_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public future_is_full_args deepCopy() {
-      return new future_is_full_args(this);
+    public future_is_empty_args deepCopy() {
+      return new future_is_empty_args(this);
     }
 
     @Override
@@ -13958,7 +14241,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public future_is_full_args setFf(long ff) {
+    public future_is_empty_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -14016,12 +14299,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_is_full_args)
-        return this.equals((future_is_full_args)that);
+      if (that instanceof future_is_empty_args)
+        return this.equals((future_is_empty_args)that);
       return false;
     }
 
-    public boolean equals(future_is_full_args that) {
+    public boolean equals(future_is_empty_args that) {
       if (that == null)
         return false;
 
@@ -14042,13 +14325,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_is_full_args other) {
+    public int compareTo(future_is_empty_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_is_full_args typedOther = (future_is_full_args)other;
+      future_is_empty_args typedOther = (future_is_empty_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -14109,7 +14392,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_is_full_args(");
+      StringBuilder sb = new StringBuilder("future_is_empty_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -14143,8 +14426,8 @@ public class ClientService {
 
   }
 
-  public static class future_is_full_result implements org.apache.thrift.TBase<future_is_full_result, future_is_full_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_full_result");
+  public static class future_is_empty_result implements org.apache.thrift.TBase<future_is_empty_result, future_is_empty_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_empty_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
@@ -14225,13 +14508,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_full_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_empty_result.class, metaDataMap);
     }
 
-    public future_is_full_result() {
+    public future_is_empty_result() {
     }
 
-    public future_is_full_result(
+    public future_is_empty_result(
       boolean success,
       ClientException e)
     {
@@ -14244,7 +14527,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_is_full_result(future_is_full_result other) {
+    public future_is_empty_result(future_is_empty_result other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.success = other.success;
@@ -14253,8 +14536,8 @@ public class ClientService {
       }
     }
 
-    public future_is_full_result deepCopy() {
-      return new future_is_full_result(this);
+    public future_is_empty_result deepCopy() {
+      return new future_is_empty_result(this);
     }
 
     @Override
@@ -14268,7 +14551,7 @@ public class ClientService {
       return this.success;
     }
 
-    public future_is_full_result setSuccess(boolean success) {
+    public future_is_empty_result setSuccess(boolean success) {
       this.success = success;
       setSuccessIsSet(true);
       return this;
@@ -14291,7 +14574,7 @@ public class ClientService {
       return this.e;
     }
 
-    public future_is_full_result setE(ClientException e) {
+    public future_is_empty_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -14363,12 +14646,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_is_full_result)
-        return this.equals((future_is_full_result)that);
+      if (that instanceof future_is_empty_result)
+        return this.equals((future_is_empty_result)that);
       return false;
     }
 
-    public boolean equals(future_is_full_result that) {
+    public boolean equals(future_is_empty_result that) {
       if (that == null)
         return false;
 
@@ -14398,13 +14681,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_is_full_result other) {
+    public int compareTo(future_is_empty_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_is_full_result typedOther = (future_is_full_result)other;
+      future_is_empty_result typedOther = (future_is_empty_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -14488,7 +14771,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_is_full_result(");
+      StringBuilder sb = new StringBuilder("future_is_empty_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -14528,8 +14811,8 @@ public class ClientService {
 
   }
 
-  public static class future_is_cancelled_args implements org.apache.thrift.TBase<future_is_cancelled_args, future_is_cancelled_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_cancelled_args");
+  public static class future_is_full_args implements org.apache.thrift.TBase<future_is_full_args, future_is_full_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_full_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -14603,13 +14886,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_cancelled_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_full_args.class, metaDataMap);
     }
 
-    public future_is_cancelled_args() {
+    public future_is_full_args() {
     }
 
-    public future_is_cancelled_args(
+    public future_is_full_args(
       long ff)
     {
       this();
@@ -14620,14 +14903,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_is_cancelled_args(future_is_cancelled_args other) {
+    public future_is_full_args(future_is_full_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public future_is_cancelled_args deepCopy() {
-      return new future_is_cancelled_args(this);
+    public future_is_full_args deepCopy() {
+      return new future_is_full_args(this);
     }
 
     @Override
@@ -14640,7 +14923,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public future_is_cancelled_args setFf(long ff) {
+    public future_is_full_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -14698,12 +14981,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_is_cancelled_args)
-        return this.equals((future_is_cancelled_args)that);
+      if (that instanceof future_is_full_args)
+        return this.equals((future_is_full_args)that);
       return false;
     }
 
-    public boolean equals(future_is_cancelled_args that) {
+    public boolean equals(future_is_full_args that) {
       if (that == null)
         return false;
 
@@ -14724,13 +15007,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_is_cancelled_args other) {
+    public int compareTo(future_is_full_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_is_cancelled_args typedOther = (future_is_cancelled_args)other;
+      future_is_full_args typedOther = (future_is_full_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -14791,7 +15074,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_is_cancelled_args(");
+      StringBuilder sb = new StringBuilder("future_is_full_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -14825,8 +15108,8 @@ public class ClientService {
 
   }
 
-  public static class future_is_cancelled_result implements org.apache.thrift.TBase<future_is_cancelled_result, future_is_cancelled_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_cancelled_result");
+  public static class future_is_full_result implements org.apache.thrift.TBase<future_is_full_result, future_is_full_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_full_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
@@ -14907,13 +15190,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_cancelled_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_full_result.class, metaDataMap);
     }
 
-    public future_is_cancelled_result() {
+    public future_is_full_result() {
     }
 
-    public future_is_cancelled_result(
+    public future_is_full_result(
       boolean success,
       ClientException e)
     {
@@ -14926,7 +15209,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_is_cancelled_result(future_is_cancelled_result other) {
+    public future_is_full_result(future_is_full_result other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.success = other.success;
@@ -14935,8 +15218,8 @@ public class ClientService {
       }
     }
 
-    public future_is_cancelled_result deepCopy() {
-      return new future_is_cancelled_result(this);
+    public future_is_full_result deepCopy() {
+      return new future_is_full_result(this);
     }
 
     @Override
@@ -14950,7 +15233,7 @@ public class ClientService {
       return this.success;
     }
 
-    public future_is_cancelled_result setSuccess(boolean success) {
+    public future_is_full_result setSuccess(boolean success) {
       this.success = success;
       setSuccessIsSet(true);
       return this;
@@ -14973,7 +15256,7 @@ public class ClientService {
       return this.e;
     }
 
-    public future_is_cancelled_result setE(ClientException e) {
+    public future_is_full_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -15045,12 +15328,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_is_cancelled_result)
-        return this.equals((future_is_cancelled_result)that);
+      if (that instanceof future_is_full_result)
+        return this.equals((future_is_full_result)that);
       return false;
     }
 
-    public boolean equals(future_is_cancelled_result that) {
+    public boolean equals(future_is_full_result that) {
       if (that == null)
         return false;
 
@@ -15080,13 +15363,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_is_cancelled_result other) {
+    public int compareTo(future_is_full_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_is_cancelled_result typedOther = (future_is_cancelled_result)other;
+      future_is_full_result typedOther = (future_is_full_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -15170,7 +15453,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_is_cancelled_result(");
+      StringBuilder sb = new StringBuilder("future_is_full_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -15210,8 +15493,8 @@ public class ClientService {
 
   }
 
-  public static class future_has_outstanding_args implements org.apache.thrift.TBase<future_has_outstanding_args, future_has_outstanding_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_has_outstanding_args");
+  public static class future_is_cancelled_args implements org.apache.thrift.TBase<future_is_cancelled_args, future_is_cancelled_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_cancelled_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -15285,13 +15568,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_has_outstanding_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_cancelled_args.class, metaDataMap);
     }
 
-    public future_has_outstanding_args() {
+    public future_is_cancelled_args() {
     }
 
-    public future_has_outstanding_args(
+    public future_is_cancelled_args(
       long ff)
     {
       this();
@@ -15302,14 +15585,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_has_outstanding_args(future_has_outstanding_args other) {
+    public future_is_cancelled_args(future_is_cancelled_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public future_has_outstanding_args deepCopy() {
-      return new future_has_outstanding_args(this);
+    public future_is_cancelled_args deepCopy() {
+      return new future_is_cancelled_args(this);
     }
 
     @Override
@@ -15322,7 +15605,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public future_has_outstanding_args setFf(long ff) {
+    public future_is_cancelled_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -15380,12 +15663,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_has_outstanding_args)
-        return this.equals((future_has_outstanding_args)that);
+      if (that instanceof future_is_cancelled_args)
+        return this.equals((future_is_cancelled_args)that);
       return false;
     }
 
-    public boolean equals(future_has_outstanding_args that) {
+    public boolean equals(future_is_cancelled_args that) {
       if (that == null)
         return false;
 
@@ -15406,13 +15689,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_has_outstanding_args other) {
+    public int compareTo(future_is_cancelled_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_has_outstanding_args typedOther = (future_has_outstanding_args)other;
+      future_is_cancelled_args typedOther = (future_is_cancelled_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -15473,7 +15756,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_has_outstanding_args(");
+      StringBuilder sb = new StringBuilder("future_is_cancelled_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -15507,8 +15790,8 @@ public class ClientService {
 
   }
 
-  public static class future_has_outstanding_result implements org.apache.thrift.TBase<future_has_outstanding_result, future_has_outstanding_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_has_outstanding_result");
+  public static class future_is_cancelled_result implements org.apache.thrift.TBase<future_is_cancelled_result, future_is_cancelled_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_is_cancelled_result");
 
     private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
@@ -15589,13 +15872,13 @@ public class ClientService {
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_has_outstanding_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_is_cancelled_result.class, metaDataMap);
     }
 
-    public future_has_outstanding_result() {
+    public future_is_cancelled_result() {
     }
 
-    public future_has_outstanding_result(
+    public future_is_cancelled_result(
       boolean success,
       ClientException e)
     {
@@ -15608,7 +15891,7 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public future_has_outstanding_result(future_has_outstanding_result other) {
+    public future_is_cancelled_result(future_is_cancelled_result other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.success = other.success;
@@ -15617,8 +15900,8 @@ public class ClientService {
       }
     }
 
-    public future_has_outstanding_result deepCopy() {
-      return new future_has_outstanding_result(this);
+    public future_is_cancelled_result deepCopy() {
+      return new future_is_cancelled_result(this);
     }
 
     @Override
@@ -15632,7 +15915,7 @@ public class ClientService {
       return this.success;
     }
 
-    public future_has_outstanding_result setSuccess(boolean success) {
+    public future_is_cancelled_result setSuccess(boolean success) {
       this.success = success;
       setSuccessIsSet(true);
       return this;
@@ -15655,7 +15938,7 @@ public class ClientService {
       return this.e;
     }
 
-    public future_has_outstanding_result setE(ClientException e) {
+    public future_is_cancelled_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -15727,12 +16010,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof future_has_outstanding_result)
-        return this.equals((future_has_outstanding_result)that);
+      if (that instanceof future_is_cancelled_result)
+        return this.equals((future_is_cancelled_result)that);
       return false;
     }
 
-    public boolean equals(future_has_outstanding_result that) {
+    public boolean equals(future_is_cancelled_result that) {
       if (that == null)
         return false;
 
@@ -15762,13 +16045,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(future_has_outstanding_result other) {
+    public int compareTo(future_is_cancelled_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      future_has_outstanding_result typedOther = (future_has_outstanding_result)other;
+      future_is_cancelled_result typedOther = (future_is_cancelled_result)other;
 
       lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
       if (lastComparison != 0) {
@@ -15852,7 +16135,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("future_has_outstanding_result(");
+      StringBuilder sb = new StringBuilder("future_is_cancelled_result(");
       boolean first = true;
 
       sb.append("success:");
@@ -15892,8 +16175,8 @@ public class ClientService {
 
   }
 
-  public static class close_future_args implements org.apache.thrift.TBase<close_future_args, close_future_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_future_args");
+  public static class future_has_outstanding_args implements org.apache.thrift.TBase<future_has_outstanding_args, future_has_outstanding_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_has_outstanding_args");
 
     private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
@@ -15967,13 +16250,13 @@ public class ClientService {
       tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_future_args.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_has_outstanding_args.class, metaDataMap);
     }
 
-    public close_future_args() {
+    public future_has_outstanding_args() {
     }
 
-    public close_future_args(
+    public future_has_outstanding_args(
       long ff)
     {
       this();
@@ -15984,14 +16267,14 @@ public class ClientService {
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_future_args(close_future_args other) {
+    public future_has_outstanding_args(future_has_outstanding_args other) {
       __isset_bit_vector.clear();
       __isset_bit_vector.or(other.__isset_bit_vector);
       this.ff = other.ff;
     }
 
-    public close_future_args deepCopy() {
-      return new close_future_args(this);
+    public future_has_outstanding_args deepCopy() {
+      return new future_has_outstanding_args(this);
     }
 
     @Override
@@ -16004,7 +16287,7 @@ public class ClientService {
       return this.ff;
     }
 
-    public close_future_args setFf(long ff) {
+    public future_has_outstanding_args setFf(long ff) {
       this.ff = ff;
       setFfIsSet(true);
       return this;
@@ -16062,12 +16345,12 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_future_args)
-        return this.equals((close_future_args)that);
+      if (that instanceof future_has_outstanding_args)
+        return this.equals((future_has_outstanding_args)that);
       return false;
     }
 
-    public boolean equals(close_future_args that) {
+    public boolean equals(future_has_outstanding_args that) {
       if (that == null)
         return false;
 
@@ -16088,13 +16371,13 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_future_args other) {
+    public int compareTo(future_has_outstanding_args other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_future_args typedOther = (close_future_args)other;
+      future_has_outstanding_args typedOther = (future_has_outstanding_args)other;
 
       lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
       if (lastComparison != 0) {
@@ -16155,7 +16438,7 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_future_args(");
+      StringBuilder sb = new StringBuilder("future_has_outstanding_args(");
       boolean first = true;
 
       sb.append("ff:");
@@ -16189,15 +16472,18 @@ public class ClientService {
 
   }
 
-  public static class close_future_result implements org.apache.thrift.TBase<close_future_result, close_future_result._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_future_result");
+  public static class future_has_outstanding_result implements org.apache.thrift.TBase<future_has_outstanding_result, future_has_outstanding_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("future_has_outstanding_result");
 
+    private static final org.apache.thrift.protocol.TField SUCCESS_FIELD_DESC = new org.apache.thrift.protocol.TField("success", org.apache.thrift.protocol.TType.BOOL, (short)0);
     private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
 
+    public boolean success; // required
     public ClientException e; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      SUCCESS((short)0, "success"),
       E((short)1, "e");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
@@ -16213,6 +16499,8 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
+          case 0: // SUCCESS
+            return SUCCESS;
           case 1: // E
             return E;
           default:
@@ -16255,49 +16543,84 @@ public class ClientService {
     }
 
     // isset id assignments
+    private static final int __SUCCESS_ISSET_ID = 0;
+    private BitSet __isset_bit_vector = new BitSet(1);
 
     public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
     static {
       Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.SUCCESS, new org.apache.thrift.meta_data.FieldMetaData("success", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.BOOL)));
       tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
           new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
       metaDataMap = Collections.unmodifiableMap(tmpMap);
-      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_future_result.class, metaDataMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(future_has_outstanding_result.class, metaDataMap);
     }
 
-    public close_future_result() {
+    public future_has_outstanding_result() {
     }
 
-    public close_future_result(
+    public future_has_outstanding_result(
+      boolean success,
       ClientException e)
     {
       this();
+      this.success = success;
+      setSuccessIsSet(true);
       this.e = e;
     }
 
     /**
      * Performs a deep copy on <i>other</i>.
      */
-    public close_future_result(close_future_result other) {
+    public future_has_outstanding_result(future_has_outstanding_result other) {
+      __isset_bit_vector.clear();
+      __isset_bit_vector.or(other.__isset_bit_vector);
+      this.success = other.success;
       if (other.isSetE()) {
         this.e = new ClientException(other.e);
       }
     }
 
-    public close_future_result deepCopy() {
-      return new close_future_result(this);
+    public future_has_outstanding_result deepCopy() {
+      return new future_has_outstanding_result(this);
     }
 
     @Override
     public void clear() {
+      setSuccessIsSet(false);
+      this.success = false;
       this.e = null;
     }
 
+    public boolean isSuccess() {
+      return this.success;
+    }
+
+    public future_has_outstanding_result setSuccess(boolean success) {
+      this.success = success;
+      setSuccessIsSet(true);
+      return this;
+    }
+
+    public void unsetSuccess() {
+      __isset_bit_vector.clear(__SUCCESS_ISSET_ID);
+    }
+
+    /** Returns true if field success is set (has been assigned a value) and false otherwise */
+    public boolean isSetSuccess() {
+      return __isset_bit_vector.get(__SUCCESS_ISSET_ID);
+    }
+
+    public void setSuccessIsSet(boolean value) {
+      __isset_bit_vector.set(__SUCCESS_ISSET_ID, value);
+    }
+
     public ClientException getE() {
       return this.e;
     }
 
-    public close_future_result setE(ClientException e) {
+    public future_has_outstanding_result setE(ClientException e) {
       this.e = e;
       return this;
     }
@@ -16319,6 +16642,14 @@ public class ClientService {
 
     public void setFieldValue(_Fields field, Object value) {
       switch (field) {
+      case SUCCESS:
+        if (value == null) {
+          unsetSuccess();
+        } else {
+          setSuccess((Boolean)value);
+        }
+        break;
+
       case E:
         if (value == null) {
           unsetE();
@@ -16332,6 +16663,9 @@ public class ClientService {
 
     public Object getFieldValue(_Fields field) {
       switch (field) {
+      case SUCCESS:
+        return Boolean.valueOf(isSuccess());
+
       case E:
         return getE();
 
@@ -16346,6 +16680,8 @@ public class ClientService {
       }
 
       switch (field) {
+      case SUCCESS:
+        return isSetSuccess();
       case E:
         return isSetE();
       }
@@ -16356,15 +16692,24 @@ public class ClientService {
     public boolean equals(Object that) {
       if (that == null)
         return false;
-      if (that instanceof close_future_result)
-        return this.equals((close_future_result)that);
+      if (that instanceof future_has_outstanding_result)
+        return this.equals((future_has_outstanding_result)that);
       return false;
     }
 
-    public boolean equals(close_future_result that) {
+    public boolean equals(future_has_outstanding_result that) {
       if (that == null)
         return false;
 
+      boolean this_present_success = true;
+      boolean that_present_success = true;
+      if (this_present_success || that_present_success) {
+        if (!(this_present_success && that_present_success))
+          return false;
+        if (this.success != that.success)
+          return false;
+      }
+
       boolean this_present_e = true && this.isSetE();
       boolean that_present_e = true && that.isSetE();
       if (this_present_e || that_present_e) {
@@ -16382,14 +16727,24 @@ public class ClientService {
       return 0;
     }
 
-    public int compareTo(close_future_result other) {
+    public int compareTo(future_has_outstanding_result other) {
       if (!getClass().equals(other.getClass())) {
         return getClass().getName().compareTo(other.getClass().getName());
       }
 
       int lastComparison = 0;
-      close_future_result typedOther = (close_future_result)other;
+      future_has_outstanding_result typedOther = (future_has_outstanding_result)other;
 
+      lastComparison = Boolean.valueOf(isSetSuccess()).compareTo(typedOther.isSetSuccess());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetSuccess()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.success, typedOther.success);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
       lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
       if (lastComparison != 0) {
         return lastComparison;
@@ -16417,6 +16772,14 @@ public class ClientService {
           break;
         }
         switch (field.id) {
+          case 0: // SUCCESS
+            if (field.type == org.apache.thrift.protocol.TType.BOOL) {
+              this.success = iprot.readBool();
+              setSuccessIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
           case 1: // E
             if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
               this.e = new ClientException();
@@ -16439,7 +16802,11 @@ public class ClientService {
     public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
       oprot.writeStructBegin(STRUCT_DESC);
 
-      if (this.isSetE()) {
+      if (this.isSetSuccess()) {
+        oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
+        oprot.writeBool(this.success);
+        oprot.writeFieldEnd();
+      } else if (this.isSetE()) {
         oprot.writeFieldBegin(E_FIELD_DESC);
         this.e.write(oprot);
         oprot.writeFieldEnd();
@@ -16450,9 +16817,13 @@ public class ClientService {
 
     @Override
     public String toString() {
-      StringBuilder sb = new StringBuilder("close_future_result(");
+      StringBuilder sb = new StringBuilder("future_has_outstanding_result(");
       boolean first = true;
 
+      sb.append("success:");
+      sb.append(this.success);
+      first = false;
+      if (!first) sb.append(", ");
       sb.append("e:");
       if (this.e == null) {
         sb.append("null");
@@ -16486,22 +16857,16 @@ public class ClientService {
 
   }
 
-  public static class open_scanner_args implements org.apache.thrift.TBase<open_scanner_args, open_scanner_args._Fields>, java.io.Serializable, Cloneable   {
-    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_scanner_args");
+  public static class close_future_args implements org.apache.thrift.TBase<close_future_args, close_future_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_future_args");
 
-    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.I64, (short)1);
-    private static final org.apache.thrift.protocol.TField TABLE_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("table_name", org.apache.thrift.protocol.TType.STRING, (short)2);
-    private static final org.apache.thrift.protocol.TField SCAN_SPEC_FIELD_DESC = new org.apache.thrift.protocol.TField("scan_spec", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+    private static final org.apache.thrift.protocol.TField FF_FIELD_DESC = new org.apache.thrift.protocol.TField("ff", org.apache.thrift.protocol.TType.I64, (short)1);
 
-    public long ns; // required
-    public String table_name; // required
-    public ScanSpec scan_spec; // required
+    public long ff; // required
 
     /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
     public enum _Fields implements org.apache.thrift.TFieldIdEnum {
-      NS((short)1, "ns"),
-      TABLE_NAME((short)2, "table_name"),
-      SCAN_SPEC((short)3, "scan_spec");
+      FF((short)1, "ff");
 
       private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
 
@@ -16516,12 +16881,612 @@ public class ClientService {
        */
       public static _Fields findByThriftId(int fieldId) {
         switch(fieldId) {
-          case 1: // NS
-            return NS;
-          case 2: // TABLE_NAME
-            return TABLE_NAME;
-          case 3: // SCAN_SPEC
-            return SCAN_SPEC;
+          case 1: // FF
+            return FF;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      public static _Fields findByName(String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final String _fieldName;
+
+      _Fields(short thriftId, String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      public String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+    private static final int __FF_ISSET_ID = 0;
+    private BitSet __isset_bit_vector = new BitSet(1);
+
+    public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.FF, new org.apache.thrift.meta_data.FieldMetaData("ff", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I64          , "Future")));
+      metaDataMap = Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_future_args.class, metaDataMap);
+    }
+
+    public close_future_args() {
+    }
+
+    public close_future_args(
+      long ff)
+    {
+      this();
+      this.ff = ff;
+      setFfIsSet(true);
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public close_future_args(close_future_args other) {
+      __isset_bit_vector.clear();
+      __isset_bit_vector.or(other.__isset_bit_vector);
+      this.ff = other.ff;
+    }
+
+    public close_future_args deepCopy() {
+      return new close_future_args(this);
+    }
+
+    @Override
+    public void clear() {
+      setFfIsSet(false);
+      this.ff = 0;
+    }
+
+    public long getFf() {
+      return this.ff;
+    }
+
+    public close_future_args setFf(long ff) {
+      this.ff = ff;
+      setFfIsSet(true);
+      return this;
+    }
+
+    public void unsetFf() {
+      __isset_bit_vector.clear(__FF_ISSET_ID);
+    }
+
+    /** Returns true if field ff is set (has been assigned a value) and false otherwise */
+    public boolean isSetFf() {
+      return __isset_bit_vector.get(__FF_ISSET_ID);
+    }
+
+    public void setFfIsSet(boolean value) {
+      __isset_bit_vector.set(__FF_ISSET_ID, value);
+    }
+
+    public void setFieldValue(_Fields field, Object value) {
+      switch (field) {
+      case FF:
+        if (value == null) {
+          unsetFf();
+        } else {
+          setFf((Long)value);
+        }
+        break;
+
+      }
+    }
+
+    public Object getFieldValue(_Fields field) {
+      switch (field) {
+      case FF:
+        return Long.valueOf(getFf());
+
+      }
+      throw new IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new IllegalArgumentException();
+      }
+
+      switch (field) {
+      case FF:
+        return isSetFf();
+      }
+      throw new IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof close_future_args)
+        return this.equals((close_future_args)that);
+      return false;
+    }
+
+    public boolean equals(close_future_args that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_ff = true;
+      boolean that_present_ff = true;
+      if (this_present_ff || that_present_ff) {
+        if (!(this_present_ff && that_present_ff))
+          return false;
+        if (this.ff != that.ff)
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public int compareTo(close_future_args other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+      close_future_args typedOther = (close_future_args)other;
+
+      lastComparison = Boolean.valueOf(isSetFf()).compareTo(typedOther.isSetFf());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetFf()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.ff, typedOther.ff);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField field;
+      iprot.readStructBegin();
+      while (true)
+      {
+        field = iprot.readFieldBegin();
+        if (field.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (field.id) {
+          case 1: // FF
+            if (field.type == org.apache.thrift.protocol.TType.I64) {
+              this.ff = iprot.readI64();
+              setFfIsSet(true);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      validate();
+    }
+
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      validate();
+
+      oprot.writeStructBegin(STRUCT_DESC);
+      oprot.writeFieldBegin(FF_FIELD_DESC);
+      oprot.writeI64(this.ff);
+      oprot.writeFieldEnd();
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("close_future_args(");
+      boolean first = true;
+
+      sb.append("ff:");
+      sb.append(this.ff);
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
+      try {
+        // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+        __isset_bit_vector = new BitSet(1);
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+  }
+
+  public static class close_future_result implements org.apache.thrift.TBase<close_future_result, close_future_result._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("close_future_result");
+
+    private static final org.apache.thrift.protocol.TField E_FIELD_DESC = new org.apache.thrift.protocol.TField("e", org.apache.thrift.protocol.TType.STRUCT, (short)1);
+
+    public ClientException e; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      E((short)1, "e");
+
+      private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
+
+      static {
+        for (_Fields field : EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // E
+            return E;
+          default:
+            return null;
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, throwing an exception
+       * if it is not found.
+       */
+      public static _Fields findByThriftIdOrThrow(int fieldId) {
+        _Fields fields = findByThriftId(fieldId);
+        if (fields == null) throw new IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+        return fields;
+      }
+
+      /**
+       * Find the _Fields constant that matches name, or null if its not found.
+       */
+      public static _Fields findByName(String name) {
+        return byName.get(name);
+      }
+
+      private final short _thriftId;
+      private final String _fieldName;
+
+      _Fields(short thriftId, String fieldName) {
+        _thriftId = thriftId;
+        _fieldName = fieldName;
+      }
+
+      public short getThriftFieldId() {
+        return _thriftId;
+      }
+
+      public String getFieldName() {
+        return _fieldName;
+      }
+    }
+
+    // isset id assignments
+
+    public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+    static {
+      Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+      tmpMap.put(_Fields.E, new org.apache.thrift.meta_data.FieldMetaData("e", org.apache.thrift.TFieldRequirementType.DEFAULT, 
+          new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRUCT)));
+      metaDataMap = Collections.unmodifiableMap(tmpMap);
+      org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(close_future_result.class, metaDataMap);
+    }
+
+    public close_future_result() {
+    }
+
+    public close_future_result(
+      ClientException e)
+    {
+      this();
+      this.e = e;
+    }
+
+    /**
+     * Performs a deep copy on <i>other</i>.
+     */
+    public close_future_result(close_future_result other) {
+      if (other.isSetE()) {
+        this.e = new ClientException(other.e);
+      }
+    }
+
+    public close_future_result deepCopy() {
+      return new close_future_result(this);
+    }
+
+    @Override
+    public void clear() {
+      this.e = null;
+    }
+
+    public ClientException getE() {
+      return this.e;
+    }
+
+    public close_future_result setE(ClientException e) {
+      this.e = e;
+      return this;
+    }
+
+    public void unsetE() {
+      this.e = null;
+    }
+
+    /** Returns true if field e is set (has been assigned a value) and false otherwise */
+    public boolean isSetE() {
+      return this.e != null;
+    }
+
+    public void setEIsSet(boolean value) {
+      if (!value) {
+        this.e = null;
+      }
+    }
+
+    public void setFieldValue(_Fields field, Object value) {
+      switch (field) {
+      case E:
+        if (value == null) {
+          unsetE();
+        } else {
+          setE((ClientException)value);
+        }
+        break;
+
+      }
+    }
+
+    public Object getFieldValue(_Fields field) {
+      switch (field) {
+      case E:
+        return getE();
+
+      }
+      throw new IllegalStateException();
+    }
+
+    /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+    public boolean isSet(_Fields field) {
+      if (field == null) {
+        throw new IllegalArgumentException();
+      }
+
+      switch (field) {
+      case E:
+        return isSetE();
+      }
+      throw new IllegalStateException();
+    }
+
+    @Override
+    public boolean equals(Object that) {
+      if (that == null)
+        return false;
+      if (that instanceof close_future_result)
+        return this.equals((close_future_result)that);
+      return false;
+    }
+
+    public boolean equals(close_future_result that) {
+      if (that == null)
+        return false;
+
+      boolean this_present_e = true && this.isSetE();
+      boolean that_present_e = true && that.isSetE();
+      if (this_present_e || that_present_e) {
+        if (!(this_present_e && that_present_e))
+          return false;
+        if (!this.e.equals(that.e))
+          return false;
+      }
+
+      return true;
+    }
+
+    @Override
+    public int hashCode() {
+      return 0;
+    }
+
+    public int compareTo(close_future_result other) {
+      if (!getClass().equals(other.getClass())) {
+        return getClass().getName().compareTo(other.getClass().getName());
+      }
+
+      int lastComparison = 0;
+      close_future_result typedOther = (close_future_result)other;
+
+      lastComparison = Boolean.valueOf(isSetE()).compareTo(typedOther.isSetE());
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+      if (isSetE()) {
+        lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.e, typedOther.e);
+        if (lastComparison != 0) {
+          return lastComparison;
+        }
+      }
+      return 0;
+    }
+
+    public _Fields fieldForId(int fieldId) {
+      return _Fields.findByThriftId(fieldId);
+    }
+
+    public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+      org.apache.thrift.protocol.TField field;
+      iprot.readStructBegin();
+      while (true)
+      {
+        field = iprot.readFieldBegin();
+        if (field.type == org.apache.thrift.protocol.TType.STOP) { 
+          break;
+        }
+        switch (field.id) {
+          case 1: // E
+            if (field.type == org.apache.thrift.protocol.TType.STRUCT) {
+              this.e = new ClientException();
+              this.e.read(iprot);
+            } else { 
+              org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+            }
+            break;
+          default:
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+        }
+        iprot.readFieldEnd();
+      }
+      iprot.readStructEnd();
+
+      // check for required fields of primitive type, which can't be checked in the validate method
+      validate();
+    }
+
+    public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+      oprot.writeStructBegin(STRUCT_DESC);
+
+      if (this.isSetE()) {
+        oprot.writeFieldBegin(E_FIELD_DESC);
+        this.e.write(oprot);
+        oprot.writeFieldEnd();
+      }
+      oprot.writeFieldStop();
+      oprot.writeStructEnd();
+    }
+
+    @Override
+    public String toString() {
+      StringBuilder sb = new StringBuilder("close_future_result(");
+      boolean first = true;
+
+      sb.append("e:");
+      if (this.e == null) {
+        sb.append("null");
+      } else {
+        sb.append(this.e);
+      }
+      first = false;
+      sb.append(")");
+      return sb.toString();
+    }
+
+    public void validate() throws org.apache.thrift.TException {
+      // check for required fields
+    }
+
+    private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+      try {
+        write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+    private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
+      try {
+        read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+      } catch (org.apache.thrift.TException te) {
+        throw new java.io.IOException(te);
+      }
+    }
+
+  }
+
+  public static class open_scanner_args implements org.apache.thrift.TBase<open_scanner_args, open_scanner_args._Fields>, java.io.Serializable, Cloneable   {
+    private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("open_scanner_args");
+
+    private static final org.apache.thrift.protocol.TField NS_FIELD_DESC = new org.apache.thrift.protocol.TField("ns", org.apache.thrift.protocol.TType.I64, (short)1);
+    private static final org.apache.thrift.protocol.TField TABLE_NAME_FIELD_DESC = new org.apache.thrift.protocol.TField("table_name", org.apache.thrift.protocol.TType.STRING, (short)2);
+    private static final org.apache.thrift.protocol.TField SCAN_SPEC_FIELD_DESC = new org.apache.thrift.protocol.TField("scan_spec", org.apache.thrift.protocol.TType.STRUCT, (short)3);
+
+    public long ns; // required
+    public String table_name; // required
+    public ScanSpec scan_spec; // required
+
+    /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+    public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+      NS((short)1, "ns"),
+      TABLE_NAME((short)2, "table_name"),
+      SCAN_SPEC((short)3, "scan_spec");
+
+      private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
+
+      static {
+        for (_Fields field : EnumSet.allOf(_Fields.class)) {
+          byName.put(field.getFieldName(), field);
+        }
+      }
+
+      /**
+       * Find the _Fields constant that matches fieldId, or null if its not found.
+       */
+      public static _Fields findByThriftId(int fieldId) {
+        switch(fieldId) {
+          case 1: // NS
+            return NS;
+          case 2: // TABLE_NAME
+            return TABLE_NAME;
+          case 3: // SCAN_SPEC
+            return SCAN_SPEC;
           default:
             return null;
         }
@@ -20685,14 +21650,14 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list38 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list38.size);
-                for (int _i39 = 0; _i39 < _list38.size; ++_i39)
+                org.apache.thrift.protocol.TList _list42 = iprot.readListBegin();
+                this.success = new ArrayList<Cell>(_list42.size);
+                for (int _i43 = 0; _i43 < _list42.size; ++_i43)
                 {
-                  Cell _elem40; // required
-                  _elem40 = new Cell();
-                  _elem40.read(iprot);
-                  this.success.add(_elem40);
+                  Cell _elem44; // required
+                  _elem44 = new Cell();
+                  _elem44.read(iprot);
+                  this.success.add(_elem44);
                 }
                 iprot.readListEnd();
               }
@@ -20726,9 +21691,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.success.size()));
-          for (Cell _iter41 : this.success)
+          for (Cell _iter45 : this.success)
           {
-            _iter41.write(oprot);
+            _iter45.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -21405,23 +22370,23 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list42 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list42.size);
-                for (int _i43 = 0; _i43 < _list42.size; ++_i43)
+                org.apache.thrift.protocol.TList _list46 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list46.size);
+                for (int _i47 = 0; _i47 < _list46.size; ++_i47)
                 {
-                  List<String> _elem44; // required
+                  List<String> _elem48; // required
                   {
-                    org.apache.thrift.protocol.TList _list45 = iprot.readListBegin();
-                    _elem44 = new ArrayList<String>(_list45.size);
-                    for (int _i46 = 0; _i46 < _list45.size; ++_i46)
+                    org.apache.thrift.protocol.TList _list49 = iprot.readListBegin();
+                    _elem48 = new ArrayList<String>(_list49.size);
+                    for (int _i50 = 0; _i50 < _list49.size; ++_i50)
                     {
-                      String _elem47; // required
-                      _elem47 = iprot.readString();
-                      _elem44.add(_elem47);
+                      String _elem51; // required
+                      _elem51 = iprot.readString();
+                      _elem48.add(_elem51);
                     }
                     iprot.readListEnd();
                   }
-                  this.success.add(_elem44);
+                  this.success.add(_elem48);
                 }
                 iprot.readListEnd();
               }
@@ -21455,13 +22420,13 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.success.size()));
-          for (List<String> _iter48 : this.success)
+          for (List<String> _iter52 : this.success)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter48.size()));
-              for (String _iter49 : _iter48)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter52.size()));
+              for (String _iter53 : _iter52)
               {
-                oprot.writeString(_iter49);
+                oprot.writeString(_iter53);
               }
               oprot.writeListEnd();
             }
@@ -22744,14 +23709,14 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list50 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list50.size);
-                for (int _i51 = 0; _i51 < _list50.size; ++_i51)
+                org.apache.thrift.protocol.TList _list54 = iprot.readListBegin();
+                this.success = new ArrayList<Cell>(_list54.size);
+                for (int _i55 = 0; _i55 < _list54.size; ++_i55)
                 {
-                  Cell _elem52; // required
-                  _elem52 = new Cell();
-                  _elem52.read(iprot);
-                  this.success.add(_elem52);
+                  Cell _elem56; // required
+                  _elem56 = new Cell();
+                  _elem56.read(iprot);
+                  this.success.add(_elem56);
                 }
                 iprot.readListEnd();
               }
@@ -22785,9 +23750,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.success.size()));
-          for (Cell _iter53 : this.success)
+          for (Cell _iter57 : this.success)
           {
-            _iter53.write(oprot);
+            _iter57.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -23464,23 +24429,23 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list54 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list54.size);
-                for (int _i55 = 0; _i55 < _list54.size; ++_i55)
+                org.apache.thrift.protocol.TList _list58 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list58.size);
+                for (int _i59 = 0; _i59 < _list58.size; ++_i59)
                 {
-                  List<String> _elem56; // required
+                  List<String> _elem60; // required
                   {
-                    org.apache.thrift.protocol.TList _list57 = iprot.readListBegin();
-                    _elem56 = new ArrayList<String>(_list57.size);
-                    for (int _i58 = 0; _i58 < _list57.size; ++_i58)
+                    org.apache.thrift.protocol.TList _list61 = iprot.readListBegin();
+                    _elem60 = new ArrayList<String>(_list61.size);
+                    for (int _i62 = 0; _i62 < _list61.size; ++_i62)
                     {
-                      String _elem59; // required
-                      _elem59 = iprot.readString();
-                      _elem56.add(_elem59);
+                      String _elem63; // required
+                      _elem63 = iprot.readString();
+                      _elem60.add(_elem63);
                     }
                     iprot.readListEnd();
                   }
-                  this.success.add(_elem56);
+                  this.success.add(_elem60);
                 }
                 iprot.readListEnd();
               }
@@ -23514,13 +24479,13 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.success.size()));
-          for (List<String> _iter60 : this.success)
+          for (List<String> _iter64 : this.success)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter60.size()));
-              for (String _iter61 : _iter60)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter64.size()));
+              for (String _iter65 : _iter64)
               {
-                oprot.writeString(_iter61);
+                oprot.writeString(_iter65);
               }
               oprot.writeListEnd();
             }
@@ -25070,14 +26035,14 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list62 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list62.size);
-                for (int _i63 = 0; _i63 < _list62.size; ++_i63)
+                org.apache.thrift.protocol.TList _list66 = iprot.readListBegin();
+                this.success = new ArrayList<Cell>(_list66.size);
+                for (int _i67 = 0; _i67 < _list66.size; ++_i67)
                 {
-                  Cell _elem64; // required
-                  _elem64 = new Cell();
-                  _elem64.read(iprot);
-                  this.success.add(_elem64);
+                  Cell _elem68; // required
+                  _elem68 = new Cell();
+                  _elem68.read(iprot);
+                  this.success.add(_elem68);
                 }
                 iprot.readListEnd();
               }
@@ -25111,9 +26076,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.success.size()));
-          for (Cell _iter65 : this.success)
+          for (Cell _iter69 : this.success)
           {
-            _iter65.write(oprot);
+            _iter69.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -25968,23 +26933,23 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list66 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list66.size);
-                for (int _i67 = 0; _i67 < _list66.size; ++_i67)
+                org.apache.thrift.protocol.TList _list70 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list70.size);
+                for (int _i71 = 0; _i71 < _list70.size; ++_i71)
                 {
-                  List<String> _elem68; // required
+                  List<String> _elem72; // required
                   {
-                    org.apache.thrift.protocol.TList _list69 = iprot.readListBegin();
-                    _elem68 = new ArrayList<String>(_list69.size);
-                    for (int _i70 = 0; _i70 < _list69.size; ++_i70)
+                    org.apache.thrift.protocol.TList _list73 = iprot.readListBegin();
+                    _elem72 = new ArrayList<String>(_list73.size);
+                    for (int _i74 = 0; _i74 < _list73.size; ++_i74)
                     {
-                      String _elem71; // required
-                      _elem71 = iprot.readString();
-                      _elem68.add(_elem71);
+                      String _elem75; // required
+                      _elem75 = iprot.readString();
+                      _elem72.add(_elem75);
                     }
                     iprot.readListEnd();
                   }
-                  this.success.add(_elem68);
+                  this.success.add(_elem72);
                 }
                 iprot.readListEnd();
               }
@@ -26018,13 +26983,13 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.success.size()));
-          for (List<String> _iter72 : this.success)
+          for (List<String> _iter76 : this.success)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter72.size()));
-              for (String _iter73 : _iter72)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter76.size()));
+              for (String _iter77 : _iter76)
               {
-                oprot.writeString(_iter73);
+                oprot.writeString(_iter77);
               }
               oprot.writeListEnd();
             }
@@ -28708,14 +29673,14 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list74 = iprot.readListBegin();
-                this.success = new ArrayList<Cell>(_list74.size);
-                for (int _i75 = 0; _i75 < _list74.size; ++_i75)
+                org.apache.thrift.protocol.TList _list78 = iprot.readListBegin();
+                this.success = new ArrayList<Cell>(_list78.size);
+                for (int _i79 = 0; _i79 < _list78.size; ++_i79)
                 {
-                  Cell _elem76; // required
-                  _elem76 = new Cell();
-                  _elem76.read(iprot);
-                  this.success.add(_elem76);
+                  Cell _elem80; // required
+                  _elem80 = new Cell();
+                  _elem80.read(iprot);
+                  this.success.add(_elem80);
                 }
                 iprot.readListEnd();
               }
@@ -28749,9 +29714,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.success.size()));
-          for (Cell _iter77 : this.success)
+          for (Cell _iter81 : this.success)
           {
-            _iter77.write(oprot);
+            _iter81.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -29607,23 +30572,23 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list78 = iprot.readListBegin();
-                this.success = new ArrayList<List<String>>(_list78.size);
-                for (int _i79 = 0; _i79 < _list78.size; ++_i79)
+                org.apache.thrift.protocol.TList _list82 = iprot.readListBegin();
+                this.success = new ArrayList<List<String>>(_list82.size);
+                for (int _i83 = 0; _i83 < _list82.size; ++_i83)
                 {
-                  List<String> _elem80; // required
+                  List<String> _elem84; // required
                   {
-                    org.apache.thrift.protocol.TList _list81 = iprot.readListBegin();
-                    _elem80 = new ArrayList<String>(_list81.size);
-                    for (int _i82 = 0; _i82 < _list81.size; ++_i82)
+                    org.apache.thrift.protocol.TList _list85 = iprot.readListBegin();
+                    _elem84 = new ArrayList<String>(_list85.size);
+                    for (int _i86 = 0; _i86 < _list85.size; ++_i86)
                     {
-                      String _elem83; // required
-                      _elem83 = iprot.readString();
-                      _elem80.add(_elem83);
+                      String _elem87; // required
+                      _elem87 = iprot.readString();
+                      _elem84.add(_elem87);
                     }
                     iprot.readListEnd();
                   }
-                  this.success.add(_elem80);
+                  this.success.add(_elem84);
                 }
                 iprot.readListEnd();
               }
@@ -29657,13 +30622,13 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.success.size()));
-          for (List<String> _iter84 : this.success)
+          for (List<String> _iter88 : this.success)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter84.size()));
-              for (String _iter85 : _iter84)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter88.size()));
+              for (String _iter89 : _iter88)
               {
-                oprot.writeString(_iter85);
+                oprot.writeString(_iter89);
               }
               oprot.writeListEnd();
             }
@@ -31852,14 +32817,14 @@ public class ClientService {
           case 4: // CELLS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list86 = iprot.readListBegin();
-                this.cells = new ArrayList<Cell>(_list86.size);
-                for (int _i87 = 0; _i87 < _list86.size; ++_i87)
+                org.apache.thrift.protocol.TList _list90 = iprot.readListBegin();
+                this.cells = new ArrayList<Cell>(_list90.size);
+                for (int _i91 = 0; _i91 < _list90.size; ++_i91)
                 {
-                  Cell _elem88; // required
-                  _elem88 = new Cell();
-                  _elem88.read(iprot);
-                  this.cells.add(_elem88);
+                  Cell _elem92; // required
+                  _elem92 = new Cell();
+                  _elem92.read(iprot);
+                  this.cells.add(_elem92);
                 }
                 iprot.readListEnd();
               }
@@ -31899,9 +32864,9 @@ public class ClientService {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.cells.size()));
-          for (Cell _iter89 : this.cells)
+          for (Cell _iter93 : this.cells)
           {
-            _iter89.write(oprot);
+            _iter93.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -32750,23 +33715,23 @@ public class ClientService {
           case 4: // CELLS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list90 = iprot.readListBegin();
-                this.cells = new ArrayList<List<String>>(_list90.size);
-                for (int _i91 = 0; _i91 < _list90.size; ++_i91)
+                org.apache.thrift.protocol.TList _list94 = iprot.readListBegin();
+                this.cells = new ArrayList<List<String>>(_list94.size);
+                for (int _i95 = 0; _i95 < _list94.size; ++_i95)
                 {
-                  List<String> _elem92; // required
+                  List<String> _elem96; // required
                   {
-                    org.apache.thrift.protocol.TList _list93 = iprot.readListBegin();
-                    _elem92 = new ArrayList<String>(_list93.size);
-                    for (int _i94 = 0; _i94 < _list93.size; ++_i94)
+                    org.apache.thrift.protocol.TList _list97 = iprot.readListBegin();
+                    _elem96 = new ArrayList<String>(_list97.size);
+                    for (int _i98 = 0; _i98 < _list97.size; ++_i98)
                     {
-                      String _elem95; // required
-                      _elem95 = iprot.readString();
-                      _elem92.add(_elem95);
+                      String _elem99; // required
+                      _elem99 = iprot.readString();
+                      _elem96.add(_elem99);
                     }
                     iprot.readListEnd();
                   }
-                  this.cells.add(_elem92);
+                  this.cells.add(_elem96);
                 }
                 iprot.readListEnd();
               }
@@ -32806,13 +33771,13 @@ public class ClientService {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.cells.size()));
-          for (List<String> _iter96 : this.cells)
+          for (List<String> _iter100 : this.cells)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter96.size()));
-              for (String _iter97 : _iter96)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter100.size()));
+              for (String _iter101 : _iter100)
               {
-                oprot.writeString(_iter97);
+                oprot.writeString(_iter101);
               }
               oprot.writeListEnd();
             }
@@ -34522,13 +35487,13 @@ public class ClientService {
           case 4: // CELL
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list98 = iprot.readListBegin();
-                this.cell = new ArrayList<String>(_list98.size);
-                for (int _i99 = 0; _i99 < _list98.size; ++_i99)
+                org.apache.thrift.protocol.TList _list102 = iprot.readListBegin();
+                this.cell = new ArrayList<String>(_list102.size);
+                for (int _i103 = 0; _i103 < _list102.size; ++_i103)
                 {
-                  String _elem100; // required
-                  _elem100 = iprot.readString();
-                  this.cell.add(_elem100);
+                  String _elem104; // required
+                  _elem104 = iprot.readString();
+                  this.cell.add(_elem104);
                 }
                 iprot.readListEnd();
               }
@@ -34568,9 +35533,9 @@ public class ClientService {
         oprot.writeFieldBegin(CELL_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, this.cell.size()));
-          for (String _iter101 : this.cell)
+          for (String _iter105 : this.cell)
           {
-            oprot.writeString(_iter101);
+            oprot.writeString(_iter105);
           }
           oprot.writeListEnd();
         }
@@ -39611,13 +40576,13 @@ public class ClientService {
           case 2: // CELL
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list102 = iprot.readListBegin();
-                this.cell = new ArrayList<String>(_list102.size);
-                for (int _i103 = 0; _i103 < _list102.size; ++_i103)
+                org.apache.thrift.protocol.TList _list106 = iprot.readListBegin();
+                this.cell = new ArrayList<String>(_list106.size);
+                for (int _i107 = 0; _i107 < _list106.size; ++_i107)
                 {
-                  String _elem104; // required
-                  _elem104 = iprot.readString();
-                  this.cell.add(_elem104);
+                  String _elem108; // required
+                  _elem108 = iprot.readString();
+                  this.cell.add(_elem108);
                 }
                 iprot.readListEnd();
               }
@@ -39647,9 +40612,9 @@ public class ClientService {
         oprot.writeFieldBegin(CELL_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, this.cell.size()));
-          for (String _iter105 : this.cell)
+          for (String _iter109 : this.cell)
           {
-            oprot.writeString(_iter105);
+            oprot.writeString(_iter109);
           }
           oprot.writeListEnd();
         }
@@ -40331,14 +41296,14 @@ public class ClientService {
           case 2: // CELLS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list106 = iprot.readListBegin();
-                this.cells = new ArrayList<Cell>(_list106.size);
-                for (int _i107 = 0; _i107 < _list106.size; ++_i107)
+                org.apache.thrift.protocol.TList _list110 = iprot.readListBegin();
+                this.cells = new ArrayList<Cell>(_list110.size);
+                for (int _i111 = 0; _i111 < _list110.size; ++_i111)
                 {
-                  Cell _elem108; // required
-                  _elem108 = new Cell();
-                  _elem108.read(iprot);
-                  this.cells.add(_elem108);
+                  Cell _elem112; // required
+                  _elem112 = new Cell();
+                  _elem112.read(iprot);
+                  this.cells.add(_elem112);
                 }
                 iprot.readListEnd();
               }
@@ -40368,9 +41333,9 @@ public class ClientService {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.cells.size()));
-          for (Cell _iter109 : this.cells)
+          for (Cell _iter113 : this.cells)
           {
-            _iter109.write(oprot);
+            _iter113.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -41050,23 +42015,23 @@ public class ClientService {
           case 2: // CELLS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list110 = iprot.readListBegin();
-                this.cells = new ArrayList<List<String>>(_list110.size);
-                for (int _i111 = 0; _i111 < _list110.size; ++_i111)
+                org.apache.thrift.protocol.TList _list114 = iprot.readListBegin();
+                this.cells = new ArrayList<List<String>>(_list114.size);
+                for (int _i115 = 0; _i115 < _list114.size; ++_i115)
                 {
-                  List<String> _elem112; // required
+                  List<String> _elem116; // required
                   {
-                    org.apache.thrift.protocol.TList _list113 = iprot.readListBegin();
-                    _elem112 = new ArrayList<String>(_list113.size);
-                    for (int _i114 = 0; _i114 < _list113.size; ++_i114)
+                    org.apache.thrift.protocol.TList _list117 = iprot.readListBegin();
+                    _elem116 = new ArrayList<String>(_list117.size);
+                    for (int _i118 = 0; _i118 < _list117.size; ++_i118)
                     {
-                      String _elem115; // required
-                      _elem115 = iprot.readString();
-                      _elem112.add(_elem115);
+                      String _elem119; // required
+                      _elem119 = iprot.readString();
+                      _elem116.add(_elem119);
                     }
                     iprot.readListEnd();
                   }
-                  this.cells.add(_elem112);
+                  this.cells.add(_elem116);
                 }
                 iprot.readListEnd();
               }
@@ -41096,13 +42061,13 @@ public class ClientService {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.cells.size()));
-          for (List<String> _iter116 : this.cells)
+          for (List<String> _iter120 : this.cells)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter116.size()));
-              for (String _iter117 : _iter116)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter120.size()));
+              for (String _iter121 : _iter120)
               {
-                oprot.writeString(_iter117);
+                oprot.writeString(_iter121);
               }
               oprot.writeListEnd();
             }
@@ -43839,13 +44804,13 @@ public class ClientService {
           case 2: // CELL
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list118 = iprot.readListBegin();
-                this.cell = new ArrayList<String>(_list118.size);
-                for (int _i119 = 0; _i119 < _list118.size; ++_i119)
+                org.apache.thrift.protocol.TList _list122 = iprot.readListBegin();
+                this.cell = new ArrayList<String>(_list122.size);
+                for (int _i123 = 0; _i123 < _list122.size; ++_i123)
                 {
-                  String _elem120; // required
-                  _elem120 = iprot.readString();
-                  this.cell.add(_elem120);
+                  String _elem124; // required
+                  _elem124 = iprot.readString();
+                  this.cell.add(_elem124);
                 }
                 iprot.readListEnd();
               }
@@ -43875,9 +44840,9 @@ public class ClientService {
         oprot.writeFieldBegin(CELL_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, this.cell.size()));
-          for (String _iter121 : this.cell)
+          for (String _iter125 : this.cell)
           {
-            oprot.writeString(_iter121);
+            oprot.writeString(_iter125);
           }
           oprot.writeListEnd();
         }
@@ -44559,14 +45524,14 @@ public class ClientService {
           case 2: // CELLS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list122 = iprot.readListBegin();
-                this.cells = new ArrayList<Cell>(_list122.size);
-                for (int _i123 = 0; _i123 < _list122.size; ++_i123)
+                org.apache.thrift.protocol.TList _list126 = iprot.readListBegin();
+                this.cells = new ArrayList<Cell>(_list126.size);
+                for (int _i127 = 0; _i127 < _list126.size; ++_i127)
                 {
-                  Cell _elem124; // required
-                  _elem124 = new Cell();
-                  _elem124.read(iprot);
-                  this.cells.add(_elem124);
+                  Cell _elem128; // required
+                  _elem128 = new Cell();
+                  _elem128.read(iprot);
+                  this.cells.add(_elem128);
                 }
                 iprot.readListEnd();
               }
@@ -44596,9 +45561,9 @@ public class ClientService {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.cells.size()));
-          for (Cell _iter125 : this.cells)
+          for (Cell _iter129 : this.cells)
           {
-            _iter125.write(oprot);
+            _iter129.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -45278,23 +46243,23 @@ public class ClientService {
           case 2: // CELLS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list126 = iprot.readListBegin();
-                this.cells = new ArrayList<List<String>>(_list126.size);
-                for (int _i127 = 0; _i127 < _list126.size; ++_i127)
+                org.apache.thrift.protocol.TList _list130 = iprot.readListBegin();
+                this.cells = new ArrayList<List<String>>(_list130.size);
+                for (int _i131 = 0; _i131 < _list130.size; ++_i131)
                 {
-                  List<String> _elem128; // required
+                  List<String> _elem132; // required
                   {
-                    org.apache.thrift.protocol.TList _list129 = iprot.readListBegin();
-                    _elem128 = new ArrayList<String>(_list129.size);
-                    for (int _i130 = 0; _i130 < _list129.size; ++_i130)
+                    org.apache.thrift.protocol.TList _list133 = iprot.readListBegin();
+                    _elem132 = new ArrayList<String>(_list133.size);
+                    for (int _i134 = 0; _i134 < _list133.size; ++_i134)
                     {
-                      String _elem131; // required
-                      _elem131 = iprot.readString();
-                      _elem128.add(_elem131);
+                      String _elem135; // required
+                      _elem135 = iprot.readString();
+                      _elem132.add(_elem135);
                     }
                     iprot.readListEnd();
                   }
-                  this.cells.add(_elem128);
+                  this.cells.add(_elem132);
                 }
                 iprot.readListEnd();
               }
@@ -45324,13 +46289,13 @@ public class ClientService {
         oprot.writeFieldBegin(CELLS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.LIST, this.cells.size()));
-          for (List<String> _iter132 : this.cells)
+          for (List<String> _iter136 : this.cells)
           {
             {
-              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter132.size()));
-              for (String _iter133 : _iter132)
+              oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, _iter136.size()));
+              for (String _iter137 : _iter136)
               {
-                oprot.writeString(_iter133);
+                oprot.writeString(_iter137);
               }
               oprot.writeListEnd();
             }
@@ -52208,13 +53173,13 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list134 = iprot.readListBegin();
-                this.success = new ArrayList<String>(_list134.size);
-                for (int _i135 = 0; _i135 < _list134.size; ++_i135)
+                org.apache.thrift.protocol.TList _list138 = iprot.readListBegin();
+                this.success = new ArrayList<String>(_list138.size);
+                for (int _i139 = 0; _i139 < _list138.size; ++_i139)
                 {
-                  String _elem136; // required
-                  _elem136 = iprot.readString();
-                  this.success.add(_elem136);
+                  String _elem140; // required
+                  _elem140 = iprot.readString();
+                  this.success.add(_elem140);
                 }
                 iprot.readListEnd();
               }
@@ -52248,9 +53213,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, this.success.size()));
-          for (String _iter137 : this.success)
+          for (String _iter141 : this.success)
           {
-            oprot.writeString(_iter137);
+            oprot.writeString(_iter141);
           }
           oprot.writeListEnd();
         }
@@ -52925,14 +53890,14 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list138 = iprot.readListBegin();
-                this.success = new ArrayList<NamespaceListing>(_list138.size);
-                for (int _i139 = 0; _i139 < _list138.size; ++_i139)
+                org.apache.thrift.protocol.TList _list142 = iprot.readListBegin();
+                this.success = new ArrayList<NamespaceListing>(_list142.size);
+                for (int _i143 = 0; _i143 < _list142.size; ++_i143)
                 {
-                  NamespaceListing _elem140; // required
-                  _elem140 = new NamespaceListing();
-                  _elem140.read(iprot);
-                  this.success.add(_elem140);
+                  NamespaceListing _elem144; // required
+                  _elem144 = new NamespaceListing();
+                  _elem144.read(iprot);
+                  this.success.add(_elem144);
                 }
                 iprot.readListEnd();
               }
@@ -52966,9 +53931,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.success.size()));
-          for (NamespaceListing _iter141 : this.success)
+          for (NamespaceListing _iter145 : this.success)
           {
-            _iter141.write(oprot);
+            _iter145.write(oprot);
           }
           oprot.writeListEnd();
         }
@@ -53734,14 +54699,14 @@ public class ClientService {
           case 0: // SUCCESS
             if (field.type == org.apache.thrift.protocol.TType.LIST) {
               {
-                org.apache.thrift.protocol.TList _list142 = iprot.readListBegin();
-                this.success = new ArrayList<TableSplit>(_list142.size);
-                for (int _i143 = 0; _i143 < _list142.size; ++_i143)
+                org.apache.thrift.protocol.TList _list146 = iprot.readListBegin();
+                this.success = new ArrayList<TableSplit>(_list146.size);
+                for (int _i147 = 0; _i147 < _list146.size; ++_i147)
                 {
-                  TableSplit _elem144; // required
-                  _elem144 = new TableSplit();
-                  _elem144.read(iprot);
-                  this.success.add(_elem144);
+                  TableSplit _elem148; // required
+                  _elem148 = new TableSplit();
+                  _elem148.read(iprot);
+                  this.success.add(_elem148);
                 }
                 iprot.readListEnd();
               }
@@ -53775,9 +54740,9 @@ public class ClientService {
         oprot.writeFieldBegin(SUCCESS_FIELD_DESC);
         {
           oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRUCT, this.success.size()));
-          for (TableSplit _iter145 : this.success)
+          for (TableSplit _iter149 : this.success)
           {
-            _iter145.write(oprot);
+            _iter149.write(oprot);
           }
           oprot.writeListEnd();
         }
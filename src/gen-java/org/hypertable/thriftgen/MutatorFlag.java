@@ -15,10 +15,13 @@ import org.apache.thrift.TEnum;
  * 
  * NO_LOG_SYNC: Do not sync the commit log
  * IGNORE_UNKNOWN_CFS: Don't throw exception if mutator writes to unknown column family
+ * COALESCE_UPDATES: Drop writes superseded by a later write to the same cell
+ *   before they are sent
  */
 public enum MutatorFlag implements org.apache.thrift.TEnum {
   NO_LOG_SYNC(1),
-  IGNORE_UNKNOWN_CFS(2);
+  IGNORE_UNKNOWN_CFS(2),
+  COALESCE_UPDATES(4);
 
   private final int value;
 
@@ -43,6 +46,8 @@ public enum MutatorFlag implements org.apache.thrift.TEnum {
         return NO_LOG_SYNC;
       case 2:
         return IGNORE_UNKNOWN_CFS;
+      case 4:
+        return COALESCE_UPDATES;
       default:
         return null;
     }
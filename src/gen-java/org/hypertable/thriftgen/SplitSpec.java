@@ -0,0 +1,551 @@
+/**
+ * Autogenerated by Thrift Compiler (0.7.0)
+ *
+ * DO NOT EDIT UNLESS YOU ARE SURE THAT YOU KNOW WHAT YOU ARE DOING
+ */
+package org.hypertable.thriftgen;
+
+import java.util.List;
+import java.util.ArrayList;
+import java.util.Map;
+import java.util.HashMap;
+import java.util.EnumMap;
+import java.util.Set;
+import java.util.HashSet;
+import java.util.EnumSet;
+import java.util.Collections;
+import java.util.BitSet;
+import java.nio.ByteBuffer;
+import java.util.Arrays;
+import org.slf4j.Logger;
+import org.slf4j.LoggerFactory;
+
+/**
+ * Describes how a new table is divided into its initial ranges.  Either
+ * an explicit list of split rows or a split algorithm with a range count
+ * is given.
+ * 
+ * <dl>
+ *   <dt>rows</dt>
+ *   <dd>Row keys at which the table is split; n rows create n+1 ranges</dd>
+ * 
+ *   <dt>algorithm</dt>
+ *   <dd>"uniform" (equal width over the first two row bytes) or "hash"
+ *   (equal width over eight-digit lowercase hex row prefixes)</dd>
+ * 
+ *   <dt>range_count</dt>
+ *   <dd>Number of ranges the algorithm creates</dd>
+ * </dl>
+ */
+public class SplitSpec implements org.apache.thrift.TBase<SplitSpec, SplitSpec._Fields>, java.io.Serializable, Cloneable {
+  private static final org.apache.thrift.protocol.TStruct STRUCT_DESC = new org.apache.thrift.protocol.TStruct("SplitSpec");
+
+  private static final org.apache.thrift.protocol.TField ROWS_FIELD_DESC = new org.apache.thrift.protocol.TField("rows", org.apache.thrift.protocol.TType.LIST, (short)1);
+  private static final org.apache.thrift.protocol.TField ALGORITHM_FIELD_DESC = new org.apache.thrift.protocol.TField("algorithm", org.apache.thrift.protocol.TType.STRING, (short)2);
+  private static final org.apache.thrift.protocol.TField RANGE_COUNT_FIELD_DESC = new org.apache.thrift.protocol.TField("range_count", org.apache.thrift.protocol.TType.I32, (short)3);
+
+  public List<String> rows; // required
+  public String algorithm; // required
+  public int range_count; // required
+
+  /** The set of fields this struct contains, along with convenience methods for finding and manipulating them. */
+  public enum _Fields implements org.apache.thrift.TFieldIdEnum {
+    ROWS((short)1, "rows"),
+    ALGORITHM((short)2, "algorithm"),
+    RANGE_COUNT((short)3, "range_count");
+
+    private static final Map<String, _Fields> byName = new HashMap<String, _Fields>();
+
+    static {
+      for (_Fields field : EnumSet.allOf(_Fields.class)) {
+        byName.put(field.getFieldName(), field);
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, or null if its not found.
+     */
+    public static _Fields findByThriftId(int fieldId) {
+      switch(fieldId) {
+        case 1: // ROWS
+          return ROWS;
+        case 2: // ALGORITHM
+          return ALGORITHM;
+        case 3: // RANGE_COUNT
+          return RANGE_COUNT;
+        default:
+          return null;
+      }
+    }
+
+    /**
+     * Find the _Fields constant that matches fieldId, throwing an exception
+     * if it is not found.
+     */
+    public static _Fields findByThriftIdOrThrow(int fieldId) {
+      _Fields fields = findByThriftId(fieldId);
+      if (fields == null) throw new IllegalArgumentException("Field " + fieldId + " doesn't exist!");
+      return fields;
+    }
+
+    /**
+     * Find the _Fields constant that matches name, or null if its not found.
+     */
+    public static _Fields findByName(String name) {
+      return byName.get(name);
+    }
+
+    private final short _thriftId;
+    private final String _fieldName;
+
+    _Fields(short thriftId, String fieldName) {
+      _thriftId = thriftId;
+      _fieldName = fieldName;
+    }
+
+    public short getThriftFieldId() {
+      return _thriftId;
+    }
+
+    public String getFieldName() {
+      return _fieldName;
+    }
+  }
+
+  // isset id assignments
+  private static final int __RANGE_COUNT_ISSET_ID = 0;
+  private BitSet __isset_bit_vector = new BitSet(1);
+
+  public static final Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> metaDataMap;
+  static {
+    Map<_Fields, org.apache.thrift.meta_data.FieldMetaData> tmpMap = new EnumMap<_Fields, org.apache.thrift.meta_data.FieldMetaData>(_Fields.class);
+    tmpMap.put(_Fields.ROWS, new org.apache.thrift.meta_data.FieldMetaData("rows", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.ListMetaData(org.apache.thrift.protocol.TType.LIST, 
+            new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING))));
+    tmpMap.put(_Fields.ALGORITHM, new org.apache.thrift.meta_data.FieldMetaData("algorithm", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.STRING)));
+    tmpMap.put(_Fields.RANGE_COUNT, new org.apache.thrift.meta_data.FieldMetaData("range_count", org.apache.thrift.TFieldRequirementType.OPTIONAL, 
+        new org.apache.thrift.meta_data.FieldValueMetaData(org.apache.thrift.protocol.TType.I32)));
+    metaDataMap = Collections.unmodifiableMap(tmpMap);
+    org.apache.thrift.meta_data.FieldMetaData.addStructMetaDataMap(SplitSpec.class, metaDataMap);
+  }
+
+  public SplitSpec() {
+  }
+
+  /**
+   * Performs a deep copy on <i>other</i>.
+   */
+  public SplitSpec(SplitSpec other) {
+    __isset_bit_vector.clear();
+    __isset_bit_vector.or(other.__isset_bit_vector);
+    if (other.isSetRows()) {
+      List<String> __this__rows = new ArrayList<String>();
+      for (String other_element : other.rows) {
+        __this__rows.add(other_element);
+      }
+      this.rows = __this__rows;
+    }
+    if (other.isSetAlgorithm()) {
+      this.algorithm = other.algorithm;
+    }
+    this.range_count = other.range_count;
+  }
+
+  public SplitSpec deepCopy() {
+    return new SplitSpec(this);
+  }
+
+  @Override
+  public void clear() {
+    this.rows = null;
+    this.algorithm = null;
+    setRange_countIsSet(false);
+    this.range_count = 0;
+  }
+
+  public int getRowsSize() {
+    return (this.rows == null) ? 0 : this.rows.size();
+  }
+
+  public java.util.Iterator<String> getRowsIterator() {
+    return (this.rows == null) ? null : this.rows.iterator();
+  }
+
+  public void addToRows(String elem) {
+    if (this.rows == null) {
+      this.rows = new ArrayList<String>();
+    }
+    this.rows.add(elem);
+  }
+
+  public List<String> getRows() {
+    return this.rows;
+  }
+
+  public SplitSpec setRows(List<String> rows) {
+    this.rows = rows;
+    return this;
+  }
+
+  public void unsetRows() {
+    this.rows = null;
+  }
+
+  /** Returns true if field rows is set (has been assigned a value) and false otherwise */
+  public boolean isSetRows() {
+    return this.rows != null;
+  }
+
+  public void setRowsIsSet(boolean value) {
+    if (!value) {
+      this.rows = null;
+    }
+  }
+
+  public String getAlgorithm() {
+    return this.algorithm;
+  }
+
+  public SplitSpec setAlgorithm(String algorithm) {
+    this.algorithm = algorithm;
+    return this;
+  }
+
+  public void unsetAlgorithm() {
+    this.algorithm = null;
+  }
+
+  /** Returns true if field algorithm is set (has been assigned a value) and false otherwise */
+  public boolean isSetAlgorithm() {
+    return this.algorithm != null;
+  }
+
+  public void setAlgorithmIsSet(boolean value) {
+    if (!value) {
+      this.algorithm = null;
+    }
+  }
+
+  public int getRange_count() {
+    return this.range_count;
+  }
+
+  public SplitSpec setRange_count(int range_count) {
+    this.range_count = range_count;
+    setRange_countIsSet(true);
+    return this;
+  }
+
+  public void unsetRange_count() {
+    __isset_bit_vector.clear(__RANGE_COUNT_ISSET_ID);
+  }
+
+  /** Returns true if field range_count is set (has been assigned a value) and false otherwise */
+  public boolean isSetRange_count() {
+    return __isset_bit_vector.get(__RANGE_COUNT_ISSET_ID);
+  }
+
+  public void setRange_countIsSet(boolean value) {
+    __isset_bit_vector.set(__RANGE_COUNT_ISSET_ID, value);
+  }
+
+  public void setFieldValue(_Fields field, Object value) {
+    switch (field) {
+    case ROWS:
+      if (value == null) {
+        unsetRows();
+      } else { 
+        setRows((List<String>)value);
+      }
+      break;
+
+    case ALGORITHM:
+      if (value == null) {
+        unsetAlgorithm();
+      } else { 
+        setAlgorithm((String)value);
+      }
+      break;
+
+    case RANGE_COUNT:
+      if (value == null) {
+        unsetRange_count();
+      } else { 
+        setRange_count((Integer)value);
+      }
+      break;
+
+    }
+  }
+
+  public Object getFieldValue(_Fields field) {
+    switch (field) {
+    case ROWS:
+      return getRows();
+
+    case ALGORITHM:
+      return getAlgorithm();
+
+    case RANGE_COUNT:
+      return Integer.valueOf(getRange_count());
+
+    }
+    throw new IllegalStateException();
+  }
+
+  /** Returns true if field corresponding to fieldID is set (has been assigned a value) and false otherwise */
+  public boolean isSet(_Fields field) {
+    if (field == null) {
+      throw new IllegalArgumentException();
+    }
+
+    switch (field) {
+    case ROWS:
+      return isSetRows();
+    case ALGORITHM:
+      return isSetAlgorithm();
+    case RANGE_COUNT:
+      return isSetRange_count();
+    }
+    throw new IllegalStateException();
+  }
+
+  @Override
+  public boolean equals(Object that) {
+    if (that == null)
+      return false;
+    if (that instanceof SplitSpec)
+      return this.equals((SplitSpec)that);
+    return false;
+  }
+
+  public boolean equals(SplitSpec that) {
+    if (that == null)
+      return false;
+
+    boolean this_present_rows = true && this.isSetRows();
+    boolean that_present_rows = true && that.isSetRows();
+    if (this_present_rows || that_present_rows) {
+      if (!(this_present_rows && that_present_rows))
+        return false;
+      if (!this.rows.equals(that.rows))
+        return false;
+    }
+
+    boolean this_present_algorithm = true && this.isSetAlgorithm();
+    boolean that_present_algorithm = true && that.isSetAlgorithm();
+    if (this_present_algorithm || that_present_algorithm) {
+      if (!(this_present_algorithm && that_present_algorithm))
+        return false;
+      if (!this.algorithm.equals(that.algorithm))
+        return false;
+    }
+
+    boolean this_present_range_count = true && this.isSetRange_count();
+    boolean that_present_range_count = true && that.isSetRange_count();
+    if (this_present_range_count || that_present_range_count) {
+      if (!(this_present_range_count && that_present_range_count))
+        return false;
+      if (this.range_count != that.range_count)
+        return false;
+    }
+
+    return true;
+  }
+
+  @Override
+  public int hashCode() {
+    return 0;
+  }
+
+  public int compareTo(SplitSpec other) {
+    if (!getClass().equals(other.getClass())) {
+      return getClass().getName().compareTo(other.getClass().getName());
+    }
+
+    int lastComparison = 0;
+    SplitSpec typedOther = (SplitSpec)other;
+
+    lastComparison = Boolean.valueOf(isSetRows()).compareTo(typedOther.isSetRows());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetRows()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.rows, typedOther.rows);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = Boolean.valueOf(isSetAlgorithm()).compareTo(typedOther.isSetAlgorithm());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetAlgorithm()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.algorithm, typedOther.algorithm);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    lastComparison = Boolean.valueOf(isSetRange_count()).compareTo(typedOther.isSetRange_count());
+    if (lastComparison != 0) {
+      return lastComparison;
+    }
+    if (isSetRange_count()) {
+      lastComparison = org.apache.thrift.TBaseHelper.compareTo(this.range_count, typedOther.range_count);
+      if (lastComparison != 0) {
+        return lastComparison;
+      }
+    }
+    return 0;
+  }
+
+  public _Fields fieldForId(int fieldId) {
+    return _Fields.findByThriftId(fieldId);
+  }
+
+  public void read(org.apache.thrift.protocol.TProtocol iprot) throws org.apache.thrift.TException {
+    org.apache.thrift.protocol.TField field;
+    iprot.readStructBegin();
+    while (true)
+    {
+      field = iprot.readFieldBegin();
+      if (field.type == org.apache.thrift.protocol.TType.STOP) { 
+        break;
+      }
+      switch (field.id) {
+        case 1: // ROWS
+          if (field.type == org.apache.thrift.protocol.TType.LIST) {
+            {
+              org.apache.thrift.protocol.TList _list38 = iprot.readListBegin();
+              this.rows = new ArrayList<String>(_list38.size);
+              for (int _i39 = 0; _i39 < _list38.size; ++_i39)
+              {
+                String _elem40; // required
+                _elem40 = iprot.readString();
+                this.rows.add(_elem40);
+              }
+              iprot.readListEnd();
+            }
+          } else { 
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
+        case 2: // ALGORITHM
+          if (field.type == org.apache.thrift.protocol.TType.STRING) {
+            this.algorithm = iprot.readString();
+          } else { 
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
+        case 3: // RANGE_COUNT
+          if (field.type == org.apache.thrift.protocol.TType.I32) {
+            this.range_count = iprot.readI32();
+            setRange_countIsSet(true);
+          } else { 
+            org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+          }
+          break;
+        default:
+          org.apache.thrift.protocol.TProtocolUtil.skip(iprot, field.type);
+      }
+      iprot.readFieldEnd();
+    }
+    iprot.readStructEnd();
+
+    // check for required fields of primitive type, which can't be checked in the validate method
+    validate();
+  }
+
+  public void write(org.apache.thrift.protocol.TProtocol oprot) throws org.apache.thrift.TException {
+    validate();
+
+    oprot.writeStructBegin(STRUCT_DESC);
+    if (this.rows != null) {
+      if (isSetRows()) {
+        oprot.writeFieldBegin(ROWS_FIELD_DESC);
+        {
+          oprot.writeListBegin(new org.apache.thrift.protocol.TList(org.apache.thrift.protocol.TType.STRING, this.rows.size()));
+          for (String _iter41 : this.rows)
+          {
+            oprot.writeString(_iter41);
+          }
+          oprot.writeListEnd();
+        }
+        oprot.writeFieldEnd();
+      }
+    }
+    if (this.algorithm != null) {
+      if (isSetAlgorithm()) {
+        oprot.writeFieldBegin(ALGORITHM_FIELD_DESC);
+        oprot.writeString(this.algorithm);
+        oprot.writeFieldEnd();
+      }
+    }
+    if (isSetRange_count()) {
+      oprot.writeFieldBegin(RANGE_COUNT_FIELD_DESC);
+      oprot.writeI32(this.range_count);
+      oprot.writeFieldEnd();
+    }
+    oprot.writeFieldStop();
+    oprot.writeStructEnd();
+  }
+
+  @Override
+  public String toString() {
+    StringBuilder sb = new StringBuilder("SplitSpec(");
+    boolean first = true;
+
+    if (isSetRows()) {
+      sb.append("rows:");
+      if (this.rows == null) {
+        sb.append("null");
+      } else { 
+        sb.append(this.rows);
+      }
+      first = false;
+    }
+    if (isSetAlgorithm()) {
+      if (!first) sb.append(", ");
+      sb.append("algorithm:");
+      if (this.algorithm == null) {
+        sb.append("null");
+      } else { 
+        sb.append(this.algorithm);
+      }
+      first = false;
+    }
+    if (isSetRange_count()) {
+      if (!first) sb.append(", ");
+      sb.append("range_count:");
+      sb.append(this.range_count);
+      first = false;
+    }
+    sb.append(")");
+    return sb.toString();
+  }
+
+  public void validate() throws org.apache.thrift.TException {
+    // check for required fields
+  }
+
+  private void writeObject(java.io.ObjectOutputStream out) throws java.io.IOException {
+    try {
+      write(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(out)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+  private void readObject(java.io.ObjectInputStream in) throws java.io.IOException, ClassNotFoundException {
+    try {
+      // it doesn't seem like you should have to do this, but java serialization is wacky, and doesn't call the default constructor.
+      __isset_bit_vector = new BitSet(1);
+      read(new org.apache.thrift.protocol.TCompactProtocol(new org.apache.thrift.transport.TIOStreamTransport(in)));
+    } catch (org.apache.thrift.TException te) {
+      throw new java.io.IOException(te);
+    }
+  }
+
+}
+
@@ -0,0 +1,82 @@
+#!/usr/bin/env bash
+#
+# Loads the same input with LOAD DATA INFILE and with ht_bulk_load, checks
+# that both tables read back exactly the input cells and reports the
+# throughput of each.  The bulk load memory limit is kept small so the
+# input is sorted in several runs that have to be merged.
+#
+
+HT_HOME=${INSTALL_DIR:-"$HOME/hypertable/current"}
+SCRIPT_DIR=`dirname $0`
+NUM_ROWS=${NUM_ROWS:-"500000"}
+VALUE_SIZE=${VALUE_SIZE:-"100"}
+
+$HT_HOME/bin/start-test-servers.sh --clear --no-thriftbroker \
+    --Hypertable.RangeServer.Range.SplitSize=10M
+
+$HT_HOME/bin/ht shell --no-prompt < $SCRIPT_DIR/create-tables.hql
+
+awk -v n=$NUM_ROWS -v size=$VALUE_SIZE 'BEGIN {
+  value = sprintf("%*s", size, ""); gsub(/ /, "v", value);
+  srand(1);
+  for (i=0; i<n; i++) {
+    row = sprintf("%010d", int(rand() * 1000000000));
+    printf("%s\ta:%d\t%s\n", row, i % 10, value);
+    printf("%s\tb\t%s\n", row, value);
+  }
+}' > data.tsv
+BYTES=`stat -c %s data.tsv`
+
+START=`date +%s.%N`
+echo "use '/'; load data infile 'data.tsv' into table LoadDataTest;" \
+    | $HT_HOME/bin/ht shell --batch
+END=`date +%s.%N`
+LOAD_DATA_SECS=`echo "$END - $START" | bc`
+
+START=`date +%s.%N`
+$HT_HOME/bin/ht ht_bulk_load --memory-limit=16M BulkLoadTest data.tsv \
+    > bulk-load.log
+if [ $? != 0 ]; then
+  cat bulk-load.log
+  echo "ht_bulk_load failed"
+  exit 1
+fi
+END=`date +%s.%N`
+BULK_LOAD_SECS=`echo "$END - $START" | bc`
+
+echo "use '/'; select * from LoadDataTest;" \
+    | $HT_HOME/bin/ht shell --batch | cut -f1-3 > load-data.output
+echo "use '/'; select * from BulkLoadTest;" \
+    | $HT_HOME/bin/ht shell --batch | cut -f1-3 > bulk-load.output
+
+sort data.tsv > expected.output
+NUM_CELLS=`wc -l < expected.output`
+if [ $NUM_CELLS != $((NUM_ROWS*2)) ]; then
+  echo "Expected $((NUM_ROWS*2)) input cells, generated $NUM_CELLS"
+  exit 1
+fi
+
+sort load-data.output | diff -q - expected.output
+if [ $? != 0 ]; then
+  echo "LoadDataTest does not read back the input"
+  exit 1
+fi
+
+sort bulk-load.output | diff -q - expected.output
+if [ $? != 0 ]; then
+  echo "BulkLoadTest does not read back the input"
+  exit 1
+fi
+
+# Runs are merged, so each range gets at most one CellStore per access group
+MAX_ATTACHED=`awk '/^Attached/ { if ($2 > max) max = $2 } END { print max+0 }' bulk-load.log`
+if [ $MAX_ATTACHED -gt 2 ]; then
+  echo "A range was attached $MAX_ATTACHED CellStores for 2 access groups"
+  exit 1
+fi
+
+echo "Input bytes:       $BYTES"
+echo "LOAD DATA INFILE:  $LOAD_DATA_SECS s, `echo "$BYTES / $LOAD_DATA_SECS" | bc` bytes/s"
+echo "ht_bulk_load:      $BULK_LOAD_SECS s, `echo "$BYTES / $BULK_LOAD_SECS" | bc` bytes/s"
+
+exit 0